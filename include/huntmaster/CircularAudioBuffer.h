@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -76,12 +77,13 @@ struct CircularBufferConfig {
     bool enableStatistics = true;          ///< Enable performance statistics
     size_t writeBlockSize = 1024;          ///< Preferred write block size
     size_t readBlockSize = 1024;           ///< Preferred read block size
+    bool enableSpscMode = false;           ///< Wait-free single-producer/single-consumer mode
 
     // Safety configuration
     float overflowThreshold = 0.95f;        ///< Buffer overflow threshold (95%)
     float underflowThreshold = 0.05f;       ///< Buffer underflow threshold (5%)
-    bool enableOverflowProtection = true;   ///< Enable overflow protection
-    bool enableUnderflowProtection = true;  ///< Enable underflow protection
+    bool enableOverflowProtection = true;   ///< Full buffer: write() returns what fit, no wait
+    bool enableUnderflowProtection = true;  ///< Empty buffer: read() returns what it got, no wait
 
     // Monitoring configuration
     bool enableLatencyMonitoring = true;     ///< Enable latency monitoring
@@ -208,6 +210,24 @@ struct CircularBufferError {
     size_t operationContext = 0;                      ///< Operation context
 };
 
+/**
+ * @brief Contiguous view(s) into the ring storage
+ *
+ * A region covers up to two spans because it may straddle the end of the
+ * storage: samples run through `first` and continue in `second`.
+ */
+template <typename T>
+struct BufferRegion {
+    std::span<T> first;   ///< Samples starting at the current position
+    std::span<T> second;  ///< Continuation from the start of storage (empty if no wrap)
+
+    size_t size() const { return first.size() + second.size(); }
+    bool empty() const { return first.empty() && second.empty(); }
+};
+
+using WriteRegion = BufferRegion<float>;
+using ReadRegion = BufferRegion<const float>;
+
 // TODO 2.4.84: Callback Type Definitions
 // --------------------------------------
 /**
@@ -321,6 +341,24 @@ class CircularAudioBuffer {
     size_t skip(size_t sampleCount);
     bool skipToLatest(size_t& skipped);
 
+    /**
+     * @brief Zero-copy region operations
+     *
+     * acquireWrite() exposes up to sampleCount free samples of the ring so a
+     * producer can decode or render straight into it; commitWrite() then
+     * publishes the first n of them. acquireRead() exposes up to sampleCount
+     * readable samples for in-place analysis and releaseRead() hands them back
+     * to the producer. An acquired region stays valid until the matching
+     * commit/release (or clear/resize). Acquiring is idempotent: acquiring
+     * again before committing returns the same storage. Commit and release
+     * clamp to what is actually free/readable and return the count applied.
+     * In SPSC mode these are wait-free like write()/read().
+     */
+    WriteRegion acquireWrite(size_t sampleCount);
+    size_t commitWrite(size_t sampleCount);
+    ReadRegion acquireRead(size_t sampleCount) const;
+    size_t releaseRead(size_t sampleCount);
+
     // TODO 2.4.88: Buffer State Management
     // -----------------------------------
     /**
@@ -337,6 +375,22 @@ class CircularAudioBuffer {
      * [ ] Thread-safe state transitions with proper synchronization
      */
 
+    /**
+     * @brief Wait-free single-producer/single-consumer mode
+     *
+     * Enabled with CircularBufferConfig::enableSpscMode. Exactly one thread may
+     * write and exactly one thread may read/peek/skip; each call is then a
+     * bounded sequence of loads, memcpy and one release store with no locks,
+     * allocation, clock reads or callbacks, so it is safe from an audio
+     * callback. Blocking reads and writes transfer what fits and return
+     * immediately. The full capacity is usable. Operation counters stay local
+     * to the producer/consumer and are published to getStatistics() every
+     * kSpscStatisticsInterval operations, so they may lag slightly.
+     * clear(), reset() and resize() must not race with either side.
+     */
+    bool isSpscMode() const;
+    static constexpr size_t kSpscStatisticsInterval = 64;
+
     // Buffer state queries
     size_t getAvailableForWrite() const;
     size_t getAvailableForRead() const;
@@ -487,6 +541,18 @@ class CircularAudioBuffer {
     void advanceWritePointer(size_t samples);
     void advanceReadPointer(size_t samples);
 
+    // SPSC fast path helpers
+    size_t writeSpsc(const float* data, size_t sampleCount) noexcept;
+    size_t readSpsc(float* data, size_t sampleCount) noexcept;
+    size_t peekSpsc(float* data, size_t sampleCount, size_t offset) const noexcept;
+    size_t skipSpsc(size_t sampleCount) noexcept;
+    size_t spscSlot(uint64_t index) const noexcept;
+    template <typename T>
+    BufferRegion<T> makeRegion(size_t position, size_t count) const noexcept;
+    void resetSpscState() noexcept;
+    void publishProducerStatistics() noexcept;
+    void publishConsumerStatistics() noexcept;
+
     // Performance monitoring helpers
     void recordWriteLatency(float latency);
     void recordReadLatency(float latency);
@@ -535,6 +601,26 @@ class CircularAudioBuffer {
     std::atomic<uint64_t> sequenceNumber_{0};
     std::atomic<uint64_t> timestamp_{0};
 
+    // SPSC state: monotonically increasing sample indices, one cache line per side
+    static constexpr size_t kCacheLineSize = 64;
+    struct alignas(kCacheLineSize) SpscProducerState {
+        std::atomic<uint64_t> head{0};  ///< Samples committed by the producer
+        uint64_t cachedTail = 0;        ///< Producer's last view of the consumer index
+        uint64_t pendingWrites = 0;     ///< Write operations not yet published
+        uint64_t pendingSamples = 0;    ///< Samples written not yet published
+        uint64_t pendingOverflows = 0;  ///< Short writes not yet published
+    };
+    struct alignas(kCacheLineSize) SpscConsumerState {
+        std::atomic<uint64_t> tail{0};   ///< Samples released by the consumer
+        uint64_t cachedHead = 0;         ///< Consumer's last view of the producer index
+        uint64_t pendingReads = 0;       ///< Read operations not yet published
+        uint64_t pendingUnderflows = 0;  ///< Short reads not yet published
+    };
+    bool spscMode_ = false;
+    size_t spscMask_ = 0;  ///< capacity - 1 for power-of-two capacities, otherwise 0
+    SpscProducerState producer_;
+    SpscConsumerState consumer_;
+
     // Threading
     mutable std::mutex writeMutex_;
     mutable std::mutex readMutex_;
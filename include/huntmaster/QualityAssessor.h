@@ -14,14 +14,15 @@
 
 #include <atomic>
 #include <chrono>
+#include <complex>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
-#include "AudioBuffer.h"
-#include "AudioConfig.h"
+#include "huntmaster/core/AudioBuffer.h"
+#include "huntmaster/core/AudioConfig.h"
 
 namespace huntmaster {
 namespace core {
@@ -76,6 +77,7 @@ struct QualityConfig {
     float noiseFloorThreshold;  ///< Noise floor threshold in dB
 
     // Frequency Analysis
+    uint32_t sampleRate;      ///< Sample rate of the analyzed audio in Hz
     uint32_t fftSize;         ///< FFT size for spectral analysis
     float minFrequency;       ///< Minimum analysis frequency in Hz
     float maxFrequency;       ///< Maximum analysis frequency in Hz
@@ -121,6 +123,7 @@ struct QualityMetrics {
     float frequencyResponseScore;   ///< Frequency response score (0.0-1.0)
     float dynamicRangeScore;        ///< Dynamic range score (0.0-1.0)
     float clippingLevel;            ///< Clipping level (0.0-1.0)
+    bool isClipping;                ///< Whether clipped samples were detected
 
     // Noise Analysis
     float backgroundNoiseLevel;   ///< Background noise level in dB
@@ -244,7 +247,6 @@ class QualityAssessor {
      * [ ] Quality threshold setup with adaptive configuration
      */
     bool initialize(const QualityConfig& config);
-    bool initialize(const StreamingConfig& streamingConfig);  // For compatibility
     bool updateConfiguration(const QualityConfig& config);
     bool isInitialized() const;
     QualityConfig getConfiguration() const;
@@ -268,6 +270,14 @@ class QualityAssessor {
     bool assessQualityRealtime(const float* audioData, size_t sampleCount, QualityMetrics& metrics);
     float getQuickQualityScore(const AudioBuffer& buffer);
 
+    /**
+     * @brief Discard streaming state accumulated by assessQualityRealtime()
+     *
+     * Call when a new stream starts so noise floor and level tracking do not
+     * carry over from the previous recording.
+     */
+    void resetRealtimeState();
+
     // TODO 2.4.50: Technical Quality Analysis
     // ---------------------------------------
     /**
@@ -507,25 +517,50 @@ class QualityAssessor {
     std::atomic<bool> initialized_;
     mutable std::mutex configMutex_;
 
-    // Analysis Components
-    std::unique_ptr<class SNRAnalyzer> snrAnalyzer_;
-    std::unique_ptr<class THDAnalyzer> thdAnalyzer_;
-    std::unique_ptr<class FrequencyAnalyzer> frequencyAnalyzer_;
-    std::unique_ptr<class PerceptualAnalyzer> perceptualAnalyzer_;
-    std::unique_ptr<class ClippingDetector> clippingDetector_;
-    std::unique_ptr<class NoiseAnalyzer> noiseAnalyzer_;
-
-    // Processing Components
+    // Processing Components (defined in QualityAssessor.cpp)
     std::unique_ptr<class FFTProcessor> fftProcessor_;
     std::unique_ptr<class WindowFunction> windowFunction_;
-    std::unique_ptr<class FilterBank> filterBank_;
-    std::unique_ptr<class PsychoacousticModel> psychoacousticModel_;
 
-    // Analysis Buffers
+    // Analysis Buffers (sized in initialize() and reused by every assessment)
     std::vector<float> analysisBuffer_;
-    std::vector<float> spectralBuffer_;
-    std::vector<std::complex<float>> fftBuffer_;
-    std::vector<float> windowBuffer_;
+    std::vector<float> spectralBuffer_;           ///< Magnitude spectrum, fftSize / 2 + 1 bins
+    std::vector<std::complex<float>> fftBuffer_;  ///< Complex FFT output, fftSize / 2 + 1 bins
+    std::vector<float> windowBuffer_;             ///< Windowed, zero-padded FFT input
+    std::vector<uint32_t> bandEdges_;             ///< FFT bin edges of frequency response bands
+
+    /**
+     * @brief Incrementally maintained level statistics
+     *
+     * Updated once per analysis hop without allocation. The noise floor uses
+     * minimum statistics over two alternating tracking windows, so it follows
+     * slowly changing background noise while ignoring calls.
+     */
+    struct RunningStatistics {
+        uint32_t frameSize = 0;          ///< Samples per statistics frame
+        uint32_t windowFrames = 0;       ///< Frames per minimum-statistics window
+        double frameEnergy = 0.0;        ///< Energy accumulated in the current hop
+        uint32_t frameSamples = 0;       ///< Samples accumulated in the current hop
+        uint32_t frameClipped = 0;       ///< Clipped samples in the current hop
+        uint64_t frameCount = 0;         ///< Completed hops
+        double signalPower = 0.0;        ///< Smoothed power of frames above the noise floor
+        double currentWindowMin = 0.0;   ///< Minimum frame power in the current window
+        double previousWindowMin = 0.0;  ///< Minimum frame power in the previous window
+        uint32_t framesInWindow = 0;     ///< Frames accumulated in the current window
+        double loudestFramePower = 0.0;  ///< Loudest frame power observed
+        float peakLevel = 0.0f;          ///< Decaying absolute peak level
+        float clippingRatio = 0.0f;      ///< Smoothed fraction of clipped samples
+        uint64_t totalSamples = 0;       ///< Samples accumulated overall
+        uint64_t totalClipped = 0;       ///< Clipped samples accumulated overall
+    };
+
+    // Streaming Analysis State (assessQualityRealtime)
+    RunningStatistics realtimeStats_;
+    std::vector<float> streamHistory_;  ///< Ring of the last analysisWindowSize samples
+    size_t streamWritePos_ = 0;
+    size_t streamFill_ = 0;
+    std::vector<float> realtimeBandResponse_;  ///< Last frequency response of the stream
+    float realtimeTHD_ = 0.0f;
+    float realtimeSpectralFlatness_ = 0.0f;
 
     // Quality History and Statistics
     mutable std::mutex statisticsMutex_;
@@ -595,8 +630,16 @@ class QualityAssessor {
     float calculateRMS(const std::vector<float>& buffer);
     float calculatePeak(const std::vector<float>& buffer);
     float calculateCrestFactor(const std::vector<float>& buffer);
-    std::vector<float> applyWindow(const std::vector<float>& buffer);
-    std::vector<std::complex<float>> performFFT(const std::vector<float>& buffer);
+    void applyWindow(const float* samples, size_t sampleCount);
+    bool performFFT();
+    bool computeMagnitudeSpectrum(const float* samples, size_t sampleCount);
+    float estimateTHDFromSpectrum(const std::vector<float>& magnitudes) const;
+    float estimateSpectralSNR(const std::vector<float>& magnitudes);
+    void computeBandResponse(const std::vector<float>& magnitudes, std::vector<float>& bands) const;
+    void accumulateRunningStatistics(RunningStatistics& stats, const float* samples, size_t count);
+    void finishStatisticsFrame(RunningStatistics& stats);
+    void fillLevelMetrics(const RunningStatistics& stats, QualityMetrics& metrics) const;
+    void computeBufferStatistics(const std::vector<float>& buffer, RunningStatistics& stats);
     float calculateSpectralFlatness(const std::vector<float>& spectrum);
     float calculateSpectralCentroid(const std::vector<float>& spectrum);
     std::vector<float> calculateBarkSpectrum(const std::vector<float>& spectrum);
@@ -256,6 +256,12 @@ class AdaptiveBufferManager {
 
 /**
  * @brief Advanced async I/O engine with io_uring support (Linux)
+ *
+ * With io_uring, requests are prepared into one shared ring and submitted in
+ * batches; a single completion thread reaps completions and runs callbacks,
+ * so queue depth is bounded by the ring, not by a thread per request.
+ * Registered buffers and files are picked up automatically by matching
+ * requests. Kernels or builds without io_uring use the thread pool.
  */
 class AdvancedAsyncIO {
   public:
@@ -278,9 +284,36 @@ class AdvancedAsyncIO {
         Config() = default;
     };
 
+    /**
+     * With io_uring, callbacks run on the completion thread. A callback may
+     * submit again, but if the ring is full that submit fails rather than
+     * waiting, since only the completion thread can free room.
+     */
     using CompletionCallback = std::function<void(
         bool success, size_t bytesTransferred, std::chrono::nanoseconds latency)>;
 
+    /**
+     * @brief One read of a chain; decode runs once its bytes have arrived
+     *
+     * Chained reads are issued as an io_uring link, so they execute in order
+     * and a failed or short read cancels the rest. decode runs on the
+     * completion thread; returning false fails the chain.
+     */
+    struct ChainedRead {
+        void* buffer = nullptr;
+        size_t size = 0;
+        off_t offset = 0;
+        std::function<bool(size_t bytesRead)> decode;
+    };
+
+    struct ReadRequest {
+        int fileDescriptor = -1;
+        void* buffer = nullptr;
+        size_t size = 0;
+        off_t offset = 0;
+        CompletionCallback callback;
+    };
+
   private:
     class Impl;
     std::unique_ptr<Impl> pImpl_;
@@ -324,6 +357,32 @@ class AdvancedAsyncIO {
                     bool isWrite,
                     CompletionCallback callback);
 
+    /**
+     * @brief Submit many reads with a single submission (bulk loads)
+     * @return Number of requests accepted, in order
+     */
+    size_t readBatchAsync(std::vector<ReadRequest> requests);
+
+    /**
+     * @brief Submit ordered reads, decoding each as it completes
+     * @param callback Called once with the chain's total bytes
+     */
+    bool readChainAsync(int fileDescriptor,
+                        std::vector<ChainedRead> chain,
+                        CompletionCallback callback);
+
+    /**
+     * @brief Pin buffers with the kernel; later reads/writes inside them skip page mapping
+     * @return false if the active engine does not support registration
+     */
+    bool registerBuffers(const std::vector<iovec>& buffers);
+
+    /**
+     * @brief Register file descriptors to skip per-request fd lookup
+     * @return false if the active engine does not support registration
+     */
+    bool registerFiles(const std::vector<int>& fileDescriptors);
+
     /**
      * @brief Get engine metrics
      */
@@ -337,17 +396,25 @@ class AdvancedAsyncIO {
 
 /**
  * @brief Intelligent compression pipeline for audio data
+ *
+ * Lossless, dependency-free block codec: each block of samples that are
+ * exact 16-bit values (x / 32768) is coded with linear prediction and
+ * partitioned Rice residuals; other blocks are stored as raw floats, so
+ * any float input round-trips bit for bit. Blocks are coded independently
+ * (in parallel when enabled) and indexed, so decompressRange() only
+ * decodes the blocks it needs.
  */
 class CompressionPipeline {
   public:
+    /// Selects the codec's speed/ratio trade-off (the maximum LPC order)
     enum class Algorithm {
-        NONE,
-        LZ4,            // Fast compression
-        ZSTD_FAST,      // Zstandard fast mode
-        ZSTD_BALANCED,  // Zstandard balanced
-        ZSTD_BEST,      // Zstandard best compression
-        FLAC_FAST,      // FLAC fast encoding
-        FLAC_BEST       // FLAC best compression
+        NONE,           // Raw float blocks, no prediction
+        LZ4,            // Fastest: order 2
+        ZSTD_FAST,      // Order 8
+        ZSTD_BALANCED,  // Order 12
+        ZSTD_BEST,      // Order 32
+        FLAC_FAST,      // Order 8
+        FLAC_BEST       // Order 32
     };
 
     struct Config {
@@ -395,6 +462,16 @@ class CompressionPipeline {
 
     DecompressionResult decompress(const uint8_t* compressedData, size_t dataSize);
 
+    /**
+     * @brief Decode only the blocks covering [firstFrame, firstFrame + frameCount)
+     *
+     * The range is clamped to the end of the stream.
+     */
+    DecompressionResult decompressRange(const uint8_t* compressedData,
+                                        size_t dataSize,
+                                        size_t firstFrame,
+                                        size_t frameCount);
+
     /**
      * @brief Estimate compression ratio for given audio characteristics
      */
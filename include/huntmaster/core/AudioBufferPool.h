@@ -6,7 +6,6 @@
 #include <chrono>
 #include <memory>
 #include <memory_resource>
-#include <semaphore>
 #include <span>
 #include <vector>
 
@@ -23,7 +22,8 @@ enum class BufferPoolError {
     ALLOCATION_FAILED,
     INVALID_CONFIGURATION,
     INVALID_ALIGNMENT,
-    OUT_OF_MEMORY
+    OUT_OF_MEMORY,
+    REQUEST_TOO_LARGE
 };
 
 /**
@@ -44,8 +44,15 @@ struct BufferPoolStats {
  * @brief Lock-free buffer pool for efficient audio buffer management
  *
  * This class provides a thread-safe, lock-free buffer pool optimized for
- * real-time audio processing. It uses C++20 counting semaphores for
- * availability tracking and custom memory resources for allocation.
+ * real-time audio processing. Each size class keeps its free buffers on an
+ * index-based Treiber stack with a tagged head, so acquire/release are O(1).
+ * Threads additionally keep a small per-pool magazine of recently released
+ * buffers per size class; hits touch no shared cache line. A thread whose
+ * class is empty takes buffers back out of other threads' magazines before
+ * falling back to a timed wait, and releases skip the magazine while anyone
+ * is waiting, so buffers released by a consumer thread always reach the
+ * producer. Magazines are only enabled for classes with at least 16 buffers
+ * and hold at most 1/16 of the class each.
  */
 class AudioBufferPool {
   public:
@@ -58,6 +65,7 @@ class AudioBufferPool {
         size_t alignment{64};                                 // Memory alignment (cache line)
         std::pmr::memory_resource* memory_resource{nullptr};  // Custom allocator
         std::chrono::milliseconds acquire_timeout{100};       // Acquisition timeout
+        std::vector<size_t> size_classes{};                   // Extra buffer sizes (bytes)
     };
 
     /**
@@ -140,6 +148,8 @@ class AudioBufferPool {
 
         BufferHandle(AudioBufferPool* pool, void* buffer, size_t index);
 
+        [[nodiscard]] size_t sizeBytes() const noexcept;
+
         AudioBufferPool* pool_{nullptr};
         void* buffer_{nullptr};
         size_t index_{0};
@@ -159,6 +169,22 @@ class AudioBufferPool {
     [[nodiscard]] huntmaster::expected<BufferHandle, BufferPoolError>
     tryAcquireFor(std::chrono::milliseconds timeout);
 
+    /**
+     * @brief Acquire a buffer from the smallest size class holding min_bytes
+     * @param min_bytes Minimum buffer size in bytes
+     * @return Buffer handle, or REQUEST_TOO_LARGE if no class is big enough
+     */
+    [[nodiscard]] huntmaster::expected<BufferHandle, BufferPoolError> acquire(size_t min_bytes);
+
+    /**
+     * @brief Size-class aware variant of tryAcquireFor()
+     * @param min_bytes Minimum buffer size in bytes
+     * @param timeout Maximum time to wait
+     * @return Buffer handle or error
+     */
+    [[nodiscard]] huntmaster::expected<BufferHandle, BufferPoolError>
+    tryAcquireFor(size_t min_bytes, std::chrono::milliseconds timeout);
+
     /**
      * @brief Release a buffer back to the pool (called automatically by BufferHandle)
      * @param handle Buffer to release
@@ -20,6 +20,8 @@ namespace huntmaster {
  *
  * Key Features:
  * - Lock-free atomic operations for real-time safety
+ * - Fused single-pass metering: sample peak, RMS, 4x oversampled true peak and
+ *   ITU-R BS.1770 K-weighted momentary (400 ms) / short-term (3 s) loudness
  * - Configurable smoothing and time constants
  * - dB conversion with proper headroom handling
  * - JSON export for cross-platform compatibility
@@ -38,6 +40,7 @@ class AudioLevelProcessor {
         float dbFloor = -60.0f;            ///< Minimum dB level (silence floor)
         float dbCeiling = 6.0f;            ///< Maximum dB level (clipping threshold)
         size_t historySize = 100;          ///< Number of level measurements to retain
+        bool enableLoudness = true;        ///< Run K-weighted loudness and true-peak metering
 
         /// Validate configuration parameters
         [[nodiscard]] bool isValid() const noexcept {
@@ -53,6 +56,10 @@ class AudioLevelProcessor {
         float rmsDb = -60.0f;                             ///< RMS level in dB
         float peakLinear = 0.0f;                          ///< Peak level (linear, 0.0-1.0)
         float peakDb = -60.0f;                            ///< Peak level in dB
+        float truePeakLinear = 0.0f;                      ///< Inter-sample peak of the last chunk
+        float truePeakDb = -60.0f;                        ///< True peak in dBTP
+        float momentaryLufs = -70.0f;                     ///< K-weighted loudness, last 400 ms
+        float shortTermLufs = -70.0f;                     ///< K-weighted loudness, last 3 s
         std::chrono::steady_clock::time_point timestamp;  ///< Measurement timestamp
 
         LevelMeasurement() : timestamp(std::chrono::steady_clock::now()) {}
@@ -96,6 +103,9 @@ class AudioLevelProcessor {
      *
      * Thread-safe method for processing incoming audio data.
      * Updates internal level calculations using attack/release smoothing.
+     * When Config::enableLoudness is set, the same pass over the chunk also
+     * runs the K-weighting filters and the true-peak interpolator; the
+     * loudness windows span chunk boundaries, so feed contiguous audio.
      *
      * @param samples Audio samples to process (interleaved if multi-channel)
      * @param numChannels Number of audio channels (1=mono, 2=stereo)
@@ -125,6 +135,9 @@ class AudioLevelProcessor {
      *   "peak": float,     // Peak level in dB
      *   "rmsLinear": float, // RMS level (linear 0.0-1.0)
      *   "peakLinear": float, // Peak level (linear 0.0-1.0)
+     *   "truePeak": float,   // True peak in dBTP
+     *   "momentaryLufs": float, // Loudness over the last 400 ms
+     *   "shortTermLufs": float, // Loudness over the last 3 s
      *   "timestamp": int64   // Unix timestamp in milliseconds
      * }
      *
@@ -96,7 +96,9 @@ class CadenceAnalyzer {
         float maxPeriod = 5.0f;              ///< Maximum period in seconds
         float onsetThreshold = 0.3f;         ///< Onset detection threshold
         float silenceThreshold = -30.0f;     ///< Silence threshold in dB
-        size_t autocorrelationLags = 1000;   ///< Number of autocorr lags
+        size_t autocorrelationLags = 1000;   ///< Max onset-envelope lags (frames)
+        float periodicityWindow = 8.0f;      ///< Streaming onset history (seconds)
+        size_t periodicityUpdateHop = 8;     ///< Flux frames between streaming updates
         bool enableBeatTracking = true;      ///< Enable beat detection
         bool enableOnsetDetection = true;    ///< Enable onset detection
         bool enableSyllableAnalysis = true;  ///< Enable syllable analysis
@@ -158,6 +160,11 @@ class CadenceAnalyzer {
 
     /**
      * @brief Estimate tempo from audio
+     *
+     * Uses the strongest autocorrelation peak of the onset envelope within
+     * [minTempo, maxTempo], falling back to inter-onset intervals when the
+     * envelope has no such peak.
+     *
      * @param audio Audio samples to analyze
      * @return Tempo in BPM and confidence
      */
@@ -165,6 +172,10 @@ class CadenceAnalyzer {
 
     /**
      * @brief Analyze periodicity in audio signal
+     *
+     * Periods are autocorrelation peaks of the onset (spectral flux) envelope,
+     * computed with FFTs, within [minPeriod, maxPeriod].
+     *
      * @param audio Audio samples to analyze
      * @return Periodicity measures
      */
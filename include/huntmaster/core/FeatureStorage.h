@@ -0,0 +1,182 @@
+/**
+ * @file FeatureStorage.h
+ * @brief Shared building blocks for persisted feature files
+ *
+ * Checksumming, read-only file mappings, the on-disk record of the MFCC
+ * configuration that produced a feature matrix, and the .mfc feature file
+ * format. Used by the master-call library pack and the .mfc feature cache.
+ *
+ * @author Huntmaster Engine Team
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "huntmaster/core/Expected.h"
+#include "huntmaster/core/MFCCProcessor.h"
+
+namespace huntmaster {
+
+/**
+ * @brief CRC-32C (Castagnoli) of a byte range
+ *
+ * Uses the SSE4.2 crc32 instruction when available. Pass a previous result as
+ * @p crc to checksum data in pieces.
+ */
+[[nodiscard]] uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0) noexcept;
+
+/**
+ * @brief MFCC settings stored alongside persisted features
+ *
+ * Loaders compare this against the live configuration so that features
+ * computed with different framing or coefficients are never compared. The
+ * layout is fixed at 32 bytes, little-endian.
+ */
+struct FeatureConfigRecord {
+    static constexpr uint32_t kUseEnergy = 1u << 0;
+    static constexpr uint32_t kApplyLifter = 1u << 1;
+
+    uint32_t sampleRate = 0;
+    uint32_t frameSize = 0;
+    uint32_t hopSize = 0;
+    uint32_t numCoefficients = 0;
+    uint32_t numFilters = 0;
+    uint32_t lifterCoeff = 0;
+    uint32_t flags = 0;
+    uint32_t reserved = 0;
+
+    /// Record for features extracted with @p config at the given hop size
+    [[nodiscard]] static FeatureConfigRecord fromMFCC(const MFCCProcessor::Config& config,
+                                                      size_t hopSize) noexcept;
+
+    /// MFCC settings that reproduce these features (hopSize is not part of them)
+    [[nodiscard]] MFCCProcessor::Config toMFCC() const noexcept;
+
+    bool operator==(const FeatureConfigRecord&) const = default;
+};
+
+static_assert(sizeof(FeatureConfigRecord) == 32, "FeatureConfigRecord is an on-disk layout");
+
+/**
+ * @brief Read-only, shared memory mapping of a whole file
+ *
+ * The mapping is shared with every other process that maps the same file, so
+ * repeated opens are page-cache lookups rather than reads.
+ */
+class ReadOnlyFileMapping {
+  public:
+    ReadOnlyFileMapping() = default;
+    ~ReadOnlyFileMapping();
+
+    ReadOnlyFileMapping(const ReadOnlyFileMapping&) = delete;
+    ReadOnlyFileMapping& operator=(const ReadOnlyFileMapping&) = delete;
+    ReadOnlyFileMapping(ReadOnlyFileMapping&& other) noexcept;
+    ReadOnlyFileMapping& operator=(ReadOnlyFileMapping&& other) noexcept;
+
+    /// Map @p path; returns false if it cannot be opened or is empty
+    bool open(const std::string& path);
+    void close() noexcept;
+
+    [[nodiscard]] bool isOpen() const noexcept {
+        return data_ != nullptr;
+    }
+    [[nodiscard]] const uint8_t* data() const noexcept {
+        return data_;
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+  private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
+
+enum class FeatureFileError {
+    FILE_NOT_FOUND,
+    INVALID_FORMAT,
+    UNSUPPORTED_VERSION,
+    CHECKSUM_MISMATCH,
+    CONFIG_MISMATCH,
+    IO_ERROR
+};
+
+/**
+ * @brief MFCC features stored in the versioned .mfc format
+ *
+ * Version 2 layout (little-endian): a 64-byte header with the magic "HMFC",
+ * the version, frame and coefficient counts, the FeatureConfigRecord and
+ * CRC-32C checksums of header and payload, followed at offset 64 by
+ * frames x coefficients float32 values in row-major order. Files are read
+ * through a shared read-only mapping, so the features are used in place.
+ *
+ * Version 1 files (a bare frame and coefficient count followed by rows)
+ * record no configuration; open() reports them as UNSUPPORTED_VERSION.
+ */
+class FeatureFile {
+  public:
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /// Map @p path and validate its header and payload checksum
+    [[nodiscard]] static huntmaster::expected<FeatureFile, FeatureFileError>
+    open(const std::string& path);
+
+    /// As open(), and reject features extracted with a different configuration
+    [[nodiscard]] static huntmaster::expected<FeatureFile, FeatureFileError>
+    open(const std::string& path, const FeatureConfigRecord& expectedConfig);
+
+    /**
+     * @brief Write @p features in the current format
+     *
+     * The file is written under a temporary name and renamed over @p path, so
+     * processes that have the old file mapped keep seeing consistent data.
+     */
+    static huntmaster::expected<void, FeatureFileError>
+    write(const std::string& path,
+          const FeatureConfigRecord& config,
+          const MFCCProcessor::FeatureMatrix& features);
+
+    FeatureFile(FeatureFile&&) noexcept = default;
+    FeatureFile& operator=(FeatureFile&&) noexcept = default;
+
+    [[nodiscard]] size_t frames() const noexcept {
+        return frames_;
+    }
+    [[nodiscard]] size_t coefficients() const noexcept {
+        return coefficients_;
+    }
+    [[nodiscard]] const FeatureConfigRecord& config() const noexcept {
+        return config_;
+    }
+
+    /// frames() x coefficients() values, row-major and 64-byte aligned, in the mapping
+    [[nodiscard]] const float* data() const noexcept {
+        return data_;
+    }
+    [[nodiscard]] std::span<const float> frame(size_t index) const noexcept {
+        return {data_ + index * coefficients_, coefficients_};
+    }
+
+    /// Copy the features into the nested layout used by DTWComparator
+    [[nodiscard]] MFCCProcessor::FeatureMatrix featureMatrix() const;
+
+  private:
+    FeatureFile() = default;
+
+    ReadOnlyFileMapping mapping_;
+    const float* data_ = nullptr;
+    size_t frames_ = 0;
+    size_t coefficients_ = 0;
+    FeatureConfigRecord config_;
+};
+
+}  // namespace huntmaster
@@ -80,6 +80,15 @@ class HarmonicAnalyzer {
         bool enableFormantTracking = true;  ///< Enable formant analysis
         bool enableTonalAnalysis = true;    ///< Enable tonal quality analysis
         float noiseFloorDb = -60.0f;        ///< Noise floor threshold in dB
+
+        // Formant extraction
+        bool useLPCFormants = true;           ///< LPC envelope (true) or FFT peak picking
+        size_t lpcOrder = 0;                  ///< LPC order (0 = 2 + sampleRate / 1000)
+        size_t lpcFrameSize = 1024;           ///< LPC analysis frame (clamped to fftSize)
+        size_t lpcGridSize = 256;             ///< Envelope evaluation points
+        float minFormantFrequency = 200.0f;   ///< Lower bound of the formant search
+        float maxFormantFrequency = 4000.0f;  ///< Upper bound of the formant search
+        float maxFormantBandwidth = 700.0f;   ///< Reject broader envelope peaks (Hz)
     };
 
     /**
@@ -138,6 +147,10 @@ class HarmonicAnalyzer {
 
     /**
      * @brief Extract formant frequencies from audio
+     *
+     * With useLPCFormants the formants are peaks of the LPC envelope of the
+     * centre lpcFrameSize samples; otherwise they are FFT magnitude peaks.
+     *
      * @param audio Audio samples to analyze
      * @return Vector of formant frequencies in Hz
      */
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
@@ -119,6 +120,24 @@ class MFCCProcessor {
      */
     using FeatureMatrix = std::vector<FeatureVector>;
 
+    /**
+     * @typedef SpectrumGate
+     * @brief Per-frame predicate over the power spectrum computed for MFCC extraction
+     *
+     * Receives the frame_size / 2 + 1 power bins of the windowed frame and returns
+     * false to skip the mel filter bank and DCT for that frame.
+     */
+    using SpectrumGate = std::function<bool(std::span<const float> power_spectrum)>;
+
+    /**
+     * @typedef SampleSource
+     * @brief Pull callback feeding streaming extraction
+     *
+     * Writes up to out.size() mono samples into out and returns the number written;
+     * returning 0 ends the stream.
+     */
+    using SampleSource = std::function<size_t(std::span<float> out)>;
+
     /**
      * @brief Construct MFCC processor with specified configuration
      *
@@ -184,6 +203,40 @@ class MFCCProcessor {
     [[nodiscard]] huntmaster::expected<FeatureMatrix, MFCCError>
     extractFeaturesFromBuffer(std::span<const float> audio_buffer, size_t hop_size);
 
+    /**
+     * @brief Extract MFCC features, letting a gate drop frames by their power spectrum
+     *
+     * Same framing as extractFeaturesFromBuffer(), but each frame's power spectrum is
+     * passed to the gate before the mel filter bank. Rejected frames are omitted from
+     * the result, so analysis such as spectral VAD can share this FFT pass.
+     *
+     * @param audio_buffer Complete audio buffer to process
+     * @param hop_size Number of samples to advance between frames
+     * @param gate Frame predicate; an empty gate accepts every frame
+     * @return Expected containing features of accepted frames, or MFCCError on failure
+     */
+    [[nodiscard]] huntmaster::expected<FeatureMatrix, MFCCError>
+    extractFeaturesFromBuffer(std::span<const float> audio_buffer,
+                              size_t hop_size,
+                              const SpectrumGate& gate);
+
+    /**
+     * @brief Extract MFCC features from a pull source with bounded memory
+     *
+     * Produces the same frames as extractFeaturesFromBuffer() over the concatenated
+     * stream, but holds only one frame plus one chunk of audio at a time, so long
+     * recordings can be analysed while they are being decoded.
+     *
+     * @param source Callback supplying mono samples until it returns 0
+     * @param hop_size Number of samples to advance between frames
+     * @param chunk_size Maximum samples requested from the source per call
+     * @return Expected containing feature matrix on success, or MFCCError on failure
+     */
+    [[nodiscard]] huntmaster::expected<FeatureMatrix, MFCCError>
+    extractFeaturesFromStream(const SampleSource& source,
+                              size_t hop_size,
+                              size_t chunk_size = 4096);
+
     /**
      * @brief Clear all cached intermediate computations
      *
@@ -0,0 +1,124 @@
+/**
+ * @file MasterCallBatchBuilder.h
+ * @brief Parallel, incremental builder for master-call libraries and caches
+ *
+ * Turns a directory of master-call WAVs into a packed MasterCallLibrary,
+ * per-call .mfc feature files, metadata JSON and waveform overviews. Calls
+ * are spread over a pool of worker threads and each WAV is read and decoded
+ * once for all outputs. A manifest records the content hash of every input
+ * and a hash of the build configuration, so a rebuild only re-analyses calls
+ * whose audio or settings changed and copies the rest from the previous
+ * library.
+ *
+ * @author Huntmaster Engine Team
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "huntmaster/core/Expected.h"
+#include "huntmaster/core/MFCCProcessor.h"
+
+namespace huntmaster {
+
+enum class MasterCallBatchError { INVALID_CONFIG, INPUT_NOT_FOUND, OUTPUT_ERROR };
+
+class MasterCallBatchBuilder {
+  public:
+    /// Decoded call handed to the metadata hook
+    struct CallInfo {
+        std::string id;
+        std::string sourcePath;       ///< Relative to Config::inputDir
+        std::span<const float> audio;  ///< Mono, at the source sample rate
+        uint32_t sampleRate = 0;
+        uint32_t channels = 0;
+        size_t featureFrames = 0;
+    };
+
+    using MetadataValue = std::variant<std::string, double, int64_t, bool>;
+    using MetadataFields = std::vector<std::pair<std::string, MetadataValue>>;
+
+    enum class Outcome { BUILT, REUSED, FAILED };
+
+    struct CallResult {
+        std::string id;
+        Outcome outcome = Outcome::FAILED;
+        std::string metadata;  ///< JSON object; empty if the call failed
+        std::string error;     ///< Reason for a failure
+    };
+
+    struct Config {
+        std::string inputDir;      ///< Searched recursively for .wav files
+        std::string libraryPath;   ///< Packed library to write; empty to skip
+        std::string featuresDir;   ///< One <id>.mfc per call; empty to skip
+        std::string metadataDir;   ///< One <id>.json per call; empty to skip
+        std::string waveformsDir;  ///< One <id>.json overview per call; empty to skip
+        std::string manifestPath;  ///< Incremental build state; empty rebuilds every call
+
+        std::vector<std::string> only;  ///< Restrict the build to these ids; empty for all
+
+        MFCCProcessor::Config mfcc;  ///< Features are extracted at mfcc.sample_rate
+        size_t hopSize = 256;
+        bool storeAudio = true;  ///< Keep quantized audio in the library
+        std::vector<size_t> waveformResolutions = {100, 500, 1000, 5000};
+
+        size_t threads = 0;  ///< Worker threads; 0 uses the hardware concurrency
+        bool force = false;  ///< Ignore the manifest and previous library
+
+        /// Extra metadata fields per call, called from worker threads
+        std::function<MetadataFields(const CallInfo&)> metadata;
+
+        /// Invoked once per finished call; calls are serialized but come from workers
+        std::function<void(const CallResult&)> onCallFinished;
+    };
+
+    struct Report {
+        std::vector<CallResult> calls;  ///< In id order
+        size_t built = 0;
+        size_t reused = 0;
+        size_t failed = 0;
+        uint64_t inputBytes = 0;     ///< WAV bytes read and hashed
+        double audioSeconds = 0.0;   ///< Audio decoded and analysed
+        double elapsedSeconds = 0.0;
+        size_t threads = 0;
+
+        [[nodiscard]] double callsPerSecond() const noexcept {
+            return elapsedSeconds > 0.0 ? static_cast<double>(calls.size()) / elapsedSeconds
+                                        : 0.0;
+        }
+        [[nodiscard]] double megabytesPerSecond() const noexcept {
+            return elapsedSeconds > 0.0 ? static_cast<double>(inputBytes) / 1e6 / elapsedSeconds
+                                        : 0.0;
+        }
+        /// Seconds of audio analysed per second of wall time
+        [[nodiscard]] double realtimeFactor() const noexcept {
+            return elapsedSeconds > 0.0 ? audioSeconds / elapsedSeconds : 0.0;
+        }
+    };
+
+    explicit MasterCallBatchBuilder(Config config);
+
+    /**
+     * @brief Build every configured output
+     *
+     * Per-call failures (unreadable WAVs, calls too short to analyse, duplicate
+     * ids) are recorded in the report and do not stop the build; the library
+     * then holds the calls that succeeded. Errors are returned only when the
+     * configuration is unusable or an output cannot be written at all.
+     */
+    [[nodiscard]] huntmaster::expected<Report, MasterCallBatchError> build();
+
+  private:
+    Config config_;
+};
+
+}  // namespace huntmaster
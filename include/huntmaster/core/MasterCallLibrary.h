@@ -0,0 +1,159 @@
+/**
+ * @file MasterCallLibrary.h
+ * @brief Packed, memory-mappable library of master calls
+ *
+ * A library file holds the MFCC features, metadata and (optionally) quantized
+ * audio of many master calls behind a sorted index. It is mapped read-only and
+ * shared between processes, so loading or switching a master call is a binary
+ * search plus page-cache hits instead of opening and parsing loose files.
+ *
+ * File layout (little-endian):
+ *   header (128 bytes) | payloads, each 64-byte aligned | strings | index
+ * The header and the index/strings regions carry CRC-32C checksums verified at
+ * open; each entry's feature and audio payloads carry their own checksums,
+ * verified on demand with MasterCallLibrary::verify().
+ *
+ * @author Huntmaster Engine Team
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "huntmaster/core/Expected.h"
+#include "huntmaster/core/FeatureStorage.h"
+#include "huntmaster/core/MFCCProcessor.h"
+
+namespace huntmaster {
+
+enum class MasterCallLibraryError {
+    FILE_NOT_FOUND,
+    INVALID_FORMAT,
+    UNSUPPORTED_VERSION,
+    CHECKSUM_MISMATCH,
+    DUPLICATE_ID,
+    INVALID_INPUT,
+    IO_ERROR
+};
+
+/**
+ * @brief One master call inside an open library
+ *
+ * All pointers and views refer to the mapping and stay valid only while the
+ * MasterCallLibrary that produced them is alive.
+ */
+struct MasterCallView {
+    std::string_view id;
+    std::string_view metadata;  ///< Free-form, usually JSON
+    uint32_t frames = 0;
+    uint32_t coefficients = 0;
+    const float* features = nullptr;  ///< frames x coefficients, row-major, 64-byte aligned
+    std::span<const int16_t> audio;   ///< Quantized mono audio; empty if not stored
+    float audioScale = 0.0f;          ///< Multiply a quantized sample by this to get a float
+    uint32_t audioSampleRate = 0;
+
+    /// Copy the features into the nested layout used by DTWComparator
+    [[nodiscard]] MFCCProcessor::FeatureMatrix featureMatrix() const;
+
+    /// Dequantize the stored audio
+    [[nodiscard]] std::vector<float> decodeAudio() const;
+};
+
+/**
+ * @brief Read-only view of a packed master-call library
+ */
+class MasterCallLibrary {
+  public:
+    static constexpr uint32_t kFormatVersion = 1;
+
+    /**
+     * @brief Map a library file and validate its header and index
+     *
+     * Payload checksums are not checked here so that opening a large library
+     * does not fault in every page; use verify() before trusting an entry.
+     */
+    [[nodiscard]] static huntmaster::expected<std::unique_ptr<MasterCallLibrary>,
+                                              MasterCallLibraryError>
+    open(const std::string& path);
+
+    ~MasterCallLibrary();
+
+    MasterCallLibrary(const MasterCallLibrary&) = delete;
+    MasterCallLibrary& operator=(const MasterCallLibrary&) = delete;
+
+    /// Number of calls; entries are ordered by id
+    [[nodiscard]] size_t size() const noexcept;
+
+    /// Entry at @p index in id order
+    [[nodiscard]] MasterCallView at(size_t index) const;
+
+    /// Binary search by id
+    [[nodiscard]] std::optional<size_t> indexOf(std::string_view id) const noexcept;
+    [[nodiscard]] std::optional<MasterCallView> find(std::string_view id) const;
+
+    /// Check the feature and audio checksums of one entry
+    [[nodiscard]] bool verify(size_t index) const noexcept;
+
+    /// MFCC configuration every feature matrix in the library was extracted with
+    [[nodiscard]] const FeatureConfigRecord& featureConfig() const noexcept;
+
+  private:
+    MasterCallLibrary();
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+/**
+ * @brief Writes a master-call library file
+ *
+ * Payloads are streamed to a temporary file as calls are added, so memory use
+ * is bounded by the index, not the library. finish() writes the index and
+ * header and atomically replaces the target, leaving processes that still map
+ * the old library unaffected. add() may be called from several threads.
+ */
+class MasterCallLibraryBuilder {
+  public:
+    struct Entry {
+        std::string id;
+        std::string metadata;
+        MFCCProcessor::FeatureMatrix features;
+        std::vector<float> audio;  ///< Mono samples, stored as 16-bit; empty to omit
+        uint32_t audioSampleRate = 0;
+    };
+
+    /**
+     * @param path Library file to produce
+     * @param featureConfig Configuration the added features were extracted with
+     * @throws std::runtime_error if the temporary file cannot be created
+     */
+    MasterCallLibraryBuilder(std::string path, const FeatureConfigRecord& featureConfig);
+    ~MasterCallLibraryBuilder();
+
+    MasterCallLibraryBuilder(const MasterCallLibraryBuilder&) = delete;
+    MasterCallLibraryBuilder& operator=(const MasterCallLibraryBuilder&) = delete;
+
+    /// Append a call; features must be rectangular with the configured coefficient count
+    huntmaster::expected<void, MasterCallLibraryError> add(const Entry& entry);
+
+    /// Append a call copied from another library without re-encoding it
+    huntmaster::expected<void, MasterCallLibraryError> add(const MasterCallView& view);
+
+    [[nodiscard]] size_t size() const;
+
+    /// Write the index and header and move the library into place
+    huntmaster::expected<void, MasterCallLibraryError> finish();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+}  // namespace huntmaster
@@ -65,13 +65,19 @@ struct IOPerformanceMetrics {
 
 /**
  * @brief Memory-mapped file reader for high-performance audio file access
+ *
+ * 8/16/24/32-bit PCM and 32/64-bit float WAV data is decoded to float on
+ * access, one window at a time, into a reusable buffer; aligned 32-bit
+ * float data is returned straight from the mapping. Only the pages around
+ * the current window need to be resident, so long recordings can be
+ * analyzed without loading them.
  */
 class MemoryMappedAudioFile {
   public:
     enum class AccessPattern {
-        SEQUENTIAL,  // Sequential read access
-        RANDOM,      // Random access pattern
-        STREAMING    // Streaming with prefetch
+        SEQUENTIAL,  // Sequential read access; decodes and prefetches ahead
+        RANDOM,      // Random access pattern; decodes only what is asked for
+        STREAMING    // Streaming with prefetch; also drops pages already consumed
     };
 
     struct Config {
@@ -107,10 +113,20 @@ class MemoryMappedAudioFile {
     void close();
 
     /**
-     * @brief Read audio samples with zero-copy access
+     * @brief Read interleaved samples [offset, offset + count) as float
+     *
+     * The pointer refers to the mapping (float files) or to the decode
+     * window, and stays valid until the next read or close().
+     * @return nullptr if the range is out of bounds
      */
     const float* readSamples(size_t offset, size_t count);
 
+    /**
+     * @brief Decode samples into caller storage, bypassing the window
+     * @return Number of samples written (0 if the range is out of bounds)
+     */
+    size_t readSamples(size_t offset, size_t count, float* destination);
+
     /**
      * @brief Get file size in samples
      */
@@ -134,7 +150,7 @@ class MemoryMappedAudioFile {
     IOPerformanceMetrics getMetrics() const;
 
     /**
-     * @brief Prefetch data for future access
+     * @brief Ask the kernel to start paging in a sample range
      */
     void prefetch(size_t offset, size_t count);
 
@@ -146,23 +162,36 @@ class MemoryMappedAudioFile {
 
 /**
  * @brief Asynchronous audio writer for non-blocking file operations
+ *
+ * Group commit: writeAsync() converts samples straight into one of
+ * bufferCount aligned staging buffers; a full buffer is handed to the
+ * writer thread and written with one large aligned write (optionally
+ * O_DIRECT) while the caller fills the next. Memory is bounded by
+ * bufferCount * bufferSizeBytes; when every buffer is busy the write is
+ * rejected rather than blocking the audio thread. Sample data starts on a
+ * 4 KiB boundary (the header is padded with a JUNK chunk), and the header
+ * sizes are only rewritten at checkpoint() and stop().
  */
 class AsyncAudioWriter {
   public:
     enum class CompressionLevel { NONE = 0, FAST = 1, BALANCED = 5, BEST = 9 };
 
     struct Config {
-        size_t bufferSizeBytes;
-        size_t maxQueuedWrites;
+        size_t bufferSizeBytes;  // Per staging buffer, rounded up to whole aligned frames
         CompressionLevel compression;
         bool enableChecksums;
         std::string tempDirectory;
+        size_t bufferCount;                      // 2 = double, 3 = triple buffering
+        bool useDirectIO;                        // O_DIRECT where the filesystem allows it
+        size_t preallocateBytes;                 // fallocate() step ahead of the data; 0 = off
+        std::chrono::milliseconds syncInterval;  // fdatasync() cadence; 0 = only at stop
 
         Config()
             : bufferSizeBytes(2 * 1024 * 1024)  // 2MB buffer
               ,
-              maxQueuedWrites(16), compression(CompressionLevel::NONE), enableChecksums(false),
-              tempDirectory("/tmp") {}
+              compression(CompressionLevel::NONE), enableChecksums(false),
+              tempDirectory("/tmp"), bufferCount(3), useDirectIO(false),
+              preallocateBytes(64 * 1024 * 1024), syncInterval(1000) {}
     };
 
     using WriteCallback = std::function<void(bool success, const std::string& error)>;
@@ -177,6 +206,7 @@ class AsyncAudioWriter {
 
     /**
      * @brief Start asynchronous writer
+     * @param bitsPerSample 16 or 24 (PCM) or 32 (IEEE float)
      */
     bool start(const std::string& filename,
                uint32_t sampleRate,
@@ -184,17 +214,33 @@ class AsyncAudioWriter {
                uint16_t bitsPerSample = 32);
 
     /**
-     * @brief Queue audio data for writing
+     * @brief Queue interleaved samples for writing
+     *
+     * The callback runs on the writer thread once the buffer holding the
+     * samples reaches the file.
+     * @return false (and callback(false, ...)) if no staging space is free
      */
     bool writeAsync(const float* data, size_t sampleCount, WriteCallback callback = nullptr);
 
+    /**
+     * @brief Write everything queued so far, finalize the header and sync
+     *
+     * The file is a complete WAV of the data written so far when this
+     * returns; recording continues afterwards.
+     */
+    bool checkpoint();
+
     /**
      * @brief Flush all pending writes and stop
+     *
+     * Returns false if the final flush has not reached the file within
+     * `timeout`; writes are rejected from then on, the flush carries on in
+     * the background, and a later stop() (or the destructor) waits for it.
      */
     bool stop(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
 
     /**
-     * @brief Get current queue depth
+     * @brief Get number of full buffers waiting for the device
      */
     size_t getQueueDepth() const;
 
@@ -7,7 +7,6 @@
 #include <condition_variable>
 #include <memory>
 #include <optional>
-#include <queue>
 #include <span>
 #include <vector>
 
@@ -45,10 +44,18 @@ struct ProcessorStats {
     size_t current_buffer_usage{0};
 };
 
+/**
+ * Bounded queue of preallocated AudioChunk slots between capture and analysis threads.
+ *
+ * Any number of producers and consumers may use it concurrently. Slots carry a
+ * sequence number (Vyukov-style ring), so enqueue and dequeue never lock and never
+ * allocate; a full queue fails immediately instead of waiting for a consumer.
+ * Batch calls claim a run of slots with a single atomic operation.
+ */
 class RealtimeAudioProcessor {
   public:
     struct Config {
-        size_t ring_buffer_size{1024};  // Must be power of 2
+        size_t ring_buffer_size{1024};  // Must be power of 2 and at least 2
         size_t chunk_size{512};
         bool enable_backpressure{true};
         std::chrono::milliseconds backpressure_timeout{10};
@@ -74,11 +81,14 @@ class RealtimeAudioProcessor {
 
     [[nodiscard]] std::optional<AudioChunk> tryDequeueChunk();
 
-    // Batch operations
+    // Batch operations: each call claims its run of slots in one atomic step
     [[nodiscard]] size_t enqueueBatch(std::span<const std::span<const float>> audio_batches);
 
     [[nodiscard]] std::vector<AudioChunk> dequeueBatch(size_t max_chunks);
 
+    // Allocation-free variant: fills the front of out and returns the chunk count
+    [[nodiscard]] size_t dequeueBatch(std::span<AudioChunk> out);
+
     // Status and control
     [[nodiscard]] bool isEmpty() const noexcept;
     [[nodiscard]] bool isFull() const noexcept;
@@ -13,6 +13,7 @@ namespace huntmaster {
 class MFCCProcessor;
 class DTWComparator;
 class AudioLevelProcessor;
+struct FeatureConfigRecord;
 
 /**
  * @brief Real-time multi-dimensional similarity scorer with detailed feedback
@@ -141,6 +142,24 @@ class RealtimeScorer {
      */
     bool setMasterCall(const std::string& masterCallPath) noexcept;
 
+    /**
+     * @brief Set master call from features that were already extracted
+     *
+     * No file is opened. Live audio is analysed with the MFCC settings and hop in
+     * @p config so both sides of the DTW comparison are framed the same way.
+     *
+     * @param features MFCC frames of the master call
+     * @param config How the features were extracted; its sample rate must match the scorer's
+     * @param rms RMS level of the master audio; 0 if unknown, which leaves volume out of
+     *            the overall score
+     * @param durationSeconds Length of the master audio; 0 derives it from frames and hop
+     * @return true if the master call was accepted
+     */
+    bool setMasterCallFeatures(std::vector<std::vector<float>> features,
+                               const FeatureConfigRecord& config,
+                               float rms,
+                               float durationSeconds = 0.0f) noexcept;
+
     /**
      * @brief Process audio samples and calculate real-time similarity score
      *
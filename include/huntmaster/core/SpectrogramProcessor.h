@@ -16,6 +16,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <span>
 #include <string>
@@ -36,6 +37,39 @@ enum class SpectrogramError {
     PROCESSING_FAILED  ///< General processing error
 };
 
+/**
+ * @enum SpectrogramColorScheme
+ * @brief 256-entry palettes used for 8-bit spectrogram rendering
+ */
+enum class SpectrogramColorScheme {
+    GRAYSCALE,  ///< Black to white
+    HEAT        ///< Black -> red -> yellow -> white
+};
+
+/**
+ * @struct SpectrogramBinaryHeader
+ * @brief Header of the payload produced by SpectrogramProcessor::exportBinary()
+ *
+ * All fields are little-endian on every host, so copying the bytes into this
+ * struct is only valid on little-endian machines. The header is followed by
+ * time_bins x frequency_bins uint8 levels, row-major [time][frequency]; level 0
+ * maps to min_db and level 255 to max_db.
+ */
+struct SpectrogramBinaryHeader {
+    char magic[4];            ///< "HMSP"
+    uint16_t version;         ///< Format version (1)
+    uint16_t header_size;     ///< Bytes before the level data
+    uint32_t time_bins;       ///< Exported time columns
+    uint32_t frequency_bins;  ///< Exported frequency rows
+    float sample_rate;        ///< Original sample rate
+    float hop_size_seconds;   ///< Time step between exported columns
+    float start_time;         ///< Time of the first column (seconds)
+    float frequency_step_hz;  ///< Frequency step between exported rows
+    float min_db;             ///< dB value of level 0
+    float max_db;             ///< dB value of level 255
+};
+static_assert(sizeof(SpectrogramBinaryHeader) == 40, "SpectrogramBinaryHeader must be packed");
+
 /**
  * @struct SpectrogramData
  * @brief Contains spectrogram analysis results for visualization
@@ -144,6 +178,28 @@ class SpectrogramProcessor {
     huntmaster::expected<std::vector<float>, SpectrogramError>
     processFrame(std::span<const float> audio_frame) noexcept;
 
+    /**
+     * @brief Streaming STFT: append audio and return only the newly completed columns
+     *
+     * Accepts chunks of any size; samples that do not yet fill a window are kept
+     * together with the hop position, so successive calls produce exactly the
+     * columns computeSpectrogram() would produce for the concatenated audio.
+     * The returned SpectrogramData holds the new columns only: time_axis is
+     * absolute from the start of the stream, and min_db/max_db give the running
+     * dB range observed since the last reset(). Cost is proportional to the new
+     * audio, not to the length of the recording.
+     *
+     * @param audio_chunk Next block of audio samples (may be empty)
+     * @return New columns (time_bins may be 0) or error
+     */
+    huntmaster::expected<SpectrogramData, SpectrogramError>
+    processStreamingChunk(std::span<const float> audio_chunk) noexcept;
+
+    /**
+     * @brief Number of columns emitted by processStreamingChunk() since the last reset()
+     */
+    size_t getStreamingColumnCount() const noexcept;
+
     /**
      * @brief Convert magnitude spectrum to decibel representation
      * @param magnitude_spectrum Linear magnitude values
@@ -160,6 +216,31 @@ class SpectrogramProcessor {
     static std::vector<std::vector<float>>
     generateColorMap(const SpectrogramData& spectrogram_data) noexcept;
 
+    /**
+     * @brief Quantize dB values to 8-bit levels in a caller-provided buffer
+     *
+     * Maps [min_db, max_db] linearly onto 0-255 (clamped), row-major
+     * [time][frequency]. Rows missing from magnitude_db are written as 0.
+     *
+     * @param spectrogram_data Spectrogram magnitude data
+     * @param levels Output buffer of at least time_bins * frequency_bins bytes
+     * @return Number of bytes written, or INVALID_INPUT if the buffer is too small
+     */
+    static huntmaster::expected<size_t, SpectrogramError>
+    quantizeToLevels(const SpectrogramData& spectrogram_data, std::span<uint8_t> levels) noexcept;
+
+    /**
+     * @brief Map 8-bit levels to RGBA pixels by palette lookup
+     * @param levels Levels from quantizeToLevels()
+     * @param rgba Output buffer of at least 4 * levels.size() bytes
+     * @param scheme Palette to use
+     * @return Number of bytes written, or INVALID_INPUT if the buffer is too small
+     */
+    static huntmaster::expected<size_t, SpectrogramError>
+    renderColorMap(std::span<const uint8_t> levels,
+                   std::span<uint8_t> rgba,
+                   SpectrogramColorScheme scheme = SpectrogramColorScheme::HEAT) noexcept;
+
     /**
      * @brief Export spectrogram data as JSON for visualization platforms
      * @param spectrogram_data Computed spectrogram data
@@ -171,6 +252,21 @@ class SpectrogramProcessor {
                                        size_t max_time_bins = 1000,
                                        size_t max_freq_bins = 512) const noexcept;
 
+    /**
+     * @brief Export spectrogram as a compact binary payload of 8-bit levels
+     *
+     * Binary counterpart of exportForVisualization() with the same downsampling
+     * rules: a SpectrogramBinaryHeader followed by one byte per exported cell.
+     *
+     * @param spectrogram_data Computed spectrogram data
+     * @param max_time_bins Maximum time bins for display optimization (0 = no limit)
+     * @param max_freq_bins Maximum frequency bins for display (0 = no limit)
+     * @return Encoded payload (empty on error)
+     */
+    std::vector<uint8_t> exportBinary(const SpectrogramData& spectrogram_data,
+                                      size_t max_time_bins = 1000,
+                                      size_t max_freq_bins = 512) const noexcept;
+
     /**
      * @brief Get current configuration
      * @return Current processor configuration
@@ -180,7 +276,7 @@ class SpectrogramProcessor {
     }
 
     /**
-     * @brief Reset processor state (clears any internal buffers)
+     * @brief Reset processor state (clears internal buffers and the streaming position)
      */
     void reset() noexcept;
 
@@ -0,0 +1,414 @@
+// File: StagedPipeline.h
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace huntmaster {
+
+/**
+ * @enum BackpressurePolicy
+ * @brief What a stage does with new work when its input queue is full
+ */
+enum class BackpressurePolicy {
+    Block,       ///< Wait up to the stage's block timeout, then drop the new item
+    DropNewest,  ///< Drop the new item immediately (producer never waits)
+    DropOldest   ///< Evict the oldest queued item to make room (keeps the freshest audio)
+};
+
+/**
+ * @struct StageMetrics
+ * @brief Per-stage counters; latencies are in microseconds
+ */
+struct StageMetrics {
+    std::string name;
+    uint64_t processed{0};         ///< Items the handler completed
+    uint64_t dropped{0};           ///< Items rejected (backpressure, stage stopped) or evicted
+    uint64_t errors{0};            ///< Items whose handler threw
+    size_t queueDepth{0};          ///< Items waiting right now
+    size_t maxQueueDepth{0};       ///< Deepest the queue has been
+    double averageWaitUs{0.0};     ///< Mean time from submit to handler start
+    double maxWaitUs{0.0};         ///< Worst queueing delay
+    double averageServiceUs{0.0};  ///< Mean handler run time
+    double maxServiceUs{0.0};      ///< Worst handler run time
+};
+
+/**
+ * @class StageQueue
+ * @brief Bounded lock-free MPMC queue of preallocated slots
+ *
+ * Same sequence-numbered ring as RealtimeAudioProcessor, generic over a
+ * default-constructible, move-assignable T. Capacity is rounded up to a power
+ * of two (minimum 2). Items carry their submit time for wait-latency metrics.
+ */
+template <typename T>
+class StageQueue {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit StageQueue(size_t capacity)
+        : capacity_(std::bit_ceil(std::max<size_t>(capacity, 2))), mask_(capacity_ - 1),
+          slots_(std::make_unique<Slot[]>(capacity_)) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    StageQueue(const StageQueue&) = delete;
+    StageQueue& operator=(const StageQueue&) = delete;
+
+    /// Moves from value only on success, so a failed push can be retried or dropped
+    [[nodiscard]] bool tryPush(T& value, Clock::time_point submitted = Clock::now()) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.submitted = submitted;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] bool tryPop(T& out, Clock::time_point* submitted = nullptr) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    out = std::move(slot.value);
+                    if (submitted) {
+                        *submitted = slot.submitted;
+                    }
+                    slot.sequence.store(pos + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Approximate under concurrency; exact when quiescent
+    [[nodiscard]] size_t size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        return std::min(tail - std::min(tail, head), capacity_);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+  private:
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence{0};
+        T value{};
+        Clock::time_point submitted{};
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) std::atomic<size_t> head_{0};
+};
+
+/**
+ * @class PipelineStage
+ * @brief One pipeline stage: a StageQueue drained by its own worker threads
+ *
+ * The handler receives each item by reference and typically forwards it to
+ * the next stage with submit(). Producers never take a lock: workers are
+ * only notified when one is actually sleeping, and sleeping workers re-check
+ * the queue every millisecond, so a lost wakeup costs at most one slice.
+ * With workers == 0 the stage runs the handler inline on submit(), which
+ * keeps the same code path usable without threads (tests, WASM, offline).
+ * A threaded stage only accepts work between start() and stop(); anything
+ * submitted outside that window is rejected rather than left in a queue
+ * nobody drains.
+ */
+template <typename T>
+class PipelineStage {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Handler = std::function<void(T&)>;
+
+    struct Config {
+        std::string name{"stage"};
+        size_t queueDepth{64};                           // Rounded up to a power of two
+        size_t workers{1};                               // 0 = run inline on submit()
+        BackpressurePolicy policy{BackpressurePolicy::Block};
+        std::chrono::milliseconds blockTimeout{10};      // Block policy only
+    };
+
+    PipelineStage(Config config, Handler handler)
+        : config_(std::move(config)), handler_(std::move(handler)), queue_(config_.queueDepth) {}
+
+    ~PipelineStage() {
+        stop();
+    }
+
+    PipelineStage(const PipelineStage&) = delete;
+    PipelineStage& operator=(const PipelineStage&) = delete;
+
+    void start() {
+        if (running_.exchange(true)) {
+            return;
+        }
+        workers_.reserve(config_.workers);
+        for (size_t i = 0; i < config_.workers; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    /// Finishes the items already queued, then joins the workers
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        wakeWorkers();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        workers_.clear();
+
+        // A submit() that saw the stage running may have pushed after the workers
+        // drained; wait it out and run whatever it queued here
+        while (active_submits_.load(std::memory_order_seq_cst) > 0) {
+            std::this_thread::yield();
+        }
+        T item{};
+        Clock::time_point submitted;
+        while (queue_.tryPop(item, &submitted)) {
+            runHandler(item, submitted);
+        }
+    }
+
+    /**
+     * @brief Hand an item to the stage, applying the backpressure policy
+     * @return false if this item was dropped, or if a threaded stage is not
+     *         running (before start() or after stop())
+     */
+    bool submit(T& item) {
+        const auto submitted = Clock::now();
+        if (config_.workers == 0) {
+            runHandler(item, submitted);
+            return true;
+        }
+
+        // Pairs with stop(): either this sees running_ cleared, or stop() sees the
+        // submit in flight and drains what it pushes
+        active_submits_.fetch_add(1, std::memory_order_seq_cst);
+        bool accepted = running_.load(std::memory_order_seq_cst)
+                        && (queue_.tryPush(item, submitted) || pushUnderPressure(item, submitted));
+        active_submits_.fetch_sub(1, std::memory_order_seq_cst);
+        if (!accepted) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        updateMax(max_depth_, queue_.size());
+        if (idle_workers_.load(std::memory_order_seq_cst) > 0) {
+            data_cv_.notify_one();
+        }
+        return true;
+    }
+
+    bool submit(T&& item) {
+        return submit(item);
+    }
+
+    [[nodiscard]] StageMetrics metrics() const {
+        StageMetrics metrics;
+        metrics.name = config_.name;
+        metrics.processed = processed_.load(std::memory_order_relaxed);
+        metrics.dropped = dropped_.load(std::memory_order_relaxed);
+        metrics.errors = errors_.load(std::memory_order_relaxed);
+        metrics.queueDepth = queue_.size();
+        metrics.maxQueueDepth = max_depth_.load(std::memory_order_relaxed);
+        const uint64_t started = metrics.processed + metrics.errors;
+        if (started > 0) {
+            metrics.averageWaitUs = total_wait_ns_.load(std::memory_order_relaxed) / 1e3 / started;
+            metrics.averageServiceUs =
+                total_service_ns_.load(std::memory_order_relaxed) / 1e3 / started;
+        }
+        metrics.maxWaitUs = max_wait_ns_.load(std::memory_order_relaxed) / 1e3;
+        metrics.maxServiceUs = max_service_ns_.load(std::memory_order_relaxed) / 1e3;
+        return metrics;
+    }
+
+    void resetMetrics() noexcept {
+        processed_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        errors_.store(0, std::memory_order_relaxed);
+        total_wait_ns_.store(0, std::memory_order_relaxed);
+        total_service_ns_.store(0, std::memory_order_relaxed);
+        max_wait_ns_.store(0, std::memory_order_relaxed);
+        max_service_ns_.store(0, std::memory_order_relaxed);
+        max_depth_.store(queue_.size(), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool isRunning() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const Config& config() const noexcept {
+        return config_;
+    }
+
+  private:
+    static constexpr std::chrono::milliseconds kWaitSlice{1};
+
+    bool pushUnderPressure(T& item, Clock::time_point submitted) {
+        switch (config_.policy) {
+            case BackpressurePolicy::DropNewest:
+                return false;
+
+            case BackpressurePolicy::DropOldest: {
+                T evicted{};
+                while (!queue_.tryPush(item, submitted)) {
+                    if (queue_.tryPop(evicted)) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                return true;
+            }
+
+            case BackpressurePolicy::Block:
+                break;
+        }
+
+        const auto deadline = submitted + config_.blockTimeout;
+        blocked_producers_.fetch_add(1, std::memory_order_seq_cst);
+        bool accepted = false;
+        {
+            std::unique_lock<std::mutex> lock(space_mutex_);
+            while (!(accepted = queue_.tryPush(item, submitted))) {
+                const auto now = Clock::now();
+                if (now >= deadline || !running_.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                space_cv_.wait_until(lock, std::min(deadline, now + kWaitSlice));
+            }
+        }
+        blocked_producers_.fetch_sub(1, std::memory_order_relaxed);
+        return accepted;
+    }
+
+    void workerLoop() {
+        T item{};
+        Clock::time_point submitted;
+        while (true) {
+            if (queue_.tryPop(item, &submitted)) {
+                if (blocked_producers_.load(std::memory_order_seq_cst) > 0) {
+                    space_cv_.notify_one();
+                }
+                runHandler(item, submitted);
+                continue;
+            }
+            if (!running_.load(std::memory_order_acquire)) {
+                break;  // Stopped and drained
+            }
+
+            idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(data_mutex_);
+                if (queue_.size() == 0 && running_.load(std::memory_order_relaxed)) {
+                    data_cv_.wait_for(lock, kWaitSlice);
+                }
+            }
+            idle_workers_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void runHandler(T& item, Clock::time_point submitted) {
+        const auto started = Clock::now();
+        bool ok = true;
+        try {
+            handler_(item);
+        } catch (...) {
+            ok = false;
+        }
+        const auto finished = Clock::now();
+
+        const int64_t wait_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(started - submitted).count();
+        const int64_t service_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(finished - started).count();
+        total_wait_ns_.fetch_add(wait_ns, std::memory_order_relaxed);
+        total_service_ns_.fetch_add(service_ns, std::memory_order_relaxed);
+        updateMax(max_wait_ns_, wait_ns);
+        updateMax(max_service_ns_, service_ns);
+        (ok ? processed_ : errors_).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void wakeWorkers() {
+        std::lock_guard<std::mutex> lock(data_mutex_);
+        data_cv_.notify_all();
+    }
+
+    template <typename V>
+    static void updateMax(std::atomic<V>& target, V value) noexcept {
+        V current = target.load(std::memory_order_relaxed);
+        while (value > current
+               && !target.compare_exchange_weak(
+                   current, value, std::memory_order_relaxed, std::memory_order_relaxed)) {
+        }
+    }
+
+    Config config_;
+    Handler handler_;
+    StageQueue<T> queue_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{false};
+
+    // Sleep/wake for idle workers and blocked producers
+    alignas(64) std::atomic<size_t> idle_workers_{0};
+    alignas(64) std::atomic<size_t> blocked_producers_{0};
+    alignas(64) std::atomic<size_t> active_submits_{0};
+    std::mutex data_mutex_;
+    std::condition_variable data_cv_;
+    std::mutex space_mutex_;
+    std::condition_variable space_cv_;
+
+    // Metrics
+    alignas(64) std::atomic<uint64_t> processed_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> errors_{0};
+    std::atomic<int64_t> total_wait_ns_{0};
+    std::atomic<int64_t> total_service_ns_{0};
+    std::atomic<int64_t> max_wait_ns_{0};
+    std::atomic<int64_t> max_service_ns_{0};
+    std::atomic<size_t> max_depth_{0};
+};
+
+}  // namespace huntmaster
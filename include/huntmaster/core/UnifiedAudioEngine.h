@@ -124,6 +124,7 @@ struct VADConfig {
     float pre_buffer = 0.1f;          ///< Pre-buffer duration for voice start (seconds)
     float post_buffer = 0.2f;         ///< Post-buffer duration for voice end (seconds)
     bool enabled = true;              ///< Whether VAD processing is enabled
+    bool spectral_mode = false;       ///< Gate MFCC frames with the noise-adaptive spectral VAD
 };
 
 /**
@@ -334,6 +335,35 @@ class UnifiedAudioEngine {
      */
     [[nodiscard]] Result<std::string> getCurrentMasterCall(SessionId sessionId) const;
 
+    /**
+     * @brief Serve master calls from a packed library file
+     *
+     * The library is memory-mapped read-only and shared by all sessions, so
+     * loadMasterCall() becomes an index lookup instead of a file open and
+     * parse. Calls missing from the library, or extracted with a different
+     * MFCC configuration than the session uses, fall back to loose files.
+     *
+     * @param libraryPath Library built by `process_master_calls --pack`, or
+     *                    empty to stop using a library
+     * @return Status::OK on success, FILE_NOT_FOUND if the file is missing,
+     *         INVALID_PARAMS if it is not a valid library
+     */
+    [[nodiscard]] Status setMasterCallLibrary(std::string_view libraryPath);
+
+    /**
+     * @brief Set where loose master calls and their feature caches live
+     *
+     * loadMasterCall() and playMasterCall() read `<audioDir>/<id>.wav`, and
+     * extracted features are cached as `<featuresDir>/<id>.mfc`. Sessions
+     * loading a call while the directories change use either the old or the
+     * new pair.
+     *
+     * @return Status::OK on success, INVALID_PARAMS for an empty path,
+     *         FILE_NOT_FOUND if either directory does not exist
+     */
+    [[nodiscard]] Status setMasterCallDirectories(std::string_view audioDir,
+                                                  std::string_view featuresDir);
+
     // === Audio Processing ===
 
     /**
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <span>
 #include <variant>
@@ -57,6 +58,27 @@ struct VADResult {
     std::chrono::milliseconds duration{0};
 };
 
+/**
+ * @struct VADChunkResult
+ * @brief Result of batch voice activity detection over a whole chunk
+ *
+ * Active windows are coalesced into contiguous spans that point into the
+ * caller's chunk, so they stay valid only as long as that audio does.
+ */
+struct VADChunkResult {
+    /** @brief Contiguous active regions of the input chunk, in order */
+    std::vector<std::span<const float>> active_spans;
+
+    /** @brief Number of complete windows analyzed */
+    size_t windows_processed{0};
+
+    /** @brief Samples covered by the analyzed windows (any partial tail is not consumed) */
+    size_t samples_consumed{0};
+
+    /** @brief Activity state after the last window */
+    bool is_active{false};
+};
+
 /**
  * @class VoiceActivityDetector
  * @brief Voice Activity Detection optimized for wildlife call analysis
@@ -72,6 +94,7 @@ struct VADResult {
  * - Pre and post buffering for complete call capture
  * - Real-time processing with minimal latency
  * - Robust handling of background noise
+ * - Noise-adaptive spectral mode driven by shared FFT frames (see processSpectrum())
  *
  * @example
  * @code
@@ -126,6 +149,24 @@ class VoiceActivityDetector {
 
         /** @brief Audio sample rate in Hz */
         size_t sample_rate{44100};
+
+        /** @brief Lowest frequency included in spectral band analysis (Hz) */
+        float spectral_min_frequency{100.0f};
+
+        /** @brief Highest frequency included in spectral band analysis (Hz) */
+        float spectral_max_frequency{8000.0f};
+
+        /** @brief Mean band SNR over the tracked noise floor required for activity (dB) */
+        float spectral_snr_threshold_db{6.0f};
+
+        /** @brief Spectral flatness above which marginal-SNR frames count as noise [0.0, 1.0] */
+        float spectral_flatness_threshold{0.5f};
+
+        /** @brief Search window of the minimum-statistics noise floor tracker */
+        std::chrono::milliseconds noise_floor_window{1500};
+
+        /** @brief Samples between consecutive spectra passed to processSpectrum() */
+        size_t spectral_hop_size{256};
     };
 
     /**
@@ -191,6 +232,47 @@ class VoiceActivityDetector {
     [[nodiscard]] huntmaster::expected<VADResult, VADError>
     processWindow(std::span<const float> audio);
 
+    /**
+     * @brief Process a whole chunk of audio as consecutive fixed-size windows
+     *
+     * Equivalent to calling processWindow() on each complete window of the chunk,
+     * but computes all window energies in a single vectorized pass and runs the
+     * state machine over them without per-window result objects.
+     *
+     * @param audio Audio samples to analyze (normalized float values)
+     * @param window_size Samples per analysis window
+     * @return Active spans of the chunk, or VADError on failure
+     *
+     * @note A trailing partial window is not analyzed; see samples_consumed
+     */
+    [[nodiscard]] huntmaster::expected<VADChunkResult, VADError>
+    processChunk(std::span<const float> audio, size_t window_size);
+
+    /**
+     * @brief Process one frame's power spectrum with the noise-adaptive spectral detector
+     *
+     * Intended to be fed the spectra that feature extraction already computes (see
+     * MFCCProcessor::SpectrumGate), so no additional FFT pass is needed. The power is
+     * split into log-spaced bands between spectral_min_frequency and
+     * spectral_max_frequency, and a per-band noise floor is tracked with minimum
+     * statistics over noise_floor_window. A frame is a candidate when its mean band SNR
+     * exceeds spectral_snr_threshold_db and it is not noise-like (spectral flatness at
+     * or below spectral_flatness_threshold), or when its SNR is twice the threshold.
+     * Candidates drive the same temporal state machine as processWindow().
+     *
+     * @param power_spectrum One-sided power spectrum (FFT size / 2 + 1 bins)
+     * @return VADResult with energy_level set to the band power scaled by 1/N^2,
+     *         or VADError on failure
+     *
+     * @note Each call advances time by spectral_hop_size samples, so durations stay exact
+     *       when the hop is not a whole number of milliseconds
+     * @note The noise floor starts from the first frames, so the detector needs about
+     *       one noise_floor_window of audio before a call that begins immediately
+     *       is separated from the background
+     */
+    [[nodiscard]] huntmaster::expected<VADResult, VADError>
+    processSpectrum(std::span<const float> power_spectrum);
+
     /**
      * @brief Reset the VAD state to initial conditions
      *
@@ -22,6 +22,7 @@ namespace huntmaster {
  * - Configurable downsampling ratios for different zoom levels
  * - Peak-hold and RMS envelope generation
  * - Circular buffer for continuous waveform display
+ * - Min/max/RMS pyramid over the whole recording for arbitrary zoom queries
  * - JSON export for cross-platform compatibility
  * - Memory-efficient processing for real-time performance
  */
@@ -29,19 +30,21 @@ class WaveformGenerator {
   public:
     /// Configuration parameters for waveform generation
     struct Config {
-        float sampleRate = 44100.0f;   ///< Audio sample rate in Hz
-        size_t maxSamples = 8192;      ///< Maximum samples to store (buffer size)
-        size_t downsampleRatio = 32;   ///< Downsampling ratio (samples per pixel)
-        float updateRateMs = 50.0f;    ///< Update rate in milliseconds
-        bool enablePeakHold = true;    ///< Enable peak-hold envelope generation
-        bool enableRmsOverlay = true;  ///< Enable RMS envelope generation
-        float rmsWindowMs = 10.0f;     ///< RMS calculation window in milliseconds
-        bool normalizeOutput = true;   ///< Normalize output to [-1.0, 1.0] range
+        float sampleRate = 44100.0f;     ///< Audio sample rate in Hz
+        size_t maxSamples = 8192;        ///< Maximum samples to store (buffer size)
+        size_t downsampleRatio = 32;     ///< Downsampling ratio (samples per pixel)
+        float updateRateMs = 50.0f;      ///< Update rate in milliseconds
+        bool enablePeakHold = true;      ///< Enable peak-hold envelope generation
+        bool enableRmsOverlay = true;    ///< Enable RMS envelope generation
+        float rmsWindowMs = 10.0f;       ///< RMS calculation window in milliseconds
+        bool normalizeOutput = true;     ///< Normalize output to [-1.0, 1.0] range
+        bool enableOverview = true;      ///< Maintain the min/max/RMS overview pyramid
+        size_t overviewBlockSize = 256;  ///< Samples per finest overview block
 
         /// Validate configuration parameters
         [[nodiscard]] bool isValid() const noexcept {
             return sampleRate > 0.0f && maxSamples > 0 && downsampleRatio > 0 && updateRateMs > 0.0f
-                   && rmsWindowMs > 0.0f;
+                   && rmsWindowMs > 0.0f && overviewBlockSize > 0;
         }
     };
 
@@ -58,6 +61,16 @@ class WaveformGenerator {
         WaveformData() : timestamp(std::chrono::steady_clock::now()) {}
     };
 
+    /// Min/max/RMS columns for a pixel-width view of the recording
+    struct WaveformOverview {
+        std::vector<float> minimums;   ///< Minimum sample value per column
+        std::vector<float> maximums;   ///< Maximum sample value per column
+        std::vector<float> rms;        ///< RMS level per column
+        size_t startSample = 0;        ///< First sample covered by the view
+        size_t endSample = 0;          ///< One past the last sample covered by the view
+        double samplesPerPixel = 0.0;  ///< Samples represented by each column
+    };
+
     /// Error types for WaveformGenerator
     enum class Error {
         INVALID_CONFIG,         ///< Invalid configuration parameters
@@ -65,10 +78,12 @@ class WaveformGenerator {
         BUFFER_OVERFLOW,        ///< Buffer capacity exceeded
         INSUFFICIENT_DATA,      ///< Not enough data for processing
         INITIALIZATION_FAILED,  ///< Generator initialization failed
+        INVALID_RANGE,          ///< Requested range lies outside the recorded data
         INTERNAL_ERROR          ///< Internal processing error
     };
 
     using Result = huntmaster::expected<WaveformData, Error>;
+    using OverviewResult = huntmaster::expected<WaveformOverview, Error>;
 
     /**
      * @brief Default constructor.
@@ -123,6 +138,31 @@ class WaveformGenerator {
      */
     [[nodiscard]] WaveformData getWaveformRange(float startTimeMs, float durationMs) const;
 
+    /**
+     * @brief Get min/max/RMS columns for any time range of the recording
+     *
+     * Answered from the overview pyramid, which covers every sample processed since
+     * the last reset independent of maxSamples and the current zoom level. Each column
+     * is assembled from O(log n) pyramid nodes, so the cost is O(pixelWidth * log n).
+     * Column boundaries are resolved to overviewBlockSize samples; a column never
+     * misses a peak inside its range.
+     *
+     * @param startTimeMs Start time in milliseconds from the start of the recording
+     * @param durationMs Duration in milliseconds (clipped to the recorded length)
+     * @param pixelWidth Number of columns to produce
+     * @return Overview columns or error
+     */
+    [[nodiscard]] OverviewResult getOverview(float startTimeMs,
+                                             float durationMs,
+                                             size_t pixelWidth) const noexcept;
+
+    /**
+     * @brief Get the number of levels currently held in the overview pyramid
+     *
+     * @return Level count (0 until the first overview block completes)
+     */
+    [[nodiscard]] size_t getOverviewLevelCount() const noexcept;
+
     /**
      * @brief Export current waveform data as JSON string
      *
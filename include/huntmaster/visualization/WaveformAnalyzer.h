@@ -37,6 +37,7 @@ namespace huntmaster {
 // Constants
 constexpr int MAX_ZOOM_LEVELS = 16;
 constexpr size_t DEFAULT_SAMPLES_PER_LEVEL = 4096;
+constexpr size_t DEFAULT_OVERVIEW_CACHE_MIN_SAMPLES_PER_PIXEL = 256;
 
 // Enumerations
 enum class WindowFunction { HANN, HAMMING, BLACKMAN };
@@ -175,6 +176,46 @@ class WaveformAnalyzer {
      */
     WaveformData getWaveformData(float start_time, float end_time, int target_width) const;
 
+    /**
+     * @brief Write the multi-resolution overview to a sidecar cache file
+     *
+     * Levels finer than min_samples_per_pixel are omitted to keep the file compact;
+     * queries for finer zoom are served from the finest stored level.
+     *
+     * @param cache_path Destination file (see getOverviewCachePath())
+     * @param min_samples_per_pixel Finest level resolution to store
+     * @return true if the file was written, false otherwise
+     */
+    bool saveOverviewCache(const std::string& cache_path,
+                           size_t min_samples_per_pixel =
+                               DEFAULT_OVERVIEW_CACHE_MIN_SAMPLES_PER_PIXEL) const;
+
+    /**
+     * @brief Memory-map a sidecar cache file and serve waveform queries from it
+     *
+     * Replaces any generated overview. The audio itself is not read; the mapping
+     * stays active until the next load, generateWaveformData() or destruction.
+     *
+     * @param cache_path Cache file written by saveOverviewCache()
+     * @return true if the cache was mapped and validated, false otherwise
+     */
+    bool loadOverviewCache(const std::string& cache_path);
+
+    /**
+     * @brief Check whether waveform queries are served from a mapped cache
+     * @return true if a cache file is mapped, false otherwise
+     */
+    bool hasMappedOverview() const {
+        return mapped_overview_ != nullptr;
+    }
+
+    /**
+     * @brief Get the conventional sidecar cache path for an audio file
+     * @param audio_path Path of the audio file
+     * @return Path of the overview cache next to the audio file
+     */
+    static std::string getOverviewCachePath(const std::string& audio_path);
+
     /**
      * @brief Analyze frequency spectrum of audio segment
      * @param audio_buffer Input audio buffer
@@ -275,8 +316,15 @@ class WaveformAnalyzer {
 
     // Waveform generation methods
     bool generateWaveformLevel(const AudioBuffer& audio_buffer, int level);
+    void reduceWaveformLevel(int level, size_t frame_count);
     int selectOptimalLevel(float start, float end, int width) const;
 
+    // Overview cache methods
+    struct LevelView;
+    struct MappedOverview;
+    LevelView getLevelView(int level) const;
+    void releaseMappedOverview();
+
     // Spectrum analysis methods
     void findSpectralPeaks(SpectrumData& spectrum_data);
     void calculateSpectralFeatures(SpectrumData& data);
@@ -349,6 +397,10 @@ class WaveformAnalyzer {
     // Audio data
     std::unique_ptr<AudioBuffer> original_audio_;
     float audio_duration_;
+    size_t frame_count_ = 0;
+
+    // Memory-mapped overview cache (null when serving generated levels)
+    std::unique_ptr<MappedOverview> mapped_overview_;
 };
 
 }  // namespace huntmaster
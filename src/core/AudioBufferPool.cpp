@@ -3,8 +3,13 @@
 
 #include <algorithm>
 #include <bit>
+#include <condition_variable>
 #include <cstring>
+#include <limits>
+#include <mutex>
 #include <new>
+#include <stdexcept>
+#include <thread>
 #include <utility>  // For std::exchange
 
 #ifdef __EMSCRIPTEN__
@@ -12,50 +17,145 @@
 #endif
 
 namespace huntmaster {
+
+namespace {
+
+constexpr uint32_t kNilIndex = std::numeric_limits<uint32_t>::max();
+constexpr size_t kMaxSizeClasses = 8;
+constexpr size_t kMaxThreadCaches = 32;   // Threads per pool that get a private magazine
+constexpr size_t kMaxMagazineSize = 16;   // Buffers per magazine and size class
+constexpr size_t kMagazineDivisor = 16;   // A magazine holds at most 1/16 of its class
+constexpr size_t kMaxThreadBindings = 8;  // Pools a thread keeps magazines for at once
+constexpr size_t kNoCache = std::numeric_limits<size_t>::max();
+
+std::atomic<uint64_t> g_next_pool_id{1};
+
+// Tagged free-list head: buffer index in the low half, ABA tag in the high half
+constexpr uint64_t packHead(uint32_t index, uint32_t tag) {
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+constexpr uint32_t headIndex(uint64_t head) {
+    return static_cast<uint32_t>(head);
+}
+constexpr uint32_t headTag(uint64_t head) {
+    return static_cast<uint32_t>(head >> 32);
+}
+
+bool validateConfig(const AudioBufferPool::Config& config) {
+    if (config.pool_size == 0 || config.buffer_size == 0) {
+        return false;
+    }
+    if (config.size_classes.size() >= kMaxSizeClasses) {
+        return false;
+    }
+    if (std::find(config.size_classes.begin(), config.size_classes.end(), size_t{0})
+        != config.size_classes.end()) {
+        return false;
+    }
+    const size_t max_buffers = (config.size_classes.size() + 1) * config.pool_size;
+    return config.pool_size <= kNilIndex && max_buffers < kNilIndex;
+}
+
+}  // namespace
+
 /**
  * @class AudioBufferPool::Impl
  * @brief Private implementation of the buffer pool
+ *
+ * Buffers are numbered 0..N-1; buffer i belongs to size class i / pool_size.
+ * Each class has its own lock-free stack threaded through next_.
  */
 class AudioBufferPool::Impl {
   public:
+    /// One size class: its buffer size and the tagged head of its free list
+    struct alignas(64) SizeClass {
+        size_t buffer_size{0};
+        size_t magazine_size{0};
+        std::atomic<uint64_t> head{packHead(kNilIndex, 0)};
+    };
+
+    /**
+     * Per-thread magazine. The owner is the only thread that parks buffers in it;
+     * other threads take them back out when their class runs dry. count/items are
+     * guarded by `locked`, which is uncontended except while someone is stealing.
+     */
+    struct alignas(64) ThreadCache {
+        std::atomic<bool> claimed{false};
+        std::atomic<bool> locked{false};
+        std::array<uint32_t, kMaxSizeClasses> count{};
+        std::array<std::array<uint32_t, kMaxMagazineSize>, kMaxSizeClasses> items{};
+        std::atomic<uint64_t> attempts{0};
+        std::atomic<uint64_t> acquired{0};
+        std::atomic<uint64_t> released{0};
+    };
+
+    /// Thread-local map from pool id to the magazine the thread owns in that pool
+    struct ThreadBindings {
+        struct Entry {
+            uint64_t pool_id{0};
+            Impl* pool{nullptr};
+            size_t cache{kNoCache};
+        };
+        std::array<Entry, kMaxThreadBindings> entries{};
+        size_t next_victim{0};
+
+        ~ThreadBindings() {
+            // Hand parked buffers back to pools that are still alive
+            std::lock_guard<std::mutex> lock(registryMutex());
+            for (auto& entry : entries) {
+                if (entry.pool_id != 0 && isRegistered(entry.pool_id)) {
+                    entry.pool->retireCache(entry.cache);
+                }
+            }
+        }
+    };
+
     Config config_;
+    uint64_t id_;
 
     // Memory management
     std::pmr::memory_resource* memory_resource_;
     std::vector<void*> buffers_;
-    // CRITICAL FIX: std::vector<bool> is not thread-safe for element-wise
-    // atomic operations. Use a vector of true atomic booleans instead.
-    std::vector<std::atomic<bool>> in_use_;
-
-    // Synchronization using C++20 counting semaphore
-    std::counting_semaphore<> available_semaphore_;
-
-    // Statistics tracking with atomics
-    std::atomic<size_t> total_allocations_{0};
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    size_t class_count_{0};
+    size_t default_class_{0};
+    std::unique_ptr<SizeClass[]> classes_;
+    std::unique_ptr<ThreadCache[]> caches_;
+
+    // Slow-path waiting when a class is empty
+    std::atomic<size_t> waiters_{0};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+
+    // Statistics for threads without a magazine and for retired magazines
+    std::atomic<uint64_t> shared_attempts_{0};
+    std::atomic<uint64_t> shared_acquired_{0};
+    std::atomic<uint64_t> shared_released_{0};
     std::atomic<size_t> failed_allocations_{0};
+    std::atomic<uint64_t> attempts_baseline_{0};
+
+    // Buffers taken off the shared free lists (held or parked in magazines)
+    std::atomic<int64_t> checked_out_{0};
     std::atomic<size_t> peak_usage_{0};
-    std::atomic<size_t> current_usage_{0};
 
     // Memory tracking
     std::atomic<size_t> total_memory_allocated_{0};
 
+    static thread_local ThreadBindings bindings_;
+
 // Error state for WASM builds
 #ifdef __EMSCRIPTEN__
     bool initialization_failed_{false};
 #endif
 
     explicit Impl(const Config& config)
-        : config_(config),
+        : config_(config), id_(g_next_pool_id.fetch_add(1, std::memory_order_relaxed)),
           memory_resource_(config.memory_resource ? config.memory_resource
-                                                  : std::pmr::get_default_resource()),
-          buffers_(config.pool_size, nullptr),
-          // Initialize a vector of atomic<bool>. They are default-initialized to false.
-          in_use_(config.pool_size),
-          available_semaphore_(static_cast<std::ptrdiff_t>(config.pool_size)) {
+                                                  : std::pmr::get_default_resource()) {
 // Validation moved to factory method for WASM
 #ifndef __EMSCRIPTEN__
         // Validate configuration
-        if (config.pool_size == 0 || config.buffer_size == 0) {
+        if (!validateConfig(config)) {
             throw std::invalid_argument("Invalid pool configuration");
         }
 
@@ -65,22 +165,69 @@ class AudioBufferPool::Impl {
         }
 #endif
 
+        // Size classes in ascending order; the configured buffer_size is the default class
+        std::vector<size_t> sizes = config.size_classes;
+        sizes.push_back(config.buffer_size);
+        std::sort(sizes.begin(), sizes.end());
+        sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+        class_count_ = sizes.size();
+        default_class_ = static_cast<size_t>(
+            std::find(sizes.begin(), sizes.end(), config.buffer_size) - sizes.begin());
+        classes_ = std::make_unique<SizeClass[]>(class_count_);
+        const size_t magazine_size =
+            std::min(kMaxMagazineSize, config.pool_size / kMagazineDivisor);
+        for (size_t c = 0; c < class_count_; ++c) {
+            classes_[c].buffer_size = sizes[c];
+            classes_[c].magazine_size = magazine_size;
+        }
+
+        const size_t total = class_count_ * config.pool_size;
+        buffers_.assign(total, nullptr);
+        next_ = std::make_unique<std::atomic<uint32_t>[]>(total);
+        caches_ = std::make_unique<ThreadCache[]>(kMaxThreadCaches);
+
         // Allocate all buffers upfront
         allocateBuffers();
+
+        // Thread every buffer onto its class free list, lowest index on top
+        for (size_t i = total; i-- > 0;) {
+            pushFree(static_cast<uint32_t>(i));
+        }
+        checked_out_.store(0, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(this);
     }
 
     ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            auto& pools = registry();
+            pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+        }
         deallocateBuffers();
     }
 
+    size_t classOf(size_t index) const noexcept {
+        return index / config_.pool_size;
+    }
+
+    size_t bufferBytes(size_t index) const noexcept {
+        return classes_[classOf(index)].buffer_size;
+    }
+
+    size_t totalBuffers() const noexcept {
+        return buffers_.size();
+    }
+
     /**
      * @brief Allocate all buffers in the pool
      */
     void allocateBuffers() {
-        // Calculate aligned buffer size
-        const size_t aligned_size = alignUp(config_.buffer_size, config_.alignment);
-
-        for (size_t i = 0; i < config_.pool_size; ++i) {
+        for (size_t i = 0; i < buffers_.size(); ++i) {
+            // Calculate aligned buffer size
+            const size_t aligned_size = alignUp(bufferBytes(i), config_.alignment);
 #ifdef __EMSCRIPTEN__
             // Direct allocation without exceptions for WASM
             void* buffer = memory_resource_->allocate(aligned_size, config_.alignment);
@@ -125,10 +272,9 @@ class AudioBufferPool::Impl {
      * @brief Deallocate all buffers in the pool
      */
     void deallocateBuffers() {
-        const size_t aligned_size = alignUp(config_.buffer_size, config_.alignment);
-
         for (size_t i = 0; i < buffers_.size(); ++i) {
             if (buffers_[i]) {
+                const size_t aligned_size = alignUp(bufferBytes(i), config_.alignment);
                 memory_resource_->deallocate(buffers_[i], aligned_size, config_.alignment);
                 buffers_[i] = nullptr;
             }
@@ -138,31 +284,176 @@ class AudioBufferPool::Impl {
     }
 
     /**
-     * @brief Find the next available buffer
-     * @return Buffer index or nullopt if none available
+     * @brief Push a buffer onto its class free list
      */
-    [[nodiscard]] std::optional<size_t> findAvailableBuffer() {
-        // Simple linear search - could be optimized with bitset
-        for (size_t i = 0; i < in_use_.size(); ++i) {
-            bool expected = false;
-            if (in_use_[i].compare_exchange_strong(
-                    expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
-                return i;
+    void pushFree(uint32_t index) noexcept {
+        SizeClass& size_class = classes_[classOf(index)];
+        uint64_t head = size_class.head.load(std::memory_order_relaxed);
+        do {
+            next_[index].store(headIndex(head), std::memory_order_relaxed);
+        } while (!size_class.head.compare_exchange_weak(head,
+                                                        packHead(index, headTag(head) + 1),
+                                                        std::memory_order_seq_cst,
+                                                        std::memory_order_relaxed));
+        checked_out_.fetch_sub(1, std::memory_order_relaxed);
+
+        // Dekker pairing with waitForBuffer(): the push above is seq_cst
+        if (waiters_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(wait_mutex_);
+            wait_cv_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Pop a buffer from a class free list
+     * @return Buffer index or kNilIndex if the class is empty
+     */
+    [[nodiscard]] uint32_t popFree(size_t class_index) noexcept {
+        SizeClass& size_class = classes_[class_index];
+        uint64_t head = size_class.head.load(std::memory_order_seq_cst);
+        while (headIndex(head) != kNilIndex) {
+            // A stale next_ read is harmless: the tag makes the CAS fail
+            const uint32_t next = next_[headIndex(head)].load(std::memory_order_relaxed);
+            if (size_class.head.compare_exchange_weak(head,
+                                                      packHead(next, headTag(head) + 1),
+                                                      std::memory_order_acquire,
+                                                      std::memory_order_acquire)) {
+                const int64_t out = checked_out_.fetch_add(1, std::memory_order_relaxed) + 1;
+                updatePeak(static_cast<size_t>(std::max<int64_t>(out, 0)));
+                return headIndex(head);
+            }
+        }
+        return kNilIndex;
+    }
+
+    void updatePeak(size_t current) noexcept {
+        size_t peak = peak_usage_.load(std::memory_order_relaxed);
+        while (current > peak) {
+            if (peak_usage_.compare_exchange_weak(
+                    peak, current, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                break;
             }
         }
-        return std::nullopt;
     }
 
     /**
-     * @brief Mark a buffer as available
+     * @brief Block until a buffer of the class is released or the timeout expires
+     */
+    [[nodiscard]] uint32_t waitForBuffer(size_t class_index, std::chrono::milliseconds timeout) {
+        if (timeout.count() <= 0) {
+            return kNilIndex;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        // Once waiters_ is raised, releases bypass magazines and notify (see markAvailable)
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+
+        uint32_t index = kNilIndex;
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        while (true) {
+            index = popFree(class_index);
+            if (index == kNilIndex) {
+                index = stealFromMagazines(class_index);
+            }
+            if (index != kNilIndex
+                || wait_cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                break;
+            }
+        }
+        if (index == kNilIndex) {
+            index = popFree(class_index);
+        }
+        lock.unlock();
+
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    /**
+     * @brief Acquire a buffer of the given class
+     */
+    huntmaster::expected<uint32_t, BufferPoolError>
+    acquireIndex(size_t class_index, std::chrono::milliseconds timeout) {
+        ThreadCache* cache = localCache();
+        bumpLocal(cache, &ThreadCache::attempts, shared_attempts_);
+
+        uint32_t index = kNilIndex;
+        if (cache) {
+            lockCache(*cache);
+            if (cache->count[class_index] > 0) {
+                index = cache->items[class_index][--cache->count[class_index]];
+            }
+            unlockCache(*cache);
+        }
+        if (index == kNilIndex) {
+            index = popFree(class_index);
+        }
+        if (index == kNilIndex) {
+            index = stealFromMagazines(class_index);
+        }
+        if (index == kNilIndex) {
+            index = waitForBuffer(class_index, timeout);
+        }
+
+        if (index == kNilIndex) {
+            failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+            return huntmaster::unexpected(BufferPoolError::POOL_EXHAUSTED);
+        }
+
+        bumpLocal(cache, &ThreadCache::acquired, shared_acquired_);
+        return index;
+    }
+
+    /**
+     * @brief Return a buffer: into this thread's magazine if it has room
      * @param index Buffer index to release
      */
     void markAvailable(size_t index) {
-        if (index < in_use_.size()) {
-            in_use_[index].store(false, std::memory_order_release);
-            current_usage_.fetch_sub(1, std::memory_order_relaxed);
-            available_semaphore_.release();
+        if (index >= buffers_.size()) {
+            return;
         }
+
+        ThreadCache* cache = localCache();
+        bumpLocal(cache, &ThreadCache::released, shared_released_);
+
+        const size_t class_index = classOf(index);
+        if (cache) {
+            // Reading waiters_ under the magazine lock pairs with waitForBuffer(): either
+            // the waiter's scan sees the parked buffer, or this sees the waiter
+            lockCache(*cache);
+            const bool park = cache->count[class_index] < classes_[class_index].magazine_size
+                              && waiters_.load(std::memory_order_seq_cst) == 0;
+            if (park) {
+                cache->items[class_index][cache->count[class_index]++] =
+                    static_cast<uint32_t>(index);
+            }
+            unlockCache(*cache);
+            if (park) {
+                return;
+            }
+        }
+        pushFree(static_cast<uint32_t>(index));
+    }
+
+    /**
+     * @brief Buffers currently held by callers (magazine contents count as free)
+     */
+    size_t inUse() const noexcept {
+        uint64_t acquired = shared_acquired_.load(std::memory_order_relaxed);
+        uint64_t released = shared_released_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kMaxThreadCaches; ++i) {
+            acquired += caches_[i].acquired.load(std::memory_order_relaxed);
+            released += caches_[i].released.load(std::memory_order_relaxed);
+        }
+        return acquired > released ? static_cast<size_t>(acquired - released) : 0;
+    }
+
+    uint64_t totalAttempts() const noexcept {
+        uint64_t attempts = shared_attempts_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kMaxThreadCaches; ++i) {
+            attempts += caches_[i].attempts.load(std::memory_order_relaxed);
+        }
+        return attempts;
     }
 
     /**
@@ -171,13 +462,155 @@ class AudioBufferPool::Impl {
     static constexpr size_t alignUp(size_t size, size_t alignment) {
         return (size + alignment - 1) & ~(alignment - 1);
     }
+
+  private:
+    static void lockCache(ThreadCache& cache) noexcept {
+        while (cache.locked.exchange(true, std::memory_order_seq_cst)) {
+            while (cache.locked.load(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static void unlockCache(ThreadCache& cache) noexcept {
+        cache.locked.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Take a buffer of the class parked in any thread's magazine
+     *
+     * Producer/consumer threads release on one thread and acquire on another, so
+     * the releasing thread's magazine must stay reachable from the acquiring one.
+     */
+    [[nodiscard]] uint32_t stealFromMagazines(size_t class_index) noexcept {
+        if (classes_[class_index].magazine_size == 0) {
+            return kNilIndex;
+        }
+        for (size_t i = 0; i < kMaxThreadCaches; ++i) {
+            ThreadCache& cache = caches_[i];
+            if (!cache.claimed.load(std::memory_order_acquire)) {
+                continue;
+            }
+            lockCache(cache);
+            uint32_t index = kNilIndex;
+            if (cache.count[class_index] > 0) {
+                index = cache.items[class_index][--cache.count[class_index]];
+            }
+            unlockCache(cache);
+            if (index != kNilIndex) {
+                return index;
+            }
+        }
+        return kNilIndex;
+    }
+
+    // Single-writer counter: a plain load/store on the owner's line, no locked RMW
+    static void bumpLocal(ThreadCache* cache,
+                          std::atomic<uint64_t> ThreadCache::*counter,
+                          std::atomic<uint64_t>& shared) noexcept {
+        if (cache) {
+            auto& value = cache->*counter;
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            shared.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    ThreadCache* localCache() noexcept {
+        for (auto& entry : bindings_.entries) {
+            if (entry.pool_id == id_) {
+                return entry.cache == kNoCache ? nullptr : &caches_[entry.cache];
+            }
+        }
+        return bindThread();
+    }
+
+    ThreadCache* bindThread() noexcept {
+        std::lock_guard<std::mutex> lock(registryMutex());
+
+        // Reuse an empty or dead entry; otherwise evict one round-robin
+        ThreadBindings::Entry* slot = nullptr;
+        for (auto& entry : bindings_.entries) {
+            if (entry.pool_id == 0 || !isRegistered(entry.pool_id)) {
+                slot = &entry;
+                break;
+            }
+        }
+        if (!slot) {
+            slot = &bindings_.entries[bindings_.next_victim];
+            bindings_.next_victim = (bindings_.next_victim + 1) % kMaxThreadBindings;
+            slot->pool->retireCache(slot->cache);
+        }
+
+        size_t cache_index = kNoCache;
+        for (size_t i = 0; i < kMaxThreadCaches; ++i) {
+            bool expected = false;
+            if (caches_[i].claimed.compare_exchange_strong(expected, true)) {
+                cache_index = i;
+                break;
+            }
+        }
+
+        *slot = {id_, this, cache_index};
+        return cache_index == kNoCache ? nullptr : &caches_[cache_index];
+    }
+
+    /**
+     * @brief Drain a magazine back to the free lists and release its slot
+     */
+    void retireCache(size_t cache_index) noexcept {
+        if (cache_index == kNoCache) {
+            return;
+        }
+        ThreadCache& cache = caches_[cache_index];
+        std::array<uint32_t, kMaxSizeClasses * kMaxMagazineSize> drained;
+        size_t drained_count = 0;
+        lockCache(cache);
+        for (size_t c = 0; c < class_count_; ++c) {
+            while (cache.count[c] > 0) {
+                drained[drained_count++] = cache.items[c][--cache.count[c]];
+            }
+        }
+        unlockCache(cache);
+        for (size_t i = 0; i < drained_count; ++i) {
+            pushFree(drained[i]);
+        }
+
+        // Fold the counters into the shared ones before the slot is reused
+        shared_attempts_.fetch_add(cache.attempts.exchange(0), std::memory_order_relaxed);
+        shared_acquired_.fetch_add(cache.acquired.exchange(0), std::memory_order_relaxed);
+        shared_released_.fetch_add(cache.released.exchange(0), std::memory_order_relaxed);
+        cache.claimed.store(false, std::memory_order_release);
+    }
+
+    static std::mutex& registryMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<Impl*>& registry() {
+        static std::vector<Impl*> pools;
+        return pools;
+    }
+
+    // Caller holds registryMutex()
+    static bool isRegistered(uint64_t pool_id) {
+        for (const Impl* pool : registry()) {
+            if (pool->id_ == pool_id) {
+                return true;
+            }
+        }
+        return false;
+    }
 };
 
+thread_local AudioBufferPool::Impl::ThreadBindings AudioBufferPool::Impl::bindings_;
+
 // Factory method for WASM-compatible creation
 huntmaster::expected<std::unique_ptr<AudioBufferPool>, BufferPoolError>
 AudioBufferPool::create(const Config& config) {
     // Validate configuration before construction
-    if (config.pool_size == 0 || config.buffer_size == 0) {
+    if (!validateConfig(config)) {
 #ifdef __EMSCRIPTEN__
         EM_ASM({ console.error('AudioBufferPool: Invalid pool configuration'); });
 #endif
@@ -244,35 +677,35 @@ AudioBufferPool::BufferHandle::operator=(BufferHandle&& other) noexcept {
 std::span<float> AudioBufferPool::BufferHandle::data() noexcept {
     if (!buffer_)
         return {};
-    return std::span<float>(static_cast<float*>(buffer_),
-                            pool_->pimpl_->config_.buffer_size / sizeof(float));
+    return std::span<float>(static_cast<float*>(buffer_), sizeBytes() / sizeof(float));
 }
 
 std::span<const float> AudioBufferPool::BufferHandle::data() const noexcept {
     if (!buffer_)
         return {};
-    return std::span<const float>(static_cast<const float*>(buffer_),
-                                  pool_->pimpl_->config_.buffer_size / sizeof(float));
+    return std::span<const float>(static_cast<const float*>(buffer_), sizeBytes() / sizeof(float));
 }
 
 std::span<std::byte> AudioBufferPool::BufferHandle::bytes() noexcept {
     if (!buffer_)
         return {};
-    return std::span<std::byte>(static_cast<std::byte*>(buffer_),
-                                pool_->pimpl_->config_.buffer_size);
+    return std::span<std::byte>(static_cast<std::byte*>(buffer_), sizeBytes());
 }
 
 std::span<const std::byte> AudioBufferPool::BufferHandle::bytes() const noexcept {
     if (!buffer_)
         return {};
-    return std::span<const std::byte>(static_cast<const std::byte*>(buffer_),
-                                      pool_->pimpl_->config_.buffer_size);
+    return std::span<const std::byte>(static_cast<const std::byte*>(buffer_), sizeBytes());
 }
 
 size_t AudioBufferPool::BufferHandle::size() const noexcept {
     if (!buffer_ || !pool_)
         return 0;
-    return pool_->pimpl_->config_.buffer_size / sizeof(float);
+    return sizeBytes() / sizeof(float);
+}
+
+size_t AudioBufferPool::BufferHandle::sizeBytes() const noexcept {
+    return pool_->pimpl_->bufferBytes(index_);
 }
 
 float* AudioBufferPool::BufferHandle::begin() noexcept {
@@ -310,40 +743,36 @@ huntmaster::expected<AudioBufferPool::BufferHandle, BufferPoolError> AudioBuffer
 
 huntmaster::expected<AudioBufferPool::BufferHandle, BufferPoolError>
 AudioBufferPool::tryAcquireFor(std::chrono::milliseconds timeout) {
-    // Update statistics
-    pimpl_->total_allocations_.fetch_add(1, std::memory_order_relaxed);
-
-    // Try to acquire with timeout
-    if (!pimpl_->available_semaphore_.try_acquire_for(timeout)) {
-        pimpl_->failed_allocations_.fetch_add(1, std::memory_order_relaxed);
-        return huntmaster::unexpected(BufferPoolError::POOL_EXHAUSTED);
+    auto index = pimpl_->acquireIndex(pimpl_->default_class_, timeout);
+    if (!index) {
+        return huntmaster::unexpected(index.error());
     }
+    return BufferHandle(this, pimpl_->buffers_[*index], *index);
+}
 
-    // Find an available buffer
-    auto index_opt = pimpl_->findAvailableBuffer();
-    if (!index_opt) {
-        // This shouldn't happen if semaphore is working correctly
-        pimpl_->available_semaphore_.release();
+huntmaster::expected<AudioBufferPool::BufferHandle, BufferPoolError>
+AudioBufferPool::acquire(size_t min_bytes) {
+    return tryAcquireFor(min_bytes, pimpl_->config_.acquire_timeout);
+}
+
+huntmaster::expected<AudioBufferPool::BufferHandle, BufferPoolError>
+AudioBufferPool::tryAcquireFor(size_t min_bytes, std::chrono::milliseconds timeout) {
+    // Classes are sorted, so the first fit is the tightest
+    size_t class_index = 0;
+    while (class_index < pimpl_->class_count_
+           && pimpl_->classes_[class_index].buffer_size < min_bytes) {
+        ++class_index;
+    }
+    if (class_index == pimpl_->class_count_) {
         pimpl_->failed_allocations_.fetch_add(1, std::memory_order_relaxed);
-        return huntmaster::unexpected(BufferPoolError::ALLOCATION_FAILED);
+        return huntmaster::unexpected(BufferPoolError::REQUEST_TOO_LARGE);
     }
 
-    size_t index = *index_opt;
-    void* buffer = pimpl_->buffers_[index];
-
-    // Update usage statistics
-    size_t current = pimpl_->current_usage_.fetch_add(1, std::memory_order_relaxed) + 1;
-
-    // Update peak usage if necessary
-    size_t peak = pimpl_->peak_usage_.load(std::memory_order_relaxed);
-    while (current > peak) {
-        if (pimpl_->peak_usage_.compare_exchange_weak(
-                peak, current, std::memory_order_relaxed, std::memory_order_relaxed)) {
-            break;
-        }
+    auto index = pimpl_->acquireIndex(class_index, timeout);
+    if (!index) {
+        return huntmaster::unexpected(index.error());
     }
-
-    return BufferHandle(this, buffer, index);
+    return BufferHandle(this, pimpl_->buffers_[*index], *index);
 }
 
 void AudioBufferPool::release(BufferHandle&& handle) {
@@ -352,24 +781,27 @@ void AudioBufferPool::release(BufferHandle&& handle) {
 }
 
 BufferPoolStats AudioBufferPool::getStats() const noexcept {
+    const uint64_t attempts = pimpl_->totalAttempts();
+    const uint64_t baseline = pimpl_->attempts_baseline_.load(std::memory_order_relaxed);
     return BufferPoolStats{
-        .total_buffers = pimpl_->config_.pool_size,
+        .total_buffers = pimpl_->totalBuffers(),
         .available_buffers = available(),
         .peak_usage = pimpl_->peak_usage_.load(std::memory_order_relaxed),
-        .total_allocations = pimpl_->total_allocations_.load(std::memory_order_relaxed),
+        .total_allocations = static_cast<size_t>(attempts > baseline ? attempts - baseline : 0),
         .failed_allocations = pimpl_->failed_allocations_.load(std::memory_order_relaxed),
         .current_memory_usage = pimpl_->total_memory_allocated_.load(std::memory_order_relaxed)};
 }
 
 size_t AudioBufferPool::available() const noexcept {
-    size_t in_use = pimpl_->current_usage_.load(std::memory_order_relaxed);
-    return pimpl_->config_.pool_size - in_use;
+    return pimpl_->totalBuffers() - std::min(pimpl_->inUse(), pimpl_->totalBuffers());
 }
 
 void AudioBufferPool::resetStats() noexcept {
-    pimpl_->total_allocations_.store(0, std::memory_order_relaxed);
+    // Per-thread counters belong to their threads, so reset by moving the baseline
+    pimpl_->attempts_baseline_.store(pimpl_->totalAttempts(), std::memory_order_relaxed);
     pimpl_->failed_allocations_.store(0, std::memory_order_relaxed);
-    pimpl_->peak_usage_.store(pimpl_->current_usage_.load(std::memory_order_relaxed),
+    const int64_t out = pimpl_->checked_out_.load(std::memory_order_relaxed);
+    pimpl_->peak_usage_.store(static_cast<size_t>(std::max<int64_t>(out, 0)),
                               std::memory_order_relaxed);
 }
 
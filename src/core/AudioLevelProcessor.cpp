@@ -1,380 +1,685 @@
-#include "huntmaster/core/AudioLevelProcessor.h"
-
-#include <algorithm>
-#include <cmath>
-#include <deque>
-#include <iomanip>
-#include <mutex>
-#include <sstream>
-
-#include "huntmaster/core/DebugLogger.h"
-
-// Enable debug output for AudioLevelProcessor
-#define DEBUG_AUDIO_LEVEL_PROCESSOR 0
-
-namespace huntmaster {
-
-/// Implementation details for AudioLevelProcessor
-class AudioLevelProcessor::Impl {
-  public:
-    Config config_;
-    mutable std::mutex mutex_;
-
-    // Smoothing filter state (atomic for lock-free reads)
-    std::atomic<float> currentRmsLinear_{0.0f};
-    std::atomic<float> currentPeakLinear_{0.0f};
-    std::atomic<float> currentRmsDb_{-60.0f};
-    std::atomic<float> currentPeakDb_{-60.0f};
-
-    // Smoothing coefficients (recalculated when config changes)
-    float rmsAttackCoeff_ = 0.0f;
-    float rmsReleaseCoeff_ = 0.0f;
-    float peakAttackCoeff_ = 0.0f;
-    float peakReleaseCoeff_ = 0.0f;
-
-    // Level history (protected by mutex)
-    std::deque<LevelMeasurement> levelHistory_;
-
-    // Processing state
-    std::atomic<bool> initialized_{false};
-    std::chrono::steady_clock::time_point lastUpdateTime_;
-
-    explicit Impl(const Config& config) : config_(config) {
-        if (config_.isValid()) {
-            calculateSmoothingCoefficients();
-            lastUpdateTime_ = std::chrono::steady_clock::now();
-            initialized_.store(true);
-        }
-    }
-
-    void calculateSmoothingCoefficients() {
-        // Calculate smoothing coefficients for exponential smoothing
-        // coeff = 1 - exp(-1 / (timeConstant * sampleRate / 1000))
-
-        const float sampleRateMs = config_.sampleRate / 1000.0f;
-
-        rmsAttackCoeff_ = 1.0f - std::exp(-1.0f / (config_.rmsAttackTimeMs * sampleRateMs));
-        rmsReleaseCoeff_ = 1.0f - std::exp(-1.0f / (config_.rmsReleaseTimeMs * sampleRateMs));
-        peakAttackCoeff_ = 1.0f - std::exp(-1.0f / (config_.peakAttackTimeMs * sampleRateMs));
-        peakReleaseCoeff_ = 1.0f - std::exp(-1.0f / (config_.peakReleaseTimeMs * sampleRateMs));
-
-        // Clamp coefficients to valid range
-        rmsAttackCoeff_ = std::clamp(rmsAttackCoeff_, 0.001f, 1.0f);
-        rmsReleaseCoeff_ = std::clamp(rmsReleaseCoeff_, 0.001f, 1.0f);
-        peakAttackCoeff_ = std::clamp(peakAttackCoeff_, 0.001f, 1.0f);
-        peakReleaseCoeff_ = std::clamp(peakReleaseCoeff_, 0.001f, 1.0f);
-    }
-};
-
-AudioLevelProcessor::AudioLevelProcessor() : AudioLevelProcessor(Config{}) {}
-
-AudioLevelProcessor::AudioLevelProcessor(const Config& config)
-    : impl_(std::make_unique<Impl>(config)) {}
-
-AudioLevelProcessor::~AudioLevelProcessor() = default;
-
-AudioLevelProcessor::Result AudioLevelProcessor::processAudio(std::span<const float> samples,
-                                                              int numChannels) noexcept {
-    // AUDIO_LOG_DEBUG("processAudio called with " + std::to_string(samples.size()) + " samples, " +
-    //                 std::to_string(numChannels) + " channels");
-
-    if (!impl_->initialized_.load()) {
-        // AUDIO_LOG_ERROR("processAudio: processor not initialized");
-        return huntmaster::unexpected(Error::INITIALIZATION_FAILED);
-    }
-
-    if (samples.empty()) {
-        // AUDIO_LOG_ERROR("processAudio: empty samples provided");
-        return huntmaster::unexpected(Error::INVALID_AUDIO_DATA);
-    }
-
-    if (numChannels <= 0 || numChannels > 8) {
-        // AUDIO_LOG_ERROR("processAudio: invalid channel count: " + std::to_string(numChannels));
-        return huntmaster::unexpected(Error::INVALID_AUDIO_DATA);
-    }
-
-    try {
-        // Calculate RMS and peak values for this audio chunk
-        float sumSquares = 0.0f;
-        float peakSample = 0.0f;
-
-        // Process samples (average across channels if multi-channel)
-        const size_t numSamples = samples.size();
-        const size_t framesCount = numSamples / numChannels;
-
-        for (size_t frame = 0; frame < framesCount; ++frame) {
-            float framePeak = 0.0f;
-            float frameSum = 0.0f;
-
-            // Process all channels in this frame
-            for (int ch = 0; ch < numChannels; ++ch) {
-                const size_t index = frame * numChannels + ch;
-                if (index < numSamples) {
-                    const float sample = samples[index];
-                    framePeak = std::max(framePeak, std::abs(sample));
-                    frameSum += sample;
-                }
-            }
-
-            // Average amplitude across channels for this frame
-            const float avgAmplitude = frameSum / numChannels;
-            sumSquares += avgAmplitude * avgAmplitude;
-            peakSample = std::max(peakSample, framePeak);
-        }
-
-        // Calculate RMS from sum of squares
-        const float rmsLinear = (framesCount > 0) ? std::sqrt(sumSquares / framesCount) : 0.0f;
-
-        // Apply smoothing filters
-        const float currentRms = impl_->currentRmsLinear_.load();
-        const float currentPeak = impl_->currentPeakLinear_.load();
-
-        // Choose attack or release coefficient based on signal direction
-        const float rmsCoeff =
-            (rmsLinear > currentRms) ? impl_->rmsAttackCoeff_ : impl_->rmsReleaseCoeff_;
-        const float peakCoeff =
-            (peakSample > currentPeak) ? impl_->peakAttackCoeff_ : impl_->peakReleaseCoeff_;
-
-        // Apply exponential smoothing
-        const float smoothedRms = currentRms + rmsCoeff * (rmsLinear - currentRms);
-        const float smoothedPeak = currentPeak + peakCoeff * (peakSample - currentPeak);
-
-        // Convert to dB
-        const float rmsDb =
-            linearToDb(smoothedRms, impl_->config_.dbFloor, impl_->config_.dbCeiling);
-        const float peakDb =
-            linearToDb(smoothedPeak, impl_->config_.dbFloor, impl_->config_.dbCeiling);
-
-        // Update atomic values
-        impl_->currentRmsLinear_.store(smoothedRms);
-        impl_->currentPeakLinear_.store(smoothedPeak);
-        impl_->currentRmsDb_.store(rmsDb);
-        impl_->currentPeakDb_.store(peakDb);
-
-        // Create measurement result
-        LevelMeasurement measurement;
-        measurement.rmsLinear = smoothedRms;
-        measurement.rmsDb = rmsDb;
-        measurement.peakLinear = smoothedPeak;
-        measurement.peakDb = peakDb;
-        measurement.timestamp = std::chrono::steady_clock::now();
-
-        // Update history (thread-safe)
-        {
-            std::lock_guard<std::mutex> lock(impl_->mutex_);
-            impl_->levelHistory_.push_front(measurement);
-
-            // Trim history to configured size
-            while (impl_->levelHistory_.size() > impl_->config_.historySize) {
-                impl_->levelHistory_.pop_back();
-            }
-        }
-
-        impl_->lastUpdateTime_ = measurement.timestamp;
-        return measurement;
-
-    } catch (...) {
-        return huntmaster::unexpected(Error::INTERNAL_ERROR);
-    }
-}
-
-AudioLevelProcessor::LevelMeasurement AudioLevelProcessor::getCurrentLevel() const noexcept {
-    LevelMeasurement current;
-    current.rmsLinear = impl_->currentRmsLinear_.load();
-    current.peakLinear = impl_->currentPeakLinear_.load();
-    current.rmsDb = impl_->currentRmsDb_.load();
-    current.peakDb = impl_->currentPeakDb_.load();
-    current.timestamp = impl_->lastUpdateTime_;
-    return current;
-}
-
-std::vector<AudioLevelProcessor::LevelMeasurement>
-AudioLevelProcessor::getLevelHistory(size_t maxCount) const {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
-    const size_t count = (maxCount > 0) ? std::min(maxCount, impl_->levelHistory_.size())
-                                        : impl_->levelHistory_.size();
-
-    std::vector<LevelMeasurement> result;
-    result.reserve(count);
-
-    auto it = impl_->levelHistory_.begin();
-    for (size_t i = 0; i < count && it != impl_->levelHistory_.end(); ++i, ++it) {
-        result.push_back(*it);
-    }
-
-    return result;
-}
-
-std::string AudioLevelProcessor::exportToJson() const {
-    const auto current = getCurrentLevel();
-
-    // Convert timestamp to milliseconds since epoch
-    const auto epoch = current.timestamp.time_since_epoch();
-    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
-
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(3);
-    oss << "{"
-        << "\"rms\":" << current.rmsDb << ","
-        << "\"peak\":" << current.peakDb << ","
-        << "\"rmsLinear\":" << current.rmsLinear << ","
-        << "\"peakLinear\":" << current.peakLinear << ","
-        << "\"timestamp\":" << millis << "}";
-
-    return oss.str();
-}
-
-std::string AudioLevelProcessor::exportHistoryToJson(size_t maxCount) const {
-    const auto history = getLevelHistory(maxCount);
-
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(3);
-    oss << "[";
-
-    for (size_t i = 0; i < history.size(); ++i) {
-        if (i > 0)
-            oss << ",";
-
-        const auto& measurement = history[i];
-        const auto epoch = measurement.timestamp.time_since_epoch();
-        const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
-
-        oss << "{"
-            << "\"rms\":" << measurement.rmsDb << ","
-            << "\"peak\":" << measurement.peakDb << ","
-            << "\"rmsLinear\":" << measurement.rmsLinear << ","
-            << "\"peakLinear\":" << measurement.peakLinear << ","
-            << "\"timestamp\":" << millis << "}";
-    }
-
-    oss << "]";
-    return oss.str();
-}
-
-void AudioLevelProcessor::reset() noexcept {
-    // AUDIO_LOG_DEBUG("reset called - clearing all audio level data");
-    impl_->currentRmsLinear_.store(0.0f);
-    impl_->currentPeakLinear_.store(0.0f);
-    impl_->currentRmsDb_.store(impl_->config_.dbFloor);
-    impl_->currentPeakDb_.store(impl_->config_.dbFloor);
-    // AUDIO_LOG_DEBUG("reset - atomic values reset");
-
-    {
-        std::lock_guard<std::mutex> lock(impl_->mutex_);
-        impl_->levelHistory_.clear();
-    }
-
-    impl_->lastUpdateTime_ = std::chrono::steady_clock::now();
-}
-
-bool AudioLevelProcessor::updateConfig(const Config& newConfig) noexcept {
-    if (!newConfig.isValid()) {
-        return false;
-    }
-
-    try {
-        std::lock_guard<std::mutex> lock(impl_->mutex_);
-        impl_->config_ = newConfig;
-        impl_->calculateSmoothingCoefficients();
-
-        // Resize history if needed
-        while (impl_->levelHistory_.size() > newConfig.historySize) {
-            impl_->levelHistory_.pop_back();
-        }
-
-        return true;
-    } catch (...) {
-        return false;
-    }
-}
-
-AudioLevelProcessor::Config AudioLevelProcessor::getConfig() const noexcept {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-    return impl_->config_;
-}
-
-bool AudioLevelProcessor::isInitialized() const noexcept {
-    return impl_->initialized_.load();
-}
-
-// Static calculation methods
-float AudioLevelProcessor::calculateRMS(std::span<const float> samples, int numChannels) noexcept {
-    if (samples.empty() || numChannels <= 0) {
-        return 0.0f;
-    }
-
-    const size_t numSamples = samples.size();
-    const size_t framesCount = numSamples / numChannels;
-
-    if (framesCount == 0) {
-        return 0.0f;
-    }
-
-    float sumSquares = 0.0f;
-    size_t totalSamplesProcessed = 0;
-
-    // Process samples frame by frame
-    for (size_t frame = 0; frame < framesCount; ++frame) {
-        for (int ch = 0; ch < numChannels; ++ch) {
-            const size_t index = frame * numChannels + ch;
-            if (index < numSamples) {
-                const float sample = samples[index];
-                sumSquares += sample * sample;
-                totalSamplesProcessed++;
-            }
-        }
-    }
-
-    if (totalSamplesProcessed == 0) {
-        return 0.0f;
-    }
-
-    // Calculate RMS
-    const float meanSquare = sumSquares / totalSamplesProcessed;
-    return std::sqrt(meanSquare);
-}
-
-float AudioLevelProcessor::calculatePeak(std::span<const float> samples, int numChannels) noexcept {
-    if (samples.empty() || numChannels <= 0) {
-        return 0.0f;
-    }
-
-    const size_t numSamples = samples.size();
-    const size_t framesCount = numSamples / numChannels;
-
-    if (framesCount == 0) {
-        return 0.0f;
-    }
-
-    float peak = 0.0f;
-
-    // Process samples frame by frame
-    for (size_t frame = 0; frame < framesCount; ++frame) {
-        for (int ch = 0; ch < numChannels; ++ch) {
-            const size_t index = frame * numChannels + ch;
-            if (index < numSamples) {
-                const float sample = std::abs(samples[index]);
-                peak = std::max(peak, sample);
-            }
-        }
-    }
-
-    return peak;
-}
-
-// Utility functions
-float linearToDb(float linear, float floor, float ceiling) noexcept {
-    if (linear <= 0.0f) {
-        return floor;
-    }
-
-    const float db = 20.0f * std::log10(linear);
-    return std::clamp(db, floor, ceiling);
-}
-
-float dbToLinear(float db) noexcept {
-    return std::pow(10.0f, db / 20.0f);
-}
-
-}  // namespace huntmaster
+#include "huntmaster/core/AudioLevelProcessor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+#include "huntmaster/core/DebugLogger.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Enable debug output for AudioLevelProcessor
+#define DEBUG_AUDIO_LEVEL_PROCESSOR 0
+
+namespace huntmaster {
+
+namespace {
+
+constexpr int kMaxChannels = 8;
+
+// True-peak interpolator: 4x oversampling, 12 taps per phase (BS.1770-4 Annex 2 layout)
+constexpr size_t kTruePeakPhases = 4;
+constexpr size_t kTruePeakTaps = 12;
+
+// Loudness windows are built from 100 ms blocks
+constexpr float kLoudnessBlockSeconds = 0.1f;
+constexpr size_t kMomentaryBlocks = 4;    // 400 ms
+constexpr size_t kShortTermBlocks = 30;   // 3 s
+constexpr float kLufsOffset = -0.691f;    // BS.1770 calibration constant
+constexpr float kLufsFloor = -70.0f;      // BS.1770 absolute gate
+
+struct PeakAndSquares {
+    float peak = 0.0f;
+    double sumSquares = 0.0;
+};
+
+// Peak magnitude and sum of squares in one pass, with double accumulation
+PeakAndSquares scanPeakAndSquares(const float* data, size_t count) noexcept {
+    size_t i = 0;
+    PeakAndSquares result;
+
+#if defined(__AVX2__)
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 peak = _mm256_setzero_ps();
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v = _mm256_loadu_ps(data + i);
+        peak = _mm256_max_ps(peak, _mm256_andnot_ps(signMask, v));
+        const __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        const __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(lo, lo));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(hi, hi));
+    }
+    alignas(32) float peakLanes[8];
+    alignas(32) double sumLanes[4];
+    _mm256_store_ps(peakLanes, peak);
+    _mm256_store_pd(sumLanes, _mm256_add_pd(acc0, acc1));
+    result.peak = *std::max_element(peakLanes, peakLanes + 8);
+    result.sumSquares = (sumLanes[0] + sumLanes[1]) + (sumLanes[2] + sumLanes[3]);
+#elif defined(__SSE2__)
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 peak = _mm_setzero_ps();
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(data + i);
+        peak = _mm_max_ps(peak, _mm_andnot_ps(signMask, v));
+        const __m128d lo = _mm_cvtps_pd(v);
+        const __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(lo, lo));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(hi, hi));
+    }
+    alignas(16) float peakLanes[4];
+    alignas(16) double sumLanes[2];
+    _mm_store_ps(peakLanes, peak);
+    _mm_store_pd(sumLanes, _mm_add_pd(acc0, acc1));
+    result.peak =
+        std::max(std::max(peakLanes[0], peakLanes[1]), std::max(peakLanes[2], peakLanes[3]));
+    result.sumSquares = sumLanes[0] + sumLanes[1];
+#endif
+
+    for (; i < count; ++i) {
+        result.peak = std::max(result.peak, std::abs(data[i]));
+        result.sumSquares += static_cast<double>(data[i]) * data[i];
+    }
+    return result;
+}
+
+/// Transposed direct form II biquad, double state for the 38 Hz high-pass
+struct Biquad {
+    double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+    double z1 = 0.0, z2 = 0.0;
+
+    double process(double x) noexcept {
+        const double y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        return y;
+    }
+};
+
+/**
+ * K-weighting and true-peak state for up to kMaxChannels interleaved channels.
+ *
+ * The K-weighting pre-filter (high shelf + RLB high-pass) is derived for the
+ * configured sample rate from the analog prototypes of BS.1770, so 44.1 kHz
+ * and 16 kHz input meter the same as the 48 kHz reference coefficients.
+ */
+class LoudnessMeter {
+  public:
+    struct ChunkLevels {
+        float peak = 0.0f;
+        double mixSquares = 0.0;
+        float truePeak = 0.0f;
+    };
+
+    void configure(float sampleRate) {
+        const double fs = sampleRate;
+
+        // Stage 1: high shelf, +4 dB above ~1.7 kHz
+        {
+            const double f0 = 1681.974450955533;
+            const double gainDb = 3.999843853973347;
+            const double q = 0.7071752369554196;
+            const double k = std::tan(M_PI * f0 / fs);
+            const double vh = std::pow(10.0, gainDb / 20.0);
+            const double vb = std::pow(vh, 0.4996667741545416);
+            const double a0 = 1.0 + k / q + k * k;
+            shelf_.b0 = (vh + vb * k / q + k * k) / a0;
+            shelf_.b1 = 2.0 * (k * k - vh) / a0;
+            shelf_.b2 = (vh - vb * k / q + k * k) / a0;
+            shelf_.a1 = 2.0 * (k * k - 1.0) / a0;
+            shelf_.a2 = (1.0 - k / q + k * k) / a0;
+        }
+        // Stage 2: RLB high-pass at ~38 Hz
+        {
+            const double f0 = 38.13547087602444;
+            const double q = 0.5003270373238773;
+            const double k = std::tan(M_PI * f0 / fs);
+            const double a0 = 1.0 + k / q + k * k;
+            highPass_.b0 = 1.0;
+            highPass_.b1 = -2.0;
+            highPass_.b2 = 1.0;
+            highPass_.a1 = 2.0 * (k * k - 1.0) / a0;
+            highPass_.a2 = (1.0 - k / q + k * k) / a0;
+        }
+
+        // Polyphase interpolator: Hann-windowed sinc with the cutoff at the input Nyquist,
+        // stored [tap][phase] so one SIMD lane evaluates one phase
+        constexpr size_t length = kTruePeakTaps * kTruePeakPhases;
+        std::array<double, length> prototype{};
+        const double centre = (length - 1) / 2.0;
+        for (size_t n = 0; n < length; ++n) {
+            const double t = (n - centre) / kTruePeakPhases;
+            const double sinc = (t == 0.0) ? 1.0 : std::sin(M_PI * t) / (M_PI * t);
+            const double window = 0.5 - 0.5 * std::cos(2.0 * M_PI * (n + 0.5) / length);
+            prototype[n] = sinc * window;
+        }
+        for (size_t p = 0; p < kTruePeakPhases; ++p) {
+            double phaseGain = 0.0;
+            for (size_t t = 0; t < kTruePeakTaps; ++t) {
+                phaseGain += prototype[t * kTruePeakPhases + p];
+            }
+            for (size_t t = 0; t < kTruePeakTaps; ++t) {
+                // History is ordered oldest -> newest, so the taps run backwards
+                const double h = prototype[(kTruePeakTaps - 1 - t) * kTruePeakPhases + p];
+                phaseCoeffs_[t * kTruePeakPhases + p] = static_cast<float>(h / phaseGain);
+            }
+        }
+
+        blockLength_ =
+            std::max<size_t>(1, static_cast<size_t>(std::lround(fs * kLoudnessBlockSeconds)));
+        reset();
+    }
+
+    void reset() noexcept {
+        for (auto& state : channels_) {
+            state = ChannelState{};
+            state.shelf = shelf_;
+            state.highPass = highPass_;
+        }
+        blockEnergy_.fill(0.0);
+        blockIndex_ = 0;
+        blocksCompleted_ = 0;
+        framesInBlock_ = 0;
+    }
+
+    /// Fused pass: sample peak, mono mixdown energy, K-weighted block energy and true peak
+    ChunkLevels process(std::span<const float> samples, int numChannels, size_t frames) noexcept {
+        ChunkLevels levels;
+        const float channelScale = 1.0f / numChannels;
+
+        for (size_t frame = 0; frame < frames; ++frame) {
+            const float* in = samples.data() + frame * numChannels;
+            float mix = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch) {
+                const float sample = in[ch];
+                ChannelState& state = channels_[ch];
+
+                levels.peak = std::max(levels.peak, std::abs(sample));
+                mix += sample;
+
+                const double weighted = state.highPass.process(state.shelf.process(sample));
+                state.blockSquares += weighted * weighted;
+
+                levels.truePeak = std::max(levels.truePeak, interpolatePeak(state, sample));
+            }
+            const float average = mix * channelScale;
+            levels.mixSquares += static_cast<double>(average) * average;
+
+            if (++framesInBlock_ == blockLength_) {
+                closeBlock(numChannels);
+            }
+        }
+        return levels;
+    }
+
+    [[nodiscard]] float momentaryLufs() const noexcept { return windowLoudness(kMomentaryBlocks); }
+    [[nodiscard]] float shortTermLufs() const noexcept { return windowLoudness(kShortTermBlocks); }
+
+  private:
+    struct ChannelState {
+        Biquad shelf;
+        Biquad highPass;
+        double blockSquares = 0.0;
+        // Doubled ring so the newest kTruePeakTaps samples are always contiguous
+        std::array<float, 2 * kTruePeakTaps> history{};
+        size_t historyPos = 0;
+    };
+
+    float interpolatePeak(ChannelState& state, float sample) noexcept {
+        state.history[state.historyPos] = sample;
+        state.history[state.historyPos + kTruePeakTaps] = sample;
+        state.historyPos = (state.historyPos + 1) % kTruePeakTaps;
+        const float* window = state.history.data() + state.historyPos;
+
+#if defined(__SSE2__)
+        __m128 acc = _mm_setzero_ps();
+        for (size_t t = 0; t < kTruePeakTaps; ++t) {
+            acc = _mm_add_ps(acc,
+                             _mm_mul_ps(_mm_set1_ps(window[t]),
+                                        _mm_loadu_ps(phaseCoeffs_.data() + t * kTruePeakPhases)));
+        }
+        acc = _mm_andnot_ps(_mm_set1_ps(-0.0f), acc);
+        acc = _mm_max_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_max_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+        return _mm_cvtss_f32(acc);
+#else
+        float peak = 0.0f;
+        for (size_t p = 0; p < kTruePeakPhases; ++p) {
+            float value = 0.0f;
+            for (size_t t = 0; t < kTruePeakTaps; ++t) {
+                value += window[t] * phaseCoeffs_[t * kTruePeakPhases + p];
+            }
+            peak = std::max(peak, std::abs(value));
+        }
+        return peak;
+#endif
+    }
+
+    void closeBlock(int numChannels) noexcept {
+        // Channels are weighted equally (mono/stereo field recordings carry no surrounds)
+        double energy = 0.0;
+        for (int ch = 0; ch < numChannels; ++ch) {
+            energy += channels_[ch].blockSquares / blockLength_;
+            channels_[ch].blockSquares = 0.0;
+        }
+        blockEnergy_[blockIndex_] = energy;
+        blockIndex_ = (blockIndex_ + 1) % kShortTermBlocks;
+        blocksCompleted_ = std::min(blocksCompleted_ + 1, kShortTermBlocks);
+        framesInBlock_ = 0;
+    }
+
+    float windowLoudness(size_t blocks) const noexcept {
+        const size_t available = std::min(blocks, blocksCompleted_);
+        if (available == 0) {
+            return kLufsFloor;
+        }
+        double energy = 0.0;
+        for (size_t b = 1; b <= available; ++b) {
+            energy += blockEnergy_[(blockIndex_ + kShortTermBlocks - b) % kShortTermBlocks];
+        }
+        energy /= available;
+        if (energy <= 0.0) {
+            return kLufsFloor;
+        }
+        return std::max(kLufsFloor, kLufsOffset + 10.0f * static_cast<float>(std::log10(energy)));
+    }
+
+    Biquad shelf_;
+    Biquad highPass_;
+    std::array<float, kTruePeakTaps * kTruePeakPhases> phaseCoeffs_{};
+    std::array<ChannelState, kMaxChannels> channels_{};
+
+    std::array<double, kShortTermBlocks> blockEnergy_{};
+    size_t blockIndex_ = 0;
+    size_t blocksCompleted_ = 0;
+    size_t blockLength_ = 1;
+    size_t framesInBlock_ = 0;
+};
+
+}  // namespace
+
+/// Implementation details for AudioLevelProcessor
+class AudioLevelProcessor::Impl {
+  public:
+    Config config_;
+    mutable std::mutex mutex_;
+
+    // Smoothing filter state (atomic for lock-free reads)
+    std::atomic<float> currentRmsLinear_{0.0f};
+    std::atomic<float> currentPeakLinear_{0.0f};
+    std::atomic<float> currentRmsDb_{-60.0f};
+    std::atomic<float> currentPeakDb_{-60.0f};
+    std::atomic<float> currentTruePeakLinear_{0.0f};
+    std::atomic<float> currentTruePeakDb_{-60.0f};
+    std::atomic<float> currentMomentaryLufs_{kLufsFloor};
+    std::atomic<float> currentShortTermLufs_{kLufsFloor};
+
+    // Smoothing coefficients (recalculated when config changes)
+    float rmsAttackCoeff_ = 0.0f;
+    float rmsReleaseCoeff_ = 0.0f;
+    float peakAttackCoeff_ = 0.0f;
+    float peakReleaseCoeff_ = 0.0f;
+
+    // K-weighting filters, loudness blocks and true-peak history
+    LoudnessMeter loudness_;
+
+    // Level history (protected by mutex)
+    std::deque<LevelMeasurement> levelHistory_;
+
+    // Processing state
+    std::atomic<bool> initialized_{false};
+    std::chrono::steady_clock::time_point lastUpdateTime_;
+
+    explicit Impl(const Config& config) : config_(config) {
+        if (config_.isValid()) {
+            calculateSmoothingCoefficients();
+            loudness_.configure(config_.sampleRate);
+            lastUpdateTime_ = std::chrono::steady_clock::now();
+            initialized_.store(true);
+        }
+    }
+
+    void calculateSmoothingCoefficients() {
+        // Calculate smoothing coefficients for exponential smoothing
+        // coeff = 1 - exp(-1 / (timeConstant * sampleRate / 1000))
+
+        const float sampleRateMs = config_.sampleRate / 1000.0f;
+
+        rmsAttackCoeff_ = 1.0f - std::exp(-1.0f / (config_.rmsAttackTimeMs * sampleRateMs));
+        rmsReleaseCoeff_ = 1.0f - std::exp(-1.0f / (config_.rmsReleaseTimeMs * sampleRateMs));
+        peakAttackCoeff_ = 1.0f - std::exp(-1.0f / (config_.peakAttackTimeMs * sampleRateMs));
+        peakReleaseCoeff_ = 1.0f - std::exp(-1.0f / (config_.peakReleaseTimeMs * sampleRateMs));
+
+        // Clamp coefficients to valid range
+        rmsAttackCoeff_ = std::clamp(rmsAttackCoeff_, 0.001f, 1.0f);
+        rmsReleaseCoeff_ = std::clamp(rmsReleaseCoeff_, 0.001f, 1.0f);
+        peakAttackCoeff_ = std::clamp(peakAttackCoeff_, 0.001f, 1.0f);
+        peakReleaseCoeff_ = std::clamp(peakReleaseCoeff_, 0.001f, 1.0f);
+    }
+};
+
+AudioLevelProcessor::AudioLevelProcessor() : AudioLevelProcessor(Config{}) {}
+
+AudioLevelProcessor::AudioLevelProcessor(const Config& config)
+    : impl_(std::make_unique<Impl>(config)) {}
+
+AudioLevelProcessor::~AudioLevelProcessor() = default;
+
+AudioLevelProcessor::Result AudioLevelProcessor::processAudio(std::span<const float> samples,
+                                                              int numChannels) noexcept {
+    // AUDIO_LOG_DEBUG("processAudio called with " + std::to_string(samples.size()) + " samples, " +
+    //                 std::to_string(numChannels) + " channels");
+
+    if (!impl_->initialized_.load()) {
+        // AUDIO_LOG_ERROR("processAudio: processor not initialized");
+        return huntmaster::unexpected(Error::INITIALIZATION_FAILED);
+    }
+
+    if (samples.empty()) {
+        // AUDIO_LOG_ERROR("processAudio: empty samples provided");
+        return huntmaster::unexpected(Error::INVALID_AUDIO_DATA);
+    }
+
+    if (numChannels <= 0 || numChannels > 8) {
+        // AUDIO_LOG_ERROR("processAudio: invalid channel count: " + std::to_string(numChannels));
+        return huntmaster::unexpected(Error::INVALID_AUDIO_DATA);
+    }
+
+    try {
+        // Config, filter state and history change together under updateConfig() and reset()
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+
+        // Calculate RMS (of the channel average) and peak values for this audio chunk
+        const size_t framesCount = samples.size() / numChannels;
+        double sumSquares = 0.0;
+        float peakSample = 0.0f;
+        float truePeak = 0.0f;
+
+        if (impl_->config_.enableLoudness) {
+            // One pass feeds the level, K-weighting and true-peak stages together
+            const auto levels = impl_->loudness_.process(samples, numChannels, framesCount);
+            sumSquares = levels.mixSquares;
+            peakSample = levels.peak;
+            truePeak = std::max(levels.truePeak, levels.peak);
+        } else if (numChannels == 1) {
+            const auto levels = scanPeakAndSquares(samples.data(), framesCount);
+            sumSquares = levels.sumSquares;
+            peakSample = levels.peak;
+        } else {
+            for (size_t frame = 0; frame < framesCount; ++frame) {
+                const float* in = samples.data() + frame * numChannels;
+                float frameSum = 0.0f;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    peakSample = std::max(peakSample, std::abs(in[ch]));
+                    frameSum += in[ch];
+                }
+                const float avgAmplitude = frameSum / numChannels;
+                sumSquares += static_cast<double>(avgAmplitude) * avgAmplitude;
+            }
+        }
+
+        const float rmsLinear =
+            (framesCount > 0) ? static_cast<float>(std::sqrt(sumSquares / framesCount)) : 0.0f;
+
+        // Apply smoothing filters
+        const float currentRms = impl_->currentRmsLinear_.load();
+        const float currentPeak = impl_->currentPeakLinear_.load();
+
+        // Choose attack or release coefficient based on signal direction
+        const float rmsCoeff =
+            (rmsLinear > currentRms) ? impl_->rmsAttackCoeff_ : impl_->rmsReleaseCoeff_;
+        const float peakCoeff =
+            (peakSample > currentPeak) ? impl_->peakAttackCoeff_ : impl_->peakReleaseCoeff_;
+
+        // Apply exponential smoothing
+        const float smoothedRms = currentRms + rmsCoeff * (rmsLinear - currentRms);
+        const float smoothedPeak = currentPeak + peakCoeff * (peakSample - currentPeak);
+
+        // Convert to dB
+        const float rmsDb =
+            linearToDb(smoothedRms, impl_->config_.dbFloor, impl_->config_.dbCeiling);
+        const float peakDb =
+            linearToDb(smoothedPeak, impl_->config_.dbFloor, impl_->config_.dbCeiling);
+        const float truePeakDb =
+            linearToDb(truePeak, impl_->config_.dbFloor, impl_->config_.dbCeiling);
+        const float momentaryLufs = impl_->config_.enableLoudness
+                                        ? impl_->loudness_.momentaryLufs()
+                                        : kLufsFloor;
+        const float shortTermLufs = impl_->config_.enableLoudness
+                                        ? impl_->loudness_.shortTermLufs()
+                                        : kLufsFloor;
+
+        // Update atomic values
+        impl_->currentRmsLinear_.store(smoothedRms);
+        impl_->currentPeakLinear_.store(smoothedPeak);
+        impl_->currentRmsDb_.store(rmsDb);
+        impl_->currentPeakDb_.store(peakDb);
+        impl_->currentTruePeakLinear_.store(truePeak);
+        impl_->currentTruePeakDb_.store(truePeakDb);
+        impl_->currentMomentaryLufs_.store(momentaryLufs);
+        impl_->currentShortTermLufs_.store(shortTermLufs);
+
+        // Create measurement result
+        LevelMeasurement measurement;
+        measurement.rmsLinear = smoothedRms;
+        measurement.rmsDb = rmsDb;
+        measurement.peakLinear = smoothedPeak;
+        measurement.peakDb = peakDb;
+        measurement.truePeakLinear = truePeak;
+        measurement.truePeakDb = truePeakDb;
+        measurement.momentaryLufs = momentaryLufs;
+        measurement.shortTermLufs = shortTermLufs;
+        measurement.timestamp = std::chrono::steady_clock::now();
+
+        // Update history
+        impl_->levelHistory_.push_front(measurement);
+
+        // Trim history to configured size
+        while (impl_->levelHistory_.size() > impl_->config_.historySize) {
+            impl_->levelHistory_.pop_back();
+        }
+
+        impl_->lastUpdateTime_ = measurement.timestamp;
+        return measurement;
+
+    } catch (...) {
+        return huntmaster::unexpected(Error::INTERNAL_ERROR);
+    }
+}
+
+AudioLevelProcessor::LevelMeasurement AudioLevelProcessor::getCurrentLevel() const noexcept {
+    LevelMeasurement current;
+    current.rmsLinear = impl_->currentRmsLinear_.load();
+    current.peakLinear = impl_->currentPeakLinear_.load();
+    current.rmsDb = impl_->currentRmsDb_.load();
+    current.peakDb = impl_->currentPeakDb_.load();
+    current.truePeakLinear = impl_->currentTruePeakLinear_.load();
+    current.truePeakDb = impl_->currentTruePeakDb_.load();
+    current.momentaryLufs = impl_->currentMomentaryLufs_.load();
+    current.shortTermLufs = impl_->currentShortTermLufs_.load();
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    current.timestamp = impl_->lastUpdateTime_;
+    return current;
+}
+
+std::vector<AudioLevelProcessor::LevelMeasurement>
+AudioLevelProcessor::getLevelHistory(size_t maxCount) const {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+
+    const size_t count = (maxCount > 0) ? std::min(maxCount, impl_->levelHistory_.size())
+                                        : impl_->levelHistory_.size();
+
+    std::vector<LevelMeasurement> result;
+    result.reserve(count);
+
+    auto it = impl_->levelHistory_.begin();
+    for (size_t i = 0; i < count && it != impl_->levelHistory_.end(); ++i, ++it) {
+        result.push_back(*it);
+    }
+
+    return result;
+}
+
+std::string AudioLevelProcessor::exportToJson() const {
+    const auto current = getCurrentLevel();
+
+    // Convert timestamp to milliseconds since epoch
+    const auto epoch = current.timestamp.time_since_epoch();
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    oss << "{"
+        << "\"rms\":" << current.rmsDb << ","
+        << "\"peak\":" << current.peakDb << ","
+        << "\"rmsLinear\":" << current.rmsLinear << ","
+        << "\"peakLinear\":" << current.peakLinear << ","
+        << "\"truePeak\":" << current.truePeakDb << ","
+        << "\"momentaryLufs\":" << current.momentaryLufs << ","
+        << "\"shortTermLufs\":" << current.shortTermLufs << ","
+        << "\"timestamp\":" << millis << "}";
+
+    return oss.str();
+}
+
+std::string AudioLevelProcessor::exportHistoryToJson(size_t maxCount) const {
+    const auto history = getLevelHistory(maxCount);
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    oss << "[";
+
+    for (size_t i = 0; i < history.size(); ++i) {
+        if (i > 0)
+            oss << ",";
+
+        const auto& measurement = history[i];
+        const auto epoch = measurement.timestamp.time_since_epoch();
+        const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
+
+        oss << "{"
+            << "\"rms\":" << measurement.rmsDb << ","
+            << "\"peak\":" << measurement.peakDb << ","
+            << "\"rmsLinear\":" << measurement.rmsLinear << ","
+            << "\"peakLinear\":" << measurement.peakLinear << ","
+            << "\"truePeak\":" << measurement.truePeakDb << ","
+            << "\"momentaryLufs\":" << measurement.momentaryLufs << ","
+            << "\"shortTermLufs\":" << measurement.shortTermLufs << ","
+            << "\"timestamp\":" << millis << "}";
+    }
+
+    oss << "]";
+    return oss.str();
+}
+
+void AudioLevelProcessor::reset() noexcept {
+    // AUDIO_LOG_DEBUG("reset called - clearing all audio level data");
+    // Held throughout so a concurrent processAudio() cannot repopulate half-reset state
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->currentRmsLinear_.store(0.0f);
+    impl_->currentPeakLinear_.store(0.0f);
+    impl_->currentRmsDb_.store(impl_->config_.dbFloor);
+    impl_->currentPeakDb_.store(impl_->config_.dbFloor);
+    impl_->currentTruePeakLinear_.store(0.0f);
+    impl_->currentTruePeakDb_.store(impl_->config_.dbFloor);
+    impl_->currentMomentaryLufs_.store(kLufsFloor);
+    impl_->currentShortTermLufs_.store(kLufsFloor);
+    // AUDIO_LOG_DEBUG("reset - atomic values reset");
+
+    impl_->levelHistory_.clear();
+    impl_->loudness_.reset();
+    impl_->lastUpdateTime_ = std::chrono::steady_clock::now();
+}
+
+bool AudioLevelProcessor::updateConfig(const Config& newConfig) noexcept {
+    if (!newConfig.isValid()) {
+        return false;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        impl_->config_ = newConfig;
+        impl_->calculateSmoothingCoefficients();
+        impl_->loudness_.configure(newConfig.sampleRate);
+
+        // Resize history if needed
+        while (impl_->levelHistory_.size() > newConfig.historySize) {
+            impl_->levelHistory_.pop_back();
+        }
+
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+AudioLevelProcessor::Config AudioLevelProcessor::getConfig() const noexcept {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    return impl_->config_;
+}
+
+bool AudioLevelProcessor::isInitialized() const noexcept {
+    return impl_->initialized_.load();
+}
+
+// Static calculation methods
+float AudioLevelProcessor::calculateRMS(std::span<const float> samples, int numChannels) noexcept {
+    if (samples.empty() || numChannels <= 0) {
+        return 0.0f;
+    }
+
+    const size_t numSamples = samples.size();
+    const size_t framesCount = numSamples / numChannels;
+
+    if (framesCount == 0) {
+        return 0.0f;
+    }
+
+    // Only complete frames are measured
+    const size_t count = framesCount * numChannels;
+    const auto levels = scanPeakAndSquares(samples.data(), count);
+    return static_cast<float>(std::sqrt(levels.sumSquares / count));
+}
+
+float AudioLevelProcessor::calculatePeak(std::span<const float> samples, int numChannels) noexcept {
+    if (samples.empty() || numChannels <= 0) {
+        return 0.0f;
+    }
+
+    const size_t numSamples = samples.size();
+    const size_t framesCount = numSamples / numChannels;
+
+    if (framesCount == 0) {
+        return 0.0f;
+    }
+
+    return scanPeakAndSquares(samples.data(), framesCount * numChannels).peak;
+}
+
+// Utility functions
+float linearToDb(float linear, float floor, float ceiling) noexcept {
+    if (linear <= 0.0f) {
+        return floor;
+    }
+
+    const float db = 20.0f * std::log10(linear);
+    return std::clamp(db, floor, ceiling);
+}
+
+float dbToLinear(float db) noexcept {
+    return std::pow(10.0f, db / 20.0f);
+}
+
+}  // namespace huntmaster
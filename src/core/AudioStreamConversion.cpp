@@ -0,0 +1,637 @@
+/**
+ * @file AudioStreamConversion.cpp
+ * @brief Pull-based WAV decoding, conversion stages and WAV encoding
+ *
+ * Each stage holds at most a few chunks of audio, so a conversion chain runs
+ * in bounded memory whatever the input length.
+ *
+ * @author Huntmaster Engine Team
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "huntmaster/core/AudioFormatConverter.h"
+
+namespace huntmaster {
+namespace core {
+
+ByteReader makeFileReader(int fd) {
+    return [fd](uint8_t* data, size_t size) -> size_t {
+        while (true) {
+#ifdef _WIN32
+            const int count =
+                _read(fd, data, static_cast<unsigned>(std::min<size_t>(size, INT_MAX)));
+#else
+            const ssize_t count = ::read(fd, data, size);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            return count > 0 ? static_cast<size_t>(count) : 0;
+        }
+    };
+}
+
+ByteReader makeMemoryReader(const uint8_t* data, size_t size) {
+    auto offset = std::make_shared<size_t>(0);
+    return [data, size, offset](uint8_t* out, size_t count) -> size_t {
+        const size_t n = std::min(count, size - *offset);
+        std::memcpy(out, data + *offset, n);
+        *offset += n;
+        return n;
+    };
+}
+
+ByteWriter makeFileWriter(int fd) {
+    return [fd](const uint8_t* data, size_t size) -> size_t {
+        size_t written = 0;
+        while (written < size) {
+#ifdef _WIN32
+            const auto request = static_cast<unsigned>(std::min<size_t>(size - written, INT_MAX));
+            const int count = _write(fd, data + written, request);
+#else
+            const ssize_t count = ::write(fd, data + written, size - written);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (count <= 0) {
+                break;
+            }
+            written += static_cast<size_t>(count);
+        }
+        return written;
+    };
+}
+
+namespace {
+
+constexpr uint16_t kWaveFormatPcm = 0x0001;
+constexpr uint16_t kWaveFormatFloat = 0x0003;
+constexpr uint16_t kWaveFormatExtensible = 0xFFFE;
+
+inline uint16_t readLE16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline uint32_t readLE32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+           | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline void writeLE16(uint8_t* p, uint16_t value) {
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8);
+}
+
+inline void writeLE32(uint8_t* p, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+}  // namespace
+
+struct WAVStreamDecoder::Impl {
+    ByteReader reader;
+    std::vector<uint8_t> buffer;
+    size_t begin = 0;  // Unconsumed bytes are buffer[begin, end)
+    size_t end = 0;
+    bool inputEnded = false;
+
+    AudioFormatInfo info{};
+    uint16_t formatTag = 0;
+    uint16_t blockAlign = 0;
+    bool sizeKnown = false;
+    uint64_t dataRemaining = 0;  // Bytes, when sizeKnown
+    std::string lastError;
+
+    /// Top up the buffer; compacts first so at least `want` bytes can fit
+    void fill(size_t want) {
+        if (begin > 0 && (buffer.size() - end < want || begin == end)) {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (buffer.size() < want) {
+            buffer.resize(want);
+        }
+        while (!inputEnded && end < buffer.size() && end - begin < want) {
+            const size_t count = reader(buffer.data() + end, buffer.size() - end);
+            if (count == 0) {
+                inputEnded = true;
+            }
+            end += count;
+        }
+    }
+
+    bool readExact(uint8_t* out, size_t size) {
+        fill(size);
+        if (end - begin < size) {
+            return false;
+        }
+        std::memcpy(out, buffer.data() + begin, size);
+        begin += size;
+        return true;
+    }
+
+    bool skip(uint64_t size) {
+        while (size > 0) {
+            fill(1);
+            if (begin == end) {
+                return false;
+            }
+            const size_t n = static_cast<size_t>(std::min<uint64_t>(size, end - begin));
+            begin += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    bool fail(const std::string& message) {
+        lastError = message;
+        info.isValid = false;
+        info.errors.push_back(message);
+        return false;
+    }
+
+    bool parseFormat(uint32_t chunkSize) {
+        uint8_t fmt[40] = {};
+        const size_t wanted = std::min<size_t>(chunkSize, sizeof(fmt));
+        if (chunkSize < 16 || !readExact(fmt, wanted)
+            || !skip(chunkSize - wanted + (chunkSize & 1))) {
+            return fail("Truncated fmt chunk");
+        }
+        formatTag = readLE16(fmt);
+        info.channels = readLE16(fmt + 2);
+        info.sampleRate = readLE32(fmt + 4);
+        info.bitrate = readLE32(fmt + 8) * 8;
+        blockAlign = readLE16(fmt + 12);
+        info.bitDepth = readLE16(fmt + 14);
+        if (formatTag == kWaveFormatExtensible && chunkSize >= 40) {
+            formatTag = readLE16(fmt + 24);  // First bytes of the sub-format GUID
+        }
+
+        const uint16_t bits = info.bitDepth;
+        const bool pcm = formatTag == kWaveFormatPcm
+                         && (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+        const bool ieee = formatTag == kWaveFormatFloat && (bits == 32 || bits == 64);
+        if (!pcm && !ieee) {
+            return fail("Unsupported WAV encoding: tag " + std::to_string(formatTag) + ", "
+                        + std::to_string(info.bitDepth) + "-bit");
+        }
+        if (info.channels == 0 || info.sampleRate == 0
+            || blockAlign != info.channels * (info.bitDepth / 8)) {
+            return fail("Inconsistent WAV fmt chunk");
+        }
+        info.format = pcm ? AudioFormat::WAV_PCM : AudioFormat::WAV_FLOAT;
+        info.codecName = pcm ? "PCM" : "IEEE Float";
+        info.mimeType = "audio/wav";
+        return true;
+    }
+
+    bool open() {
+        uint8_t riff[12];
+        if (!readExact(riff, sizeof(riff)) || std::memcmp(riff, "RIFF", 4) != 0
+            || std::memcmp(riff + 8, "WAVE", 4) != 0) {
+            return fail("Not a RIFF/WAVE stream");
+        }
+
+        bool haveFormat = false;
+        while (true) {
+            uint8_t header[8];
+            if (!readExact(header, sizeof(header))) {
+                return fail("No data chunk found");
+            }
+            const uint32_t chunkSize = readLE32(header + 4);
+            if (std::memcmp(header, "fmt ", 4) == 0) {
+                if (!parseFormat(chunkSize)) {
+                    return false;
+                }
+                haveFormat = true;
+            } else if (std::memcmp(header, "data", 4) == 0) {
+                if (!haveFormat) {
+                    return fail("data chunk before fmt chunk");
+                }
+                sizeKnown = chunkSize != 0 && chunkSize != 0xFFFFFFFFu;
+                dataRemaining = sizeKnown ? chunkSize - chunkSize % blockAlign : 0;
+                break;
+            } else if (!skip(static_cast<uint64_t>(chunkSize) + (chunkSize & 1))) {
+                return fail("Truncated chunk before data");
+            }
+        }
+
+        info.isValid = true;
+        info.isValidated = true;
+        if (sizeKnown) {
+            info.frameCount = dataRemaining / blockAlign;
+            info.durationSeconds = static_cast<double>(info.frameCount) / info.sampleRate;
+            info.duration = info.durationSeconds;
+        }
+        return true;
+    }
+
+    void decode(const uint8_t* in, size_t samples, float* out) const {
+        switch (info.bitDepth) {
+            case 8:
+                for (size_t i = 0; i < samples; ++i) {
+                    out[i] = static_cast<float>(in[i]) * (2.0f / 255.0f) - 1.0f;  // As dr_wav
+                }
+                break;
+            case 16:
+                for (size_t i = 0; i < samples; ++i) {
+                    out[i] = static_cast<int16_t>(readLE16(in + i * 2)) / 32768.0f;
+                }
+                break;
+            case 24:
+                for (size_t i = 0; i < samples; ++i) {
+                    const uint8_t* p = in + i * 3;
+                    const int32_t value = static_cast<int32_t>(
+                        (static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16)
+                        | (static_cast<uint32_t>(p[2]) << 24));
+                    out[i] = static_cast<float>(value >> 8) / 8388608.0f;
+                }
+                break;
+            case 32:
+                if (formatTag == kWaveFormatFloat) {
+                    std::memcpy(out, in, samples * sizeof(float));
+                } else {
+                    for (size_t i = 0; i < samples; ++i) {
+                        out[i] = static_cast<float>(static_cast<int32_t>(readLE32(in + i * 4))
+                                                    / 2147483648.0);
+                    }
+                }
+                break;
+            case 64:
+                for (size_t i = 0; i < samples; ++i) {
+                    double value;
+                    std::memcpy(&value, in + i * 8, sizeof(value));
+                    out[i] = static_cast<float>(value);
+                }
+                break;
+        }
+    }
+
+    size_t read(float* output, size_t maxFrames) {
+        if (!info.isValid || !output) {
+            return 0;
+        }
+        size_t frames = 0;
+        while (frames < maxFrames) {
+            size_t wanted = maxFrames - frames;
+            if (sizeKnown) {
+                wanted = std::min<uint64_t>(wanted, dataRemaining / blockAlign);
+                if (wanted == 0) {
+                    break;
+                }
+            }
+            fill(blockAlign);
+            const size_t available = std::min(wanted, (end - begin) / blockAlign);
+            if (available == 0) {
+                if (sizeKnown) {
+                    lastError = "WAV data ended early";
+                }
+                break;
+            }
+            decode(buffer.data() + begin, available * info.channels,
+                   output + frames * info.channels);
+            begin += available * blockAlign;
+            frames += available;
+            if (sizeKnown) {
+                dataRemaining -= static_cast<uint64_t>(available) * blockAlign;
+            }
+        }
+        return frames;
+    }
+};
+
+WAVStreamDecoder::WAVStreamDecoder(ByteReader reader, size_t chunkBytes)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->reader = std::move(reader);
+    impl_->buffer.resize(std::max<size_t>(chunkBytes, 64));
+}
+
+WAVStreamDecoder::~WAVStreamDecoder() = default;
+
+bool WAVStreamDecoder::open() {
+    if (!impl_->reader) {
+        return impl_->fail("No input reader");
+    }
+    return impl_->open();
+}
+
+const AudioFormatInfo& WAVStreamDecoder::getFormatInfo() const {
+    return impl_->info;
+}
+
+uint32_t WAVStreamDecoder::sampleRate() const {
+    return impl_->info.sampleRate;
+}
+
+uint16_t WAVStreamDecoder::channels() const {
+    return impl_->info.channels;
+}
+
+std::optional<uint64_t> WAVStreamDecoder::totalFrames() const {
+    if (!impl_->sizeKnown) {
+        return std::nullopt;
+    }
+    return impl_->info.frameCount;
+}
+
+size_t WAVStreamDecoder::read(float* output, size_t maxFrames) {
+    return impl_->read(output, maxFrames);
+}
+
+std::string WAVStreamDecoder::getLastError() const {
+    return impl_->lastError;
+}
+
+ChannelConversionStage::ChannelConversionStage(std::unique_ptr<AudioStreamSource> upstream,
+                                               uint16_t targetChannels)
+    : upstream_(std::move(upstream)), targetChannels_(targetChannels) {
+    if (!upstream_ || targetChannels_ == 0 || upstream_->channels() == 0) {
+        throw std::invalid_argument("ChannelConversionStage: invalid upstream or channel count");
+    }
+}
+
+uint32_t ChannelConversionStage::sampleRate() const {
+    return upstream_->sampleRate();
+}
+
+uint16_t ChannelConversionStage::channels() const {
+    return targetChannels_;
+}
+
+std::optional<uint64_t> ChannelConversionStage::totalFrames() const {
+    return upstream_->totalFrames();
+}
+
+size_t ChannelConversionStage::read(float* output, size_t maxFrames) {
+    const size_t inChannels = upstream_->channels();
+    if (inChannels == targetChannels_) {
+        return upstream_->read(output, maxFrames);
+    }
+
+    scratch_.resize(maxFrames * inChannels);
+    const size_t frames = upstream_->read(scratch_.data(), maxFrames);
+    for (size_t i = 0; i < frames; ++i) {
+        const float* in = scratch_.data() + i * inChannels;
+        float* out = output + i * targetChannels_;
+        if (targetChannels_ == 1) {
+            float sum = 0.0f;
+            for (size_t c = 0; c < inChannels; ++c) {
+                sum += in[c];
+            }
+            out[0] = sum / static_cast<float>(inChannels);
+        } else {
+            for (size_t c = 0; c < targetChannels_; ++c) {
+                out[c] = in[c % inChannels];
+            }
+        }
+    }
+    return frames;
+}
+
+std::string ChannelConversionStage::getLastError() const {
+    return upstream_->getLastError();
+}
+
+namespace {
+
+PolyphaseResampler::Config resamplerConfigFor(const AudioStreamSource* upstream,
+                                              uint32_t targetSampleRate,
+                                              ResamplingQuality quality) {
+    if (!upstream) {
+        throw std::invalid_argument("ResamplingStage: no upstream");
+    }
+    return {upstream->sampleRate(), targetSampleRate, upstream->channels(), quality};
+}
+
+}  // namespace
+
+ResamplingStage::ResamplingStage(std::unique_ptr<AudioStreamSource> upstream,
+                                 uint32_t targetSampleRate,
+                                 ResamplingQuality quality,
+                                 size_t chunkFrames)
+    : upstream_(std::move(upstream)),
+      resampler_(resamplerConfigFor(upstream_.get(), targetSampleRate, quality)),
+      chunkFrames_(std::max<size_t>(chunkFrames, 1)) {}
+
+uint32_t ResamplingStage::sampleRate() const {
+    return resampler_.getConfig().outputRate;
+}
+
+uint16_t ResamplingStage::channels() const {
+    return upstream_->channels();
+}
+
+std::optional<uint64_t> ResamplingStage::totalFrames() const {
+    const auto frames = upstream_->totalFrames();
+    if (!frames) {
+        return std::nullopt;
+    }
+    const uint64_t inRate = resampler_.getConfig().inputRate;
+    return (*frames * resampler_.getConfig().outputRate + inRate - 1) / inRate;
+}
+
+size_t ResamplingStage::read(float* output, size_t maxFrames) {
+    const size_t channelCount = channels();
+    size_t frames = 0;
+    while (frames < maxFrames) {
+        if (pendingOffset_ == pending_.size()) {
+            if (flushed_) {
+                break;
+            }
+            pending_.clear();
+            pendingOffset_ = 0;
+            input_.resize(chunkFrames_ * channelCount);
+            const size_t read = upstream_->read(input_.data(), chunkFrames_);
+            if (read == 0) {
+                resampler_.flush(pending_);
+                flushed_ = true;
+            } else {
+                resampler_.process(input_.data(), read, pending_);
+            }
+            continue;
+        }
+        const size_t count =
+            std::min(maxFrames - frames, (pending_.size() - pendingOffset_) / channelCount);
+        std::copy_n(pending_.begin() + pendingOffset_, count * channelCount,
+                    output + frames * channelCount);
+        pendingOffset_ += count * channelCount;
+        frames += count;
+    }
+    return frames;
+}
+
+std::string ResamplingStage::getLastError() const {
+    return upstream_->getLastError();
+}
+
+WAVStreamEncoder::WAVStreamEncoder(ByteWriter writer, uint16_t bitDepth)
+    : writer_(std::move(writer)), bitDepth_(bitDepth) {}
+
+bool WAVStreamEncoder::writeAll(const uint8_t* data, size_t size) {
+    if (writer_(data, size) != size) {
+        lastError_ = "Output writer failed";
+        return false;
+    }
+    bytesWritten_ += size;
+    return true;
+}
+
+bool WAVStreamEncoder::encode(AudioStreamSource& source, size_t chunkFrames) {
+    framesWritten_ = 0;
+    bytesWritten_ = 0;
+    lastError_.clear();
+    if (!writer_) {
+        lastError_ = "No output writer";
+        return false;
+    }
+    if (bitDepth_ != 16 && bitDepth_ != 24 && bitDepth_ != 32) {
+        lastError_ = "Unsupported output bit depth: " + std::to_string(bitDepth_);
+        return false;
+    }
+
+    const uint16_t channelCount = source.channels();
+    const uint16_t bytesPerSample = bitDepth_ / 8;
+    const uint16_t blockAlign = channelCount * bytesPerSample;
+    const auto total = source.totalFrames();
+    const uint64_t dataBytes = total ? *total * blockAlign : 0;
+    const bool sizesFit = total && dataBytes + (dataBytes & 1) + 36 <= 0xFFFFFFFFu;
+
+    uint8_t header[44];
+    std::memcpy(header, "RIFF", 4);
+    writeLE32(header + 4, sizesFit ? static_cast<uint32_t>(36 + dataBytes + (dataBytes & 1))
+                                   : 0xFFFFFFFFu);
+    std::memcpy(header + 8, "WAVEfmt ", 8);
+    writeLE32(header + 16, 16);
+    writeLE16(header + 20, bitDepth_ == 32 ? kWaveFormatFloat : kWaveFormatPcm);
+    writeLE16(header + 22, channelCount);
+    writeLE32(header + 24, source.sampleRate());
+    writeLE32(header + 28, source.sampleRate() * blockAlign);
+    writeLE16(header + 32, blockAlign);
+    writeLE16(header + 34, bitDepth_);
+    std::memcpy(header + 36, "data", 4);
+    writeLE32(header + 40, sizesFit ? static_cast<uint32_t>(dataBytes) : 0xFFFFFFFFu);
+    if (!writeAll(header, sizeof(header))) {
+        return false;
+    }
+
+    chunkFrames = std::max<size_t>(chunkFrames, 1);
+    std::vector<float> samples(chunkFrames * channelCount);
+    std::vector<uint8_t> bytes(chunkFrames * blockAlign);
+    while (true) {
+        const size_t frames = source.read(samples.data(), chunkFrames);
+        if (frames == 0) {
+            break;
+        }
+        const size_t count = frames * channelCount;
+        for (size_t i = 0; i < count; ++i) {
+            const float sample = std::clamp(samples[i], -1.0f, 1.0f);
+            uint8_t* out = bytes.data() + i * bytesPerSample;
+            if (bitDepth_ == 16) {
+                writeLE16(out, static_cast<uint16_t>(
+                                   static_cast<int16_t>(std::lrint(sample * 32767.0f))));
+            } else if (bitDepth_ == 24) {
+                const auto value = static_cast<int32_t>(std::lrint(sample * 8388607.0f));
+                out[0] = static_cast<uint8_t>(value);
+                out[1] = static_cast<uint8_t>(value >> 8);
+                out[2] = static_cast<uint8_t>(value >> 16);
+            } else {
+                std::memcpy(out, &samples[i], sizeof(float));  // Float output is not clamped
+            }
+        }
+        if (!writeAll(bytes.data(), frames * blockAlign)) {
+            return false;
+        }
+        framesWritten_ += frames;
+    }
+
+    const std::string sourceError = source.getLastError();
+    if (!sourceError.empty()) {
+        lastError_ = sourceError;
+        return false;
+    }
+    if (total && framesWritten_ != *total) {
+        lastError_ = "Stream length did not match its header";
+        return false;
+    }
+    const uint64_t written = framesWritten_ * blockAlign;
+    if (written & 1) {
+        const uint8_t pad = 0;
+        return writeAll(&pad, 1);
+    }
+    return true;
+}
+
+uint64_t WAVStreamEncoder::getFramesWritten() const {
+    return framesWritten_;
+}
+
+uint64_t WAVStreamEncoder::getBytesWritten() const {
+    return bytesWritten_;
+}
+
+std::string WAVStreamEncoder::getLastError() const {
+    return lastError_;
+}
+
+WAVStreamConversionResult
+convertWAVStream(ByteReader reader, ByteWriter writer, const WAVStreamConversion& conversion) {
+    WAVStreamConversionResult result;
+    if (!reader || !writer) {
+        result.error = "Missing input reader or output writer";
+        return result;
+    }
+
+    try {
+        auto decoder = std::make_unique<WAVStreamDecoder>(std::move(reader));
+        if (!decoder->open()) {
+            result.error = decoder->getLastError();
+            return result;
+        }
+        std::unique_ptr<AudioStreamSource> source = std::move(decoder);
+
+        if (conversion.targetChannels != 0 && conversion.targetChannels != source->channels()) {
+            source = std::make_unique<ChannelConversionStage>(std::move(source),
+                                                              conversion.targetChannels);
+        }
+        if (conversion.targetSampleRate != 0
+            && conversion.targetSampleRate != source->sampleRate()) {
+            source = std::make_unique<ResamplingStage>(
+                std::move(source), conversion.targetSampleRate, conversion.quality);
+        }
+
+        WAVStreamEncoder encoder(std::move(writer), conversion.bitDepth);
+        result.success = encoder.encode(*source);
+        result.framesWritten = encoder.getFramesWritten();
+        result.bytesWritten = encoder.getBytesWritten();
+        if (!result.success) {
+            result.error = encoder.getLastError();
+        }
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.error = "Streaming conversion error: " + std::string(e.what());
+    }
+    return result;
+}
+
+}  // namespace core
+}  // namespace huntmaster
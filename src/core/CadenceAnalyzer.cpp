@@ -13,12 +13,153 @@
 #include "huntmaster/core/PerformanceProfiler.h"
 #include "huntmaster/security/memory-guard.h"
 
+#ifdef HAVE_KISSFFT
+#include "kiss_fftr.h"
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 namespace huntmaster {
 
+namespace {
+
+constexpr float kMinPeriodicityPeak = 0.1f;  // Weakest autocorrelation peak reported
+constexpr size_t kMaxPeriodicityPeaks = 10;
+
+/**
+ * @brief Autocorrelation of an onset envelope via zero-padded real FFTs
+ *
+ * r = IFFT(|FFT(x)|^2) costs O(N log N) whatever the lag range, against
+ * O(N * lags) for the direct sum. Plans are rebuilt only when the padded
+ * length changes, so repeated updates over a fixed window do not allocate.
+ */
+class OnsetAutocorrelator {
+  public:
+    OnsetAutocorrelator() = default;
+
+    ~OnsetAutocorrelator() {
+        release();
+    }
+
+    OnsetAutocorrelator(const OnsetAutocorrelator&) = delete;
+    OnsetAutocorrelator& operator=(const OnsetAutocorrelator&) = delete;
+
+    /**
+     * @brief Mean-removed autocorrelation of @p envelope for lags [0, maxLag]
+     *
+     * The result is normalised so r[0] = 1 (biased estimate, which favours the
+     * shortest of several equally strong periods).
+     *
+     * @return false if the envelope is constant or too short
+     */
+    bool compute(const float* envelope, size_t count, size_t maxLag, std::vector<float>& result) {
+        result.clear();
+        if (count < 2) {
+            return false;
+        }
+        maxLag = std::min(maxLag, count - 1);
+
+        double mean = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            mean += envelope[i];
+        }
+        mean /= static_cast<double>(count);
+
+#ifdef HAVE_KISSFFT
+        // Pad to at least count + maxLag so the circular correlation equals the linear one
+        size_t fftSize = 2;
+        while (fftSize < count + maxLag + 1) {
+            fftSize <<= 1;
+        }
+        if (!ensureSize(fftSize)) {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            timeBuffer_[i] = envelope[i] - static_cast<float>(mean);
+        }
+        std::fill(timeBuffer_.begin() + count, timeBuffer_.end(), 0.0f);
+
+        kiss_fftr(forward_, timeBuffer_.data(), spectrum_.data());
+        for (auto& bin : spectrum_) {
+            bin.r = bin.r * bin.r + bin.i * bin.i;
+            bin.i = 0.0f;
+        }
+        kiss_fftri(inverse_, spectrum_.data(), timeBuffer_.data());
+
+        const float* raw = timeBuffer_.data();
+#else
+        timeBuffer_.assign(maxLag + 1, 0.0f);
+        for (size_t lag = 0; lag <= maxLag; ++lag) {
+            double sum = 0.0;
+            for (size_t i = lag; i < count; ++i) {
+                sum += (envelope[i] - mean) * (envelope[i - lag] - mean);
+            }
+            timeBuffer_[lag] = static_cast<float>(sum);
+        }
+
+        const float* raw = timeBuffer_.data();
+#endif
+
+        if (!(raw[0] > 0.0f) || !std::isfinite(raw[0])) {
+            return false;
+        }
+
+        result.resize(maxLag + 1);
+        const float scale = 1.0f / raw[0];
+        for (size_t lag = 0; lag <= maxLag; ++lag) {
+            result[lag] = raw[lag] * scale;
+        }
+        return true;
+    }
+
+  private:
+#ifdef HAVE_KISSFFT
+    bool ensureSize(size_t fftSize) {
+        if (fftSize == fftSize_ && forward_ && inverse_) {
+            return true;
+        }
+        release();
+        forward_ = kiss_fftr_alloc(static_cast<int>(fftSize), 0, nullptr, nullptr);
+        inverse_ = kiss_fftr_alloc(static_cast<int>(fftSize), 1, nullptr, nullptr);
+        if (!forward_ || !inverse_) {
+            release();
+            return false;
+        }
+        fftSize_ = fftSize;
+        timeBuffer_.assign(fftSize, 0.0f);
+        spectrum_.assign(fftSize / 2 + 1, kiss_fft_cpx{});
+        return true;
+    }
+#endif
+
+    void release() {
+#ifdef HAVE_KISSFFT
+        if (forward_) {
+            kiss_fftr_free(forward_);
+            forward_ = nullptr;
+        }
+        if (inverse_) {
+            kiss_fftr_free(inverse_);
+            inverse_ = nullptr;
+        }
+        fftSize_ = 0;
+#endif
+    }
+
+    std::vector<float> timeBuffer_;
+#ifdef HAVE_KISSFFT
+    size_t fftSize_ = 0;
+    kiss_fftr_cfg forward_ = nullptr;
+    kiss_fftr_cfg inverse_ = nullptr;
+    std::vector<kiss_fft_cpx> spectrum_;
+#endif
+};
+
+}  // namespace
+
 /**
  * @brief Internal implementation of CadenceAnalyzer
  */
@@ -46,6 +187,18 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
     std::vector<float> spectralFlux_;
     float adaptiveThreshold_ = 0.0f;
 
+    // Periodicity state. Streaming keeps the onset envelope in a mirrored ring (each value is
+    // written twice) so the latest window is always contiguous, and refreshes its
+    // autocorrelation every periodicityUpdateHop frames at a cost set by the window alone.
+    OnsetAutocorrelator autocorrelator_;
+    std::vector<float> batchAutocorr_;
+    std::vector<float> streamAutocorr_;
+    std::vector<float> envelopeRing_;
+    size_t envelopeCapacity_ = 0;
+    size_t envelopeWritePos_ = 0;
+    size_t envelopeFill_ = 0;
+    size_t framesSinceUpdate_ = 0;
+
   public:
     CadenceAnalyzerImpl(const Config& config) : config_(config) {
         initializeParameters();
@@ -61,87 +214,7 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
     ~CadenceAnalyzerImpl() = default;
 
     Result<CadenceProfile, Error> analyzeCadence(std::span<const float> audio) override {
-        security::MemoryGuard guard(security::GuardConfig{});
-
-        if (!isInitialized_) {
-            return Result<CadenceProfile, Error>(unexpected<Error>(Error::INITIALIZATION_FAILED));
-        }
-
-        if (audio.size() < frameSize_) {
-            return Result<CadenceProfile, Error>(unexpected<Error>(Error::INSUFFICIENT_DATA));
-        }
-
-        try {
-            auto start = std::chrono::high_resolution_clock::now();
-
-            CadenceProfile profile;
-            profile.timestamp =
-                static_cast<float>(processedFrames_ * hopSize_) / config_.sampleRate;
-
-            // Detect onsets
-            auto onsetsResult = detectOnsetsInternal(audio);
-            if (!onsetsResult.has_value()) {
-                return unexpected(onsetsResult.error());
-            }
-
-            std::vector<float> onsets = onsetsResult.value();
-
-            // Analyze call sequence
-            analyzeCallSequence(profile, onsets);
-
-            // Estimate tempo if beat tracking enabled
-            if (config_.enableBeatTracking) {
-                auto tempoResult = estimateTempoInternal(audio, onsets);
-                if (tempoResult.has_value()) {
-                    auto tempoConf = tempoResult.value();
-                    float tempo = tempoConf.first;
-                    float confidence = tempoConf.second;
-                    profile.estimatedTempo = tempo;
-                    profile.tempoConfidence = confidence;
-
-                    // Extract beat times
-                    extractBeats(profile, onsets);
-                }
-            }
-
-            // Analyze periodicity
-            analyzePeriodicityInternal(profile, audio);
-
-            // Extract rhythmic features
-            if (!onsets.empty()) {
-                auto rhythmResult = extractRhythmicFeaturesInternal(onsets);
-                if (rhythmResult.has_value()) {
-                    profile.rhythm = rhythmResult.value();
-                }
-            }
-
-            // Syllable analysis if enabled
-            if (config_.enableSyllableAnalysis) {
-                analyzeSyllables(profile, audio, onsets);
-            }
-
-            // Calculate overall rhythm score
-            profile.overallRhythmScore = calculateOverallRhythmScore(profile);
-            profile.confidence = calculateConfidence(profile);
-            profile.hasStrongRhythm = profile.overallRhythmScore > 0.6f;
-
-            currentProfile_ = profile;
-            isActive_ = true;
-
-            auto end = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration<double, std::milli>(end - start).count();
-            updatePerformanceStats(duration);
-
-            // DEBUG_LOG removed for compilation
-            // "Analysis complete - Tempo: " + std::to_string(profile.estimatedTempo)
-            //     + "BPM, Rhythm Score: " + std::to_string(profile.overallRhythmScore));
-
-            return Result<CadenceProfile, Error>(std::move(profile));
-
-        } catch (const std::exception& e) {
-            // DEBUG_LOG removed for compilation
-            return Result<CadenceProfile, Error>(unexpected<Error>(Error::PROCESSING_ERROR));
-        }
+        return analyze(audio, false);
     }
 
     Result<void, Error> processAudioChunk(std::span<const float> audio) override {
@@ -155,7 +228,7 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         // Process if we have enough data
         while (buffer_.size() >= frameSize_) {
             std::span<const float> chunk(buffer_.data(), frameSize_);
-            auto result = analyzeCadence(chunk);
+            auto result = analyze(chunk, true);
 
             if (!result.has_value()) {
                 return unexpected(result.error());
@@ -181,18 +254,34 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
     }
 
     Result<std::pair<float, float>, Error> estimateTempo(std::span<const float> audio) override {
+        if (audio.size() < frameSize_) {
+            return Result<std::pair<float, float>, Error>(
+                unexpected<Error>(Error::INSUFFICIENT_DATA));
+        }
+
         auto onsetsResult = detectOnsetsInternal(audio);
         if (!onsetsResult.has_value()) {
             return Result<std::pair<float, float>, Error>(unexpected<Error>(onsetsResult.error()));
         }
+        if (!config_.enableOnsetDetection) {
+            computeSpectralFlux(audio);
+        }
 
-        return estimateTempoInternal(audio, onsetsResult.value());
+        const auto& autocorr = computeBatchAutocorrelation();
+        return estimateTempoInternal(autocorr, onsetsResult.value());
     }
 
     Result<CadenceProfile::PeriodicityMeasures, Error>
     analyzePerodicity(std::span<const float> audio) override {
+        if (audio.size() < frameSize_) {
+            return Result<CadenceProfile::PeriodicityMeasures, Error>(
+                unexpected<Error>(Error::INSUFFICIENT_DATA));
+        }
+
+        computeSpectralFlux(audio);
+
         CadenceProfile::PeriodicityMeasures measures;
-        analyzePeriodicityInternal(measures, audio);
+        analyzePeriodicityInternal(measures, computeBatchAutocorrelation());
         return Result<CadenceProfile::PeriodicityMeasures, Error>(measures);
     }
 
@@ -206,8 +295,9 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         energyHistory_.clear();
         onsetDetectionFunction_.clear();
         beatTrackingState_.clear();
-        prevSpectrum_.clear();
+        prevSpectrum_.assign(frameSize_ / 2 + 1, 0.0f);
         spectralFlux_.clear();
+        resetPeriodicityState();
 
         currentProfile_ = CadenceProfile{};
         isActive_ = false;
@@ -252,6 +342,7 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         }
         oss << "  Frame size: " << frameSize_ << " samples\n";
         oss << "  Hop size: " << hopSize_ << " samples\n";
+        oss << "  Onset history: " << envelopeFill_ << "/" << envelopeCapacity_ << " frames\n";
         oss << "  Sample rate: " << config_.sampleRate << "Hz";
         return oss.str();
     }
@@ -271,6 +362,102 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
     }
 
   private:
+    /**
+     * @brief Full cadence analysis of @p audio
+     * @param streaming True when called per hop from processAudioChunk; periodicity then comes
+     *        from the rolling onset history rather than from @p audio alone
+     */
+    Result<CadenceProfile, Error> analyze(std::span<const float> audio, bool streaming) {
+        security::MemoryGuard guard(security::GuardConfig{});
+
+        if (!isInitialized_) {
+            return Result<CadenceProfile, Error>(unexpected<Error>(Error::INITIALIZATION_FAILED));
+        }
+
+        if (audio.size() < frameSize_) {
+            return Result<CadenceProfile, Error>(unexpected<Error>(Error::INSUFFICIENT_DATA));
+        }
+
+        try {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            CadenceProfile profile;
+            profile.timestamp =
+                static_cast<float>(processedFrames_ * hopSize_) / config_.sampleRate;
+
+            // Detect onsets
+            auto onsetsResult = detectOnsetsInternal(audio);
+            if (!onsetsResult.has_value()) {
+                return unexpected(onsetsResult.error());
+            }
+            if (!config_.enableOnsetDetection) {
+                // Periodicity still needs the onset envelope
+                computeSpectralFlux(audio);
+            }
+
+            std::vector<float> onsets = onsetsResult.value();
+
+            const std::vector<float>& autocorr =
+                streaming ? updateStreamingAutocorrelation() : computeBatchAutocorrelation();
+
+            // Analyze call sequence
+            analyzeCallSequence(profile, onsets);
+
+            // Estimate tempo if beat tracking enabled
+            if (config_.enableBeatTracking) {
+                auto tempoResult = estimateTempoInternal(autocorr, onsets);
+                if (tempoResult.has_value()) {
+                    auto tempoConf = tempoResult.value();
+                    float tempo = tempoConf.first;
+                    float confidence = tempoConf.second;
+                    profile.estimatedTempo = tempo;
+                    profile.tempoConfidence = confidence;
+
+                    // Extract beat times
+                    extractBeats(profile, onsets);
+                }
+            }
+
+            // Analyze periodicity
+            analyzePeriodicityInternal(profile.periodicity, autocorr);
+
+            // Extract rhythmic features
+            if (!onsets.empty()) {
+                auto rhythmResult = extractRhythmicFeaturesInternal(onsets);
+                if (rhythmResult.has_value()) {
+                    profile.rhythm = rhythmResult.value();
+                }
+            }
+
+            // Syllable analysis if enabled
+            if (config_.enableSyllableAnalysis) {
+                analyzeSyllables(profile, audio, onsets);
+            }
+
+            // Calculate overall rhythm score
+            profile.overallRhythmScore = calculateOverallRhythmScore(profile);
+            profile.confidence = calculateConfidence(profile);
+            profile.hasStrongRhythm = profile.overallRhythmScore > 0.6f;
+
+            currentProfile_ = profile;
+            isActive_ = true;
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration<double, std::milli>(end - start).count();
+            updatePerformanceStats(duration);
+
+            // DEBUG_LOG removed for compilation
+            // "Analysis complete - Tempo: " + std::to_string(profile.estimatedTempo)
+            //     + "BPM, Rhythm Score: " + std::to_string(profile.overallRhythmScore));
+
+            return Result<CadenceProfile, Error>(std::move(profile));
+
+        } catch (const std::exception& e) {
+            // DEBUG_LOG removed for compilation
+            return Result<CadenceProfile, Error>(unexpected<Error>(Error::PROCESSING_ERROR));
+        }
+    }
+
     void initializeParameters() {
         frameSize_ = static_cast<size_t>(config_.frameSize * config_.sampleRate);
         hopSize_ = static_cast<size_t>(config_.hopSize * config_.sampleRate);
@@ -295,6 +482,75 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
 
         prevSpectrum_.resize(frameSize_ / 2 + 1, 0.0f);
         spectralFlux_.clear();
+
+        const float framesPerSecond = config_.sampleRate / static_cast<float>(hopSize_);
+        envelopeCapacity_ = std::max(
+            static_cast<size_t>(std::ceil(config_.periodicityWindow * framesPerSecond)),
+            static_cast<size_t>(4));
+        envelopeRing_.assign(envelopeCapacity_ * 2, 0.0f);
+        resetPeriodicityState();
+    }
+
+    void resetPeriodicityState() {
+        std::fill(envelopeRing_.begin(), envelopeRing_.end(), 0.0f);
+        envelopeWritePos_ = 0;
+        envelopeFill_ = 0;
+        framesSinceUpdate_ = 0;
+        batchAutocorr_.clear();
+        streamAutocorr_.clear();
+    }
+
+    float framesPerSecond() const {
+        return config_.sampleRate / static_cast<float>(hopSize_);
+    }
+
+    /// Longest lag (in flux frames) needed by either the periodicity or the tempo search
+    size_t maxAutocorrelationLag() const {
+        float longestPeriod = config_.maxPeriod;
+        if (config_.minTempo > 0.0f) {
+            longestPeriod = std::max(longestPeriod, 60.0f / config_.minTempo);
+        }
+        auto lag = static_cast<size_t>(std::ceil(longestPeriod * framesPerSecond())) + 1;
+        return std::min(lag, std::max(config_.autocorrelationLags, static_cast<size_t>(2)));
+    }
+
+    const std::vector<float>& computeBatchAutocorrelation() {
+        if (!autocorrelator_.compute(spectralFlux_.data(),
+                                     spectralFlux_.size(),
+                                     maxAutocorrelationLag(),
+                                     batchAutocorr_)) {
+            batchAutocorr_.clear();
+        }
+        return batchAutocorr_;
+    }
+
+    /**
+     * @brief Append the newest flux frames to the onset history and refresh its autocorrelation
+     *
+     * The autocorrelation is recomputed once every periodicityUpdateHop frames over at most
+     * envelopeCapacity_ frames, so the cost per update stays constant however long the call
+     * sequence runs.
+     */
+    const std::vector<float>& updateStreamingAutocorrelation() {
+        for (float flux : spectralFlux_) {
+            envelopeRing_[envelopeWritePos_] = flux;
+            envelopeRing_[envelopeWritePos_ + envelopeCapacity_] = flux;
+            envelopeWritePos_ = (envelopeWritePos_ + 1) % envelopeCapacity_;
+            envelopeFill_ = std::min(envelopeFill_ + 1, envelopeCapacity_);
+            ++framesSinceUpdate_;
+        }
+
+        if (framesSinceUpdate_ >= std::max(config_.periodicityUpdateHop, static_cast<size_t>(1))) {
+            framesSinceUpdate_ = 0;
+            // Oldest-to-newest window of the mirrored ring is contiguous
+            const float* window =
+                envelopeRing_.data() + envelopeWritePos_ + envelopeCapacity_ - envelopeFill_;
+            if (!autocorrelator_.compute(
+                    window, envelopeFill_, maxAutocorrelationLag(), streamAutocorr_)) {
+                streamAutocorr_.clear();
+            }
+        }
+        return streamAutocorr_;
     }
 
     Result<std::vector<float>, Error> detectOnsetsInternal(std::span<const float> audio) {
@@ -421,8 +677,29 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         adaptiveThreshold_ = median * config_.adaptiveThreshold;
     }
 
-    Result<std::pair<float, float>, Error> estimateTempoInternal(std::span<const float> audio,
-                                                                 const std::vector<float>& onsets) {
+    Result<std::pair<float, float>, Error>
+    estimateTempoInternal(const std::vector<float>& autocorr, const std::vector<float>& onsets) {
+        if (config_.minTempo > 0.0f && config_.maxTempo > config_.minTempo) {
+            const float fps = framesPerSecond();
+            std::vector<std::pair<float, float>> peaks;
+            findAutocorrelationPeaks(autocorr,
+                                     60.0f / config_.maxTempo * fps,
+                                     60.0f / config_.minTempo * fps,
+                                     peaks);
+            if (!peaks.empty()) {
+                float period = peaks.front().first / fps;
+                float tempo = std::clamp(60.0f / period, config_.minTempo, config_.maxTempo);
+                float confidence = std::clamp(peaks.front().second, 0.0f, 1.0f);
+                return Result<std::pair<float, float>, Error>(std::make_pair(tempo, confidence));
+            }
+        }
+
+        // No periodic onset envelope: fall back to the inter-onset interval histogram
+        return estimateTempoFromIntervals(onsets);
+    }
+
+    Result<std::pair<float, float>, Error>
+    estimateTempoFromIntervals(const std::vector<float>& onsets) {
         if (onsets.size() < 3) {
             return Result<std::pair<float, float>, Error>(std::make_pair(0.0f, 0.0f));
         }
@@ -529,78 +806,57 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         beatTrackingState_ = profile.beatStrengths;
     }
 
-    void analyzePeriodicityInternal(CadenceProfile& profile, std::span<const float> audio) {
-        analyzePeriodicityInternal(profile.periodicity, audio);
-    }
-
     void analyzePeriodicityInternal(CadenceProfile::PeriodicityMeasures& measures,
-                                    std::span<const float> audio) {
-        // Compute autocorrelation for periodicity analysis
-        std::vector<float> autocorr = computeAutocorrelation(audio);
-
-        if (autocorr.empty())
-            return;
+                                    const std::vector<float>& autocorr) {
+        const float fps = framesPerSecond();
 
-        // Find peaks in autocorrelation
-        std::vector<std::pair<size_t, float>> peaks;
-        findAutocorrelationPeaks(autocorr, peaks);
+        std::vector<std::pair<float, float>> peaks;
+        findAutocorrelationPeaks(autocorr, config_.minPeriod * fps, config_.maxPeriod * fps, peaks);
 
         if (!peaks.empty()) {
-            // Best peak (excluding lag 0)
-            auto bestPeak =
-                std::max_element(peaks.begin(), peaks.end(), [](const auto& a, const auto& b) {
-                    return a.second < b.second;
-                });
+            // Peaks are sorted strongest first
+            const auto& bestPeak = peaks.front();
 
-            measures.autocorrelationPeak = bestPeak->second;
-            measures.dominantPeriod = static_cast<float>(bestPeak->first) / config_.sampleRate;
-            measures.periodicityStrength = bestPeak->second;
+            measures.autocorrelationPeak = std::clamp(bestPeak.second, 0.0f, 1.0f);
+            measures.dominantPeriod = bestPeak.first / fps;
+            measures.periodicityStrength = measures.autocorrelationPeak;
 
             // Extract multiple periodicities
             for (const auto& [lag, strength] : peaks) {
-                float period = static_cast<float>(lag) / config_.sampleRate;
-                if (period >= config_.minPeriod && period <= config_.maxPeriod) {
-                    measures.periodicities.push_back(period);
-                    measures.periodicityStrengths.push_back(strength);
-                }
+                measures.periodicities.push_back(lag / fps);
+                measures.periodicityStrengths.push_back(strength);
             }
         }
     }
 
-    std::vector<float> computeAutocorrelation(std::span<const float> audio) {
-        size_t maxLag = std::min(config_.autocorrelationLags, audio.size() / 2);
-        std::vector<float> autocorr(maxLag);
-
-        for (size_t lag = 1; lag < maxLag; ++lag) {
-            float sum = 0.0f;
-            size_t count = 0;
-
-            for (size_t i = 0; i < audio.size() - lag; ++i) {
-                sum += audio[i] * audio[i + lag];
-                count++;
-            }
-
-            autocorr[lag] = count > 0 ? sum / count : 0.0f;
-        }
-
-        // Normalize
-        float maxVal = *std::max_element(autocorr.begin(), autocorr.end());
-        if (maxVal > 0.0f) {
-            for (float& val : autocorr) {
-                val /= maxVal;
-            }
+    /**
+     * @brief Local maxima of @p autocorr between two lags, strongest first
+     *
+     * Lags are refined by parabolic interpolation, so periods are not quantised to the hop.
+     */
+    void findAutocorrelationPeaks(const std::vector<float>& autocorr,
+                                  float minLag,
+                                  float maxLag,
+                                  std::vector<std::pair<float, float>>& peaks) {
+        peaks.clear();
+        if (autocorr.size() < 3) {
+            return;
         }
 
-        return autocorr;
-    }
+        size_t first = std::max(static_cast<size_t>(std::ceil(std::max(minLag, 0.0f))),
+                                static_cast<size_t>(1));
+        size_t last = std::min(static_cast<size_t>(std::max(maxLag, 0.0f)), autocorr.size() - 2);
 
-    void findAutocorrelationPeaks(const std::vector<float>& autocorr,
-                                  std::vector<std::pair<size_t, float>>& peaks) {
         // Find local maxima
-        for (size_t i = 1; i < autocorr.size() - 1; ++i) {
-            if (autocorr[i] > autocorr[i - 1] && autocorr[i] > autocorr[i + 1]
-                && autocorr[i] > 0.1f) {
-                peaks.push_back({i, autocorr[i]});
+        for (size_t i = first; i <= last; ++i) {
+            float alpha = autocorr[i - 1];
+            float beta = autocorr[i];
+            float gamma = autocorr[i + 1];
+            if (beta > alpha && beta >= gamma && beta > kMinPeriodicityPeak) {
+                float curvature = alpha - 2.0f * beta + gamma;
+                float delta = curvature < 0.0f ? 0.5f * (alpha - gamma) / curvature : 0.0f;
+                float value = beta - 0.25f * (alpha - gamma) * delta;
+                peaks.push_back({static_cast<float>(i) + delta, value});
             }
         }
 
@@ -610,8 +866,8 @@ class CadenceAnalyzerImpl : public CadenceAnalyzer {
         });
 
         // Keep only top peaks
-        if (peaks.size() > 10) {
-            peaks.resize(10);
+        if (peaks.size() > kMaxPeriodicityPeaks) {
+            peaks.resize(kMaxPeriodicityPeaks);
         }
     }
 
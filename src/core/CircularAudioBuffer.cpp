@@ -82,6 +82,13 @@ CircularAudioBuffer::CircularAudioBuffer(CircularAudioBuffer&& other) noexcept
       throughputHistory_(std::move(other.throughputHistory_)),
       currentThroughput_(other.currentThroughput_.load()), healthScore_(other.healthScore_.load()),
       isHealthy_(other.isHealthy_.load()) {
+    spscMode_ = other.spscMode_;
+    spscMask_ = other.spscMask_;
+    producer_.head.store(other.producer_.head.load());
+    producer_.cachedTail = other.producer_.cachedTail;
+    consumer_.tail.store(other.consumer_.tail.load());
+    consumer_.cachedHead = other.consumer_.cachedHead;
+
     other.initialized_ = false;
     other.buffer_.reset();
     other.bufferSize_ = 0;
@@ -110,6 +117,12 @@ CircularAudioBuffer& CircularAudioBuffer::operator=(CircularAudioBuffer&& other)
         currentThroughput_ = other.currentThroughput_.load();
         healthScore_ = other.healthScore_.load();
         isHealthy_ = other.isHealthy_.load();
+        spscMode_ = other.spscMode_;
+        spscMask_ = other.spscMask_;
+        producer_.head.store(other.producer_.head.load());
+        producer_.cachedTail = other.producer_.cachedTail;
+        consumer_.tail.store(other.consumer_.tail.load());
+        consumer_.cachedHead = other.consumer_.cachedHead;
 
         other.initialized_ = false;
         other.buffer_.reset();
@@ -148,6 +161,9 @@ bool CircularAudioBuffer::initialize(const CircularBufferConfig& config) {
         sequenceNumber_ = 0;
         timestamp_ = 0;
 
+        spscMode_ = config.enableSpscMode;
+        resetSpscState();
+
         writeInProgress_ = false;
         readInProgress_ = false;
 
@@ -211,7 +227,8 @@ bool CircularAudioBuffer::updateConfiguration(const CircularBufferConfig& config
     bool needsReinitialization = false;
 
     if (config.bufferSize != config_.bufferSize || config.numChannels != config_.numChannels
-        || config.sampleRate != config_.sampleRate) {
+        || config.sampleRate != config_.sampleRate
+        || config.enableSpscMode != config_.enableSpscMode) {
         needsReinitialization = true;
     }
 
@@ -228,6 +245,10 @@ bool CircularAudioBuffer::isInitialized() const {
     return initialized_;
 }
 
+bool CircularAudioBuffer::isSpscMode() const {
+    return spscMode_;
+}
+
 CircularBufferConfig CircularAudioBuffer::getConfiguration() const {
     std::lock_guard<std::mutex> lock(configMutex_);
     return config_;
@@ -315,6 +336,10 @@ size_t CircularAudioBuffer::peek(float* data, size_t sampleCount, size_t offset)
     }
 
     try {
+        if (spscMode_) {
+            return peekSpsc(data, sampleCount, offset);
+        }
+
         size_t available = getAvailableForRead();
         if (offset >= available) {
             return 0;  // Offset beyond available data
@@ -351,6 +376,10 @@ size_t CircularAudioBuffer::skip(size_t sampleCount) {
         return 0;
     }
 
+    if (spscMode_) {
+        return skipSpsc(sampleCount);
+    }
+
     try {
         size_t available = getAvailableForRead();
         size_t toSkip = std::min(sampleCount, available);
@@ -393,16 +422,105 @@ bool CircularAudioBuffer::skipToLatest(size_t& skipped) {
     }
 }
 
+template <typename T>
+BufferRegion<T> CircularAudioBuffer::makeRegion(size_t position, size_t count) const noexcept {
+    BufferRegion<T> region;
+    if (count == 0) {
+        return region;
+    }
+
+    const size_t capacity = bufferSize_.load(std::memory_order_relaxed);
+    const size_t firstPart = std::min(count, capacity - position);
+    region.first = std::span<T>(buffer_.get() + position, firstPart);
+    if (firstPart < count) {
+        region.second = std::span<T>(buffer_.get(), count - firstPart);
+    }
+    return region;
+}
+
+WriteRegion CircularAudioBuffer::acquireWrite(size_t sampleCount) {
+    if (!initialized_ || sampleCount == 0) {
+        return {};
+    }
+
+    if (spscMode_) {
+        const uint64_t head = producer_.head.load(std::memory_order_relaxed);
+        producer_.cachedTail = consumer_.tail.load(std::memory_order_acquire);
+        const size_t space = getCapacity() - static_cast<size_t>(head - producer_.cachedTail);
+        return makeRegion<float>(spscSlot(head), std::min(sampleCount, space));
+    }
+
+    const size_t count = std::min(sampleCount, getAvailableForWrite());
+    return makeRegion<float>(writePointer_.load(std::memory_order_acquire), count);
+}
+
+size_t CircularAudioBuffer::commitWrite(size_t sampleCount) {
+    if (!initialized_ || sampleCount == 0) {
+        return 0;
+    }
+
+    if (spscMode_) {
+        const uint64_t head = producer_.head.load(std::memory_order_relaxed);
+        size_t space = getCapacity() - static_cast<size_t>(head - producer_.cachedTail);
+        if (space < sampleCount) {
+            producer_.cachedTail = consumer_.tail.load(std::memory_order_acquire);
+            space = getCapacity() - static_cast<size_t>(head - producer_.cachedTail);
+        }
+        const size_t committed = std::min(sampleCount, space);
+        producer_.head.store(head + committed, std::memory_order_release);
+
+        producer_.pendingSamples += committed;
+        if (++producer_.pendingWrites >= kSpscStatisticsInterval) {
+            publishProducerStatistics();
+        }
+        return committed;
+    }
+
+    const size_t committed = std::min(sampleCount, getAvailableForWrite());
+    if (committed > 0) {
+        advanceWritePointer(committed);
+
+        statistics_.totalWrites.fetch_add(1, std::memory_order_relaxed);
+        statistics_.totalSamples.fetch_add(committed, std::memory_order_relaxed);
+        sequenceNumber_.fetch_add(1, std::memory_order_relaxed);
+
+        if (bufferStateCallback_) {
+            bufferStateCallback_(getCurrentLevel(), getFillRatio());
+        }
+    }
+    return committed;
+}
+
+ReadRegion CircularAudioBuffer::acquireRead(size_t sampleCount) const {
+    if (!initialized_ || sampleCount == 0) {
+        return {};
+    }
+
+    const size_t count = std::min(sampleCount, getAvailableForRead());
+    const size_t position = spscMode_ ? spscSlot(consumer_.tail.load(std::memory_order_relaxed))
+                                      : readPointer_.load(std::memory_order_acquire);
+    return makeRegion<const float>(position, count);
+}
+
+size_t CircularAudioBuffer::releaseRead(size_t sampleCount) {
+    // Releasing consumed samples is exactly a skip
+    return skip(sampleCount);
+}
+
 size_t CircularAudioBuffer::getAvailableForWrite() const {
     if (!initialized_) {
         return 0;
     }
 
+    if (spscMode_) {
+        return getCapacity() - getAvailableForRead();
+    }
+
+    // availableData_ tells a full ring from an empty one, so no slot is held back
     size_t currentLevel = availableData_.load(std::memory_order_acquire);
     size_t bufferSize = bufferSize_.load(std::memory_order_acquire);
 
-    return (bufferSize > currentLevel) ? (bufferSize - currentLevel - 1) : 0;
-    // Note: -1 to prevent write pointer from catching up to read pointer
+    return (bufferSize > currentLevel) ? (bufferSize - currentLevel) : 0;
 }
 
 size_t CircularAudioBuffer::getAvailableForRead() const {
@@ -410,6 +528,13 @@ size_t CircularAudioBuffer::getAvailableForRead() const {
         return 0;
     }
 
+    if (spscMode_) {
+        // Load the consumer index first so the difference can never go negative
+        const uint64_t tail = consumer_.tail.load(std::memory_order_acquire);
+        const uint64_t head = producer_.head.load(std::memory_order_acquire);
+        return static_cast<size_t>(head - tail);
+    }
+
     return availableData_.load(std::memory_order_acquire);
 }
 
@@ -452,6 +577,7 @@ void CircularAudioBuffer::clear() {
         writePointer_ = 0;
         readPointer_ = 0;
         availableData_ = 0;
+        resetSpscState();
 
         if (buffer_) {
             std::memset(buffer_.get(), 0, bufferSize_ * sizeof(float));
@@ -524,9 +650,9 @@ bool CircularAudioBuffer::resize(size_t newSize) {
             return false;
         }
 
-        size_t dataToCopy = std::min(getAvailableForRead(), newSize - 1);
+        size_t dataToCopy = std::min(getAvailableForRead(), spscMode_ ? newSize : newSize - 1);
         if (dataToCopy > 0) {
-            size_t readPos = readPointer_.load();
+            size_t readPos = spscMode_ ? spscSlot(consumer_.tail.load()) : readPointer_.load();
 
             if (readPos + dataToCopy <= oldSize) {
                 // Single contiguous copy
@@ -548,6 +674,8 @@ bool CircularAudioBuffer::resize(size_t newSize) {
         readPointer_ = 0;
         writePointer_ = dataToCopy;
         availableData_ = dataToCopy;
+        resetSpscState();
+        producer_.head.store(dataToCopy, std::memory_order_release);
 
         if (resizeCallback_) {
             resizeCallback_(oldSize, newSize);
@@ -624,6 +752,7 @@ void CircularAudioBuffer::cleanupBuffer() {
     availableData_ = 0;
     sequenceNumber_ = 0;
     timestamp_ = 0;
+    resetSpscState();
 }
 
 bool CircularAudioBuffer::validateConfiguration(const CircularBufferConfig& config,
@@ -681,6 +810,10 @@ size_t CircularAudioBuffer::writeInternal(const float* data, size_t sampleCount,
         return 0;
     }
 
+    if (spscMode_) {
+        return writeSpsc(data, sampleCount);
+    }
+
     auto startTime = std::chrono::high_resolution_clock::now();
 
     try {
@@ -696,11 +829,14 @@ size_t CircularAudioBuffer::writeInternal(const float* data, size_t sampleCount,
                     break;
                 }
 
+                // Protected writes report the overflow and return what fit; otherwise
+                // wait for the reader to make room
                 if (config_.enableOverflowProtection) {
                     if (overflowCallback_) {
                         overflowCallback_(remaining, available);
                     }
                     statistics_.overflowCount.fetch_add(1, std::memory_order_relaxed);
+                    break;
                 }
 
                 std::this_thread::yield();
@@ -779,6 +915,10 @@ size_t CircularAudioBuffer::readInternal(float* data, size_t sampleCount, bool b
         return 0;
     }
 
+    if (spscMode_) {
+        return readSpsc(data, sampleCount);
+    }
+
     auto startTime = std::chrono::high_resolution_clock::now();
 
     try {
@@ -799,6 +939,7 @@ size_t CircularAudioBuffer::readInternal(float* data, size_t sampleCount, bool b
                         underflowCallback_(remaining, available);
                     }
                     statistics_.underflowCount.fetch_add(1, std::memory_order_relaxed);
+                    break;
                 }
 
                 std::this_thread::yield();
@@ -885,6 +1026,148 @@ void CircularAudioBuffer::advanceReadPointer(size_t samples) {
     availableData_.fetch_sub(samples, std::memory_order_acq_rel);
 }
 
+size_t CircularAudioBuffer::spscSlot(uint64_t index) const noexcept {
+    if (spscMask_ != 0) {
+        return static_cast<size_t>(index & spscMask_);
+    }
+    return static_cast<size_t>(index % bufferSize_.load(std::memory_order_relaxed));
+}
+
+void CircularAudioBuffer::resetSpscState() noexcept {
+    const size_t capacity = bufferSize_.load();
+    spscMask_ = (capacity > 0 && (capacity & (capacity - 1)) == 0) ? capacity - 1 : 0;
+
+    producer_.head.store(0, std::memory_order_relaxed);
+    producer_.cachedTail = 0;
+    producer_.pendingWrites = 0;
+    producer_.pendingSamples = 0;
+    producer_.pendingOverflows = 0;
+
+    consumer_.tail.store(0, std::memory_order_relaxed);
+    consumer_.cachedHead = 0;
+    consumer_.pendingReads = 0;
+    consumer_.pendingUnderflows = 0;
+}
+
+size_t CircularAudioBuffer::writeSpsc(const float* data, size_t sampleCount) noexcept {
+    const size_t capacity = bufferSize_.load(std::memory_order_relaxed);
+    const uint64_t head = producer_.head.load(std::memory_order_relaxed);
+
+    // Only touch the consumer's cache line when the cached view says we are short
+    size_t space = capacity - static_cast<size_t>(head - producer_.cachedTail);
+    if (space < sampleCount) {
+        producer_.cachedTail = consumer_.tail.load(std::memory_order_acquire);
+        space = capacity - static_cast<size_t>(head - producer_.cachedTail);
+    }
+
+    const size_t toWrite = std::min(sampleCount, space);
+    if (toWrite > 0) {
+        const size_t pos = spscSlot(head);
+        const size_t firstPart = std::min(toWrite, capacity - pos);
+        std::memcpy(buffer_.get() + pos, data, firstPart * sizeof(float));
+        if (firstPart < toWrite) {
+            std::memcpy(buffer_.get(), data + firstPart, (toWrite - firstPart) * sizeof(float));
+        }
+        producer_.head.store(head + toWrite, std::memory_order_release);
+    }
+
+    if (toWrite < sampleCount && config_.enableOverflowProtection) {
+        ++producer_.pendingOverflows;
+    }
+    producer_.pendingSamples += toWrite;
+    if (++producer_.pendingWrites >= kSpscStatisticsInterval) {
+        publishProducerStatistics();
+    }
+    return toWrite;
+}
+
+size_t CircularAudioBuffer::readSpsc(float* data, size_t sampleCount) noexcept {
+    const size_t capacity = bufferSize_.load(std::memory_order_relaxed);
+    const uint64_t tail = consumer_.tail.load(std::memory_order_relaxed);
+
+    size_t available = static_cast<size_t>(consumer_.cachedHead - tail);
+    if (available < sampleCount) {
+        consumer_.cachedHead = producer_.head.load(std::memory_order_acquire);
+        available = static_cast<size_t>(consumer_.cachedHead - tail);
+    }
+
+    const size_t toRead = std::min(sampleCount, available);
+    if (toRead > 0) {
+        const size_t pos = spscSlot(tail);
+        const size_t firstPart = std::min(toRead, capacity - pos);
+        std::memcpy(data, buffer_.get() + pos, firstPart * sizeof(float));
+        if (firstPart < toRead) {
+            std::memcpy(data + firstPart, buffer_.get(), (toRead - firstPart) * sizeof(float));
+        }
+        consumer_.tail.store(tail + toRead, std::memory_order_release);
+    }
+
+    if (toRead < sampleCount && config_.enableUnderflowProtection) {
+        ++consumer_.pendingUnderflows;
+    }
+    if (++consumer_.pendingReads >= kSpscStatisticsInterval) {
+        publishConsumerStatistics();
+    }
+    return toRead;
+}
+
+size_t CircularAudioBuffer::peekSpsc(float* data,
+                                     size_t sampleCount,
+                                     size_t offset) const noexcept {
+    const size_t capacity = bufferSize_.load(std::memory_order_relaxed);
+    const uint64_t tail = consumer_.tail.load(std::memory_order_relaxed);
+    const size_t available =
+        static_cast<size_t>(producer_.head.load(std::memory_order_acquire) - tail);
+    if (offset >= available) {
+        return 0;
+    }
+
+    const size_t count = std::min(sampleCount, available - offset);
+    const size_t pos = spscSlot(tail + offset);
+    const size_t firstPart = std::min(count, capacity - pos);
+    std::memcpy(data, buffer_.get() + pos, firstPart * sizeof(float));
+    if (firstPart < count) {
+        std::memcpy(data + firstPart, buffer_.get(), (count - firstPart) * sizeof(float));
+    }
+    return count;
+}
+
+size_t CircularAudioBuffer::skipSpsc(size_t sampleCount) noexcept {
+    const uint64_t tail = consumer_.tail.load(std::memory_order_relaxed);
+    consumer_.cachedHead = producer_.head.load(std::memory_order_acquire);
+
+    const size_t toSkip = std::min(sampleCount, static_cast<size_t>(consumer_.cachedHead - tail));
+    if (toSkip > 0) {
+        consumer_.tail.store(tail + toSkip, std::memory_order_release);
+        if (++consumer_.pendingReads >= kSpscStatisticsInterval) {
+            publishConsumerStatistics();
+        }
+    }
+    return toSkip;
+}
+
+void CircularAudioBuffer::publishProducerStatistics() noexcept {
+    // One relaxed add per counter per interval instead of per operation
+    statistics_.totalWrites.fetch_add(producer_.pendingWrites, std::memory_order_relaxed);
+    statistics_.totalSamples.fetch_add(producer_.pendingSamples, std::memory_order_relaxed);
+    if (producer_.pendingOverflows > 0) {
+        statistics_.overflowCount.fetch_add(producer_.pendingOverflows, std::memory_order_relaxed);
+    }
+    producer_.pendingWrites = 0;
+    producer_.pendingSamples = 0;
+    producer_.pendingOverflows = 0;
+}
+
+void CircularAudioBuffer::publishConsumerStatistics() noexcept {
+    statistics_.totalReads.fetch_add(consumer_.pendingReads, std::memory_order_relaxed);
+    if (consumer_.pendingUnderflows > 0) {
+        statistics_.underflowCount.fetch_add(consumer_.pendingUnderflows,
+                                             std::memory_order_relaxed);
+    }
+    consumer_.pendingReads = 0;
+    consumer_.pendingUnderflows = 0;
+}
+
 void CircularAudioBuffer::recordWriteLatency(float latency) {
     std::lock_guard<std::mutex> lock(statisticsMutex_);
 
@@ -1238,16 +1521,5 @@ bool validateBufferConfiguration(const CircularBufferConfig& config, std::string
     return tempBuffer.validateConfiguration(config, error);
 }
 
-// Custom deleter for aligned memory
-struct AlignedDeleter {
-    void operator()(float* ptr) const {
-#ifdef _WIN32
-        _aligned_free(ptr);
-#else
-        free(ptr);
-#endif
-    }
-};
-
 }  // namespace core
 }  // namespace huntmaster
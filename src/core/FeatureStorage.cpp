@@ -0,0 +1,351 @@
+/**
+ * @file FeatureStorage.cpp
+ * @brief Checksums, file mappings and config records for persisted features
+ */
+
+#include "huntmaster/core/FeatureStorage.h"
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace huntmaster {
+
+namespace {
+
+#ifndef __SSE4_2__
+constexpr uint32_t kCrc32cPolynomial = 0x82F63B78u;  // Reflected Castagnoli
+
+/// Slice-by-8 tables: entry [k][b] is the CRC of byte b followed by k zero bytes
+using Crc32cTables = std::array<std::array<uint32_t, 256>, 8>;
+
+const Crc32cTables& crc32cTables() {
+    static const Crc32cTables tables = [] {
+        Crc32cTables t{};
+        for (uint32_t b = 0; b < 256; ++b) {
+            uint32_t crc = b;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1u) ? kCrc32cPolynomial : 0u);
+            }
+            t[0][b] = crc;
+        }
+        for (size_t k = 1; k < 8; ++k) {
+            for (uint32_t b = 0; b < 256; ++b) {
+                t[k][b] = (t[k - 1][b] >> 8) ^ t[0][t[k - 1][b] & 0xFFu];
+            }
+        }
+        return t;
+    }();
+    return tables;
+}
+#endif
+
+constexpr uint32_t kFeatureFileMagic = 0x43464D48u;  // "HMFC"
+
+struct FeatureFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t frames;
+    uint32_t coefficients;
+    uint32_t payloadChecksum;
+    FeatureConfigRecord config;
+    uint32_t headerChecksum;  // This header with headerChecksum zeroed
+    uint32_t reserved;
+};
+
+static_assert(sizeof(FeatureFileHeader) == 64, "FeatureFileHeader is an on-disk layout");
+
+}  // namespace
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+
+#ifdef __SSE4_2__
+    uint64_t crc64 = crc;
+    for (; size >= 8; size -= 8, bytes += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; size > 0; --size, ++bytes) {
+        crc = _mm_crc32_u8(crc, *bytes);
+    }
+#else
+    const auto& t = crc32cTables();
+    for (; size >= 8; size -= 8, bytes += 8) {
+        uint32_t lo;
+        uint32_t hi;
+        std::memcpy(&lo, bytes, sizeof(lo));  // Little-endian hosts only, like the file formats
+        std::memcpy(&hi, bytes + 4, sizeof(hi));
+        lo ^= crc;
+        crc = t[7][lo & 0xFFu] ^ t[6][(lo >> 8) & 0xFFu] ^ t[5][(lo >> 16) & 0xFFu]
+              ^ t[4][lo >> 24] ^ t[3][hi & 0xFFu] ^ t[2][(hi >> 8) & 0xFFu]
+              ^ t[1][(hi >> 16) & 0xFFu] ^ t[0][hi >> 24];
+    }
+    for (; size > 0; --size, ++bytes) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *bytes) & 0xFFu];
+    }
+#endif
+
+    return ~crc;
+}
+
+FeatureConfigRecord FeatureConfigRecord::fromMFCC(const MFCCProcessor::Config& config,
+                                                  size_t hopSize) noexcept {
+    FeatureConfigRecord record;
+    record.sampleRate = static_cast<uint32_t>(config.sample_rate);
+    record.frameSize = static_cast<uint32_t>(config.frame_size);
+    record.hopSize = static_cast<uint32_t>(hopSize);
+    record.numCoefficients = static_cast<uint32_t>(config.num_coefficients);
+    record.numFilters = static_cast<uint32_t>(config.num_filters);
+    record.lifterCoeff = static_cast<uint32_t>(config.lifter_coeff);
+    record.flags =
+        (config.use_energy ? kUseEnergy : 0u) | (config.apply_lifter ? kApplyLifter : 0u);
+    return record;
+}
+
+MFCCProcessor::Config FeatureConfigRecord::toMFCC() const noexcept {
+    MFCCProcessor::Config config;
+    config.sample_rate = sampleRate;
+    config.frame_size = frameSize;
+    config.num_coefficients = numCoefficients;
+    config.num_filters = numFilters;
+    config.lifter_coeff = lifterCoeff;
+    config.use_energy = (flags & kUseEnergy) != 0;
+    config.apply_lifter = (flags & kApplyLifter) != 0;
+    return config;
+}
+
+// ReadOnlyFileMapping
+
+ReadOnlyFileMapping::~ReadOnlyFileMapping() {
+    close();
+}
+
+ReadOnlyFileMapping::ReadOnlyFileMapping(ReadOnlyFileMapping&& other) noexcept {
+    *this = std::move(other);
+}
+
+ReadOnlyFileMapping& ReadOnlyFileMapping::operator=(ReadOnlyFileMapping&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        fileHandle_ = std::exchange(other.fileHandle_, nullptr);
+        mappingHandle_ = std::exchange(other.mappingHandle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool ReadOnlyFileMapping::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_DELETE,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle_ = file;
+    mappingHandle_ = mapping;
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file alive; the descriptor is no longer needed
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+
+    return true;
+}
+
+void ReadOnlyFileMapping::close() noexcept {
+    if (!data_) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(mappingHandle_);
+    CloseHandle(fileHandle_);
+    fileHandle_ = nullptr;
+    mappingHandle_ = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+// FeatureFile
+
+huntmaster::expected<FeatureFile, FeatureFileError> FeatureFile::open(const std::string& path) {
+    FeatureFile file;
+    if (!file.mapping_.open(path)) {
+        return huntmaster::unexpected(FeatureFileError::FILE_NOT_FOUND);
+    }
+
+    const uint8_t* base = file.mapping_.data();
+    const size_t size = file.mapping_.size();
+    FeatureFileHeader header;
+    if (size < sizeof(header)) {
+        return huntmaster::unexpected(FeatureFileError::UNSUPPORTED_VERSION);
+    }
+    std::memcpy(&header, base, sizeof(header));
+    if (header.magic != kFeatureFileMagic) {
+        return huntmaster::unexpected(FeatureFileError::UNSUPPORTED_VERSION);
+    }
+    if (header.version != kFormatVersion || header.headerSize != sizeof(header)) {
+        return huntmaster::unexpected(FeatureFileError::UNSUPPORTED_VERSION);
+    }
+    const uint32_t storedHeaderChecksum = header.headerChecksum;
+    header.headerChecksum = 0;
+    if (crc32c(&header, sizeof(header)) != storedHeaderChecksum) {
+        return huntmaster::unexpected(FeatureFileError::CHECKSUM_MISMATCH);
+    }
+
+    const uint64_t payloadBytes =
+        static_cast<uint64_t>(header.frames) * header.coefficients * sizeof(float);
+    if (header.frames == 0 || header.coefficients == 0
+        || payloadBytes != size - sizeof(header)) {
+        return huntmaster::unexpected(FeatureFileError::INVALID_FORMAT);
+    }
+    if (crc32c(base + sizeof(header), payloadBytes) != header.payloadChecksum) {
+        return huntmaster::unexpected(FeatureFileError::CHECKSUM_MISMATCH);
+    }
+
+    // The mapping is page aligned and the header is 64 bytes, so rows are aligned too
+    file.data_ = reinterpret_cast<const float*>(base + sizeof(header));
+    file.frames_ = header.frames;
+    file.coefficients_ = header.coefficients;
+    file.config_ = header.config;
+    return file;
+}
+
+huntmaster::expected<FeatureFile, FeatureFileError>
+FeatureFile::open(const std::string& path, const FeatureConfigRecord& expectedConfig) {
+    auto file = open(path);
+    if (file && file->config() != expectedConfig) {
+        return huntmaster::unexpected(FeatureFileError::CONFIG_MISMATCH);
+    }
+    return file;
+}
+
+huntmaster::expected<void, FeatureFileError>
+FeatureFile::write(const std::string& path,
+                   const FeatureConfigRecord& config,
+                   const MFCCProcessor::FeatureMatrix& features) {
+    if (features.empty() || features.front().empty()) {
+        return huntmaster::unexpected(FeatureFileError::INVALID_FORMAT);
+    }
+    const size_t coefficients = features.front().size();
+
+    FeatureFileHeader header{};
+    header.magic = kFeatureFileMagic;
+    header.version = kFormatVersion;
+    header.headerSize = sizeof(header);
+    header.frames = static_cast<uint32_t>(features.size());
+    header.coefficients = static_cast<uint32_t>(coefficients);
+    header.config = config;
+    for (const auto& frame : features) {
+        if (frame.size() != coefficients) {
+            return huntmaster::unexpected(FeatureFileError::INVALID_FORMAT);
+        }
+        header.payloadChecksum =
+            crc32c(frame.data(), frame.size() * sizeof(float), header.payloadChecksum);
+    }
+    header.headerChecksum = crc32c(&header, sizeof(header));
+
+    // Unique per writer so concurrent sessions caching the same call do not collide
+    const std::string tempPath =
+        path + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& frame : features) {
+            out.write(reinterpret_cast<const char*>(frame.data()),
+                      static_cast<std::streamsize>(frame.size() * sizeof(float)));
+        }
+        if (!out.flush()) {
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return huntmaster::unexpected(FeatureFileError::IO_ERROR);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return huntmaster::unexpected(FeatureFileError::IO_ERROR);
+    }
+    return {};
+}
+
+MFCCProcessor::FeatureMatrix FeatureFile::featureMatrix() const {
+    MFCCProcessor::FeatureMatrix matrix(frames_);
+    for (size_t i = 0; i < frames_; ++i) {
+        const auto row = frame(i);
+        matrix[i].assign(row.begin(), row.end());
+    }
+    return matrix;
+}
+
+}  // namespace huntmaster
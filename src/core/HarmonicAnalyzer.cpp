@@ -20,8 +20,67 @@
 #include <fftw3.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace huntmaster {
 
+namespace {
+
+constexpr float kLPCPreEmphasis = 0.97f;      // First-order pre-emphasis before LPC
+constexpr double kLPCLagBandwidth = 40.0;     // Gaussian lag window bandwidth (Hz)
+constexpr double kLPCNoiseCorrection = 1e-4;  // White-noise correction on r[0]
+constexpr float kFormantHalfPowerDb = 3.0f;   // Bandwidth measured at -3 dB
+
+/**
+ * @brief Dot product of two float arrays, vectorised where the target allows
+ */
+float dotProduct(const float* a, const float* b, size_t count) {
+    size_t i = 0;
+    float sum = 0.0f;
+
+#if defined(__AVX2__)
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    __m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc4);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+    // Independent accumulators so the compiler can keep several FMAs in flight
+    float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    for (; i + 4 <= count; i += 4) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    sum = (s0 + s1) + (s2 + s3);
+#endif
+
+    for (; i < count; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+}  // namespace
+
 /**
  * @brief Internal implementation of HarmonicAnalyzer
  */
@@ -33,6 +92,21 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
     std::vector<float> spectrum_;
     std::vector<float> frequencyBins_;
 
+    // LPC formant analysis; everything is sized up front so per-hop tracking never allocates
+    size_t lpcOrder_ = 0;
+    size_t lpcFrameSize_ = 0;
+    std::vector<float> lpcWindow_;     // Hamming window over the LPC frame
+    std::vector<float> lpcFrame_;      // Pre-emphasised, windowed frame
+    std::vector<double> lpcAutocorr_;  // r[0..order]
+    std::vector<double> lpcLagWindow_;
+    std::vector<double> lpcCoeffs_;  // a[0..order], a[0] = 1
+    std::vector<double> lpcScratch_;
+    std::vector<float> lpcPoly_;       // Float copy of lpcCoeffs_ for envelope evaluation
+    std::vector<float> lpcGridFreqs_;  // Envelope grid in Hz
+    std::vector<float> lpcGridCos_;    // gridSize x (order + 1) cos(w k)
+    std::vector<float> lpcGridSin_;    // gridSize x (order + 1) sin(w k)
+    std::vector<float> lpcEnvelope_;   // Envelope in dB on the grid
+
     HarmonicProfile currentProfile_;
     bool isInitialized_ = false;
     bool isActive_ = false;
@@ -54,6 +128,7 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
         createFFTPlan();
         generateWindow();
         generateFrequencyBins();
+        initializeLPC();
         isInitialized_ = true;
 
         // DEBUG_LOG removed for compilation
@@ -95,15 +170,16 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
             // Find fundamental frequency
             profile.fundamentalFreq = findFundamentalFrequency();
 
+            // Formants describe the resonator rather than the source, so they are tracked
+            // on every frame, voiced or not
+            if (config_.enableFormantTracking) {
+                extractFormantsInternal(profile, audio);
+            }
+
             if (profile.fundamentalFreq > 0.0f) {
                 // Analyze harmonics
                 analyzeHarmonicStructure(profile);
 
-                // Extract formants if enabled
-                if (config_.enableFormantTracking) {
-                    extractFormantsInternal(profile);
-                }
-
                 // Assess tonal qualities if enabled
                 if (config_.enableTonalAnalysis) {
                     assessTonalQualitiesInternal(profile);
@@ -182,6 +258,18 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
     }
 
     Result<std::vector<float>, Error> extractFormants(std::span<const float> audio) override {
+        if (config_.useLPCFormants) {
+            if (audio.size() < lpcFrameSize_) {
+                return Result<std::vector<float>, Error>(
+                    unexpected<Error>(Error::INSUFFICIENT_DATA));
+            }
+
+            std::vector<float> formants;
+            std::vector<float> bandwidths;
+            extractFormantsLPC(audio, formants, bandwidths);
+            return Result<std::vector<float>, Error>(std::move(formants));
+        }
+
         auto spectrumResult = computeSpectrum(audio);
         if (!spectrumResult.has_value()) {
             return Result<std::vector<float>, Error>(unexpected<Error>(spectrumResult.error()));
@@ -230,6 +318,7 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
         createFFTPlan();
         generateWindow();
         generateFrequencyBins();
+        initializeLPC();
 
         // DEBUG_LOG removed for compilation
         return Result<void, Error>();
@@ -254,6 +343,9 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
                 << "ms\n";
         }
         oss << "  FFT size: " << config_.fftSize << "\n";
+        if (config_.useLPCFormants) {
+            oss << "  LPC order: " << lpcOrder_ << " (frame " << lpcFrameSize_ << ")\n";
+        }
         oss << "  Sample rate: " << config_.sampleRate << "Hz";
         return oss.str();
     }
@@ -300,6 +392,61 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
         }
     }
 
+    void initializeLPC() {
+        lpcFrameSize_ = config_.lpcFrameSize > 0
+                            ? std::min(config_.lpcFrameSize, config_.fftSize)
+                            : config_.fftSize;
+
+        lpcOrder_ = config_.lpcOrder > 0
+                        ? config_.lpcOrder
+                        : 2 + static_cast<size_t>(config_.sampleRate / 1000.0f);
+        lpcOrder_ = std::min(lpcOrder_, lpcFrameSize_ > 1 ? lpcFrameSize_ - 1 : size_t{1});
+
+        lpcWindow_.resize(lpcFrameSize_);
+        for (size_t i = 0; i < lpcFrameSize_; ++i) {
+            lpcWindow_[i] =
+                lpcFrameSize_ > 1
+                    ? 0.54f - 0.46f * std::cos(2.0f * M_PI * i / (lpcFrameSize_ - 1))
+                    : 1.0f;
+        }
+        lpcFrame_.assign(lpcFrameSize_, 0.0f);
+
+        const size_t coeffCount = lpcOrder_ + 1;
+        lpcAutocorr_.assign(coeffCount, 0.0);
+        lpcCoeffs_.assign(coeffCount, 0.0);
+        lpcScratch_.assign(coeffCount, 0.0);
+        lpcPoly_.assign(coeffCount, 0.0f);
+
+        // Gaussian lag window: smooths the envelope so LPC peaks follow resonances rather than
+        // individual harmonics of high-pitched calls
+        lpcLagWindow_.resize(coeffCount);
+        for (size_t k = 0; k < coeffCount; ++k) {
+            double x = 2.0 * M_PI * kLPCLagBandwidth * static_cast<double>(k) / config_.sampleRate;
+            lpcLagWindow_[k] = std::exp(-0.5 * x * x);
+        }
+
+        // Coarse envelope grid; peak positions are refined by parabolic interpolation
+        const float nyquist = config_.sampleRate * 0.5f;
+        const float lowFreq = std::clamp(config_.minFormantFrequency, 0.0f, nyquist);
+        const float highFreq = std::clamp(config_.maxFormantFrequency, lowFreq, nyquist);
+        const size_t gridSize = std::max<size_t>(config_.lpcGridSize, 3);
+        const float step = (highFreq - lowFreq) / static_cast<float>(gridSize - 1);
+
+        lpcGridFreqs_.resize(gridSize);
+        lpcGridCos_.resize(gridSize * coeffCount);
+        lpcGridSin_.resize(gridSize * coeffCount);
+        lpcEnvelope_.assign(gridSize, 0.0f);
+
+        for (size_t g = 0; g < gridSize; ++g) {
+            lpcGridFreqs_[g] = lowFreq + step * static_cast<float>(g);
+            double omega = 2.0 * M_PI * lpcGridFreqs_[g] / config_.sampleRate;
+            for (size_t k = 0; k < coeffCount; ++k) {
+                lpcGridCos_[g * coeffCount + k] = static_cast<float>(std::cos(omega * k));
+                lpcGridSin_[g * coeffCount + k] = static_cast<float>(std::sin(omega * k));
+            }
+        }
+    }
+
     void generateFrequencyBins() {
         frequencyBins_.resize(config_.fftSize / 2 + 1);
         for (size_t i = 0; i < frequencyBins_.size(); ++i) {
@@ -533,7 +680,12 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
         return count > 0 ? totalDeviation / count : 0.0f;
     }
 
-    void extractFormantsInternal(HarmonicProfile& profile) {
+    void extractFormantsInternal(HarmonicProfile& profile, std::span<const float> audio) {
+        if (config_.useLPCFormants) {
+            extractFormantsLPC(audio, profile.formants, profile.formantBandwidths);
+            return;
+        }
+
         extractFormantsFromSpectrum(profile.formants);
 
         // Estimate bandwidths (simplified)
@@ -543,6 +695,162 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
         }
     }
 
+    /**
+     * @brief Formants from the LPC envelope of the centre frame of @p audio
+     *
+     * Autocorrelation -> Levinson-Durbin -> |1/A(e^jw)|^2 on a coarse grid -> peaks. Peaks
+     * broader than maxFormantBandwidth are treated as spectral tilt and skipped.
+     */
+    void extractFormantsLPC(std::span<const float> audio,
+                            std::vector<float>& formants,
+                            std::vector<float>& bandwidths) {
+        formants.clear();
+        bandwidths.clear();
+
+        if (audio.size() < lpcFrameSize_ || lpcFrameSize_ <= lpcOrder_) {
+            return;
+        }
+
+        // Pre-emphasis + window over the centre of the analysis frame
+        const size_t offset = (audio.size() - lpcFrameSize_) / 2;
+        float previous = offset > 0 ? audio[offset - 1] : 0.0f;
+        for (size_t i = 0; i < lpcFrameSize_; ++i) {
+            float sample = audio[offset + i];
+            lpcFrame_[i] = (sample - kLPCPreEmphasis * previous) * lpcWindow_[i];
+            previous = sample;
+        }
+
+        if (!computeLPCCoefficients()) {
+            return;
+        }
+
+        evaluateLPCEnvelope();
+        pickEnvelopePeaks(formants, bandwidths);
+    }
+
+    bool computeLPCCoefficients() {
+        const size_t order = lpcOrder_;
+        const float* frame = lpcFrame_.data();
+
+        for (size_t k = 0; k <= order; ++k) {
+            lpcAutocorr_[k] =
+                static_cast<double>(dotProduct(frame, frame + k, lpcFrameSize_ - k))
+                * lpcLagWindow_[k];
+        }
+        lpcAutocorr_[0] *= 1.0 + kLPCNoiseCorrection;
+
+        // Silent or non-finite frames carry no envelope
+        if (!(lpcAutocorr_[0] > 0.0) || !std::isfinite(lpcAutocorr_[0])) {
+            return false;
+        }
+
+        // Levinson-Durbin recursion
+        std::fill(lpcCoeffs_.begin(), lpcCoeffs_.end(), 0.0);
+        lpcCoeffs_[0] = 1.0;
+        double error = lpcAutocorr_[0];
+
+        for (size_t i = 1; i <= order; ++i) {
+            double acc = lpcAutocorr_[i];
+            for (size_t j = 1; j < i; ++j) {
+                acc += lpcCoeffs_[j] * lpcAutocorr_[i - j];
+            }
+
+            double reflection = -acc / error;
+            for (size_t j = 1; j < i; ++j) {
+                lpcScratch_[j] = lpcCoeffs_[j] + reflection * lpcCoeffs_[i - j];
+            }
+            for (size_t j = 1; j < i; ++j) {
+                lpcCoeffs_[j] = lpcScratch_[j];
+            }
+            lpcCoeffs_[i] = reflection;
+
+            error *= 1.0 - reflection * reflection;
+            if (error <= 0.0) {
+                break;
+            }
+        }
+
+        for (size_t k = 0; k <= order; ++k) {
+            lpcPoly_[k] = static_cast<float>(lpcCoeffs_[k]);
+        }
+        return true;
+    }
+
+    void evaluateLPCEnvelope() {
+        const size_t coeffCount = lpcOrder_ + 1;
+        for (size_t g = 0; g < lpcEnvelope_.size(); ++g) {
+            float re = dotProduct(&lpcGridCos_[g * coeffCount], lpcPoly_.data(), coeffCount);
+            float im = dotProduct(&lpcGridSin_[g * coeffCount], lpcPoly_.data(), coeffCount);
+            // Envelope is 1 / |A|^2; kept in dB so peak interpolation is parabolic
+            lpcEnvelope_[g] = -10.0f * std::log10(std::max(re * re + im * im, 1e-20f));
+        }
+    }
+
+    void pickEnvelopePeaks(std::vector<float>& formants, std::vector<float>& bandwidths) {
+        const size_t gridSize = lpcEnvelope_.size();
+        const float step = lpcGridFreqs_[1] - lpcGridFreqs_[0];
+
+        for (size_t g = 1; g + 1 < gridSize && formants.size() < config_.numFormants; ++g) {
+            const float alpha = lpcEnvelope_[g - 1];
+            const float beta = lpcEnvelope_[g];
+            const float gamma = lpcEnvelope_[g + 1];
+            if (!(beta > alpha && beta >= gamma)) {
+                continue;
+            }
+
+            const float curvature = alpha - 2.0f * beta + gamma;
+            const float delta = curvature < 0.0f ? 0.5f * (alpha - gamma) / curvature : 0.0f;
+            const float peakDb = beta - 0.25f * (alpha - gamma) * delta;
+            const float frequency = lpcGridFreqs_[g] + delta * step;
+
+            float bandwidth = measureHalfPowerWidth(g, peakDb - kFormantHalfPowerDb) * step;
+            if (bandwidth <= 0.0f && curvature < 0.0f) {
+                // Flanks merge into a neighbouring peak before dropping 3 dB;
+                // fall back to the width of the fitted parabola
+                bandwidth = 2.0f * std::sqrt(-2.0f * kFormantHalfPowerDb / curvature) * step;
+            }
+
+            if (bandwidth > 0.0f && bandwidth <= config_.maxFormantBandwidth) {
+                formants.push_back(frequency);
+                bandwidths.push_back(bandwidth);
+            }
+        }
+    }
+
+    /**
+     * @brief Width in grid steps between the half-power crossings around @p peak
+     * @return 0 if either flank reaches a valley or the grid edge first
+     */
+    float measureHalfPowerWidth(size_t peak, float thresholdDb) const {
+        float left = -1.0f;
+        for (size_t g = peak; g > 0; --g) {
+            if (lpcEnvelope_[g - 1] > lpcEnvelope_[g]) {
+                break;
+            }
+            if (lpcEnvelope_[g - 1] <= thresholdDb) {
+                float t = (lpcEnvelope_[g] - thresholdDb)
+                          / (lpcEnvelope_[g] - lpcEnvelope_[g - 1]);
+                left = static_cast<float>(g) - t;
+                break;
+            }
+        }
+
+        float right = -1.0f;
+        for (size_t g = peak; g + 1 < lpcEnvelope_.size(); ++g) {
+            if (lpcEnvelope_[g + 1] > lpcEnvelope_[g]) {
+                break;
+            }
+            if (lpcEnvelope_[g + 1] <= thresholdDb) {
+                float t = (lpcEnvelope_[g] - thresholdDb)
+                          / (lpcEnvelope_[g] - lpcEnvelope_[g + 1]);
+                right = static_cast<float>(g) + t;
+                break;
+            }
+        }
+
+        return (left >= 0.0f && right >= 0.0f) ? right - left : 0.0f;
+    }
+
     void extractFormantsFromSpectrum(std::vector<float>& formants) {
         formants.clear();
 
@@ -554,7 +862,8 @@ class HarmonicAnalyzerImpl : public HarmonicAnalyzer {
             if (spectrum_[i] > spectrum_[i - 1] && spectrum_[i] > spectrum_[i + 1]
                 && spectrum_[i] > spectrum_[i - 2] && spectrum_[i] > spectrum_[i + 2]) {
                 float frequency = frequencyBins_[i];
-                if (frequency >= 200.0f && frequency <= 4000.0f) {  // Typical formant range
+                if (frequency >= config_.minFormantFrequency
+                    && frequency <= config_.maxFormantFrequency) {
                     peaks.push_back(i);
                 }
             }
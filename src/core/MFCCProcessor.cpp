@@ -194,6 +194,16 @@ class MFCCProcessor::Impl {
 
     huntmaster::expected<FeatureVector, MFCCError>
     extractFeatures(std::span<const float> audio_frame) {
+        auto spectrum = computePowerSpectrum(audio_frame);
+        if (!spectrum) {
+            return huntmaster::unexpected(spectrum.error());
+        }
+        return computeCoefficients();
+    }
+
+    // Window and FFT the frame into powerSpectrum
+    huntmaster::expected<std::span<const float>, MFCCError>
+    computePowerSpectrum(std::span<const float> audio_frame) {
         if (audio_frame.size() != config.frame_size) {
             ComponentErrorHandler::MFCCProcessorErrors::logInvalidInputSize(audio_frame.size(),
                                                                             config.frame_size);
@@ -245,6 +255,23 @@ class MFCCProcessor::Impl {
                 }
             }
 
+            return std::span<const float>(powerSpectrum);
+        } catch (const std::exception& e) {
+            ComponentErrorHandler::MFCCProcessorErrors::logFeatureExtractionFailure(
+                config.frame_size,
+                "Unexpected error during MFCC extraction: " + std::string(e.what()));
+            return huntmaster::unexpected(MFCCError::PROCESSING_FAILED);
+        }
+#else
+        ComponentErrorHandler::MFCCProcessorErrors::logFFTInitializationFailure(
+            "FFT not available - HAVE_KISSFFT not defined");
+        return huntmaster::unexpected(MFCCError::FFT_FAILED);
+#endif
+    }
+
+    // Mel filter bank and DCT over the current powerSpectrum
+    huntmaster::expected<FeatureVector, MFCCError> computeCoefficients() {
+        try {
             // Apply mel filter bank
             for (size_t i = 0; i < config.num_filters; ++i) {
                 try {
@@ -295,11 +322,6 @@ class MFCCProcessor::Impl {
                 "Unexpected error during MFCC extraction: " + std::string(e.what()));
             return huntmaster::unexpected(MFCCError::PROCESSING_FAILED);
         }
-#else
-        ComponentErrorHandler::MFCCProcessorErrors::logFFTInitializationFailure(
-            "FFT not available - HAVE_KISSFFT not defined");
-        return huntmaster::unexpected(MFCCError::FFT_FAILED);
-#endif
     }
 };
 
@@ -353,6 +375,108 @@ MFCCProcessor::extractFeaturesFromBuffer(std::span<const float> audio_buffer, si
     return all_features;
 }
 
+huntmaster::expected<MFCCProcessor::FeatureMatrix, MFCCError>
+MFCCProcessor::extractFeaturesFromBuffer(std::span<const float> audio_buffer,
+                                         size_t hop_size,
+                                         const SpectrumGate& gate) {
+    if (!gate) {
+        return extractFeaturesFromBuffer(audio_buffer, hop_size);
+    }
+
+    if (audio_buffer.empty() || hop_size == 0) {
+        LOG_ERROR(Component::MFCC_PROCESSOR, "extractFeaturesFromBuffer: invalid buffer or hop");
+        return huntmaster::unexpected(MFCCError::INVALID_INPUT);
+    }
+
+    FeatureMatrix all_features;
+    const size_t frame_size = pimpl_->config.frame_size;
+    size_t rejected_frames = 0;
+
+    for (size_t offset = 0; offset + frame_size <= audio_buffer.size(); offset += hop_size) {
+        auto spectrum = pimpl_->computePowerSpectrum(audio_buffer.subspan(offset, frame_size));
+        if (!spectrum) {
+            return huntmaster::unexpected(spectrum.error());
+        }
+
+        if (!gate(*spectrum)) {
+            ++rejected_frames;
+            continue;
+        }
+
+        auto features_result = pimpl_->computeCoefficients();
+        if (!features_result) {
+            return huntmaster::unexpected(features_result.error());
+        }
+        all_features.push_back(std::move(*features_result));
+    }
+
+    LOG_DEBUG(Component::MFCC_PROCESSOR,
+              "extractFeaturesFromBuffer: gate kept " + std::to_string(all_features.size())
+                  + " frames, skipped " + std::to_string(rejected_frames));
+    return all_features;
+}
+
+huntmaster::expected<MFCCProcessor::FeatureMatrix, MFCCError>
+MFCCProcessor::extractFeaturesFromStream(const SampleSource& source,
+                                         size_t hop_size,
+                                         size_t chunk_size) {
+    if (!source || hop_size == 0 || chunk_size == 0) {
+        LOG_ERROR(Component::MFCC_PROCESSOR, "extractFeaturesFromStream: invalid source or hop");
+        return huntmaster::unexpected(MFCCError::INVALID_INPUT);
+    }
+
+    FeatureMatrix all_features;
+    const size_t frame_size = pimpl_->config.frame_size;
+
+    // Samples [0, filled) are the unconsumed tail of the stream. After each pass fewer
+    // than frame_size remain, so one chunk always fits behind them.
+    std::vector<float> window(frame_size + chunk_size);
+    size_t filled = 0;
+    size_t skip = 0;  // Stream samples to drop before the next frame when hop > frame_size
+    size_t total = 0;
+
+    while (true) {
+        size_t read = source(std::span<float>(window.data() + filled, chunk_size));
+        if (read == 0) {
+            break;
+        }
+        read = std::min(read, chunk_size);
+        total += read;
+        const size_t dropped = std::min(skip, read);
+        if (dropped > 0) {
+            std::copy(window.begin() + filled + dropped, window.begin() + filled + read,
+                      window.begin() + filled);
+            skip -= dropped;
+            read -= dropped;
+        }
+        filled += read;
+
+        size_t offset = 0;
+        for (; offset + frame_size <= filled; offset += hop_size) {
+            auto features_result =
+                extractFeatures(std::span<const float>(window.data() + offset, frame_size));
+            if (!features_result) {
+                return huntmaster::unexpected(features_result.error());
+            }
+            all_features.push_back(std::move(*features_result));
+        }
+
+        if (offset >= filled) {
+            skip += offset - filled;
+            filled = 0;
+        } else {
+            std::copy(window.begin() + offset, window.begin() + filled, window.begin());
+            filled -= offset;
+        }
+    }
+
+    if (total == 0) {
+        LOG_ERROR(Component::MFCC_PROCESSOR, "extractFeaturesFromStream: empty stream");
+        return huntmaster::unexpected(MFCCError::INVALID_INPUT);
+    }
+    return all_features;
+}
+
 void MFCCProcessor::clearCache() { /* Caching logic to be implemented */ }
 size_t MFCCProcessor::getCacheSize() const noexcept {
     return 0;
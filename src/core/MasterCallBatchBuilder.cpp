@@ -0,0 +1,649 @@
+/**
+ * @file MasterCallBatchBuilder.cpp
+ * @brief Parallel, incremental master-call library builder
+ */
+
+#include "huntmaster/core/MasterCallBatchBuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "dr_wav.h"
+#include "huntmaster/core/AudioFormatConverter.h"
+#include "huntmaster/core/FeatureStorage.h"
+#include "huntmaster/core/MasterCallLibrary.h"
+
+namespace huntmaster {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+using CallInfo = MasterCallBatchBuilder::CallInfo;
+using CallResult = MasterCallBatchBuilder::CallResult;
+using Config = MasterCallBatchBuilder::Config;
+using MetadataFields = MasterCallBatchBuilder::MetadataFields;
+using Outcome = MasterCallBatchBuilder::Outcome;
+
+constexpr char kManifestTag[] = "huntmaster-master-call-manifest";
+constexpr uint32_t kManifestVersion = 1;
+
+struct Input {
+    std::string id;
+    fs::path path;
+    std::string relativePath;
+};
+
+/// What the manifest remembers about one built call
+struct ManifestRecord {
+    uint64_t size = 0;
+    uint32_t checksum = 0;
+    std::string metadata;
+};
+
+using Manifest = std::unordered_map<std::string, ManifestRecord>;
+
+bool isWav(const fs::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return ext == ".wav";
+}
+
+/// Everything besides the audio itself that determines a call's outputs
+uint32_t configChecksum(const Config& config, const FeatureConfigRecord& featureConfig) {
+    uint32_t crc = crc32c(&kManifestVersion, sizeof(kManifestVersion));
+    crc = crc32c(&featureConfig, sizeof(featureConfig), crc);
+    const float band[2] = {config.mfcc.low_freq, config.mfcc.high_freq};
+    crc = crc32c(band, sizeof(band), crc);
+    const uint8_t storeAudio = config.storeAudio ? 1 : 0;
+    crc = crc32c(&storeAudio, 1, crc);
+    for (const size_t resolution : config.waveformResolutions) {
+        const auto value = static_cast<uint64_t>(resolution);
+        crc = crc32c(&value, sizeof(value), crc);
+    }
+    return crc;
+}
+
+/// Manifest records, or none if the file is missing or was written for another config
+Manifest readManifest(const std::string& path, uint32_t expectedConfig) {
+    Manifest manifest;
+    std::ifstream file(path);
+    std::string tag;
+    uint32_t version = 0;
+    uint32_t config = 0;
+    if (!(file >> tag >> version >> std::hex >> config) || tag != kManifestTag
+        || version != kManifestVersion || config != expectedConfig) {
+        return manifest;
+    }
+    file >> std::dec;
+    file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::string line;
+    while (std::getline(file, line)) {
+        // id \t size \t checksum \t metadata
+        const size_t a = line.find('\t');
+        const size_t b = a == std::string::npos ? a : line.find('\t', a + 1);
+        const size_t c = b == std::string::npos ? b : line.find('\t', b + 1);
+        if (c == std::string::npos) {
+            continue;
+        }
+        ManifestRecord record;
+        try {
+            record.size = std::stoull(line.substr(a + 1, b - a - 1));
+            record.checksum =
+                static_cast<uint32_t>(std::stoul(line.substr(b + 1, c - b - 1), nullptr, 16));
+        } catch (const std::exception&) {
+            continue;
+        }
+        record.metadata = line.substr(c + 1);
+        manifest[line.substr(0, a)] = std::move(record);
+    }
+    return manifest;
+}
+
+/// Write @p content under a temporary name and rename it over @p path
+bool writeFileAtomically(const fs::path& path, const std::string& content) {
+    fs::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(temp, path, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+bool writeManifest(const std::string& path, uint32_t config, const Manifest& manifest) {
+    std::vector<const Manifest::value_type*> records;
+    records.reserve(manifest.size());
+    for (const auto& record : manifest) {
+        records.push_back(&record);
+    }
+    std::sort(records.begin(), records.end(),
+              [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    std::ostringstream out;
+    char checksum[16];
+    std::snprintf(checksum, sizeof(checksum), "%08x", config);
+    out << kManifestTag << ' ' << kManifestVersion << ' ' << checksum << '\n';
+    for (const auto* record : records) {
+        std::snprintf(checksum, sizeof(checksum), "%08x", record->second.checksum);
+        out << record->first << '\t' << record->second.size << '\t' << checksum << '\t'
+            << record->second.metadata << '\n';
+    }
+    return writeFileAtomically(path, out.str());
+}
+
+void appendJsonString(std::string& out, std::string_view value) {
+    out += '"';
+    for (const char c : value) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+void appendJsonNumber(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    std::ostringstream number;
+    number << value;
+    out += number.str();
+}
+
+/// One-line JSON object: the standard fields, then any from the metadata hook
+std::string metadataJson(const CallInfo& info, const MetadataFields& extra) {
+    std::string out = "{\"id\":";
+    appendJsonString(out, info.id);
+    out += ",\"source\":";
+    appendJsonString(out, info.sourcePath);
+    out += ",\"sampleRate\":" + std::to_string(info.sampleRate);
+    out += ",\"channels\":" + std::to_string(info.channels);
+    out += ",\"duration\":";
+    appendJsonNumber(out, static_cast<double>(info.audio.size()) / info.sampleRate);
+    out += ",\"featureFrames\":" + std::to_string(info.featureFrames);
+
+    for (const auto& [key, value] : extra) {
+        out += ',';
+        appendJsonString(out, key);
+        out += ':';
+        if (const auto* text = std::get_if<std::string>(&value)) {
+            appendJsonString(out, *text);
+        } else if (const auto* number = std::get_if<double>(&value)) {
+            appendJsonNumber(out, *number);
+        } else if (const auto* integer = std::get_if<int64_t>(&value)) {
+            out += std::to_string(*integer);
+        } else {
+            out += std::get<bool>(value) ? "true" : "false";
+        }
+    }
+    out += '}';
+    return out;
+}
+
+/// Min, max and RMS per bucket at each resolution, for drawing the call at any zoom
+std::string waveformJson(std::span<const float> samples,
+                         uint32_t sampleRate,
+                         const std::vector<size_t>& resolutions) {
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"duration\": " << (static_cast<double>(samples.size()) / sampleRate) << ",\n";
+    out << "  \"samples\": " << samples.size() << ",\n";
+    out << "  \"sampleRate\": " << sampleRate << ",\n";
+    out << "  \"resolutions\": {\n";
+
+    std::vector<float> minima, maxima, rms;
+    for (size_t r = 0; r < resolutions.size(); ++r) {
+        const size_t buckets = std::max<size_t>(1, resolutions[r]);
+        const size_t step = std::max<size_t>(1, samples.size() / buckets);
+        minima.clear();
+        maxima.clear();
+        rms.clear();
+        for (size_t i = 0; i < samples.size(); i += step) {
+            const size_t end = std::min(i + step, samples.size());
+            float lo = samples[i];
+            float hi = samples[i];
+            double energy = 0.0;
+            for (size_t j = i; j < end; ++j) {
+                lo = std::min(lo, samples[j]);
+                hi = std::max(hi, samples[j]);
+                energy += static_cast<double>(samples[j]) * samples[j];
+            }
+            minima.push_back(lo);
+            maxima.push_back(hi);
+            rms.push_back(static_cast<float>(std::sqrt(energy / static_cast<double>(end - i))));
+        }
+
+        auto writeSeries = [&out](const char* name, const std::vector<float>& values) {
+            out << "      \"" << name << "\": [";
+            for (size_t i = 0; i < values.size(); ++i) {
+                out << (i > 0 ? ", " : "") << values[i];
+            }
+            out << "]";
+        };
+        out << "    \"" << resolutions[r] << "\": {\n";
+        writeSeries("min", minima);
+        out << ",\n";
+        writeSeries("max", maxima);
+        out << ",\n";
+        writeSeries("rms", rms);
+        out << "\n    }" << (r + 1 < resolutions.size() ? "," : "") << "\n";
+    }
+    out << "  }\n}\n";
+    return out.str();
+}
+
+/**
+ * Convert mono audio to the feature sample rate with the polyphase resampler
+ * the engine's streaming master-call reader uses, so both extract identical
+ * features from the same file.
+ */
+std::vector<float>
+resampleToFeatureRate(const std::vector<float>& input, uint32_t inputRate, size_t outputRate) {
+    if (inputRate == outputRate || input.empty()) {
+        return input;
+    }
+    return core::PolyphaseResampler::resample(
+        input.data(),
+        input.size(),
+        core::PolyphaseResampler::Config{inputRate, static_cast<uint32_t>(outputRate), 1});
+}
+
+/// Per-call work shared by all worker threads
+class CallProcessor {
+  public:
+    struct Stats {
+        uint64_t bytes = 0;
+        double audioSeconds = 0.0;
+        std::optional<ManifestRecord> record;  ///< Set when the call has valid outputs
+    };
+
+    CallProcessor(const Config& config,
+                  const FeatureConfigRecord& featureConfig,
+                  const Manifest& previous,
+                  const MasterCallLibrary* previousLibrary,
+                  MasterCallLibraryBuilder* library)
+        : config_(config), featureConfig_(featureConfig), previous_(previous),
+          previousLibrary_(previousLibrary), library_(library) {}
+
+    CallResult process(const Input& input, MFCCProcessor& mfcc, Stats& stats) const {
+        CallResult result;
+        result.id = input.id;
+
+        ReadOnlyFileMapping file;
+        if (!file.open(input.path.string())) {
+            result.error = "cannot read file";
+            return result;
+        }
+        ManifestRecord record;
+        record.size = file.size();
+        record.checksum = crc32c(file.data(), file.size());
+        stats.bytes = file.size();
+
+        if (reuse(input.id, record)) {
+            result.outcome = Outcome::REUSED;
+            result.metadata = record.metadata;
+            stats.record = std::move(record);
+            return result;
+        }
+
+        unsigned int channels = 0;
+        unsigned int sampleRate = 0;
+        drwav_uint64 frames = 0;
+        float* interleaved = drwav_open_memory_and_read_pcm_frames_f32(
+            file.data(), file.size(), &channels, &sampleRate, &frames, nullptr);
+        if (!interleaved) {
+            result.error = "not a readable WAV file";
+            return result;
+        }
+        if (frames == 0 || channels == 0 || sampleRate == 0) {
+            drwav_free(interleaved, nullptr);
+            result.error = "no audio";
+            return result;
+        }
+        std::vector<float> audio(static_cast<size_t>(frames));
+        for (size_t i = 0; i < audio.size(); ++i) {
+            float sum = 0.0f;
+            for (unsigned int c = 0; c < channels; ++c) {
+                sum += interleaved[i * channels + c];
+            }
+            audio[i] = sum / static_cast<float>(channels);
+        }
+        drwav_free(interleaved, nullptr);
+        file.close();
+        stats.audioSeconds = static_cast<double>(audio.size()) / sampleRate;
+
+        auto features = mfcc.extractFeaturesFromBuffer(
+            resampleToFeatureRate(audio, sampleRate, config_.mfcc.sample_rate), config_.hopSize);
+        if (!features || features->empty()) {
+            result.error = "too short for analysis";
+            return result;
+        }
+
+        CallInfo info;
+        info.id = input.id;
+        info.sourcePath = input.relativePath;
+        info.audio = audio;
+        info.sampleRate = sampleRate;
+        info.channels = channels;
+        info.featureFrames = features->size();
+        record.metadata =
+            metadataJson(info, config_.metadata ? config_.metadata(info) : MetadataFields{});
+
+        if (!config_.featuresDir.empty()
+            && !FeatureFile::write(featurePath(input.id), featureConfig_, *features)) {
+            result.error = "cannot write features";
+            return result;
+        }
+        if (!config_.metadataDir.empty()
+            && !writeFileAtomically(fs::path(config_.metadataDir) / (input.id + ".json"),
+                                    record.metadata)) {
+            result.error = "cannot write metadata";
+            return result;
+        }
+        if (!config_.waveformsDir.empty()
+            && !writeFileAtomically(
+                fs::path(config_.waveformsDir) / (input.id + ".json"),
+                waveformJson(audio, sampleRate, config_.waveformResolutions))) {
+            result.error = "cannot write waveform";
+            return result;
+        }
+        if (library_) {
+            MasterCallLibraryBuilder::Entry entry;
+            entry.id = input.id;
+            entry.metadata = record.metadata;
+            entry.features = std::move(*features);
+            if (config_.storeAudio) {
+                entry.audio = std::move(audio);
+                entry.audioSampleRate = sampleRate;
+            }
+            if (!library_->add(entry)) {
+                result.error = "cannot add to library";
+                return result;
+            }
+        }
+
+        result.outcome = Outcome::BUILT;
+        result.metadata = record.metadata;
+        stats.record = std::move(record);
+        return result;
+    }
+
+  private:
+    std::string featurePath(const std::string& id) const {
+        return (fs::path(config_.featuresDir) / (id + ".mfc")).string();
+    }
+
+    /// Keep the previous outputs if the input is unchanged and every output is intact
+    bool reuse(const std::string& id, ManifestRecord& record) const {
+        const auto it = previous_.find(id);
+        if (it == previous_.end() || it->second.size != record.size
+            || it->second.checksum != record.checksum) {
+            return false;
+        }
+        if (!config_.featuresDir.empty() && !FeatureFile::open(featurePath(id), featureConfig_)) {
+            return false;
+        }
+        std::error_code ec;
+        if (!config_.metadataDir.empty()
+            && !fs::exists(fs::path(config_.metadataDir) / (id + ".json"), ec)) {
+            return false;
+        }
+        if (!config_.waveformsDir.empty()
+            && !fs::exists(fs::path(config_.waveformsDir) / (id + ".json"), ec)) {
+            return false;
+        }
+        if (library_) {
+            const auto index = previousLibrary_ ? previousLibrary_->indexOf(id) : std::nullopt;
+            if (!index || !previousLibrary_->verify(*index)
+                || !library_->add(previousLibrary_->at(*index))) {
+                return false;
+            }
+        }
+        record.metadata = it->second.metadata;
+        return true;
+    }
+
+    const Config& config_;
+    const FeatureConfigRecord& featureConfig_;
+    const Manifest& previous_;
+    const MasterCallLibrary* previousLibrary_;
+    MasterCallLibraryBuilder* library_;
+};
+
+}  // namespace
+
+MasterCallBatchBuilder::MasterCallBatchBuilder(Config config) : config_(std::move(config)) {}
+
+huntmaster::expected<MasterCallBatchBuilder::Report, MasterCallBatchError>
+MasterCallBatchBuilder::build() {
+    const auto start = std::chrono::steady_clock::now();
+
+    if (config_.hopSize == 0 || config_.mfcc.sample_rate == 0
+        || (config_.libraryPath.empty() && config_.featuresDir.empty()
+            && config_.metadataDir.empty() && config_.waveformsDir.empty())) {
+        return huntmaster::unexpected(MasterCallBatchError::INVALID_CONFIG);
+    }
+    std::error_code ec;
+    if (!fs::is_directory(config_.inputDir, ec)) {
+        return huntmaster::unexpected(MasterCallBatchError::INPUT_NOT_FOUND);
+    }
+    for (const auto* dir : {&config_.featuresDir, &config_.metadataDir, &config_.waveformsDir}) {
+        if (!dir->empty() && !fs::create_directories(*dir, ec) && ec) {
+            return huntmaster::unexpected(MasterCallBatchError::OUTPUT_ERROR);
+        }
+    }
+
+    // Discover inputs in id order
+    const std::unordered_set<std::string> only(config_.only.begin(), config_.only.end());
+    std::vector<Input> inputs;
+    for (auto it = fs::recursive_directory_iterator(config_.inputDir, ec);
+         !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (!it->is_regular_file(ec) || !isWav(it->path())) {
+            continue;
+        }
+        Input input;
+        input.id = it->path().stem().string();
+        if (!only.empty() && !only.count(input.id)) {
+            continue;
+        }
+        input.path = it->path();
+        input.relativePath = it->path().lexically_relative(config_.inputDir).generic_string();
+        inputs.push_back(std::move(input));
+    }
+    std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) {
+        return a.id != b.id ? a.id < b.id : a.relativePath < b.relativePath;
+    });
+
+    const FeatureConfigRecord featureConfig =
+        FeatureConfigRecord::fromMFCC(config_.mfcc, config_.hopSize);
+    const uint32_t configHash = configChecksum(config_, featureConfig);
+    Manifest stored = config_.manifestPath.empty()
+                          ? Manifest{}
+                          : readManifest(config_.manifestPath, configHash);
+    const Manifest none;
+    const Manifest& previous = config_.force ? none : stored;
+
+    // The old library stays mapped while the new one replaces it
+    std::unique_ptr<MasterCallLibrary> previousLibrary;
+    std::optional<MasterCallLibraryBuilder> library;
+    if (!config_.libraryPath.empty()) {
+        auto opened = MasterCallLibrary::open(config_.libraryPath);
+        if (opened && (*opened)->featureConfig() == featureConfig) {
+            previousLibrary = std::move(*opened);
+        }
+        try {
+            library.emplace(config_.libraryPath, featureConfig);
+        } catch (const std::exception&) {
+            return huntmaster::unexpected(MasterCallBatchError::OUTPUT_ERROR);
+        }
+
+        // A partial build keeps the calls it did not select
+        if (!only.empty() && previousLibrary) {
+            std::unordered_set<std::string> selected;
+            for (const auto& input : inputs) {
+                selected.insert(input.id);
+            }
+            for (size_t i = 0; i < previousLibrary->size(); ++i) {
+                const auto view = previousLibrary->at(i);
+                if (!selected.count(std::string(view.id)) && !library->add(view)) {
+                    return huntmaster::unexpected(MasterCallBatchError::OUTPUT_ERROR);
+                }
+            }
+        }
+    }
+
+    Report report;
+    report.calls.resize(inputs.size());
+    std::vector<std::optional<ManifestRecord>> records(inputs.size());
+    std::mutex reportMutex;
+
+    auto finishCall = [&](size_t index, CallResult result, const CallProcessor::Stats& stats) {
+        std::lock_guard<std::mutex> lock(reportMutex);
+        switch (result.outcome) {
+            case Outcome::BUILT:
+                ++report.built;
+                break;
+            case Outcome::REUSED:
+                ++report.reused;
+                break;
+            case Outcome::FAILED:
+                ++report.failed;
+                break;
+        }
+        report.inputBytes += stats.bytes;
+        report.audioSeconds += stats.audioSeconds;
+        records[index] = stats.record;
+        report.calls[index] = std::move(result);
+        if (config_.onCallFinished) {
+            config_.onCallFinished(report.calls[index]);
+        }
+    };
+
+    // Every output is keyed by id, so only the first of several same-named files is built
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (i > 0 && inputs[i].id == inputs[i - 1].id) {
+            CallResult duplicate;
+            duplicate.id = inputs[i].id;
+            duplicate.error = "duplicate id (" + inputs[i].relativePath + ")";
+            finishCall(i, std::move(duplicate), {});
+        } else {
+            pending.push_back(i);
+        }
+    }
+
+    const CallProcessor processor(config_, featureConfig, previous, previousLibrary.get(),
+                                  library ? &*library : nullptr);
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        std::unique_ptr<MFCCProcessor> mfcc;
+        for (size_t n = next++; n < pending.size(); n = next++) {
+            const size_t index = pending[n];
+            CallProcessor::Stats stats;
+            CallResult result;
+            try {
+                if (!mfcc) {
+                    mfcc = std::make_unique<MFCCProcessor>(config_.mfcc);
+                }
+                result = processor.process(inputs[index], *mfcc, stats);
+            } catch (const std::exception& e) {
+                result.id = inputs[index].id;
+                result.outcome = Outcome::FAILED;
+                result.error = e.what();
+                stats.record.reset();
+            }
+            finishCall(index, std::move(result), stats);
+        }
+    };
+
+    size_t threads = config_.threads ? config_.threads : std::thread::hardware_concurrency();
+    threads = std::max<size_t>(1, std::min(threads, pending.size()));
+    report.threads = threads;
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    if (library && !library->finish()) {
+        return huntmaster::unexpected(MasterCallBatchError::OUTPUT_ERROR);
+    }
+    previousLibrary.reset();
+
+    if (!config_.manifestPath.empty()) {
+        Manifest manifest;
+        if (!only.empty()) {
+            manifest = std::move(stored);
+            for (const auto& input : inputs) {
+                manifest.erase(input.id);
+            }
+        }
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (records[i] && inputs[i].id.find_first_of("\t\n\r") == std::string::npos) {
+                manifest[inputs[i].id] = std::move(*records[i]);
+            }
+        }
+        if (!writeManifest(config_.manifestPath, configHash, manifest)) {
+            return huntmaster::unexpected(MasterCallBatchError::OUTPUT_ERROR);
+        }
+    }
+
+    report.elapsedSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+}  // namespace huntmaster
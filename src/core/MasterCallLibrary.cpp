@@ -0,0 +1,450 @@
+/**
+ * @file MasterCallLibrary.cpp
+ * @brief Packed master-call library reader and builder
+ */
+
+#include "huntmaster/core/MasterCallLibrary.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace huntmaster {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4C434D48u;  // "HMCL"
+constexpr uint64_t kPayloadAlignment = 64;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t entryCount;
+    uint64_t indexOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t fileSize;
+    FeatureConfigRecord featureConfig;
+    uint32_t indexChecksum;   // Index entries followed by the strings region
+    uint32_t headerChecksum;  // This header with headerChecksum zeroed
+    uint8_t reserved[40];
+};
+
+struct IndexEntry {
+    uint32_t idOffset;  // Offsets into the strings region
+    uint32_t idLength;
+    uint32_t metadataOffset;
+    uint32_t metadataLength;
+    uint32_t frames;
+    uint32_t coefficients;
+    uint64_t featureOffset;  // Absolute file offsets
+    uint64_t audioOffset;
+    uint64_t audioSamples;
+    uint32_t audioSampleRate;
+    float audioScale;
+    uint32_t featureChecksum;
+    uint32_t audioChecksum;
+};
+
+static_assert(sizeof(FileHeader) == 128, "FileHeader is an on-disk layout");
+static_assert(sizeof(IndexEntry) == 64, "IndexEntry is an on-disk layout");
+
+uint32_t headerChecksum(FileHeader header) {
+    header.headerChecksum = 0;
+    return crc32c(&header, sizeof(header));
+}
+
+/// True if [offset, offset + length) lies within a file of @p fileSize bytes
+bool inBounds(uint64_t offset, uint64_t length, uint64_t fileSize) {
+    return offset <= fileSize && length <= fileSize - offset;
+}
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+// MasterCallView
+
+MFCCProcessor::FeatureMatrix MasterCallView::featureMatrix() const {
+    MFCCProcessor::FeatureMatrix matrix(frames);
+    for (uint32_t i = 0; i < frames; ++i) {
+        const float* row = features + static_cast<size_t>(i) * coefficients;
+        matrix[i].assign(row, row + coefficients);
+    }
+    return matrix;
+}
+
+std::vector<float> MasterCallView::decodeAudio() const {
+    std::vector<float> samples(audio.size());
+    for (size_t i = 0; i < audio.size(); ++i) {
+        samples[i] = static_cast<float>(audio[i]) * audioScale;
+    }
+    return samples;
+}
+
+// MasterCallLibrary
+
+struct MasterCallLibrary::Impl {
+    ReadOnlyFileMapping mapping;
+    const FileHeader* header = nullptr;
+    const IndexEntry* index = nullptr;
+    const char* strings = nullptr;
+
+    std::string_view idOf(size_t i) const {
+        return {strings + index[i].idOffset, index[i].idLength};
+    }
+};
+
+MasterCallLibrary::MasterCallLibrary() : pimpl_(std::make_unique<Impl>()) {}
+
+MasterCallLibrary::~MasterCallLibrary() = default;
+
+huntmaster::expected<std::unique_ptr<MasterCallLibrary>, MasterCallLibraryError>
+MasterCallLibrary::open(const std::string& path) {
+    std::unique_ptr<MasterCallLibrary> library(new MasterCallLibrary());
+    Impl& impl = *library->pimpl_;
+    if (!impl.mapping.open(path)) {
+        return huntmaster::unexpected(MasterCallLibraryError::FILE_NOT_FOUND);
+    }
+
+    const uint8_t* base = impl.mapping.data();
+    const uint64_t fileSize = impl.mapping.size();
+    if (fileSize < sizeof(FileHeader)) {
+        return huntmaster::unexpected(MasterCallLibraryError::INVALID_FORMAT);
+    }
+    const auto* header = reinterpret_cast<const FileHeader*>(base);
+    if (header->magic != kMagic || header->headerSize != sizeof(FileHeader)) {
+        return huntmaster::unexpected(MasterCallLibraryError::INVALID_FORMAT);
+    }
+    if (header->version != kFormatVersion) {
+        return huntmaster::unexpected(MasterCallLibraryError::UNSUPPORTED_VERSION);
+    }
+    if (headerChecksum(*header) != header->headerChecksum) {
+        return huntmaster::unexpected(MasterCallLibraryError::CHECKSUM_MISMATCH);
+    }
+
+    const uint64_t indexBytes = static_cast<uint64_t>(header->entryCount) * sizeof(IndexEntry);
+    if (header->fileSize != fileSize || header->indexOffset % alignof(IndexEntry) != 0
+        || !inBounds(header->indexOffset, indexBytes, fileSize)
+        || !inBounds(header->stringsOffset, header->stringsSize, fileSize)) {
+        return huntmaster::unexpected(MasterCallLibraryError::INVALID_FORMAT);
+    }
+    const uint32_t indexChecksum =
+        crc32c(base + header->stringsOffset, header->stringsSize,
+               crc32c(base + header->indexOffset, indexBytes));
+    if (indexChecksum != header->indexChecksum) {
+        return huntmaster::unexpected(MasterCallLibraryError::CHECKSUM_MISMATCH);
+    }
+
+    impl.header = header;
+    impl.index = reinterpret_cast<const IndexEntry*>(base + header->indexOffset);
+    impl.strings = reinterpret_cast<const char*>(base + header->stringsOffset);
+
+    // The checksums say the index is what the builder wrote; these checks keep a
+    // well-formed but inconsistent file from sending a view outside the mapping
+    for (size_t i = 0; i < header->entryCount; ++i) {
+        const IndexEntry& entry = impl.index[i];
+        const uint64_t featureBytes =
+            static_cast<uint64_t>(entry.frames) * entry.coefficients * sizeof(float);
+        if (!inBounds(entry.idOffset, entry.idLength, header->stringsSize)
+            || !inBounds(entry.metadataOffset, entry.metadataLength, header->stringsSize)
+            || entry.featureOffset % kPayloadAlignment != 0
+            || !inBounds(entry.featureOffset, featureBytes, fileSize)
+            || entry.audioOffset % alignof(int16_t) != 0
+            || entry.audioSamples > fileSize / sizeof(int16_t)
+            || !inBounds(entry.audioOffset, entry.audioSamples * sizeof(int16_t), fileSize)
+            || (i > 0 && !(impl.idOf(i - 1) < impl.idOf(i)))) {
+            return huntmaster::unexpected(MasterCallLibraryError::INVALID_FORMAT);
+        }
+    }
+
+    return library;
+}
+
+size_t MasterCallLibrary::size() const noexcept {
+    return pimpl_->header->entryCount;
+}
+
+MasterCallView MasterCallLibrary::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("MasterCallLibrary index out of range");
+    }
+    const uint8_t* base = pimpl_->mapping.data();
+    const IndexEntry& entry = pimpl_->index[index];
+
+    MasterCallView view;
+    view.id = pimpl_->idOf(index);
+    view.metadata = {pimpl_->strings + entry.metadataOffset, entry.metadataLength};
+    view.frames = entry.frames;
+    view.coefficients = entry.coefficients;
+    view.features = reinterpret_cast<const float*>(base + entry.featureOffset);
+    if (entry.audioSamples > 0) {
+        view.audio = {reinterpret_cast<const int16_t*>(base + entry.audioOffset),
+                      static_cast<size_t>(entry.audioSamples)};
+    }
+    view.audioScale = entry.audioScale;
+    view.audioSampleRate = entry.audioSampleRate;
+    return view;
+}
+
+std::optional<size_t> MasterCallLibrary::indexOf(std::string_view id) const noexcept {
+    size_t low = 0;
+    size_t high = size();
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (pimpl_->idOf(mid) < id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < size() && pimpl_->idOf(low) == id) {
+        return low;
+    }
+    return std::nullopt;
+}
+
+std::optional<MasterCallView> MasterCallLibrary::find(std::string_view id) const {
+    const auto index = indexOf(id);
+    if (!index) {
+        return std::nullopt;
+    }
+    return at(*index);
+}
+
+bool MasterCallLibrary::verify(size_t index) const noexcept {
+    if (index >= size()) {
+        return false;
+    }
+    const uint8_t* base = pimpl_->mapping.data();
+    const IndexEntry& entry = pimpl_->index[index];
+    const size_t featureBytes =
+        static_cast<size_t>(entry.frames) * entry.coefficients * sizeof(float);
+    const size_t audioBytes = static_cast<size_t>(entry.audioSamples) * sizeof(int16_t);
+    return crc32c(base + entry.featureOffset, featureBytes) == entry.featureChecksum
+           && crc32c(base + entry.audioOffset, audioBytes) == entry.audioChecksum;
+}
+
+const FeatureConfigRecord& MasterCallLibrary::featureConfig() const noexcept {
+    return pimpl_->header->featureConfig;
+}
+
+// MasterCallLibraryBuilder
+
+struct MasterCallLibraryBuilder::Impl {
+    struct PendingEntry {
+        IndexEntry entry{};
+        std::string id;
+        std::string metadata;
+    };
+
+    std::string path;
+    std::string tempPath;
+    FeatureConfigRecord featureConfig;
+
+    std::mutex mutex;  // Guards everything below
+    std::ofstream out;
+    uint64_t offset = 0;
+    std::vector<PendingEntry> entries;
+    std::unordered_set<std::string> ids;
+    bool finished = false;
+
+    /// Append @p bytes at the next aligned offset; returns that offset
+    uint64_t appendAligned(const void* bytes, size_t size) {
+        static constexpr char kZeros[kPayloadAlignment] = {};
+        const uint64_t start = alignUp(offset, kPayloadAlignment);
+        out.write(kZeros, static_cast<std::streamsize>(start - offset));
+        out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+        offset = start + size;
+        return start;
+    }
+
+    huntmaster::expected<void, MasterCallLibraryError> append(std::string_view id,
+                                                              std::string_view metadata,
+                                                              const float* features,
+                                                              uint32_t frames,
+                                                              uint32_t coefficients,
+                                                              std::span<const int16_t> audio,
+                                                              float audioScale,
+                                                              uint32_t audioSampleRate) {
+        if (id.empty() || frames == 0 || coefficients == 0
+            || (featureConfig.numCoefficients != 0 && coefficients != featureConfig.numCoefficients)
+            || (!audio.empty() && audioSampleRate == 0)) {
+            return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+        }
+
+        PendingEntry pending;
+        pending.id = std::string(id);
+        pending.metadata = std::string(metadata);
+        IndexEntry& entry = pending.entry;
+        const size_t featureBytes = static_cast<size_t>(frames) * coefficients * sizeof(float);
+        entry.frames = frames;
+        entry.coefficients = coefficients;
+        entry.featureChecksum = crc32c(features, featureBytes);
+        entry.audioSamples = audio.size();
+        entry.audioSampleRate = audioSampleRate;
+        entry.audioScale = audioScale;
+        entry.audioChecksum = crc32c(audio.data(), audio.size_bytes());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (finished) {
+            return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+        }
+        if (!ids.insert(pending.id).second) {
+            return huntmaster::unexpected(MasterCallLibraryError::DUPLICATE_ID);
+        }
+        entry.featureOffset = appendAligned(features, featureBytes);
+        entry.audioOffset = audio.empty() ? 0 : appendAligned(audio.data(), audio.size_bytes());
+        if (!out) {
+            return huntmaster::unexpected(MasterCallLibraryError::IO_ERROR);
+        }
+        entries.push_back(std::move(pending));
+        return {};
+    }
+};
+
+MasterCallLibraryBuilder::MasterCallLibraryBuilder(std::string path,
+                                                   const FeatureConfigRecord& featureConfig)
+    : pimpl_(std::make_unique<Impl>()) {
+    pimpl_->path = std::move(path);
+    pimpl_->tempPath = pimpl_->path + ".tmp";
+    pimpl_->featureConfig = featureConfig;
+    pimpl_->out.open(pimpl_->tempPath, std::ios::binary | std::ios::trunc);
+    if (!pimpl_->out) {
+        throw std::runtime_error("Cannot create master call library: " + pimpl_->tempPath);
+    }
+
+    // The header is written last, once the index location is known
+    const FileHeader placeholder{};
+    pimpl_->out.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+    pimpl_->offset = sizeof(placeholder);
+}
+
+MasterCallLibraryBuilder::~MasterCallLibraryBuilder() {
+    if (!pimpl_->finished) {
+        pimpl_->out.close();
+        std::error_code ec;
+        std::filesystem::remove(pimpl_->tempPath, ec);
+    }
+}
+
+huntmaster::expected<void, MasterCallLibraryError>
+MasterCallLibraryBuilder::add(const Entry& entry) {
+    if (entry.features.empty()) {
+        return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+    }
+    const size_t coefficients = entry.features.front().size();
+    std::vector<float> flat;
+    flat.reserve(entry.features.size() * coefficients);
+    for (const auto& frame : entry.features) {
+        if (frame.size() != coefficients) {
+            return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+        }
+        flat.insert(flat.end(), frame.begin(), frame.end());
+    }
+
+    // Peak-normalized 16-bit audio: half the size of float, ample for playback and display
+    float peak = 0.0f;
+    for (float sample : entry.audio) {
+        peak = std::max(peak, std::abs(sample));
+    }
+    const float scale = peak > 0.0f ? peak / 32767.0f : 1.0f;
+    std::vector<int16_t> quantized(entry.audio.size());
+    for (size_t i = 0; i < entry.audio.size(); ++i) {
+        const float q = std::clamp(std::nearbyint(entry.audio[i] / scale), -32767.0f, 32767.0f);
+        quantized[i] = static_cast<int16_t>(q);
+    }
+
+    return pimpl_->append(entry.id,
+                          entry.metadata,
+                          flat.data(),
+                          static_cast<uint32_t>(entry.features.size()),
+                          static_cast<uint32_t>(coefficients),
+                          quantized,
+                          scale,
+                          entry.audioSampleRate);
+}
+
+huntmaster::expected<void, MasterCallLibraryError>
+MasterCallLibraryBuilder::add(const MasterCallView& view) {
+    return pimpl_->append(view.id,
+                          view.metadata,
+                          view.features,
+                          view.frames,
+                          view.coefficients,
+                          view.audio,
+                          view.audioScale,
+                          view.audioSampleRate);
+}
+
+size_t MasterCallLibraryBuilder::size() const {
+    std::lock_guard<std::mutex> lock(pimpl_->mutex);
+    return pimpl_->entries.size();
+}
+
+huntmaster::expected<void, MasterCallLibraryError> MasterCallLibraryBuilder::finish() {
+    Impl& impl = *pimpl_;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    if (impl.finished) {
+        return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+    }
+
+    std::sort(impl.entries.begin(), impl.entries.end(),
+              [](const auto& a, const auto& b) { return a.id < b.id; });
+
+    std::string strings;
+    std::vector<IndexEntry> index;
+    index.reserve(impl.entries.size());
+    for (auto& pending : impl.entries) {
+        if (strings.size() + pending.id.size() + pending.metadata.size() > UINT32_MAX) {
+            return huntmaster::unexpected(MasterCallLibraryError::INVALID_INPUT);
+        }
+        IndexEntry entry = pending.entry;
+        entry.idOffset = static_cast<uint32_t>(strings.size());
+        entry.idLength = static_cast<uint32_t>(pending.id.size());
+        strings += pending.id;
+        entry.metadataOffset = static_cast<uint32_t>(strings.size());
+        entry.metadataLength = static_cast<uint32_t>(pending.metadata.size());
+        strings += pending.metadata;
+        index.push_back(entry);
+    }
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = MasterCallLibrary::kFormatVersion;
+    header.headerSize = sizeof(FileHeader);
+    header.entryCount = static_cast<uint32_t>(index.size());
+    header.featureConfig = impl.featureConfig;
+    header.stringsOffset = impl.appendAligned(strings.data(), strings.size());
+    header.stringsSize = strings.size();
+    header.indexOffset = impl.appendAligned(index.data(), index.size() * sizeof(IndexEntry));
+    header.fileSize = impl.offset;
+    header.indexChecksum = crc32c(strings.data(), strings.size(),
+                                  crc32c(index.data(), index.size() * sizeof(IndexEntry)));
+    header.headerChecksum = headerChecksum(header);
+
+    impl.out.seekp(0);
+    impl.out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    impl.out.close();
+    if (!impl.out) {
+        return huntmaster::unexpected(MasterCallLibraryError::IO_ERROR);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(impl.tempPath, impl.path, ec);
+    if (ec) {
+        return huntmaster::unexpected(MasterCallLibraryError::IO_ERROR);
+    }
+    impl.finished = true;
+    return {};
+}
+
+}  // namespace huntmaster
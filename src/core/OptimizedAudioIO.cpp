@@ -6,7 +6,11 @@
 #include "huntmaster/core/OptimizedAudioIO.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -16,19 +20,94 @@
 
 #ifdef _WIN32
 #include <Windows.h>
+#include <fcntl.h>
+#include <io.h>
 #include <memoryapi.h>
+#include <sys/stat.h>
 #else
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
 namespace huntmaster {
 
 // ============================================================================
 // MemoryMappedAudioFile Implementation
 // ============================================================================
 
+namespace {
+
+constexpr float kInt16ToFloat = 1.0f / 32768.0f;
+constexpr float kInt24ToFloat = 1.0f / 8388608.0f;
+constexpr float kInt32ToFloat = 1.0f / 2147483648.0f;
+
+void convertPcm16(const uint8_t* in, size_t count, float* out) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128 scale = _mm_set1_ps(kInt16ToFloat);
+    for (; i + 8 <= count; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2));
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+        int16_t sample;
+        std::memcpy(&sample, in + i * 2, sizeof(sample));
+        out[i] = static_cast<float>(sample) * kInt16ToFloat;
+    }
+}
+
+void convertPcm24(const uint8_t* in, size_t count, float* out) {
+    size_t i = 0;
+#ifdef __SSSE3__
+    // Move each 3-byte sample into the top of a 32-bit lane, then shift down
+    // arithmetically to sign-extend. A 16-byte load covers 4 samples plus 4
+    // spare bytes, so stop while at least 6 samples remain.
+    const __m128i spread = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    const __m128 scale = _mm_set1_ps(kInt24ToFloat);
+    for (; i + 6 <= count; i += 4) {
+        const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 3));
+        const __m128i wide = _mm_srai_epi32(_mm_shuffle_epi8(raw, spread), 8);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(wide), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+        const uint8_t* p = in + i * 3;
+        const auto packed = static_cast<uint32_t>(p[0] << 8 | p[1] << 16 | p[2] << 24);
+        out[i] = static_cast<float>(static_cast<int32_t>(packed) >> 8) * kInt24ToFloat;
+    }
+}
+
+void convertPcm32(const uint8_t* in, size_t count, float* out) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128 scale = _mm_set1_ps(kInt32ToFloat);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(v), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+        int32_t sample;
+        std::memcpy(&sample, in + i * 4, sizeof(sample));
+        out[i] = static_cast<float>(sample) * kInt32ToFloat;
+    }
+}
+
+}  // namespace
+
 class MemoryMappedAudioFile::Impl {
   public:
     Config config_;
@@ -48,10 +127,19 @@ class MemoryMappedAudioFile::Impl {
     int fileDescriptor_ = -1;
 #endif
 
-    // Cache for frequently accessed data
-    mutable std::unordered_map<size_t, std::vector<float>> cache_;
+    // Sample data within the mapping
+    const uint8_t* samples_ = nullptr;
+    size_t dataOffset_ = 0;  // File offset of the first sample byte
+    uint16_t formatTag_ = 0;
+    size_t bytesPerSample_ = 0;
+
+    // Decode window, reused across reads
+    std::vector<float> window_;
+    size_t windowStart_ = 0;
+    size_t windowCount_ = 0;
+    size_t prefetchedEnd_ = 0;  // File offset up to which read-ahead was requested
+    size_t releasedEnd_ = 0;    // File offset below which STREAMING dropped pages
     mutable std::mutex cacheMutex_;
-    mutable size_t cacheSize_ = 0;
 
     ~Impl() {
         close();
@@ -69,9 +157,22 @@ class MemoryMappedAudioFile::Impl {
 
         // Open file for memory mapping
         if (!openForMapping()) {
+            closeMapping();
             return false;
         }
 
+        // Trust the mapping over the header if the file was truncated
+        if (dataOffset_ > fileSize_) {
+            closeMapping();
+            return false;
+        }
+        const size_t channels = std::max<size_t>(format_.channels, 1);
+        const size_t available = (fileSize_ - dataOffset_) / bytesPerSample_;
+        sampleCount_ = std::min(sampleCount_, available / channels * channels);
+        samples_ = static_cast<const uint8_t*>(mappedData_) + dataOffset_;
+
+        windowStart_ = windowCount_ = 0;
+        prefetchedEnd_ = releasedEnd_ = dataOffset_;
         isOpen_ = true;
         return true;
     }
@@ -80,84 +181,82 @@ class MemoryMappedAudioFile::Impl {
         if (!isOpen_)
             return;
 
-#ifdef _WIN32
-        if (mappedData_) {
-            UnmapViewOfFile(mappedData_);
-            mappedData_ = nullptr;
-        }
-        if (mappingHandle_ != INVALID_HANDLE_VALUE) {
-            CloseHandle(mappingHandle_);
-            mappingHandle_ = INVALID_HANDLE_VALUE;
-        }
-        if (fileHandle_ != INVALID_HANDLE_VALUE) {
-            CloseHandle(fileHandle_);
-            fileHandle_ = INVALID_HANDLE_VALUE;
-        }
-#else
-        if (mappedData_ && mappedData_ != MAP_FAILED) {
-            munmap(mappedData_, fileSize_);
-            mappedData_ = nullptr;
-        }
-        if (fileDescriptor_ >= 0) {
-            ::close(fileDescriptor_);
-            fileDescriptor_ = -1;
-        }
-#endif
+        closeMapping();
 
-        // Clear cache
+        // Release the decode window
         std::lock_guard<std::mutex> lock(cacheMutex_);
-        cache_.clear();
-        cacheSize_ = 0;
+        std::vector<float>().swap(window_);
+        windowStart_ = windowCount_ = 0;
+        samples_ = nullptr;
 
         isOpen_ = false;
     }
 
     const float* readSamples(size_t offset, size_t count) {
-        if (!isOpen_ || offset + count > sampleCount_) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!isOpen_ || offset > sampleCount_ || count > sampleCount_ - offset) {
             return nullptr;
         }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        // Check cache first
-        if (config_.enableCaching) {
-            std::lock_guard<std::mutex> lock(cacheMutex_);
-            auto it = cache_.find(offset);
-            if (it != cache_.end() && it->second.size() >= count) {
-                metrics_.cacheHits++;
-                return it->second.data();
-            }
-            metrics_.cacheMisses++;
+        // Aligned float data needs no conversion
+        const uint8_t* source = samples_ + offset * bytesPerSample_;
+        if (formatTag_ == DR_WAVE_FORMAT_IEEE_FLOAT && bytesPerSample_ == sizeof(float)
+            && reinterpret_cast<uintptr_t>(source) % alignof(float) == 0) {
+            adviseAround(offset, count);
+            recordRead(startTime, count);
+            return reinterpret_cast<const float*>(source);
         }
 
-        // Read from memory-mapped data
-        const float* data = readFromMappedData(offset, count);
+        if (offset >= windowStart_ && offset + count <= windowStart_ + windowCount_) {
+            metrics_.cacheHits++;
+            return window_.data() + (offset - windowStart_);
+        }
+        metrics_.cacheMisses++;
 
-        // Cache the data if enabled
-        if (config_.enableCaching && data && cacheSize_ < config_.maxCacheSize) {
-            std::lock_guard<std::mutex> lock(cacheMutex_);
-            if (cache_.find(offset) == cache_.end()) {
-                std::vector<float> cached(data, data + count);
-                cache_[offset] = std::move(cached);
-                cacheSize_ += count * sizeof(float);
+        // Decode a full window ahead for sequential readers; exactly the
+        // request for random access or when caching is off
+        size_t span = count;
+        if (config_.enableCaching && config_.accessPattern != AccessPattern::RANDOM) {
+            span = std::min(std::max(count, windowSamples()), sampleCount_ - offset);
+        }
+        if (window_.size() < span) {
+            window_.resize(span);
+        }
+        decode(offset, span, window_.data());
+        windowStart_ = offset;
+        windowCount_ = span;
 
-                // Evict oldest entries if cache is too large
-                while (cacheSize_ > config_.maxCacheSize && !cache_.empty()) {
-                    auto oldest = cache_.begin();
-                    cacheSize_ -= oldest->second.size() * sizeof(float);
-                    cache_.erase(oldest);
-                }
-            }
+        adviseAround(offset, span);
+        recordRead(startTime, span);
+        return window_.data();
+    }
+
+    size_t readSamples(size_t offset, size_t count, float* destination) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!isOpen_ || !destination || offset > sampleCount_ || count > sampleCount_ - offset) {
+            return 0;
         }
+        auto startTime = std::chrono::high_resolution_clock::now();
+        decode(offset, count, destination);
+        adviseAround(offset, count);
+        recordRead(startTime, count);
+        return count;
+    }
 
-        // Update metrics
-        auto endTime = std::chrono::high_resolution_clock::now();
-        metrics_.totalReadTime +=
-            std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-        metrics_.bytesRead += count * sizeof(float);
-        metrics_.readOperations++;
+    void prefetch(size_t offset, size_t count) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!isOpen_ || offset >= sampleCount_) {
+            return;
+        }
+        count = std::min(count, sampleCount_ - offset);
+        advise(dataOffset_ + offset * bytesPerSample_, count * bytesPerSample_, true);
+    }
 
-        return data;
+    IOPerformanceMetrics metrics() const {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        return metrics_;
     }
 
   private:
@@ -174,11 +273,149 @@ class MemoryMappedAudioFile::Impl {
         format_.formatName = "WAV";
 
         sampleCount_ = wav.totalPCMFrameCount * wav.channels;
+        formatTag_ = wav.translatedFormatTag;
+        bytesPerSample_ = wav.bitsPerSample / 8;
+        dataOffset_ = static_cast<size_t>(wav.dataChunkDataPos);
 
         drwav_uninit(&wav);
+
+        const bool pcm = formatTag_ == DR_WAVE_FORMAT_PCM && bytesPerSample_ >= 1
+                         && bytesPerSample_ <= 4 && format_.bitsPerSample % 8 == 0;
+        const bool ieee = formatTag_ == DR_WAVE_FORMAT_IEEE_FLOAT
+                          && (format_.bitsPerSample == 32 || format_.bitsPerSample == 64);
+        if (!pcm && !ieee) {
+            std::cerr << "Unsupported sample format for mapping: " << filename_ << std::endl;
+            return false;
+        }
         return true;
     }
 
+    size_t windowSamples() const {
+        const size_t bytes = std::min(config_.prefetchSizeBytes, config_.maxCacheSize);
+        const size_t channels = std::max<size_t>(format_.channels, 1);
+        return std::max<size_t>(bytes / sizeof(float) / channels, 1) * channels;
+    }
+
+    void decode(size_t offset, size_t count, float* out) const {
+        const uint8_t* in = samples_ + offset * bytesPerSample_;
+        if (formatTag_ == DR_WAVE_FORMAT_IEEE_FLOAT) {
+            if (bytesPerSample_ == sizeof(float)) {
+                std::memcpy(out, in, count * sizeof(float));
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    double sample;
+                    std::memcpy(&sample, in + i * sizeof(double), sizeof(sample));
+                    out[i] = static_cast<float>(sample);
+                }
+            }
+            return;
+        }
+
+        switch (bytesPerSample_) {
+            case 1:
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = (static_cast<float>(in[i]) - 128.0f) * (1.0f / 128.0f);
+                }
+                break;
+            case 2:
+                convertPcm16(in, count, out);
+                break;
+            case 3:
+                convertPcm24(in, count, out);
+                break;
+            default:
+                convertPcm32(in, count, out);
+                break;
+        }
+    }
+
+    void recordRead(std::chrono::high_resolution_clock::time_point startTime, size_t count) {
+        auto endTime = std::chrono::high_resolution_clock::now();
+        metrics_.totalReadTime +=
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+        metrics_.bytesRead += count * bytesPerSample_;
+        metrics_.readOperations++;
+    }
+
+    /// Read ahead of [offset, offset + count) and, when streaming, drop what is behind it
+    void adviseAround(size_t offset, size_t count) {
+        if (config_.accessPattern == AccessPattern::RANDOM) {
+            return;
+        }
+        const size_t begin = dataOffset_ + offset * bytesPerSample_;
+        const size_t end = begin + count * bytesPerSample_;
+        const size_t target = std::min(end + config_.prefetchSizeBytes, fileSize_);
+        if (target > prefetchedEnd_) {
+            const size_t from = std::max(prefetchedEnd_, begin);
+            advise(from, target - from, true);
+            prefetchedEnd_ = target;
+        }
+
+        if (config_.accessPattern == AccessPattern::STREAMING
+            && begin > releasedEnd_ + config_.prefetchSizeBytes) {
+            // Keep one prefetch span behind the window for short look-backs
+            const size_t upTo = begin - config_.prefetchSizeBytes;
+            advise(releasedEnd_, upTo - releasedEnd_, false);
+            releasedEnd_ = upTo;
+        }
+    }
+
+    /// madvise over the whole pages covering [begin, begin + length)
+    void advise(size_t begin, size_t length, bool willNeed) {
+#ifndef _WIN32
+        if (length == 0) {
+            return;
+        }
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        // WILLNEED rounds out to whole pages; DONTNEED must not touch the
+        // page that still holds data at the end of the range
+        const size_t first = begin / pageSize * pageSize;
+        const size_t last = willNeed ? std::min((begin + length + pageSize - 1) / pageSize
+                                                    * pageSize, fileSize_)
+                                     : (begin + length) / pageSize * pageSize;
+        if (last <= first) {
+            return;
+        }
+        auto* address = static_cast<char*>(mappedData_) + first;
+        madvise(address, last - first, willNeed ? MADV_WILLNEED : MADV_DONTNEED);
+#ifdef __linux__
+        if (willNeed && config_.accessPattern == AccessPattern::STREAMING) {
+            readahead(fileDescriptor_, static_cast<off_t>(first), last - first);
+        }
+#endif
+#else
+        (void)begin;
+        (void)length;
+        (void)willNeed;
+#endif
+    }
+
+    void closeMapping() {
+#ifdef _WIN32
+        if (mappedData_) {
+            UnmapViewOfFile(mappedData_);
+            mappedData_ = nullptr;
+        }
+        if (mappingHandle_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(mappingHandle_);
+            mappingHandle_ = INVALID_HANDLE_VALUE;
+        }
+        if (fileHandle_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle_);
+            fileHandle_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (mappedData_ && mappedData_ != MAP_FAILED) {
+            munmap(mappedData_, fileSize_);
+        }
+        mappedData_ = nullptr;
+        if (fileDescriptor_ >= 0) {
+            ::close(fileDescriptor_);
+            fileDescriptor_ = -1;
+        }
+#endif
+    }
+
     bool openForMapping() {
 #ifdef _WIN32
         fileHandle_ = CreateFileA(filename_.c_str(),
@@ -232,40 +469,15 @@ class MemoryMappedAudioFile::Impl {
             return false;
         }
 
-        // Provide hints to the kernel about access pattern
-        int advice = MADV_SEQUENTIAL;
-        switch (config_.accessPattern) {
-            case AccessPattern::RANDOM:
-                advice = MADV_RANDOM;
-                break;
-            case AccessPattern::STREAMING:
-                advice = MADV_WILLNEED;
-                break;
-            default:
-                advice = MADV_SEQUENTIAL;
-                break;
-        }
+        // Provide hints to the kernel about access pattern; read-ahead for
+        // the sequential patterns is issued per window in adviseAround()
+        const int advice =
+            config_.accessPattern == AccessPattern::RANDOM ? MADV_RANDOM : MADV_SEQUENTIAL;
         madvise(mappedData_, fileSize_, advice);
 #endif
 
         return true;
     }
-
-    const float* readFromMappedData(size_t offset, size_t count) {
-        // This is a simplified version - in practice, you'd need to handle
-        // the WAV header format and convert to float samples
-
-        // For now, assume the mapped data contains raw float samples
-        // after the WAV header (typically 44 bytes)
-        size_t headerSize = 44;  // Simplified WAV header size
-        size_t byteOffset = headerSize + (offset * sizeof(float));
-
-        if (byteOffset + (count * sizeof(float)) > fileSize_) {
-            return nullptr;
-        }
-
-        return reinterpret_cast<const float*>(static_cast<char*>(mappedData_) + byteOffset);
-    }
 };
 
 MemoryMappedAudioFile::MemoryMappedAudioFile(const Config& config)
@@ -287,6 +499,10 @@ const float* MemoryMappedAudioFile::readSamples(size_t offset, size_t count) {
     return pImpl->readSamples(offset, count);
 }
 
+size_t MemoryMappedAudioFile::readSamples(size_t offset, size_t count, float* destination) {
+    return pImpl->readSamples(offset, count, destination);
+}
+
 size_t MemoryMappedAudioFile::getSampleCount() const {
     return pImpl->sampleCount_;
 }
@@ -296,15 +512,11 @@ MemoryMappedAudioFile::AudioFormat MemoryMappedAudioFile::getFormat() const {
 }
 
 IOPerformanceMetrics MemoryMappedAudioFile::getMetrics() const {
-    return pImpl->metrics_;
+    return pImpl->metrics();
 }
 
 void MemoryMappedAudioFile::prefetch(size_t offset, size_t count) {
-    if (!pImpl->isOpen_)
-        return;
-
-    // Trigger read to cache the data
-    readSamples(offset, count);
+    pImpl->prefetch(offset, count);
 }
 
 bool MemoryMappedAudioFile::isOpen() const {
@@ -315,25 +527,269 @@ bool MemoryMappedAudioFile::isOpen() const {
 // AsyncAudioWriter Implementation
 // ============================================================================
 
+namespace {
+
+constexpr size_t kWriteAlignment = 4096;  // Logical block size O_DIRECT is safe with
+constexpr size_t kWavHeaderBytes = kWriteAlignment;
+
+inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+struct AlignedFree {
+    void operator()(uint8_t* p) const {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+};
+using AlignedBuffer = std::unique_ptr<uint8_t[], AlignedFree>;
+
+AlignedBuffer allocateAligned(size_t bytes) {
+#ifdef _WIN32
+    auto* p = static_cast<uint8_t*>(_aligned_malloc(bytes, kWriteAlignment));
+#else
+    auto* p = static_cast<uint8_t*>(std::aligned_alloc(kWriteAlignment, bytes));
+#endif
+    if (p) {
+        std::memset(p, 0, bytes);
+    }
+    return AlignedBuffer(p);
+}
+
+template <typename T>
+void storeLE(uint8_t* out, T value) {
+    std::memcpy(out, &value, sizeof(T));
+}
+
+/**
+ * RIFF/fmt header padded with a JUNK chunk so "data" payload begins at
+ * kWavHeaderBytes. Sizes saturate at 4 GiB (no RF64).
+ */
+void buildWavHeader(uint8_t* out,
+                    uint32_t sampleRate,
+                    uint16_t channels,
+                    uint16_t bitsPerSample,
+                    uint64_t dataBytes) {
+    std::memset(out, 0, kWavHeaderBytes);
+    const uint16_t blockAlign = static_cast<uint16_t>(channels * bitsPerSample / 8);
+    const uint64_t padded = dataBytes + (dataBytes & 1);  // RIFF chunks are word aligned
+    const auto clamp32 = [](uint64_t value) {
+        return static_cast<uint32_t>(std::min<uint64_t>(value, 0xFFFFFFFFu));
+    };
+
+    std::memcpy(out, "RIFF", 4);
+    storeLE<uint32_t>(out + 4, clamp32(kWavHeaderBytes - 8 + padded));
+    std::memcpy(out + 8, "WAVE", 4);
+    std::memcpy(out + 12, "fmt ", 4);
+    storeLE<uint32_t>(out + 16, 16);
+    storeLE<uint16_t>(out + 20, bitsPerSample == 32 ? DR_WAVE_FORMAT_IEEE_FLOAT
+                                                     : DR_WAVE_FORMAT_PCM);
+    storeLE<uint16_t>(out + 22, channels);
+    storeLE<uint32_t>(out + 24, sampleRate);
+    storeLE<uint32_t>(out + 28, sampleRate * blockAlign);
+    storeLE<uint16_t>(out + 32, blockAlign);
+    storeLE<uint16_t>(out + 34, bitsPerSample);
+    std::memcpy(out + 36, "JUNK", 4);
+    storeLE<uint32_t>(out + 40, static_cast<uint32_t>(kWavHeaderBytes - 44 - 8));
+    std::memcpy(out + kWavHeaderBytes - 8, "data", 4);
+    storeLE<uint32_t>(out + kWavHeaderBytes - 4, clamp32(dataBytes));
+}
+
+/// Convert float samples to the file's sample format
+void encodeSamples(const float* in, size_t count, uint16_t bitsPerSample, uint8_t* out) {
+    switch (bitsPerSample) {
+        case 16:
+            for (size_t i = 0; i < count; ++i) {
+                const float clamped = std::clamp(in[i], -1.0f, 1.0f);
+                const auto sample = static_cast<int16_t>(std::lrint(clamped * 32767.0f));
+                std::memcpy(out + i * 2, &sample, sizeof(sample));
+            }
+            break;
+        case 24:
+            for (size_t i = 0; i < count; ++i) {
+                const float clamped = std::clamp(in[i], -1.0f, 1.0f);
+                const auto sample = static_cast<int32_t>(std::lrint(clamped * 8388607.0f));
+                out[i * 3] = static_cast<uint8_t>(sample);
+                out[i * 3 + 1] = static_cast<uint8_t>(sample >> 8);
+                out[i * 3 + 2] = static_cast<uint8_t>(sample >> 16);
+            }
+            break;
+        default:
+            std::memcpy(out, in, count * sizeof(float));
+            break;
+    }
+}
+
+/// Positional writes on a raw descriptor, with the platform-specific extras
+class OutputFile {
+  public:
+    ~OutputFile() {
+        close();
+    }
+
+    bool open(const std::string& path, bool directIO) {
+#ifdef _WIN32
+        (void)directIO;
+        fd_ = _open(path.c_str(), _O_CREAT | _O_TRUNC | _O_RDWR | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        const int flags = O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+        if (directIO) {
+            fd_ = ::open(path.c_str(), flags | O_DIRECT, 0644);
+            direct_ = fd_ >= 0;  // Falls back below, e.g. on tmpfs (EINVAL)
+        }
+#else
+        (void)directIO;
+#endif
+        if (fd_ < 0) {
+            fd_ = ::open(path.c_str(), flags, 0644);
+        }
+#endif
+        return fd_ >= 0;
+    }
+
+    bool isDirect() const {
+        return direct_;
+    }
+
+    bool writeAt(const uint8_t* data, size_t size, uint64_t offset) {
+        while (size > 0) {
+#ifdef _WIN32
+            if (_lseeki64(fd_, static_cast<__int64>(offset), SEEK_SET) < 0) {
+                return false;
+            }
+            const int written = _write(fd_, data, static_cast<unsigned>(size));
+#else
+            const ssize_t written = ::pwrite(fd_, data, size, static_cast<off_t>(offset));
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (written <= 0) {
+                return false;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+            offset += static_cast<uint64_t>(written);
+        }
+        return true;
+    }
+
+    /// Reserve space past EOF without changing the file size; false if unsupported
+    bool preallocate(uint64_t offset, uint64_t length) {
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+        return fallocate(fd_, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset),
+                         static_cast<off_t>(length))
+               == 0;
+#else
+        (void)offset;
+        (void)length;
+        return false;
+#endif
+    }
+
+    void syncData(uint64_t writtenEnd) {
+#ifdef _WIN32
+        (void)writtenEnd;
+        _commit(fd_);
+#else
+#ifdef __linux__
+        fdatasync(fd_);
+#else
+        fsync(fd_);
+#endif
+#ifdef POSIX_FADV_DONTNEED
+        // Synced pages are clean; dropping them keeps long recordings from
+        // filling the page cache
+        if (!direct_) {
+            posix_fadvise(fd_, 0, static_cast<off_t>(writtenEnd), POSIX_FADV_DONTNEED);
+        }
+#endif
+#endif
+    }
+
+    bool truncate(uint64_t size) {
+#ifdef _WIN32
+        return _chsize_s(fd_, static_cast<__int64>(size)) == 0;
+#else
+        return ftruncate(fd_, static_cast<off_t>(size)) == 0;
+#endif
+    }
+
+    void close() {
+        if (fd_ >= 0) {
+#ifdef _WIN32
+            _close(fd_);
+#else
+            ::close(fd_);
+#endif
+            fd_ = -1;
+        }
+        direct_ = false;
+    }
+
+  private:
+    int fd_ = -1;
+    bool direct_ = false;
+};
+
+}  // namespace
+
 class AsyncAudioWriter::Impl {
   public:
     Config config_;
     std::string filename_;
-    drwav wav_;
-    bool wavInitialized_ = false;
 
-    // Async processing
+    // Format
+    uint32_t sampleRate_ = 0;
+    uint16_t channels_ = 0;
+    uint16_t bitsPerSample_ = 32;
+    size_t bytesPerSample_ = sizeof(float);
+
+    // Staging buffers; blocks_[active_] is being filled by writeAsync()
+    struct Block {
+        AlignedBuffer data;
+        size_t used = 0;
+        uint64_t fileOffset = 0;
+        std::vector<WriteCallback> callbacks;
+    };
+    std::vector<Block> blocks_;
+    std::deque<size_t> freeBlocks_;
+    std::deque<size_t> fullBlocks_;
+    size_t active_ = 0;
+    size_t blockBytes_ = 0;
+    uint64_t nextOffset_ = kWavHeaderBytes;  // File offset of the active block
+    uint64_t dataBytes_ = 0;                 // Accepted so far
+
+    // Writer thread
+    OutputFile file_;
     std::thread writerThread_;
-    std::queue<std::pair<std::vector<float>, WriteCallback>> writeQueue_;
-    std::mutex queueMutex_;
+    mutable std::mutex queueMutex_;
     std::condition_variable queueCondition_;
+    std::condition_variable checkpointDone_;
+    uint64_t checkpointsRequested_ = 0;
+    uint64_t checkpointsCompleted_ = 0;
+    bool checkpointOk_ = true;
     std::atomic<bool> shouldStop_{false};
     std::atomic<bool> isActive_{false};
+    bool writerDone_ = false;  // The writer thread has finished its final flush
+
+    // Writer-thread state
+    AlignedBuffer scratch_;  // Zero-padded tail for partial O_DIRECT writes
+    uint64_t preallocatedEnd_ = 0;
+    bool preallocationSupported_ = true;
+    uint64_t writtenEnd_ = kWavHeaderBytes;
+    std::chrono::steady_clock::time_point lastSync_;
+    bool ioError_ = false;
 
     IOPerformanceMetrics metrics_ = {};
 
     ~Impl() {
-        stop(std::chrono::milliseconds(1000));
+        while (!stop(std::chrono::milliseconds(1000)) && isActive_) {
+        }
     }
 
     bool start(const std::string& filename,
@@ -343,57 +799,132 @@ class AsyncAudioWriter::Impl {
         if (isActive_) {
             return false;
         }
+        if (channels == 0 || (bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32)) {
+            std::cerr << "Unsupported WAV format for writing: " << bitsPerSample << "-bit"
+                      << std::endl;
+            return false;
+        }
 
         filename_ = filename;
+        sampleRate_ = sampleRate;
+        channels_ = channels;
+        bitsPerSample_ = bitsPerSample;
+        bytesPerSample_ = bitsPerSample / 8;
 
-        // Initialize WAV file
-        drwav_data_format format;
-        format.container = drwav_container_riff;
-        format.format = DR_WAVE_FORMAT_IEEE_FLOAT;
-        format.channels = channels;
-        format.sampleRate = sampleRate;
-        format.bitsPerSample = bitsPerSample;
-
-        if (!drwav_init_file_write(&wav_, filename_.c_str(), &format, nullptr)) {
+        if (!file_.open(filename_, config_.useDirectIO)) {
             std::cerr << "Failed to initialize WAV file for writing: " << filename_ << std::endl;
             return false;
         }
-        wavInitialized_ = true;
 
-        // Start writer thread
+        // Whole frames per block keep every block boundary on a frame, and a
+        // multiple of the write alignment keeps every block's file offset
+        // aligned for O_DIRECT (24-bit and odd channel counts need both)
+        const size_t frameBytes = bytesPerSample_ * channels_;
+        const size_t unit = std::lcm(frameBytes, kWriteAlignment);
+        blockBytes_ = alignUp(std::max(config_.bufferSizeBytes, unit), unit);
+
+        blocks_.clear();
+        freeBlocks_.clear();
+        fullBlocks_.clear();
+        const size_t count = std::max<size_t>(config_.bufferCount, 2);
+        for (size_t i = 0; i < count; ++i) {
+            Block block;
+            block.data = allocateAligned(blockBytes_);
+            if (!block.data) {
+                file_.close();
+                return false;
+            }
+            blocks_.push_back(std::move(block));
+            freeBlocks_.push_back(i);
+        }
+        scratch_ = allocateAligned(kWriteAlignment);
+        active_ = freeBlocks_.front();
+        freeBlocks_.pop_front();
+        nextOffset_ = writtenEnd_ = preallocatedEnd_ = kWavHeaderBytes;
+        blocks_[active_].fileOffset = nextOffset_;
+        dataBytes_ = 0;
+        preallocationSupported_ = config_.preallocateBytes > 0;
+        checkpointsRequested_ = checkpointsCompleted_ = 0;
+        ioError_ = false;
+
+        // A valid, empty WAV from the start
+        if (!writeHeader()) {
+            file_.close();
+            return false;
+        }
+
+        lastSync_ = std::chrono::steady_clock::now();
         shouldStop_ = false;
+        writerDone_ = false;
         isActive_ = true;
         writerThread_ = std::thread(&Impl::writerThreadFunc, this);
-
         return true;
     }
 
     bool writeAsync(const float* data, size_t sampleCount, WriteCallback callback) {
-        if (!isActive_) {
+        if (!isActive_ || (!data && sampleCount > 0)) {
             return false;
         }
 
-        // Check queue depth
-        {
-            std::lock_guard<std::mutex> lock(queueMutex_);
-            if (writeQueue_.size() >= config_.maxQueuedWrites) {
-                if (callback) {
-                    callback(false, "Write queue full");
-                }
-                return false;
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        if (shouldStop_ || !isActive_) {
+            return false;
+        }
+        // Accept all or nothing. Completing a block needs a free one to rotate
+        // into, so the request must end before the last free byte.
+        const size_t bytes = sampleCount * bytesPerSample_;
+        const size_t capacity = blockBytes_;
+        const size_t room = (capacity - blocks_[active_].used) + freeBlocks_.size() * capacity;
+        if (bytes >= room || ioError_) {
+            const bool failed = ioError_;
+            lock.unlock();
+            if (callback) {
+                callback(false, failed ? "Write failed" : "Write queue full");
             }
+            return false;
         }
 
-        // Copy data and queue for writing
-        std::vector<float> dataCopy(data, data + sampleCount);
+        // Convert straight into the staging buffers, rotating as they fill
+        size_t done = 0;
+        bool handedOff = false;
+        while (done < sampleCount) {
+            Block& block = blocks_[active_];
+            const size_t fit =
+                std::min(sampleCount - done, (capacity - block.used) / bytesPerSample_);
+            encodeSamples(data + done, fit, bitsPerSample_, block.data.get() + block.used);
+            block.used += fit * bytesPerSample_;
+            done += fit;
+            if (block.used == capacity) {
+                if (done == sampleCount && callback) {
+                    // Completes with the block holding its last sample
+                    block.callbacks.push_back(std::move(callback));
+                    callback = nullptr;
+                }
+                rotateActive();
+                handedOff = true;
+            }
+        }
+        if (callback) {
+            blocks_[active_].callbacks.push_back(std::move(callback));
+        }
+        dataBytes_ += bytes;
+        lock.unlock();
 
-        {
-            std::lock_guard<std::mutex> lock(queueMutex_);
-            writeQueue_.emplace(std::move(dataCopy), callback);
+        if (handedOff) {
+            queueCondition_.notify_one();
         }
+        return true;
+    }
 
+    bool checkpoint() {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        if (!isActive_) {
+            return false;
+        }
+        const uint64_t ticket = ++checkpointsRequested_;
         queueCondition_.notify_one();
-        return true;
+        checkpointDone_.wait(lock, [&] { return checkpointsCompleted_ >= ticket || !isActive_; });
+        return checkpointsCompleted_ >= ticket && checkpointOk_;
     }
 
     bool stop(std::chrono::milliseconds timeout) {
@@ -401,80 +932,207 @@ class AsyncAudioWriter::Impl {
             return true;
         }
 
-        shouldStop_ = true;
-        queueCondition_.notify_all();
-
-        if (writerThread_.joinable()) {
-            if (timeout.count() > 0) {
-                // Try to join with timeout (simplified - in practice you'd use platform-specific
-                // APIs)
-                writerThread_.join();
-            } else {
-                writerThread_.join();
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            shouldStop_ = true;
+            queueCondition_.notify_all();
+            // The writer keeps going on timeout; the file is only valid once it finishes
+            if (!checkpointDone_.wait_for(lock, timeout, [this] { return writerDone_; })) {
+                return false;
             }
         }
 
-        if (wavInitialized_) {
-            drwav_uninit(&wav_);
-            wavInitialized_ = false;
+        if (writerThread_.joinable()) {
+            writerThread_.join();
         }
 
-        isActive_ = false;
-        return true;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            isActive_ = false;
+        }
+        checkpointDone_.notify_all();
+
+        file_.close();
+        blocks_.clear();
+        freeBlocks_.clear();
+        fullBlocks_.clear();
+        scratch_.reset();
+        return !ioError_;
     }
 
     size_t getQueueDepth() const {
         std::lock_guard<std::mutex> lock(queueMutex_);
-        return writeQueue_.size();
+        return fullBlocks_.size();
+    }
+
+    IOPerformanceMetrics metrics() const {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        return metrics_;
     }
 
   private:
-    void writerThreadFunc() {
-        while (!shouldStop_ || !writeQueue_.empty()) {
-            std::unique_lock<std::mutex> lock(queueMutex_);
+    // Caller holds queueMutex_ and has checked a free block exists
+    void rotateActive() {
+        fullBlocks_.push_back(active_);
+        nextOffset_ += blocks_[active_].used;
+        active_ = freeBlocks_.front();
+        freeBlocks_.pop_front();
+        blocks_[active_].used = 0;
+        blocks_[active_].fileOffset = nextOffset_;
+    }
+
+    bool writeHeader() {
+        auto header = allocateAligned(kWavHeaderBytes);
+        if (!header) {
+            return false;
+        }
+        uint64_t dataBytes = 0;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            dataBytes = writtenEnd_ - kWavHeaderBytes;
+        }
+        buildWavHeader(header.get(), sampleRate_, channels_, bitsPerSample_, dataBytes);
+        return file_.writeAt(header.get(), kWavHeaderBytes, 0);
+    }
 
-            // Wait for data or stop signal
-            queueCondition_.wait(lock, [this] { return !writeQueue_.empty() || shouldStop_; });
+    /**
+     * Write `size` bytes of a block at `offset`. With O_DIRECT the last
+     * partial 4 KiB is copied to scratch_ and zero padded; the excess is
+     * overwritten by the next write or cut off at stop.
+     */
+    bool writeBlock(const uint8_t* data, size_t size, uint64_t offset) {
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        ensurePreallocated(offset + alignUp(size, kWriteAlignment));
+
+        bool ok = true;
+        if (file_.isDirect() && size % kWriteAlignment != 0) {
+            const size_t whole = size / kWriteAlignment * kWriteAlignment;
+            ok = whole == 0 || file_.writeAt(data, whole, offset);
+            std::memset(scratch_.get(), 0, kWriteAlignment);
+            std::memcpy(scratch_.get(), data + whole, size - whole);
+            ok = ok && file_.writeAt(scratch_.get(), kWriteAlignment, offset + whole);
+        } else {
+            ok = file_.writeAt(data, size, offset);
+        }
 
-            if (writeQueue_.empty()) {
-                continue;
-            }
+        const auto endTime = std::chrono::high_resolution_clock::now();
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        metrics_.totalWriteTime +=
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+        if (ok) {
+            metrics_.bytesWritten += size;
+            metrics_.writeOperations++;
+            writtenEnd_ = std::max(writtenEnd_, offset + size);
+        } else {
+            ioError_ = true;
+        }
+        return ok;
+    }
 
-            // Get next write operation
-            auto [data, callback] = std::move(writeQueue_.front());
-            writeQueue_.pop();
-            lock.unlock();
+    void ensurePreallocated(uint64_t end) {
+        if (!preallocationSupported_ || end <= preallocatedEnd_) {
+            return;
+        }
+        const uint64_t step = std::max<uint64_t>(config_.preallocateBytes, end - preallocatedEnd_);
+        if (file_.preallocate(preallocatedEnd_, step)) {
+            preallocatedEnd_ += step;
+        } else {
+            preallocationSupported_ = false;
+        }
+    }
 
-            // Perform write operation
-            auto startTime = std::chrono::high_resolution_clock::now();
+    void syncIfDue(bool force) {
+        const auto now = std::chrono::steady_clock::now();
+        const bool due =
+            config_.syncInterval.count() > 0 && now - lastSync_ >= config_.syncInterval;
+        if (force || due) {
+            file_.syncData(writtenEnd_);
+            lastSync_ = now;
+        }
+    }
 
-            bool success = false;
-            std::string errorMessage;
+    void fireCallbacks(std::vector<WriteCallback>& callbacks, bool ok) {
+        for (auto& callback : callbacks) {
+            callback(ok, ok ? std::string() : "Failed to write audio samples");
+        }
+        callbacks.clear();
+    }
 
-            if (wavInitialized_) {
-                drwav_uint64 samplesWritten =
-                    drwav_write_pcm_frames(&wav_, data.size(), data.data());
-                success = (samplesWritten == data.size());
-                if (!success) {
-                    errorMessage = "Failed to write audio samples";
-                }
+    /// Write the active block's current prefix; the caller keeps filling it
+    bool flushActive(std::unique_lock<std::mutex>& lock) {
+        Block& block = blocks_[active_];
+        const size_t size = block.used;
+        const uint64_t offset = block.fileOffset;
+        std::vector<WriteCallback> callbacks;
+        callbacks.swap(block.callbacks);
+        // Bytes below `size` are stable: writers only append and the block
+        // cannot be recycled while it is active or queued for this thread
+        lock.unlock();
+        const bool ok = size == 0 || writeBlock(block.data.get(), size, offset);
+        fireCallbacks(callbacks, ok);
+        lock.lock();
+        return ok;
+    }
+
+    void writerThreadFunc() {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        while (true) {
+            const auto ready = [this] {
+                return !fullBlocks_.empty() || shouldStop_
+                       || checkpointsCompleted_ < checkpointsRequested_;
+            };
+            if (config_.syncInterval.count() > 0) {
+                queueCondition_.wait_until(lock, lastSync_ + config_.syncInterval, ready);
             } else {
-                errorMessage = "WAV file not initialized";
+                queueCondition_.wait(lock, ready);
             }
 
-            // Update metrics
-            auto endTime = std::chrono::high_resolution_clock::now();
-            metrics_.totalWriteTime +=
-                std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-            metrics_.bytesWritten += data.size() * sizeof(float);
-            metrics_.writeOperations++;
+            // Full blocks first, in file order
+            while (!fullBlocks_.empty()) {
+                const size_t index = fullBlocks_.front();
+                fullBlocks_.pop_front();
+                Block& block = blocks_[index];
+                lock.unlock();
+                const bool ok = writeBlock(block.data.get(), block.used, block.fileOffset);
+                fireCallbacks(block.callbacks, ok);
+                lock.lock();
+                block.used = 0;
+                freeBlocks_.push_back(index);
+            }
 
-            // Call completion callback
-            if (callback) {
-                callback(success, errorMessage);
+            const uint64_t pending = checkpointsRequested_;
+            if (shouldStop_ || checkpointsCompleted_ < pending) {
+                bool ok = flushActive(lock);
+                lock.unlock();
+                ok = writeHeader() && ok;
+                if (shouldStop_) {
+                    // Drop the O_DIRECT padding and any preallocation past the end
+                    const uint64_t end = kWavHeaderBytes + dataBytesSnapshot();
+                    ok = file_.truncate(end + (end & 1)) && ok;
+                }
+                syncIfDue(true);
+                lock.lock();
+                checkpointOk_ = ok && !ioError_;
+                checkpointsCompleted_ = pending;
+                checkpointDone_.notify_all();
+                if (shouldStop_ && fullBlocks_.empty()) {
+                    writerDone_ = true;
+                    checkpointDone_.notify_all();
+                    break;
+                }
+                continue;
             }
+
+            lock.unlock();
+            syncIfDue(false);
+            lock.lock();
         }
     }
+
+    uint64_t dataBytesSnapshot() {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        return dataBytes_;
+    }
 };
 
 AsyncAudioWriter::AsyncAudioWriter(const Config& config) : pImpl(std::make_unique<Impl>()) {
@@ -491,7 +1149,11 @@ bool AsyncAudioWriter::start(const std::string& filename,
 }
 
 bool AsyncAudioWriter::writeAsync(const float* data, size_t sampleCount, WriteCallback callback) {
-    return pImpl->writeAsync(data, sampleCount, callback);
+    return pImpl->writeAsync(data, sampleCount, std::move(callback));
+}
+
+bool AsyncAudioWriter::checkpoint() {
+    return pImpl->checkpoint();
 }
 
 bool AsyncAudioWriter::stop(std::chrono::milliseconds timeout) {
@@ -507,7 +1169,7 @@ bool AsyncAudioWriter::isActive() const {
 }
 
 IOPerformanceMetrics AsyncAudioWriter::getMetrics() const {
-    return pImpl->metrics_;
+    return pImpl->metrics();
 }
 
 // ============================================================================
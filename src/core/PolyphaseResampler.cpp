@@ -0,0 +1,332 @@
+/**
+ * @file PolyphaseResampler.cpp
+ * @brief Streaming polyphase windowed-sinc sample-rate converter
+ *
+ * Kept apart from AudioFormatConverter.cpp so the resampler builds on its own;
+ * the format converter, the streaming stages and the engine's file sources
+ * all share it.
+ *
+ * @author Huntmaster Engine Team
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "huntmaster/core/AudioFormatConverter.h"
+
+namespace huntmaster {
+namespace core {
+
+namespace {
+
+constexpr uint32_t kMaxPolyphasePhases = 1024;
+constexpr double kPi = 3.14159265358979323846;
+
+struct PolyphaseFilterBank {
+    uint32_t interpolation = 1;       // L = outputRate / gcd
+    uint32_t decimation = 1;          // M = inputRate / gcd
+    uint32_t phases = 1;              // Stored branches: L, or kMaxPolyphasePhases when larger
+    size_t taps = 0;                  // Per branch, a multiple of 8
+    std::vector<float> coefficients;  // phases * taps, branch-major
+};
+
+size_t baseTapsForQuality(ResamplingQuality quality) {
+    switch (quality) {
+        case ResamplingQuality::FAST:
+            return 8;
+        case ResamplingQuality::BALANCED:
+            return 16;
+        case ResamplingQuality::BEST:
+            return 64;
+        case ResamplingQuality::HIGH:
+        default:
+            return 32;
+    }
+}
+
+double kaiserBetaForQuality(ResamplingQuality quality) {
+    switch (quality) {
+        case ResamplingQuality::FAST:
+            return 5.0;
+        case ResamplingQuality::BALANCED:
+            return 6.5;
+        case ResamplingQuality::BEST:
+            return 10.0;
+        case ResamplingQuality::HIGH:
+        default:
+            return 8.6;
+    }
+}
+
+/// Zeroth-order modified Bessel function of the first kind
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    const double halfX = x / 2.0;
+    for (int k = 1; k < 64 && term > sum * 1e-12; ++k) {
+        term *= (halfX / k) * (halfX / k);
+        sum += term;
+    }
+    return sum;
+}
+
+std::shared_ptr<const PolyphaseFilterBank>
+buildFilterBank(uint32_t interpolation, uint32_t decimation, ResamplingQuality quality) {
+    auto bank = std::make_shared<PolyphaseFilterBank>();
+    bank->interpolation = interpolation;
+    bank->decimation = decimation;
+    bank->phases = std::min(interpolation, kMaxPolyphasePhases);
+
+    // Cut off just below the lower Nyquist frequency. When downsampling the
+    // kernel widens in input time, so the tap count grows to keep its shape.
+    const double scale = std::min(1.0, static_cast<double>(interpolation) / decimation);
+    const double rolloff = quality == ResamplingQuality::FAST ? 0.85 : 0.94;
+    const double cutoff = scale * rolloff;
+    const size_t taps = static_cast<size_t>(std::ceil(baseTapsForQuality(quality) / scale));
+    bank->taps = (taps + 7) / 8 * 8;
+
+    const double halfWidth = static_cast<double>(bank->taps) / 2.0;
+    const double beta = kaiserBetaForQuality(quality);
+    const double i0Beta = besselI0(beta);
+    bank->coefficients.resize(static_cast<size_t>(bank->phases) * bank->taps);
+
+    for (uint32_t p = 0; p < bank->phases; ++p) {
+        // Branch p interpolates at fractional input offset p / phases; tap j
+        // weights input sample (base - taps/2 + 1 + j)
+        const double offset = static_cast<double>(p) / bank->phases;
+        float* branch = bank->coefficients.data() + static_cast<size_t>(p) * bank->taps;
+        double sum = 0.0;
+        for (size_t j = 0; j < bank->taps; ++j) {
+            const double t = offset + halfWidth - 1.0 - static_cast<double>(j);
+            const double x = kPi * cutoff * t;
+            const double sinc = std::abs(x) < 1e-12 ? 1.0 : std::sin(x) / x;
+            const double ratio = t / halfWidth;
+            const double window = std::abs(ratio) >= 1.0
+                                      ? 0.0
+                                      : besselI0(beta * std::sqrt(1.0 - ratio * ratio)) / i0Beta;
+            const double value = cutoff * sinc * window;
+            branch[j] = static_cast<float>(value);
+            sum += value;
+        }
+        // Unity gain at DC for every branch
+        for (size_t j = 0; j < bank->taps; ++j) {
+            branch[j] = static_cast<float>(branch[j] / sum);
+        }
+    }
+    return bank;
+}
+
+/// Filter banks are shared by every resampler with the same ratio and quality
+std::shared_ptr<const PolyphaseFilterBank>
+getFilterBank(uint32_t interpolation, uint32_t decimation, ResamplingQuality quality) {
+    static std::mutex cacheMutex;
+    static std::map<std::tuple<uint32_t, uint32_t, int>, std::shared_ptr<const PolyphaseFilterBank>>
+        cache;
+
+    const auto key = std::make_tuple(interpolation, decimation, static_cast<int>(quality));
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto& bank = cache[key];
+    if (!bank) {
+        bank = buildFilterBank(interpolation, decimation, quality);
+    }
+    return bank;
+}
+
+/// Dot product of two float arrays; n is a multiple of 8
+inline float dotProduct(const float* a, const float* b, size_t n) {
+#if defined(__AVX2__)
+    __m256 acc = _mm256_setzero_ps();
+    for (size_t i = 0; i < n; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#elif defined(__SSE2__)
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (size_t i = 0; i < n; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    __m128 sum = _mm_add_ps(acc0, acc1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#else
+    float sum = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+#endif
+}
+
+}  // namespace
+
+struct PolyphaseResampler::Impl {
+    Config config;
+    std::shared_ptr<const PolyphaseFilterBank> bank;
+
+    // Per-channel input not yet fully consumed; history[c][0] is input frame
+    // `dropped` - (taps/2 - 1), the leading zeros standing in for t < 0
+    std::vector<std::vector<float>> history;
+    uint64_t dropped = 0;
+
+    // Next output time in input frames: base + phase / L
+    uint64_t base = 0;
+    uint32_t phase = 0;
+
+    uint64_t inputFrames = 0;
+    uint64_t outputFrames = 0;
+
+    void reset() {
+        history.assign(config.channels, std::vector<float>(bank->taps / 2 - 1, 0.0f));
+        dropped = 0;
+        base = 0;
+        phase = 0;
+        inputFrames = 0;
+        outputFrames = 0;
+    }
+
+    size_t produce(std::vector<float>& output, uint64_t limit) {
+        const size_t taps = bank->taps;
+        const size_t available = history[0].size();
+        const uint32_t interpolation = bank->interpolation;
+        const uint32_t decimation = bank->decimation;
+        const bool exactPhases = bank->phases == interpolation;
+
+        size_t produced = 0;
+        while (outputFrames < limit) {
+            const size_t start = static_cast<size_t>(base - dropped);
+            if (start + taps > available) {
+                break;
+            }
+            const uint32_t branch =
+                exactPhases ? phase
+                            : static_cast<uint32_t>(static_cast<uint64_t>(phase) * bank->phases
+                                                    / interpolation);
+            const float* coefs = bank->coefficients.data() + static_cast<size_t>(branch) * taps;
+            for (const auto& channel : history) {
+                output.push_back(dotProduct(coefs, channel.data() + start, taps));
+            }
+            ++outputFrames;
+            ++produced;
+
+            phase += decimation;
+            base += phase / interpolation;
+            phase %= interpolation;
+        }
+
+        // Everything before the next window start is no longer needed
+        const size_t consumed =
+            static_cast<size_t>(std::min<uint64_t>(base - dropped, available));
+        if (consumed > 0) {
+            for (auto& channel : history) {
+                channel.erase(channel.begin(), channel.begin() + consumed);
+            }
+            dropped += consumed;
+        }
+        return produced;
+    }
+};
+
+PolyphaseResampler::PolyphaseResampler(const Config& config) : impl_(std::make_unique<Impl>()) {
+    if (config.inputRate == 0 || config.outputRate == 0 || config.channels == 0) {
+        throw std::invalid_argument("PolyphaseResampler: rates and channels must be non-zero");
+    }
+    const uint32_t divisor = std::gcd(config.inputRate, config.outputRate);
+    impl_->config = config;
+    impl_->bank =
+        getFilterBank(config.outputRate / divisor, config.inputRate / divisor, config.quality);
+    impl_->reset();
+}
+
+PolyphaseResampler::~PolyphaseResampler() = default;
+PolyphaseResampler::PolyphaseResampler(PolyphaseResampler&&) noexcept = default;
+PolyphaseResampler& PolyphaseResampler::operator=(PolyphaseResampler&&) noexcept = default;
+
+size_t
+PolyphaseResampler::process(const float* input, size_t inputFrames, std::vector<float>& output) {
+    if (!input || inputFrames == 0) {
+        return 0;
+    }
+    const size_t channels = impl_->config.channels;
+    for (size_t c = 0; c < channels; ++c) {
+        auto& channel = impl_->history[c];
+        const size_t offset = channel.size();
+        channel.resize(offset + inputFrames);
+        for (size_t i = 0; i < inputFrames; ++i) {
+            channel[offset + i] = input[i * channels + c];
+        }
+    }
+    output.reserve(output.size() + maxOutputFrames(inputFrames) * channels);
+    impl_->inputFrames += inputFrames;
+    return impl_->produce(output, std::numeric_limits<uint64_t>::max());
+}
+
+size_t PolyphaseResampler::flush(std::vector<float>& output) {
+    // Zeros past the end complete the windows of the final outputs
+    for (auto& channel : impl_->history) {
+        channel.resize(channel.size() + impl_->bank->taps / 2, 0.0f);
+    }
+    const uint64_t total =
+        (impl_->inputFrames * impl_->bank->interpolation + impl_->bank->decimation - 1)
+        / impl_->bank->decimation;
+    const size_t produced = impl_->produce(output, total);
+    impl_->reset();
+    return produced;
+}
+
+void PolyphaseResampler::reset() {
+    impl_->reset();
+}
+
+std::vector<float>
+PolyphaseResampler::resample(const float* input, size_t inputFrames, const Config& config) {
+    PolyphaseResampler resampler(config);
+    std::vector<float> output;
+    resampler.process(input, inputFrames, output);
+    resampler.flush(output);
+    return output;
+}
+
+size_t PolyphaseResampler::maxOutputFrames(size_t inputFrames) const {
+    const uint64_t total =
+        ((impl_->inputFrames + inputFrames) * impl_->bank->interpolation
+         + impl_->bank->decimation - 1)
+        / impl_->bank->decimation;
+    return static_cast<size_t>(total - impl_->outputFrames);
+}
+
+size_t PolyphaseResampler::latencyFrames() const {
+    return impl_->bank->taps / 2;
+}
+
+size_t PolyphaseResampler::tapsPerPhase() const {
+    return impl_->bank->taps;
+}
+
+const PolyphaseResampler::Config& PolyphaseResampler::getConfig() const {
+    return impl_->config;
+}
+
+}  // namespace core
+}  // namespace huntmaster
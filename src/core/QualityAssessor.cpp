@@ -15,14 +15,163 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <sstream>
 
+#ifdef HAVE_KISSFFT
+#include "kiss_fftr.h"
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 namespace huntmaster {
 namespace core {
 
+namespace {
+
+constexpr double kMinPower = 1e-12;           // -120 dBFS floor for level conversions
+constexpr double kSignalSmoothing = 0.9;      // Per-frame smoothing of active signal power
+constexpr double kActivityMargin = 2.0;       // Frames 3 dB above the noise floor count as signal
+constexpr float kClippingSmoothing = 0.9f;    // Per-frame smoothing of the clipping ratio
+constexpr float kClippingRatioLimit = 1e-4f;  // Clipped fraction reported as clipping
+constexpr float kPeakDecay = 0.95f;           // Per-frame decay of the tracked peak
+constexpr float kNoiseWindowSeconds = 1.5f;   // Minimum-statistics tracking window
+constexpr uint32_t kMinNoiseWindowFrames = 8;
+constexpr uint32_t kBlockStatisticsFrames = 32;  // Frames per buffer in block assessments
+constexpr uint32_t kMinBlockFrameSize = 64;
+constexpr size_t kMaxHarmonics = 10;
+constexpr size_t kLobeHalfWidth = 2;  // Hann window main lobe half-width in bins
+
+double powerToDb(double power) {
+    return 10.0 * std::log10(std::max(power, kMinPower));
+}
+
+/**
+ * @brief Log-spaced frequency response band edges expressed as FFT bins
+ */
+std::vector<uint32_t> buildBandEdges(const QualityConfig& config) {
+    std::vector<uint32_t> edges;
+    const uint32_t binCount = config.fftSize / 2 + 1;
+    const float binHz = static_cast<float>(config.sampleRate) / config.fftSize;
+    const float low = std::max(config.minFrequency, binHz);
+    const float high = std::min(config.maxFrequency, config.sampleRate * 0.5f);
+
+    if (config.frequencyBands == 0 || high <= low) {
+        return edges;
+    }
+
+    edges.reserve(config.frequencyBands + 1);
+    for (uint32_t band = 0; band <= config.frequencyBands; ++band) {
+        const float frequency =
+            low * std::pow(high / low, static_cast<float>(band) / config.frequencyBands);
+        auto bin = static_cast<uint32_t>(frequency / binHz + 0.5f);
+        if (!edges.empty()) {
+            bin = std::max(bin, edges.back() + 1);
+        }
+        edges.push_back(std::min(bin, binCount));
+    }
+    return edges;
+}
+
+}  // namespace
+
+/**
+ * @brief Real-input FFT sized once per configuration
+ *
+ * Wraps the KissFFT plan and its output scratch so spectral queries never
+ * allocate after initialize().
+ */
+class FFTProcessor {
+  public:
+    explicit FFTProcessor(size_t fftSize) : fftSize_(fftSize) {
+#ifdef HAVE_KISSFFT
+        config_ = kiss_fftr_alloc(static_cast<int>(fftSize), 0, nullptr, nullptr);
+        output_.resize(fftSize / 2 + 1);
+#endif
+    }
+
+    ~FFTProcessor() {
+#ifdef HAVE_KISSFFT
+        if (config_) {
+            kiss_fftr_free(config_);
+        }
+#endif
+    }
+
+    FFTProcessor(const FFTProcessor&) = delete;
+    FFTProcessor& operator=(const FFTProcessor&) = delete;
+
+    bool isValid() const {
+#ifdef HAVE_KISSFFT
+        return config_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    size_t size() const { return fftSize_; }
+
+    /// Transforms fftSize real samples into fftSize / 2 + 1 complex bins
+    bool forward(const float* input, std::complex<float>* output) {
+#ifdef HAVE_KISSFFT
+        if (!config_) {
+            return false;
+        }
+        kiss_fftr(config_, input, output_.data());
+        for (size_t i = 0; i < output_.size(); ++i) {
+            output[i] = std::complex<float>(output_[i].r, output_[i].i);
+        }
+        return true;
+#else
+        (void)input;
+        (void)output;
+        return false;
+#endif
+    }
+
+  private:
+    size_t fftSize_;
+#ifdef HAVE_KISSFFT
+    kiss_fftr_cfg config_ = nullptr;
+    std::vector<kiss_fft_cpx> output_;
+#endif
+};
+
+/**
+ * @brief Cached Hann window table
+ *
+ * The table is regenerated only when the requested length changes, which in
+ * practice happens once per configuration.
+ */
+class WindowFunction {
+  public:
+    const std::vector<float>& coefficients(size_t length) {
+        if (coefficients_.size() != length) {
+            coefficients_.resize(length);
+            sum_ = 0.0f;
+            const float step = length > 1 ? 2.0f * static_cast<float>(M_PI) / (length - 1) : 0.0f;
+            for (size_t i = 0; i < length; ++i) {
+                coefficients_[i] = length > 1 ? 0.5f * (1.0f - std::cos(step * i)) : 1.0f;
+                sum_ += coefficients_[i];
+            }
+        }
+        return coefficients_;
+    }
+
+    /// Sum of the current coefficients, used to normalize magnitudes
+    float sum() const { return sum_; }
+
+  private:
+    std::vector<float> coefficients_;
+    float sum_ = 0.0f;
+};
+
 // TODO: Phase 2.4 - Advanced Audio Engine Implementation - COMPREHENSIVE FILE TODO
 // =================================================================================
 
@@ -44,8 +193,8 @@ namespace core {
 
 QualityAssessor::QualityAssessor()
     : initialized_(false), startTime_(std::chrono::steady_clock::now()),
-      lastProcessingTime_(std::chrono::high_resolution_clock::now()),
-      lastAdaptation_(std::chrono::steady_clock::now()) {
+      lastAdaptation_(std::chrono::steady_clock::now()),
+      lastProcessingTime_(std::chrono::high_resolution_clock::now()) {
     // TODO: Initialize default configuration
     config_ = createDefaultConfig();
 
@@ -71,16 +220,8 @@ QualityAssessor::~QualityAssessor() {
     clearCallbacks();
 
     // TODO: Reset all components
-    snrAnalyzer_.reset();
-    thdAnalyzer_.reset();
-    frequencyAnalyzer_.reset();
-    perceptualAnalyzer_.reset();
-    clippingDetector_.reset();
-    noiseAnalyzer_.reset();
     fftProcessor_.reset();
     windowFunction_.reset();
-    filterBank_.reset();
-    psychoacousticModel_.reset();
 
     std::cout << "QualityAssessor destructed" << std::endl;
 }
@@ -114,41 +255,23 @@ bool QualityAssessor::initialize(const QualityConfig& config) {
         // TODO: Store validated configuration
         config_ = config;
 
-        // TODO: Initialize analysis components
-        if (config.enableSNRAnalysis) {
-            snrAnalyzer_ = std::make_unique<SNRAnalyzer>();
-        }
-
-        if (config.enableTHDAnalysis) {
-            thdAnalyzer_ = std::make_unique<THDAnalyzer>();
-        }
-
-        if (config.enableFrequencyResponse) {
-            frequencyAnalyzer_ = std::make_unique<FrequencyAnalyzer>();
-        }
-
-        if (config.enablePerceptualAnalysis) {
-            perceptualAnalyzer_ = std::make_unique<PerceptualAnalyzer>();
-        }
-
-        if (config.enableClippingDetection) {
-            clippingDetector_ = std::make_unique<ClippingDetector>();
-        }
-
-        // TODO: Initialize processing components
-        fftProcessor_ = std::make_unique<FFTProcessor>();
+        // Spectral pipeline: FFT plan, window table and band layout are built once here
+        // so per-chunk analysis only touches preallocated buffers.
+        fftProcessor_ = std::make_unique<FFTProcessor>(config.fftSize);
         windowFunction_ = std::make_unique<WindowFunction>();
-
-        if (config.enablePerceptualAnalysis) {
-            filterBank_ = std::make_unique<FilterBank>();
-            psychoacousticModel_ = std::make_unique<PsychoacousticModel>();
+        windowFunction_->coefficients(std::min(config.analysisWindowSize, config.fftSize));
+        if (!fftProcessor_->isValid()) {
+            std::cerr << "QualityAssessor: FFT unavailable, spectral metrics disabled" << std::endl;
         }
 
         // TODO: Initialize processing buffers
         analysisBuffer_.resize(config.analysisWindowSize);
         spectralBuffer_.resize(config.fftSize / 2 + 1);
-        fftBuffer_.resize(config.fftSize);
-        windowBuffer_.resize(config.analysisWindowSize);
+        fftBuffer_.resize(config.fftSize / 2 + 1);
+        windowBuffer_.assign(config.fftSize, 0.0f);
+        bandEdges_ = buildBandEdges(config);
+        streamHistory_.resize(config.analysisWindowSize);
+        resetRealtimeState();
 
         // TODO: Initialize adaptive thresholds
         adaptiveThresholds_.resize(10);  // For different quality metrics
@@ -174,23 +297,6 @@ bool QualityAssessor::initialize(const QualityConfig& config) {
     }
 }
 
-bool QualityAssessor::initialize(const StreamingConfig& streamingConfig) {
-    // TODO: Convert StreamingConfig to QualityConfig
-    QualityConfig qualityConfig = createDefaultConfig();
-
-    // Map common parameters
-    qualityConfig.enableSNRAnalysis = streamingConfig.enableQualityAssessment;
-    qualityConfig.enableTHDAnalysis = streamingConfig.enableQualityAssessment;
-    qualityConfig.enableFrequencyResponse = streamingConfig.enableQualityAssessment;
-    qualityConfig.enablePerceptualAnalysis = streamingConfig.enableQualityAssessment;
-    qualityConfig.enableClippingDetection = true;
-    qualityConfig.snrThreshold = 20.0f;  // 20 dB minimum
-    qualityConfig.thdThreshold = 5.0f;   // 5% maximum
-    qualityConfig.clippingThreshold = streamingConfig.qualityThreshold;
-
-    return initialize(qualityConfig);
-}
-
 bool QualityAssessor::updateConfiguration(const QualityConfig& config) {
     if (!initialized_) {
         handleError(-10, "Quality assessor not initialized");
@@ -210,6 +316,11 @@ bool QualityAssessor::updateConfiguration(const QualityConfig& config) {
     bool needsReinitialization = false;
 
     if (config.analysisWindowSize != config_.analysisWindowSize || config.fftSize != config_.fftSize
+        || config.analysisHopSize != config_.analysisHopSize
+        || config.sampleRate != config_.sampleRate
+        || config.frequencyBands != config_.frequencyBands
+        || config.minFrequency != config_.minFrequency
+        || config.maxFrequency != config_.maxFrequency
         || config.enablePerceptualAnalysis != config_.enablePerceptualAnalysis) {
         needsReinitialization = true;
     }
@@ -359,14 +470,78 @@ bool QualityAssessor::assessQualityRealtime(const float* audioData,
     }
 
     try {
-        // TODO: Create temporary audio buffer
-        AudioBuffer tempBuffer;
-        // Note: This would require implementing AudioBuffer construction from raw data
-        // For now, we'll simulate the processing
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        // Feed the chunk hop by hop: level statistics are updated incrementally and the
+        // history ring always holds the most recent analysis window.
+        const size_t historySize = streamHistory_.size();
+        bool hopCompleted = false;
+        size_t offset = 0;
+        while (offset < sampleCount) {
+            const size_t untilHop = realtimeStats_.frameSize - realtimeStats_.frameSamples;
+            const size_t count = std::min(untilHop, sampleCount - offset);
+            const float* chunk = audioData + offset;
+
+            for (size_t written = 0; written < count;) {
+                const size_t n = std::min(count - written, historySize - streamWritePos_);
+                std::memcpy(streamHistory_.data() + streamWritePos_,
+                            chunk + written,
+                            n * sizeof(float));
+                streamWritePos_ = (streamWritePos_ + n) % historySize;
+                written += n;
+            }
+            streamFill_ = std::min(historySize, streamFill_ + count);
+
+            accumulateRunningStatistics(realtimeStats_, chunk, count);
+            hopCompleted |= realtimeStats_.frameSamples == 0;
+            offset += count;
+        }
 
-        // TODO: Process with optimized realtime path
-        metrics = assessQuality(tempBuffer);
-        return metrics.errorCode == 0;
+        // One spectrum per chunk at most, over the latest full window
+        const bool spectralEnabled = config_.enableTHDAnalysis || config_.enableFrequencyResponse;
+        if (spectralEnabled && hopCompleted && streamFill_ == historySize) {
+            const size_t tail = historySize - streamWritePos_;
+            std::memcpy(analysisBuffer_.data(),
+                        streamHistory_.data() + streamWritePos_,
+                        tail * sizeof(float));
+            std::memcpy(analysisBuffer_.data() + tail,
+                        streamHistory_.data(),
+                        streamWritePos_ * sizeof(float));
+
+            const size_t spectrumLength = std::min(historySize, fftProcessor_->size());
+            if (computeMagnitudeSpectrum(analysisBuffer_.data() + historySize - spectrumLength,
+                                         spectrumLength)) {
+                if (config_.enableTHDAnalysis) {
+                    realtimeTHD_ = estimateTHDFromSpectrum(spectralBuffer_);
+                }
+                if (config_.enableFrequencyResponse) {
+                    computeBandResponse(spectralBuffer_, realtimeBandResponse_);
+                }
+                realtimeSpectralFlatness_ = calculateSpectralFlatness(spectralBuffer_);
+            }
+        }
+
+        fillLevelMetrics(realtimeStats_, metrics);
+        metrics.totalHarmonicDistortion = realtimeTHD_;
+        metrics.spectralFlatness = realtimeSpectralFlatness_;
+        metrics.frequencyResponse.assign(realtimeBandResponse_.begin(),
+                                         realtimeBandResponse_.end());
+
+        if (!calculateOverallQuality(metrics)) {
+            metrics.errorCode = -24;
+            metrics.errorMessage = "Overall quality calculation failed";
+            return false;
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        metrics.timestamp =
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime.time_since_epoch());
+        metrics.processingLatency =
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count()
+            / 1000.0f;  // Convert to ms
+        metrics.errorCode = 0;
+        metrics.errorMessage.clear();
+        return true;
 
     } catch (const std::exception& e) {
         metrics.errorCode = -31;
@@ -376,8 +551,25 @@ bool QualityAssessor::assessQualityRealtime(const float* audioData,
     }
 }
 
+void QualityAssessor::resetRealtimeState() {
+    realtimeStats_ = {};
+    realtimeStats_.frameSize = std::max(1u, config_.analysisHopSize);
+    realtimeStats_.windowFrames = std::max(
+        kMinNoiseWindowFrames,
+        static_cast<uint32_t>(config_.sampleRate * kNoiseWindowSeconds / realtimeStats_.frameSize));
+
+    std::fill(streamHistory_.begin(), streamHistory_.end(), 0.0f);
+    streamWritePos_ = 0;
+    streamFill_ = 0;
+
+    realtimeBandResponse_.assign(bandEdges_.empty() ? 0 : bandEdges_.size() - 1,
+                                 static_cast<float>(powerToDb(0.0)));
+    realtimeTHD_ = 0.0f;
+    realtimeSpectralFlatness_ = 0.0f;
+}
+
 float QualityAssessor::getQuickQualityScore(const AudioBuffer& buffer) {
-    if (!initialized_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || buffer.getFrameCount() == 0) {
         return 0.0f;
     }
 
@@ -422,7 +614,7 @@ float QualityAssessor::getQuickQualityScore(const AudioBuffer& buffer) {
  * [ ] Cross-correlation analysis with reference signal comparison
  */
 float QualityAssessor::calculateSNR(const AudioBuffer& buffer) {
-    if (!snrAnalyzer_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || !config_.enableSNRAnalysis || buffer.getFrameCount() == 0) {
         return 0.0f;
     }
 
@@ -432,19 +624,19 @@ float QualityAssessor::calculateSNR(const AudioBuffer& buffer) {
             return 0.0f;
         }
 
-        // TODO: Estimate signal and noise levels
-        float signalRMS = calculateRMS(analysisBuffer_);
+        // Active signal power against the minimum-statistics noise floor
+        RunningStatistics stats;
+        computeBufferStatistics(analysisBuffer_, stats);
 
-        // Simple noise estimation (would be more sophisticated in real implementation)
-        float noiseRMS = signalRMS * 0.05f;  // Assume 5% noise level
+        QualityMetrics metrics = {};
+        fillLevelMetrics(stats, metrics);
 
-        if (noiseRMS <= 0.0f) {
-            return 60.0f;  // Very high SNR
+        // A single window rarely contains a noise-only gap; fall back to the spectral floor
+        float snr = metrics.signalToNoiseRatio;
+        if (computeMagnitudeSpectrum(analysisBuffer_.data(), analysisBuffer_.size())) {
+            snr = std::max(snr, estimateSpectralSNR(spectralBuffer_));
         }
-
-        // Calculate SNR in dB
-        float snr = 20.0f * std::log10(signalRMS / noiseRMS);
-        return std::max(0.0f, std::min(60.0f, snr));  // Clamp to reasonable range
+        return std::min(60.0f, snr);  // Clamp to reasonable range
 
     } catch (const std::exception& e) {
         handleError(-40, "SNR calculation failed", e.what());
@@ -453,20 +645,17 @@ float QualityAssessor::calculateSNR(const AudioBuffer& buffer) {
 }
 
 float QualityAssessor::calculateTHD(const AudioBuffer& buffer) {
-    if (!thdAnalyzer_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || !config_.enableTHDAnalysis || buffer.getFrameCount() == 0) {
         return 0.0f;
     }
 
     try {
-        // TODO: Perform FFT analysis for harmonic detection
-        std::vector<float> windowedBuffer = applyWindow(analysisBuffer_);
-        std::vector<std::complex<float>> fftResult = performFFT(windowedBuffer);
-
-        // TODO: Identify fundamental frequency and harmonics
-        // For now, return a simple estimate
-        float thd = 1.0f;  // 1% THD estimate
+        if (!preprocessBuffer(buffer, analysisBuffer_)
+            || !computeMagnitudeSpectrum(analysisBuffer_.data(), analysisBuffer_.size())) {
+            return 0.0f;
+        }
 
-        return std::max(0.0f, std::min(100.0f, thd));  // Clamp to percentage range
+        return estimateTHDFromSpectrum(spectralBuffer_);
 
     } catch (const std::exception& e) {
         handleError(-41, "THD calculation failed", e.what());
@@ -477,21 +666,18 @@ float QualityAssessor::calculateTHD(const AudioBuffer& buffer) {
 std::vector<float> QualityAssessor::analyzeFrequencyResponse(const AudioBuffer& buffer) {
     std::vector<float> response;
 
-    if (!frequencyAnalyzer_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || !config_.enableFrequencyResponse || buffer.getFrameCount() == 0) {
         return response;
     }
 
     try {
-        // TODO: Perform frequency analysis
-        std::vector<float> windowedBuffer = applyWindow(analysisBuffer_);
-        std::vector<std::complex<float>> fftResult = performFFT(windowedBuffer);
-
-        // Convert to magnitude spectrum
-        response.resize(fftResult.size() / 2 + 1);
-        for (size_t i = 0; i < response.size(); ++i) {
-            response[i] = std::abs(fftResult[i]);
+        if (!preprocessBuffer(buffer, analysisBuffer_)
+            || !computeMagnitudeSpectrum(analysisBuffer_.data(), analysisBuffer_.size())) {
+            return response;
         }
 
+        // Band levels in dB between minFrequency and maxFrequency
+        computeBandResponse(spectralBuffer_, response);
         return response;
 
     } catch (const std::exception& e) {
@@ -501,7 +687,7 @@ std::vector<float> QualityAssessor::analyzeFrequencyResponse(const AudioBuffer&
 }
 
 float QualityAssessor::calculateDynamicRange(const AudioBuffer& buffer) {
-    if (buffer.getSampleCount() == 0) {
+    if (buffer.getFrameCount() == 0) {
         return 0.0f;
     }
 
@@ -511,16 +697,13 @@ float QualityAssessor::calculateDynamicRange(const AudioBuffer& buffer) {
             return 0.0f;
         }
 
-        float rms = calculateRMS(analysisBuffer_);
-        float peak = calculatePeak(analysisBuffer_);
+        // Loudest frame level above the noise floor
+        RunningStatistics stats;
+        computeBufferStatistics(analysisBuffer_, stats);
 
-        if (rms <= 0.0f) {
-            return 0.0f;
-        }
-
-        // Calculate dynamic range in dB
-        float dynamicRange = 20.0f * std::log10(peak / rms);
-        return std::max(0.0f, std::min(60.0f, dynamicRange));  // Clamp to reasonable range
+        QualityMetrics metrics = {};
+        fillLevelMetrics(stats, metrics);
+        return std::min(60.0f, metrics.dynamicRange);  // Clamp to reasonable range
 
     } catch (const std::exception& e) {
         handleError(-43, "Dynamic range calculation failed", e.what());
@@ -529,7 +712,7 @@ float QualityAssessor::calculateDynamicRange(const AudioBuffer& buffer) {
 }
 
 float QualityAssessor::detectClipping(const AudioBuffer& buffer) {
-    if (!clippingDetector_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || !config_.enableClippingDetection || buffer.getFrameCount() == 0) {
         return 0.0f;
     }
 
@@ -557,7 +740,7 @@ float QualityAssessor::detectClipping(const AudioBuffer& buffer) {
 }
 
 float QualityAssessor::analyzeNoiseLevel(const AudioBuffer& buffer) {
-    if (!noiseAnalyzer_ || buffer.getSampleCount() == 0) {
+    if (!initialized_ || buffer.getFrameCount() == 0) {
         return -60.0f;  // Default noise floor
     }
 
@@ -567,25 +750,13 @@ float QualityAssessor::analyzeNoiseLevel(const AudioBuffer& buffer) {
             return -60.0f;
         }
 
-        // Simple noise level estimation based on minimum RMS over time windows
-        float minRMS = std::numeric_limits<float>::max();
-        size_t windowSize = 1024;
-
-        for (size_t i = 0; i + windowSize < analysisBuffer_.size(); i += windowSize / 2) {
-            float windowRMS = 0.0f;
-            for (size_t j = i; j < i + windowSize; ++j) {
-                windowRMS += analysisBuffer_[j] * analysisBuffer_[j];
-            }
-            windowRMS = std::sqrt(windowRMS / windowSize);
-            minRMS = std::min(minRMS, windowRMS);
-        }
+        // Minimum-statistics noise floor over short frames
+        RunningStatistics stats;
+        computeBufferStatistics(analysisBuffer_, stats);
 
-        // Convert to dB
-        if (minRMS > 0.0f) {
-            return 20.0f * std::log10(minRMS);
-        } else {
-            return -60.0f;
-        }
+        QualityMetrics metrics = {};
+        fillLevelMetrics(stats, metrics);
+        return std::max(-120.0f, metrics.noiseFloor);
 
     } catch (const std::exception& e) {
         handleError(-45, "Noise level analysis failed", e.what());
@@ -596,7 +767,7 @@ float QualityAssessor::analyzeNoiseLevel(const AudioBuffer& buffer) {
 std::vector<float> QualityAssessor::performSpectralAnalysis(const AudioBuffer& buffer) {
     std::vector<float> spectrum;
 
-    if (buffer.getSampleCount() == 0) {
+    if (buffer.getFrameCount() == 0) {
         return spectrum;
     }
 
@@ -606,16 +777,11 @@ std::vector<float> QualityAssessor::performSpectralAnalysis(const AudioBuffer& b
             return spectrum;
         }
 
-        // TODO: Apply window and perform FFT
-        std::vector<float> windowedBuffer = applyWindow(analysisBuffer_);
-        std::vector<std::complex<float>> fftResult = performFFT(windowedBuffer);
-
-        // Convert to magnitude spectrum
-        spectrum.resize(fftResult.size() / 2 + 1);
-        for (size_t i = 0; i < spectrum.size(); ++i) {
-            spectrum[i] = std::abs(fftResult[i]);
+        if (!computeMagnitudeSpectrum(analysisBuffer_.data(), analysisBuffer_.size())) {
+            return spectrum;
         }
 
+        spectrum = spectralBuffer_;
         return spectrum;
 
     } catch (const std::exception& e) {
@@ -642,19 +808,24 @@ std::vector<float> QualityAssessor::performSpectralAnalysis(const AudioBuffer& b
 bool QualityAssessor::preprocessBuffer(const AudioBuffer& input, std::vector<float>& output) {
     try {
         // TODO: Validate input buffer
-        if (input.getSampleCount() == 0) {
+        const size_t channels = input.getChannelCount();
+        if (input.getFrameCount() == 0 || channels == 0) {
             return false;
         }
 
         // TODO: Resize output buffer if needed
-        size_t requiredSize =
-            std::min(static_cast<size_t>(input.getSampleCount()), config_.analysisWindowSize);
+        const size_t requiredSize =
+            std::min(input.getFrameCount(), static_cast<size_t>(config_.analysisWindowSize));
         output.resize(requiredSize);
 
-        // TODO: Copy and potentially resample data
-        const float* inputData = input.getData();
-        for (size_t i = 0; i < requiredSize; ++i) {
-            output[i] = inputData[i];
+        // Mix down to mono; analysis runs on a single channel
+        const float channelScale = 1.0f / static_cast<float>(channels);
+        for (size_t frame = 0; frame < requiredSize; ++frame) {
+            float sum = 0.0f;
+            for (size_t channel = 0; channel < channels; ++channel) {
+                sum += input.getSample(channel, frame);
+            }
+            output[frame] = sum * channelScale;
         }
 
         // TODO: Apply preprocessing (normalize, filter, etc.)
@@ -675,77 +846,27 @@ bool QualityAssessor::preprocessBuffer(const AudioBuffer& input, std::vector<flo
 bool QualityAssessor::performTechnicalAnalysis(const std::vector<float>& buffer,
                                                QualityMetrics& metrics) {
     try {
-        // Calculate basic RMS and peak values for other metrics
-        float rms = calculateRMS(buffer);
-        float peak = calculatePeak(buffer);
-
-        // Calculate Signal-to-Noise Ratio
-        // Estimate noise floor from quietest 10% of samples
-        std::vector<float> sortedSamples = buffer;
-        std::sort(sortedSamples.begin(), sortedSamples.end(), [](float a, float b) {
-            return std::abs(a) < std::abs(b);
-        });
-
-        size_t noiseFloorSamples = std::max(size_t(1), buffer.size() / 10);
-        float noiseRMS = 0.0f;
-        for (size_t i = 0; i < noiseFloorSamples; ++i) {
-            noiseRMS += sortedSamples[i] * sortedSamples[i];
-        }
-        noiseRMS = std::sqrt(noiseRMS / noiseFloorSamples);
-
-        metrics.signalToNoiseRatio = (noiseRMS > 1e-10f)
-                                         ? 20.0f * std::log10(rms / noiseRMS)
-                                         : 100.0f;  // Cap at 100 dB for very quiet noise
-
-        // Calculate Total Harmonic Distortion (simplified)
-        // For production, this would require FFT analysis
-        // Here we estimate THD from peak-to-RMS ratio deviation
-        float theoreticalPeakRMS = peak / std::sqrt(2.0f);  // For sine wave
-        float thdEstimate = std::abs(rms - theoreticalPeakRMS) / std::max(rms, 1e-10f);
-        metrics.totalHarmonicDistortion = std::min(thdEstimate * 100.0f, 50.0f);  // Cap at 50%
-
-        // Calculate clipping level
-        metrics.clippingLevel =
-            static_cast<float>(std::count_if(
-                buffer.begin(),
-                buffer.end(),
-                [this](float sample) { return std::abs(sample) > config_.clippingThreshold; }))
-            / buffer.size();
-
-        // Calculate dynamic characteristics
-        metrics.crestFactor = peak > 0.0f ? 20.0f * std::log10(peak / std::max(1e-10f, rms)) : 0.0f;
-        metrics.dynamicRange = metrics.crestFactor;
-
-        // Calculate noise characteristics
-        metrics.backgroundNoiseLevel = noiseRMS;
-        metrics.noiseFloor = metrics.backgroundNoiseLevel;
-
-        // Perform basic spectral analysis
-        // For production, this would use proper FFT
-        // Here we provide a simplified frequency distribution
-        std::vector<float> spectrum(64, 0.0f);  // 64-bin spectrum
-        const size_t windowSize = std::min(buffer.size(), size_t(1024));
-
-        for (size_t band = 0; band < spectrum.size(); ++band) {
-            float bandEnergy = 0.0f;
-            size_t startIdx = (band * windowSize) / spectrum.size();
-            size_t endIdx = ((band + 1) * windowSize) / spectrum.size();
-
-            for (size_t i = startIdx; i < endIdx && i < buffer.size(); ++i) {
-                bandEnergy += buffer[i] * buffer[i];
+        // Level statistics: SNR, noise floor, dynamic range, crest factor and clipping
+        RunningStatistics stats;
+        computeBufferStatistics(buffer, stats);
+        fillLevelMetrics(stats, metrics);
+
+        // Spectral statistics from one windowed FFT of the analysis buffer
+        if (computeMagnitudeSpectrum(buffer.data(), buffer.size())) {
+            if (config_.enableTHDAnalysis) {
+                metrics.totalHarmonicDistortion = estimateTHDFromSpectrum(spectralBuffer_);
             }
+            if (config_.enableFrequencyResponse) {
+                computeBandResponse(spectralBuffer_, metrics.frequencyResponse);
+            }
+            metrics.spectralFlatness = calculateSpectralFlatness(spectralBuffer_);
+            metrics.signalToNoiseRatio =
+                std::max(metrics.signalToNoiseRatio, estimateSpectralSNR(spectralBuffer_));
 
-            spectrum[band] = std::sqrt(bandEnergy / (endIdx - startIdx));
-        }
-
-        if (!spectrum.empty()) {
-            metrics.spectralFlatness = calculateSpectralFlatness(spectrum);
-            metrics.frequencyResponse = spectrum;
+            const float binHz = static_cast<float>(config_.sampleRate) / fftProcessor_->size();
+            metrics.spectralCentroid.push_back(calculateSpectralCentroid(spectralBuffer_) * binHz);
         }
 
-        // TODO: Set quality flags
-        metrics.isClipping = metrics.clippingLevel > config_.clippingThreshold;
-
         return true;
 
     } catch (const std::exception& e) {
@@ -1061,45 +1182,254 @@ float QualityAssessor::calculateCrestFactor(const std::vector<float>& buffer) {
     return peak / rms;
 }
 
-std::vector<float> QualityAssessor::applyWindow(const std::vector<float>& buffer) {
-    // TODO: Implement proper windowing function (Hamming, Hanning, etc.)
-    // For now, return buffer unchanged
-    return buffer;
+void QualityAssessor::applyWindow(const float* samples, size_t sampleCount) {
+    // Window the first min(sampleCount, fftSize) samples and zero-pad the remainder
+    const size_t length = std::min(sampleCount, windowBuffer_.size());
+    const std::vector<float>& window = windowFunction_->coefficients(length);
+
+    for (size_t i = 0; i < length; ++i) {
+        windowBuffer_[i] = samples[i] * window[i];
+    }
+    std::fill(windowBuffer_.begin() + length, windowBuffer_.end(), 0.0f);
+}
+
+bool QualityAssessor::performFFT() {
+    return fftProcessor_->forward(windowBuffer_.data(), fftBuffer_.data());
 }
 
-std::vector<std::complex<float>> QualityAssessor::performFFT(const std::vector<float>& buffer) {
-    // TODO: Implement FFT using kissfft or similar library
-    // For now, return a placeholder
-    std::vector<std::complex<float>> result(buffer.size());
-    for (size_t i = 0; i < buffer.size(); ++i) {
-        result[i] = std::complex<float>(buffer[i], 0.0f);
+bool QualityAssessor::computeMagnitudeSpectrum(const float* samples, size_t sampleCount) {
+    if (!fftProcessor_ || !fftProcessor_->isValid() || !samples || sampleCount == 0) {
+        return false;
     }
-    return result;
+
+    applyWindow(samples, sampleCount);
+    if (!performFFT()) {
+        return false;
+    }
+
+    // Normalize so a full-scale sinusoid peaks at a magnitude of 1.0
+    const float scale = windowFunction_->sum() > 0.0f ? 2.0f / windowFunction_->sum() : 0.0f;
+    for (size_t i = 0; i < fftBuffer_.size(); ++i) {
+        spectralBuffer_[i] = std::abs(fftBuffer_[i]) * scale;
+    }
+    return true;
 }
 
-float QualityAssessor::calculateSpectralFlatness(const std::vector<float>& spectrum) {
-    if (spectrum.empty()) {
+float QualityAssessor::estimateTHDFromSpectrum(const std::vector<float>& magnitudes) const {
+    const size_t binCount = magnitudes.size();
+    const float binHz = static_cast<float>(config_.sampleRate) / fftProcessor_->size();
+    const size_t minBin = std::max(kLobeHalfWidth + 1,
+                                   static_cast<size_t>(std::ceil(config_.minFrequency / binHz)));
+    const size_t maxBin =
+        std::min(binCount - kLobeHalfWidth - 1, static_cast<size_t>(config_.maxFrequency / binHz));
+    if (binCount <= 2 * kLobeHalfWidth + 1 || minBin >= maxBin) {
         return 0.0f;
     }
 
-    // Calculate geometric mean and arithmetic mean
-    float geometricMean = 1.0f;
-    float arithmeticMean = 0.0f;
+    // Fundamental: strongest peak in the analysis band, refined by parabolic interpolation
+    size_t peakBin = minBin;
+    for (size_t k = minBin + 1; k <= maxBin; ++k) {
+        if (magnitudes[k] > magnitudes[peakBin]) {
+            peakBin = k;
+        }
+    }
+    const float left = magnitudes[peakBin - 1];
+    const float center = magnitudes[peakBin];
+    const float right = magnitudes[peakBin + 1];
+    const float curvature = left - 2.0f * center + right;
+    const float fundamentalBin =
+        peakBin + (curvature != 0.0f ? 0.5f * (left - right) / curvature : 0.0f);
+
+    auto lobeEnergy = [&](size_t bin) {
+        double energy = 0.0;
+        for (size_t k = bin - kLobeHalfWidth; k <= bin + kLobeHalfWidth; ++k) {
+            energy += static_cast<double>(magnitudes[k]) * magnitudes[k];
+        }
+        return energy;
+    };
 
-    for (float bin : spectrum) {
-        if (bin > 0.0f) {
-            geometricMean *= std::pow(bin, 1.0f / spectrum.size());
-            arithmeticMean += bin;
+    const double fundamentalEnergy = lobeEnergy(peakBin);
+    if (fundamentalEnergy < kMinPower) {
+        return 0.0f;
+    }
+
+    double harmonicEnergy = 0.0;
+    for (size_t harmonic = 2; harmonic <= kMaxHarmonics; ++harmonic) {
+        const auto bin = static_cast<size_t>(std::lround(harmonic * fundamentalBin));
+        if (bin + kLobeHalfWidth >= binCount) {
+            break;
+        }
+        harmonicEnergy += lobeEnergy(bin);
+    }
+
+    const float thd = static_cast<float>(100.0 * std::sqrt(harmonicEnergy / fundamentalEnergy));
+    return std::min(100.0f, thd);  // Clamp to percentage range
+}
+
+float QualityAssessor::estimateSpectralSNR(const std::vector<float>& magnitudes) {
+    if (magnitudes.size() < 3) {
+        return 0.0f;
+    }
+
+    // Broadband noise dominates the median bin while tonal energy is sparse. The FFT
+    // input scratch is free at this point and doubles as the selection buffer.
+    const size_t binCount = magnitudes.size() - 1;  // Skip DC
+    double totalPower = 0.0;
+    for (size_t k = 0; k < binCount; ++k) {
+        windowBuffer_[k] = magnitudes[k + 1] * magnitudes[k + 1];
+        totalPower += windowBuffer_[k];
+    }
+
+    auto median = windowBuffer_.begin() + binCount / 2;
+    std::nth_element(windowBuffer_.begin(), median, windowBuffer_.begin() + binCount);
+
+    // Median of exponentially distributed bin powers is mean * ln(2)
+    const double noisePower = *median / std::log(2.0) * binCount;
+    const double signalPower = std::max(totalPower - noisePower, 0.0);
+    return static_cast<float>(
+        std::clamp(powerToDb(signalPower) - powerToDb(noisePower), 0.0, 100.0));
+}
+
+void QualityAssessor::computeBandResponse(const std::vector<float>& magnitudes,
+                                          std::vector<float>& bands) const {
+    const size_t bandCount = bandEdges_.empty() ? 0 : bandEdges_.size() - 1;
+    bands.resize(bandCount);
+
+    for (size_t band = 0; band < bandCount; ++band) {
+        const size_t first = bandEdges_[band];
+        const size_t last = std::min<size_t>(bandEdges_[band + 1], magnitudes.size());
+
+        double power = 0.0;
+        for (size_t k = first; k < last; ++k) {
+            power += static_cast<double>(magnitudes[k]) * magnitudes[k];
+        }
+        bands[band] = static_cast<float>(powerToDb(last > first ? power / (last - first) : 0.0));
+    }
+}
+
+void QualityAssessor::accumulateRunningStatistics(RunningStatistics& stats,
+                                                  const float* samples,
+                                                  size_t count) {
+    const float clipLevel = config_.clippingThreshold;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (stats.frameSamples == 0) {
+            stats.peakLevel *= kPeakDecay;
+        }
+
+        const float sample = samples[i];
+        const float magnitude = std::abs(sample);
+        stats.frameEnergy += static_cast<double>(sample) * sample;
+        stats.peakLevel = std::max(stats.peakLevel, magnitude);
+        stats.frameClipped += magnitude >= clipLevel ? 1u : 0u;
+
+        if (++stats.frameSamples == stats.frameSize) {
+            finishStatisticsFrame(stats);
         }
     }
+}
+
+void QualityAssessor::finishStatisticsFrame(RunningStatistics& stats) {
+    if (stats.frameSamples == 0) {
+        return;
+    }
 
-    arithmeticMean /= spectrum.size();
+    const double framePower = stats.frameEnergy / stats.frameSamples;
+    const float frameClipRatio = static_cast<float>(stats.frameClipped) / stats.frameSamples;
+    stats.totalSamples += stats.frameSamples;
+    stats.totalClipped += stats.frameClipped;
+
+    if (stats.frameCount == 0) {
+        stats.currentWindowMin = framePower;
+        stats.previousWindowMin = framePower;
+        stats.signalPower = framePower;
+        stats.clippingRatio = frameClipRatio;
+    } else {
+        stats.currentWindowMin = std::min(stats.currentWindowMin, framePower);
+        stats.clippingRatio =
+            kClippingSmoothing * stats.clippingRatio + (1.0f - kClippingSmoothing) * frameClipRatio;
+    }
 
-    if (arithmeticMean <= 0.0f) {
+    // Only frames clearly above the noise floor update the signal estimate
+    const double noisePower = std::min(stats.currentWindowMin, stats.previousWindowMin);
+    if (framePower > noisePower * kActivityMargin) {
+        stats.signalPower =
+            kSignalSmoothing * stats.signalPower + (1.0 - kSignalSmoothing) * framePower;
+    }
+    stats.loudestFramePower = std::max(stats.loudestFramePower, framePower);
+
+    // Minimum statistics: restart the tracking window once it has elapsed
+    if (++stats.framesInWindow >= stats.windowFrames) {
+        stats.previousWindowMin = stats.currentWindowMin;
+        stats.currentWindowMin = framePower;
+        stats.framesInWindow = 0;
+    }
+
+    ++stats.frameCount;
+    stats.frameEnergy = 0.0;
+    stats.frameSamples = 0;
+    stats.frameClipped = 0;
+}
+
+void QualityAssessor::fillLevelMetrics(const RunningStatistics& stats,
+                                       QualityMetrics& metrics) const {
+    const double noisePower = stats.frameCount > 0
+                                  ? std::min(stats.currentWindowMin, stats.previousWindowMin)
+                                  : 0.0;
+    const double noiseDb = powerToDb(noisePower);
+
+    metrics.noiseFloor = static_cast<float>(noiseDb);
+    metrics.backgroundNoiseLevel = metrics.noiseFloor;
+    metrics.signalToNoiseRatio =
+        static_cast<float>(std::clamp(powerToDb(stats.signalPower) - noiseDb, 0.0, 100.0));
+    metrics.dynamicRange =
+        static_cast<float>(std::clamp(powerToDb(stats.loudestFramePower) - noiseDb, 0.0, 100.0));
+    metrics.dynamicRangeScore = std::min(1.0f, metrics.dynamicRange / 60.0f);
+
+    const double loudestRMS = std::sqrt(stats.loudestFramePower);
+    metrics.crestFactor =
+        (stats.peakLevel > 0.0f && loudestRMS > 0.0)
+            ? static_cast<float>(20.0 * std::log10(stats.peakLevel / loudestRMS))
+            : 0.0f;
+
+    metrics.clippingLevel = config_.enableClippingDetection ? stats.clippingRatio : 0.0f;
+    metrics.isClipping = metrics.clippingLevel > kClippingRatioLimit;
+}
+
+void QualityAssessor::computeBufferStatistics(const std::vector<float>& buffer,
+                                              RunningStatistics& stats) {
+    // Short frames so even a single analysis window yields a usable noise floor
+    stats = {};
+    stats.frameSize = std::max(kMinBlockFrameSize,
+                               static_cast<uint32_t>(buffer.size() / kBlockStatisticsFrames));
+    stats.windowFrames = std::numeric_limits<uint32_t>::max();
+
+    accumulateRunningStatistics(stats, buffer.data(), buffer.size());
+    finishStatisticsFrame(stats);
+
+    // Whole-buffer assessments report the exact clipped fraction
+    if (stats.totalSamples > 0) {
+        stats.clippingRatio = static_cast<float>(stats.totalClipped) / stats.totalSamples;
+    }
+}
+
+float QualityAssessor::calculateSpectralFlatness(const std::vector<float>& spectrum) {
+    if (spectrum.empty()) {
         return 0.0f;
     }
 
-    return geometricMean / arithmeticMean;
+    // Wiener entropy of the power spectrum: geometric over arithmetic mean
+    double logSum = 0.0;
+    double powerSum = 0.0;
+    for (float bin : spectrum) {
+        const double power = static_cast<double>(bin) * bin + kMinPower;
+        logSum += std::log(power);
+        powerSum += power;
+    }
+
+    const double arithmeticMean = powerSum / spectrum.size();
+    const double geometricMean = std::exp(logSum / spectrum.size());
+    return static_cast<float>(std::min(1.0, geometricMean / arithmeticMean));
 }
 
 float QualityAssessor::calculateSpectralCentroid(const std::vector<float>& spectrum) {
@@ -1396,11 +1726,21 @@ bool QualityAssessor::validateConfiguration(const QualityConfig& config,
         return false;
     }
 
-    if (config.fftSize < 64 || config.fftSize > 8192) {
+    if (config.fftSize < 64 || config.fftSize > 8192 || config.fftSize % 2 != 0) {
         errorMessage = "Invalid FFT size: " + std::to_string(config.fftSize);
         return false;
     }
 
+    if (config.analysisHopSize == 0 || config.analysisHopSize > config.analysisWindowSize) {
+        errorMessage = "Invalid analysis hop size: " + std::to_string(config.analysisHopSize);
+        return false;
+    }
+
+    if (config.sampleRate == 0) {
+        errorMessage = "Invalid sample rate: " + std::to_string(config.sampleRate);
+        return false;
+    }
+
     return true;
 }
 
@@ -1424,7 +1764,7 @@ void QualityAssessor::handleError(int code,
         std::lock_guard<std::mutex> lock(statisticsMutex_);
         statistics_.totalErrors++;
         statistics_.errorRate = static_cast<float>(statistics_.totalErrors)
-                                / std::max(1ULL, statistics_.totalAssessments);
+                                / std::max<uint64_t>(1, statistics_.totalAssessments);
     }
 
     // TODO: Trigger error callback
@@ -1434,6 +1774,10 @@ void QualityAssessor::handleError(int code,
 }
 
 QualityConfig QualityAssessor::createDefaultConfig() {
+    return createDefaultQualityConfig();
+}
+
+QualityConfig createDefaultQualityConfig() {
     QualityConfig config = {};
 
     // Enable basic quality metrics
@@ -1460,6 +1804,7 @@ QualityConfig QualityAssessor::createDefaultConfig() {
     config.noiseFloorThreshold = -40.0f;  // -40 dB
 
     // Frequency analysis
+    config.sampleRate = 44100;
     config.fftSize = 2048;
     config.minFrequency = 20.0f;     // 20 Hz
     config.maxFrequency = 20000.0f;  // 20 kHz
@@ -4,21 +4,24 @@
 #include <algorithm>
 #include <bit>
 #include <cmath>
-#include <iostream>
 #include <mutex>
 #include <numeric>
-#include <queue>
-#include <thread>
-
-#include "huntmaster/core/DebugLogger.h"
-
-// Enable debug output for RealtimeAudioProcessor
-#define DEBUG_REALTIME_PROCESSOR 0
+#include <stdexcept>
+#include <utility>
 
 namespace huntmaster {
 
 class RealtimeAudioProcessor::Impl {
   public:
+    /**
+     * One preallocated chunk plus its sequence number. For queue position p the
+     * slot is free when sequence == p and holds data when sequence == p + 1.
+     */
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence{0};
+        AudioChunk chunk;
+    };
+
     Config config_;
 
     // Performance metrics
@@ -29,233 +32,175 @@ class RealtimeAudioProcessor::Impl {
     alignas(64) std::atomic<std::chrono::nanoseconds::rep> total_processing_ns_{0};
     alignas(64) std::atomic<std::chrono::nanoseconds::rep> max_processing_ns_{0};
 
-    // Frame counter
-    std::atomic<size_t> frame_counter_{0};
-
-#if HUNTMASTER_SINGLE_THREADED
-    // ========================================================================
-    // --- SINGLE-THREADED IMPLEMENTATION (Simpler, std::queue) ---
-    // ========================================================================
-    std::queue<AudioChunk> queue_;
-    mutable std::mutex mutex_;  // A simple mutex for basic thread safety
-
-    explicit Impl(const Config& config) : config_(config) {}
-
-    [[nodiscard]] huntmaster::expected<void, ProcessorError>
-    enqueue(std::span<const float> audio_data) {
-        if (audio_data.size() > AudioChunk::MAX_CHUNK_SIZE) {
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Single-threaded enqueue: INVALID_SIZE - data size "
-                      << audio_data.size() << " > " << AudioChunk::MAX_CHUNK_SIZE << std::endl;
-#endif
-            return huntmaster::unexpected(ProcessorError::INVALID_SIZE);
-        }
+    // Ring of slots; positions grow monotonically and double as frame indices
+    std::unique_ptr<Slot[]> slots_;
+    size_t buffer_mask_;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+
+    // Backpressure support. Producers only notify (never lock) and only when someone waits;
+    // waiters re-check in short slices so a notify that races their sleep costs one slice.
+    static constexpr std::chrono::milliseconds kWaitSlice{1};
+    alignas(64) std::atomic<size_t> data_waiters_{0};
+    std::atomic<size_t> space_waiters_{0};
+    std::condition_variable cv_space_;
+    std::condition_variable cv_data_;
+    std::mutex cv_mutex_;
 
-        std::unique_lock lock(mutex_);
-        if (queue_.size() >= config_.ring_buffer_size) {
-            overruns_.fetch_add(1, std::memory_order_relaxed);
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Single-threaded enqueue: BUFFER_FULL - queue size "
-                      << queue_.size() << " >= " << config_.ring_buffer_size << std::endl;
-#endif
-            return huntmaster::unexpected(ProcessorError::BUFFER_FULL);
+    explicit Impl(const Config& config) : config_(config) {
+        // Ensure buffer size is power of 2 (and leaves room to tell full from empty)
+        if (!std::has_single_bit(config.ring_buffer_size) || config.ring_buffer_size < 2) {
+            throw std::invalid_argument("Ring buffer size must be power of 2");
         }
 
-        AudioChunk& chunk = queue_.emplace();  // Create chunk in place
-        chunk.valid_samples = audio_data.size();
-        chunk.timestamp = std::chrono::steady_clock::now();
-        chunk.frame_index = frame_counter_.fetch_add(1, std::memory_order_relaxed);
-        std::copy(audio_data.begin(), audio_data.end(), chunk.data.begin());
-
-        // Calculate energy for audio metadata
-        chunk.energy_level = std::sqrt(std::transform_reduce(audio_data.begin(),
-                                                             audio_data.end(),
-                                                             0.0f,
-                                                             std::plus{},
-                                                             [](float x) { return x * x; })
-                                       / audio_data.size());
-
-        // Simple voice detection
-        chunk.contains_voice = chunk.energy_level > 0.01f;
-
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Single-threaded enqueue: SUCCESS - energy=" << chunk.energy_level
-                  << ", voice=" << chunk.contains_voice << ", samples=" << chunk.valid_samples
-                  << std::endl;
-#endif
+        buffer_mask_ = config.ring_buffer_size - 1;
+        slots_ = std::make_unique<Slot[]>(config.ring_buffer_size);
+        for (size_t i = 0; i < config.ring_buffer_size; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
 
-        // Update metrics
-        if (config_.enable_metrics) {
-            auto start_time = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::high_resolution_clock::now() - start_time;
-            auto ns = duration.count();
-            total_processing_ns_.fetch_add(ns, std::memory_order_relaxed);
-            auto max_ns = max_processing_ns_.load(std::memory_order_relaxed);
-            while (ns > max_ns) {
-                if (max_processing_ns_.compare_exchange_weak(
-                        max_ns, ns, std::memory_order_relaxed, std::memory_order_relaxed)) {
+    /**
+     * @brief Claim up to max_count consecutive free slots with one CAS
+     * @return First claimed position and the number of slots claimed
+     */
+    std::pair<size_t, size_t> claimForWrite(size_t max_count) noexcept {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            size_t count = 0;
+            bool stale = false;
+            while (count < max_count) {
+                const size_t seq =
+                    slots_[(pos + count) & buffer_mask_].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count) {
+                    // seq < pos: a consumer has not drained the slot yet (full)
+                    // seq > pos: another producer already claimed it (stale pos)
+                    stale = count == 0 && static_cast<std::ptrdiff_t>(seq - pos) > 0;
                     break;
                 }
+                ++count;
             }
-        }
-
-        total_chunks_.fetch_add(1, std::memory_order_relaxed);
-        return {};
-    }
 
-    [[nodiscard]] huntmaster::expected<AudioChunk, ProcessorError> dequeue() {
-        std::unique_lock lock(mutex_);
-        if (queue_.empty()) {
-            underruns_.fetch_add(1, std::memory_order_relaxed);
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Single-threaded dequeue: BUFFER_EMPTY - queue is empty"
-                      << std::endl;
-#endif
-            return huntmaster::unexpected(ProcessorError::BUFFER_EMPTY);
+            if (count == 0) {
+                if (!stale) {
+                    return {pos, 0};
+                }
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + count, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                return {pos, count};
+            }
         }
-
-        AudioChunk chunk = std::move(queue_.front());
-        queue_.pop();
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Single-threaded dequeue: SUCCESS - energy=" << chunk.energy_level
-                  << ", voice=" << chunk.contains_voice << ", samples=" << chunk.valid_samples
-                  << std::endl;
-#endif
-        return chunk;
     }
 
-    [[nodiscard]] bool isEmpty() const noexcept {
-        std::unique_lock lock(mutex_);
-        return queue_.empty();
-    }
-
-    [[nodiscard]] bool isFull() const noexcept {
-        std::unique_lock lock(mutex_);
-        bool full = queue_.size() >= config_.ring_buffer_size;
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Single-threaded isFull: " << full << " (size=" << queue_.size()
-                  << ", capacity=" << config_.ring_buffer_size << ")" << std::endl;
-#endif
-        return full;
-    }
+    /**
+     * @brief Claim up to max_count consecutive filled slots with one CAS
+     */
+    std::pair<size_t, size_t> claimForRead(size_t max_count) noexcept {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            size_t count = 0;
+            bool stale = false;
+            while (count < max_count) {
+                const size_t seq =
+                    slots_[(pos + count) & buffer_mask_].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count + 1) {
+                    stale = count == 0 && static_cast<std::ptrdiff_t>(seq - (pos + 1)) > 0;
+                    break;
+                }
+                ++count;
+            }
 
-    [[nodiscard]] size_t available() const noexcept {
-        std::unique_lock lock(mutex_);
-        return queue_.size();
+            if (count == 0) {
+                if (!stale) {
+                    return {pos, 0};
+                }
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (dequeue_pos_.compare_exchange_weak(
+                    pos, pos + count, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                return {pos, count};
+            }
+        }
     }
 
-#else
-    // ========================================================================
-    // --- MULTI-THREADED IMPLEMENTATION (Lock-Free Ring Buffer) ---
-    // ========================================================================
-    // The atomicity is handled by the read/write indices, not by making the
-    // large AudioChunk object itself atomic. This is much more efficient.
+    void fillSlot(size_t pos,
+                  std::span<const float> audio_data,
+                  std::chrono::steady_clock::time_point timestamp) noexcept {
+        Slot& slot = slots_[pos & buffer_mask_];
+        AudioChunk& chunk = slot.chunk;
 
-    std::unique_ptr<AudioChunk[]> ring_buffer_;
-    alignas(64) std::atomic<size_t> write_index_{0};
-    alignas(64) std::atomic<size_t> read_index_{0};
-    alignas(64) mutable std::atomic<size_t> cached_write_index_{0};
-    alignas(64) mutable std::atomic<size_t> cached_read_index_{0};
-    alignas(64) std::atomic<size_t> item_count_{0};  // Track actual item count
-
-    size_t buffer_mask_;
-
-    // Backpressure support
-    std::condition_variable_any cv_space_;
-    std::condition_variable_any cv_data_;
-    std::mutex cv_mutex_;
+        chunk.valid_samples = audio_data.size();
+        chunk.timestamp = timestamp;
+        chunk.frame_index = pos;
+        std::copy(audio_data.begin(), audio_data.end(), chunk.data.begin());
 
-    explicit Impl(const Config& config) : config_(config) {
-        // Ensure buffer size is power of 2
-        if (!std::has_single_bit(config.ring_buffer_size)) {
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Multi-threaded constructor: INVALID buffer size "
-                      << config.ring_buffer_size << " - must be power of 2" << std::endl;
-#endif
-            throw std::invalid_argument("Ring buffer size must be power of 2");
-        }
+        // Calculate energy for audio metadata
+        chunk.energy_level = audio_data.empty()
+                                 ? 0.0f
+                                 : std::sqrt(std::transform_reduce(audio_data.begin(),
+                                                                   audio_data.end(),
+                                                                   0.0f,
+                                                                   std::plus{},
+                                                                   [](float x) { return x * x; })
+                                             / audio_data.size());
 
-        buffer_mask_ = config.ring_buffer_size - 1;
-        ring_buffer_ = std::make_unique<AudioChunk[]>(config.ring_buffer_size);
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded constructor: SUCCESS - buffer_size="
-                  << config.ring_buffer_size << ", mask=" << buffer_mask_ << std::endl;
-#endif
-    }
+        // Simple voice detection
+        chunk.contains_voice = chunk.energy_level > 0.01f;
 
-    [[nodiscard]] size_t distance(size_t from, size_t to) const noexcept {
-        return (to - from) & buffer_mask_;
+        slot.sequence.store(pos + 1, std::memory_order_release);
     }
 
-    [[nodiscard]] bool canWrite() const noexcept {
-        auto count = item_count_.load(std::memory_order_relaxed);
-        bool can_write = count < config_.ring_buffer_size;
-
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded canWrite: " << can_write << " - item_count=" << count
-                  << ", capacity=" << config_.ring_buffer_size << std::endl;
-#endif
-        return can_write;
-    }
+    void drainSlot(size_t pos, AudioChunk& out) noexcept {
+        Slot& slot = slots_[pos & buffer_mask_];
+        const AudioChunk& chunk = slot.chunk;
 
-    [[nodiscard]] bool canRead() const noexcept {
-        auto count = item_count_.load(std::memory_order_relaxed);
-        bool can_read = count > 0;
+        // Only the valid prefix of the sample array is copied
+        out.valid_samples = chunk.valid_samples;
+        out.timestamp = chunk.timestamp;
+        out.frame_index = chunk.frame_index;
+        out.energy_level = chunk.energy_level;
+        out.contains_voice = chunk.contains_voice;
+        std::copy_n(chunk.data.begin(), chunk.valid_samples, out.data.begin());
 
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded canRead: " << can_read << " - item_count=" << count
-                  << std::endl;
-#endif
-        return can_read;
+        slot.sequence.store(pos + config_.ring_buffer_size, std::memory_order_release);
     }
 
-    [[nodiscard]] huntmaster::expected<void, ProcessorError>
-    enqueue(std::span<const float> audio_data) {
-        if (audio_data.size() > AudioChunk::MAX_CHUNK_SIZE) {
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Multi-threaded enqueue: INVALID_SIZE - data size "
-                      << audio_data.size() << " > " << AudioChunk::MAX_CHUNK_SIZE << std::endl;
-#endif
+    /**
+     * @brief Enqueue a run of buffers; stops at the first oversized one or when full
+     */
+    [[nodiscard]] huntmaster::expected<size_t, ProcessorError>
+    enqueue(std::span<const std::span<const float>> audio_batches) {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        size_t requested = 0;
+        while (requested < audio_batches.size()
+               && audio_batches[requested].size() <= AudioChunk::MAX_CHUNK_SIZE) {
+            ++requested;
+        }
+        if (requested == 0) {
             return huntmaster::unexpected(ProcessorError::INVALID_SIZE);
         }
-        if (!canWrite()) {
+
+        const auto [pos, count] = claimForWrite(requested);
+        if (count < requested) {
             overruns_.fetch_add(1, std::memory_order_relaxed);
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Multi-threaded enqueue: BUFFER_FULL - cannot write" << std::endl;
-#endif
+        }
+        if (count == 0) {
             return huntmaster::unexpected(ProcessorError::BUFFER_FULL);
         }
 
-        auto write_idx = write_index_.load(std::memory_order_relaxed);
-        AudioChunk& chunk = ring_buffer_[write_idx & buffer_mask_];
-
-        chunk.valid_samples = audio_data.size();
-        chunk.timestamp = std::chrono::steady_clock::now();
-        chunk.frame_index = frame_counter_.fetch_add(1, std::memory_order_relaxed);
-        std::copy(audio_data.begin(), audio_data.end(), chunk.data.begin());
-
-        // Calculate energy for audio metadata
-        chunk.energy_level = std::sqrt(std::transform_reduce(audio_data.begin(),
-                                                             audio_data.end(),
-                                                             0.0f,
-                                                             std::plus{},
-                                                             [](float x) { return x * x; })
-                                       / audio_data.size());
-
-        // Simple voice detection
-        chunk.contains_voice = chunk.energy_level > 0.01f;
-
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded enqueue: SUCCESS - write_idx=" << write_idx
-                  << ", energy=" << chunk.energy_level << ", voice=" << chunk.contains_voice
-                  << ", samples=" << chunk.valid_samples << std::endl;
-#endif
+        for (size_t i = 0; i < count; ++i) {
+            fillSlot(pos + i, audio_batches[i], start_time);
+        }
 
         // Update metrics
         if (config_.enable_metrics) {
-            auto start_time = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::high_resolution_clock::now() - start_time;
-            auto ns = duration.count();
+            const auto ns = std::max<std::chrono::nanoseconds::rep>(
+                (std::chrono::steady_clock::now() - start_time).count(), 1);
             total_processing_ns_.fetch_add(ns, std::memory_order_relaxed);
             auto max_ns = max_processing_ns_.load(std::memory_order_relaxed);
             while (ns > max_ns) {
@@ -266,55 +211,66 @@ class RealtimeAudioProcessor::Impl {
             }
         }
 
-        // Advance write index
-        write_index_.store((write_idx + 1) & buffer_mask_, std::memory_order_release);
-        item_count_.fetch_add(1, std::memory_order_relaxed);
-
-        total_chunks_.fetch_add(1, std::memory_order_relaxed);
-        if (config_.enable_backpressure)
-            cv_data_.notify_one();
-        return {};
+        total_chunks_.fetch_add(count, std::memory_order_relaxed);
+        if (data_waiters_.load(std::memory_order_relaxed) > 0) {
+            cv_data_.notify_all();
+        }
+        return count;
     }
 
-    [[nodiscard]] huntmaster::expected<AudioChunk, ProcessorError> dequeue() {
-        if (!canRead()) {
+    [[nodiscard]] size_t dequeue(std::span<AudioChunk> out) {
+        if (out.empty()) {
+            return 0;
+        }
+
+        const auto [pos, count] = claimForRead(out.size());
+        if (count < out.size()) {
             underruns_.fetch_add(1, std::memory_order_relaxed);
-#if DEBUG_REALTIME_PROCESSOR
-            std::cout << "[DEBUG] Multi-threaded dequeue: BUFFER_EMPTY - cannot read" << std::endl;
-#endif
-            return huntmaster::unexpected(ProcessorError::BUFFER_EMPTY);
         }
 
-        auto read_idx = read_index_.load(std::memory_order_relaxed);
-        AudioChunk chunk = ring_buffer_[read_idx & buffer_mask_];
-        read_index_.store((read_idx + 1) & buffer_mask_, std::memory_order_release);
-        item_count_.fetch_sub(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            drainSlot(pos + i, out[i]);
+        }
 
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded dequeue: SUCCESS - read_idx=" << read_idx
-                  << ", energy=" << chunk.energy_level << ", voice=" << chunk.contains_voice
-                  << ", samples=" << chunk.valid_samples << std::endl;
-#endif
+        if (count > 0 && space_waiters_.load(std::memory_order_relaxed) > 0) {
+            cv_space_.notify_all();
+        }
+        return count;
+    }
 
-        if (config_.enable_backpressure)
-            cv_space_.notify_one();
-        return chunk;
+    [[nodiscard]] size_t available() const noexcept {
+        // Read the consumer side first so the difference cannot go negative
+        const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        return std::min(tail - std::min(tail, head), config_.ring_buffer_size);
     }
 
     [[nodiscard]] bool isEmpty() const noexcept {
-        return !canRead();
+        return available() == 0;
     }
+
     [[nodiscard]] bool isFull() const noexcept {
-        bool full = !canWrite();
-#if DEBUG_REALTIME_PROCESSOR
-        std::cout << "[DEBUG] Multi-threaded isFull: " << full << std::endl;
-#endif
-        return full;
+        return available() >= config_.ring_buffer_size;
     }
-    [[nodiscard]] size_t available() const noexcept {
-        return item_count_.load(std::memory_order_relaxed);
+
+    template <typename Predicate>
+    void waitUntil(std::condition_variable& cv,
+                   std::atomic<size_t>& waiters,
+                   std::chrono::milliseconds timeout,
+                   Predicate ready) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        waiters.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock lock(cv_mutex_);
+        while (!ready()) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                break;
+            }
+            cv.wait_until(lock, std::min<std::chrono::steady_clock::time_point>(
+                                    deadline, now + kWaitSlice));
+        }
+        waiters.fetch_sub(1, std::memory_order_relaxed);
     }
-#endif
 };
 
 // ============================================================================
@@ -331,48 +287,50 @@ RealtimeAudioProcessor::operator=(RealtimeAudioProcessor&&) noexcept = default;
 
 huntmaster::expected<void, ProcessorError>
 RealtimeAudioProcessor::enqueueAudio(std::span<const float> audio_data) {
-    return pimpl_->enqueue(audio_data);
+    auto result = pimpl_->enqueue(std::span<const std::span<const float>>(&audio_data, 1));
+    if (!result) {
+        return huntmaster::unexpected(result.error());
+    }
+    return {};
 }
 
 bool RealtimeAudioProcessor::tryEnqueueAudio(std::span<const float> audio_data) {
-    return pimpl_->enqueue(audio_data).has_value();
+    return enqueueAudio(audio_data).has_value();
 }
 
 huntmaster::expected<AudioChunk, ProcessorError> RealtimeAudioProcessor::dequeueChunk() {
-    return pimpl_->dequeue();
+    AudioChunk chunk;
+    if (pimpl_->dequeue(std::span<AudioChunk>(&chunk, 1)) == 0) {
+        return huntmaster::unexpected(ProcessorError::BUFFER_EMPTY);
+    }
+    return chunk;
 }
 
 std::optional<AudioChunk> RealtimeAudioProcessor::tryDequeueChunk() {
-    auto result = pimpl_->dequeue();
+    auto result = dequeueChunk();
     if (result)
         return std::move(*result);
     return std::nullopt;
 }
 
 size_t RealtimeAudioProcessor::enqueueBatch(std::span<const std::span<const float>> audio_batches) {
-    size_t enqueued = 0;
-    for (const auto& batch : audio_batches) {
-        if (tryEnqueueAudio(batch)) {
-            ++enqueued;
-        } else {
-            break;
-        }
+    if (audio_batches.empty()) {
+        return 0;
     }
-    return enqueued;
+    auto result = pimpl_->enqueue(audio_batches);
+    return result ? *result : 0;
 }
 
 std::vector<AudioChunk> RealtimeAudioProcessor::dequeueBatch(size_t max_chunks) {
-    std::vector<AudioChunk> chunks;
-    chunks.reserve(std::min(max_chunks, available()));
-    while (chunks.size() < max_chunks) {
-        auto chunk = tryDequeueChunk();
-        if (!chunk)
-            break;
-        chunks.push_back(std::move(*chunk));
-    }
+    std::vector<AudioChunk> chunks(std::min(max_chunks, available()));
+    chunks.resize(dequeueBatch(std::span<AudioChunk>(chunks)));
     return chunks;
 }
 
+size_t RealtimeAudioProcessor::dequeueBatch(std::span<AudioChunk> out) {
+    return pimpl_->dequeue(out);
+}
+
 bool RealtimeAudioProcessor::isEmpty() const noexcept {
     return pimpl_->isEmpty();
 }
@@ -402,14 +360,6 @@ ProcessorStats RealtimeAudioProcessor::getStats() const noexcept {
                                    / stats.total_chunks_processed / 1e6f;
     }
 
-#if DEBUG_REALTIME_PROCESSOR
-    std::cout << "[DEBUG] getStats: processed=" << stats.total_chunks_processed
-              << ", dropped=" << stats.chunks_dropped << ", overruns=" << stats.buffer_overruns
-              << ", underruns=" << stats.buffer_underruns
-              << ", total_time=" << stats.total_processing_time.count()
-              << ", max_time=" << stats.max_processing_time.count() << std::endl;
-#endif
-
     return stats;
 }
 
@@ -422,18 +372,14 @@ void RealtimeAudioProcessor::resetStats() noexcept {
     pimpl_->max_processing_ns_.store(0);
 }
 
-void RealtimeAudioProcessor::waitForSpace([[maybe_unused]] std::chrono::milliseconds timeout) {
-#if !HUNTMASTER_SINGLE_THREADED
-    std::unique_lock lock(pimpl_->cv_mutex_);
-    pimpl_->cv_space_.wait_for(lock, timeout, [this] { return !isFull(); });
-#endif
+void RealtimeAudioProcessor::waitForSpace(std::chrono::milliseconds timeout) {
+    pimpl_->waitUntil(
+        pimpl_->cv_space_, pimpl_->space_waiters_, timeout, [this] { return !isFull(); });
 }
 
-void RealtimeAudioProcessor::waitForData([[maybe_unused]] std::chrono::milliseconds timeout) {
-#if !HUNTMASTER_SINGLE_THREADED
-    std::unique_lock lock(pimpl_->cv_mutex_);
-    pimpl_->cv_data_.wait_for(lock, timeout, [this] { return !isEmpty(); });
-#endif
+void RealtimeAudioProcessor::waitForData(std::chrono::milliseconds timeout) {
+    pimpl_->waitUntil(
+        pimpl_->cv_data_, pimpl_->data_waiters_, timeout, [this] { return !isEmpty(); });
 }
 
 }  // namespace huntmaster
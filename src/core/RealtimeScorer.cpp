@@ -18,6 +18,7 @@
 #include "huntmaster/core/AudioLevelProcessor.h"
 #include "huntmaster/core/DTWComparator.h"
 #include "huntmaster/core/DebugLogger.h"
+#include "huntmaster/core/FeatureStorage.h"
 #include "huntmaster/core/MFCCProcessor.h"
 
 // Enable debug output for RealtimeScorer
@@ -46,6 +47,8 @@ class RealtimeScorer::Impl {
 
     // Component processors
     std::unique_ptr<MFCCProcessor> mfccProcessor_;
+    size_t liveFrameSize_ = 0;  // MFCC frame and hop used on live audio
+    size_t liveHopSize_ = 0;
     std::unique_ptr<DTWComparator> dtwComparator_;
     std::unique_ptr<AudioLevelProcessor> levelProcessor_;
 
@@ -75,14 +78,20 @@ class RealtimeScorer::Impl {
     explicit Impl(const Config& config);
 
     void initializeComponents();
+    MFCCProcessor::Config defaultMfccConfig() const;
+    void setLiveFeatureExtraction(const MFCCProcessor::Config& mfccConfig, size_t hopSize);
     float calculateWeightedScore(float mfcc, float volume, float timing, float pitch) const;
     float calculatePitchEstimate(const std::vector<float>& audioBuffer) const;
     float calculateProgressRatio() const;
+    bool loadLegacyFeatures(const std::string& path);
     std::string generateRecommendation(const SimilarityScore& score) const;
     bool isScoreTrendingUp() const;
 };
 
 // Helper functions for scoring logic, scoped to this file.
+// Hop between live MFCC frames unless a master call's features set another
+constexpr size_t kDefaultHopSize = 512;
+
 static float
 calculateVolumeSimilarity(float liveRms, float masterRms, float tolerance = 0.3f) noexcept {
     if (masterRms < 1e-6f) {
@@ -144,11 +153,7 @@ RealtimeScorer::Impl::Impl(const Config& config) : config_(config) {
 
 void RealtimeScorer::Impl::initializeComponents() {
     // Initialize MFCC processor with appropriate settings
-    MFCCProcessor::Config mfccConfig;
-    mfccConfig.sample_rate = static_cast<size_t>(config_.sampleRate);
-    mfccConfig.frame_size = 1024;
-    mfccConfig.num_coefficients = 13;
-    mfccProcessor_ = std::make_unique<MFCCProcessor>(mfccConfig);
+    setLiveFeatureExtraction(defaultMfccConfig(), kDefaultHopSize);
 
     // Initialize DTW comparator
     DTWComparator::Config dtwConfig;
@@ -161,10 +166,32 @@ void RealtimeScorer::Impl::initializeComponents() {
     levelProcessor_ = std::make_unique<AudioLevelProcessor>(levelConfig);
 }
 
+MFCCProcessor::Config RealtimeScorer::Impl::defaultMfccConfig() const {
+    MFCCProcessor::Config mfccConfig;
+    mfccConfig.sample_rate = static_cast<size_t>(config_.sampleRate);
+    mfccConfig.frame_size = 1024;
+    mfccConfig.num_coefficients = 13;
+    return mfccConfig;
+}
+
+void RealtimeScorer::Impl::setLiveFeatureExtraction(const MFCCProcessor::Config& mfccConfig,
+                                                     size_t hopSize) {
+    mfccProcessor_ = std::make_unique<MFCCProcessor>(mfccConfig);
+    liveFrameSize_ = mfccConfig.frame_size;
+    liveHopSize_ = hopSize;
+}
+
 float RealtimeScorer::Impl::calculateWeightedScore(float mfcc,
                                                    float volume,
                                                    float timing,
                                                    float pitch) const {
+    // Without a master level there is nothing to match volume against, so it
+    // is left out rather than counted as a mismatch
+    if (masterCallRms_ <= 0.0f && config_.volumeWeight < 1.0f) {
+        return (config_.mfccWeight * mfcc + config_.timingWeight * timing
+                + config_.pitchWeight * pitch)
+               / (1.0f - config_.volumeWeight);
+    }
     return config_.mfccWeight * mfcc + config_.volumeWeight * volume + config_.timingWeight * timing
            + config_.pitchWeight * pitch;
 }
@@ -287,6 +314,44 @@ bool RealtimeScorer::Impl::isScoreTrendingUp() const {
     return recentAvg > olderAvg * 1.1f;  // 10% improvement threshold
 }
 
+/// Version 1 .mfc: frame and coefficient counts followed by rows, no config
+bool RealtimeScorer::Impl::loadLegacyFeatures(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Read feature dimensions
+    uint32_t numFrames, numCoeffs;
+    file.read(reinterpret_cast<char*>(&numFrames), sizeof(numFrames));
+    file.read(reinterpret_cast<char*>(&numCoeffs), sizeof(numCoeffs));
+
+    if (!file || numFrames == 0 || numCoeffs == 0) {
+        return false;
+    }
+
+    // Read feature data
+    masterMfccFeatures_.clear();
+    masterMfccFeatures_.reserve(numFrames);
+
+    for (uint32_t frame = 0; frame < numFrames; ++frame) {
+        std::vector<float> frameFeatures(numCoeffs);
+        file.read(reinterpret_cast<char*>(frameFeatures.data()), numCoeffs * sizeof(float));
+
+        if (!file) {
+            masterMfccFeatures_.clear();
+            return false;
+        }
+
+        masterMfccFeatures_.push_back(std::move(frameFeatures));
+    }
+
+    // Estimate master call duration (approximate)
+    const float frameRateMs = 512.0f / config_.sampleRate * 1000.0f;  // Hop size based
+    masterCallDuration_ = numFrames * frameRateMs / 1000.0f;          // Convert to seconds
+    return true;
+}
+
 bool RealtimeScorer::setMasterCall(const std::string& masterCallPath) noexcept {
     try {
         std::lock_guard<std::mutex> lock(impl_->mutex_);
@@ -294,41 +359,25 @@ bool RealtimeScorer::setMasterCall(const std::string& masterCallPath) noexcept {
         // Try to load as feature file first (.mfc)
         if (masterCallPath.size() >= 4
             && masterCallPath.compare(masterCallPath.size() - 4, 4, ".mfc") == 0) {
-            std::ifstream file(masterCallPath, std::ios::binary);
-            if (!file.is_open()) {
+            // Versioned files carry the hop and sample rate they were extracted with
+            auto featureFile = FeatureFile::open(masterCallPath);
+            if (featureFile) {
+                impl_->masterMfccFeatures_ = featureFile->featureMatrix();
+                const auto& config = featureFile->config();
+                impl_->setLiveFeatureExtraction(config.toMFCC(), config.hopSize);
+                impl_->masterCallDuration_ =
+                    config.sampleRate > 0 ? static_cast<float>(featureFile->frames())
+                                                * static_cast<float>(config.hopSize)
+                                                / static_cast<float>(config.sampleRate)
+                                          : 0.0f;
+            } else if (featureFile.error() != FeatureFileError::UNSUPPORTED_VERSION) {
                 return false;
-            }
-
-            // Read feature dimensions
-            uint32_t numFrames, numCoeffs;
-            file.read(reinterpret_cast<char*>(&numFrames), sizeof(numFrames));
-            file.read(reinterpret_cast<char*>(&numCoeffs), sizeof(numCoeffs));
-
-            if (!file || numFrames == 0 || numCoeffs == 0) {
+            } else if (!impl_->loadLegacyFeatures(masterCallPath)) {
                 return false;
+            } else {
+                impl_->setLiveFeatureExtraction(impl_->defaultMfccConfig(), kDefaultHopSize);
             }
 
-            // Read feature data
-            impl_->masterMfccFeatures_.clear();
-            impl_->masterMfccFeatures_.reserve(numFrames);
-
-            for (uint32_t frame = 0; frame < numFrames; ++frame) {
-                std::vector<float> frameFeatures(numCoeffs);
-                file.read(reinterpret_cast<char*>(frameFeatures.data()), numCoeffs * sizeof(float));
-
-                if (!file) {
-                    impl_->masterMfccFeatures_.clear();
-                    return false;
-                }
-
-                impl_->masterMfccFeatures_.push_back(std::move(frameFeatures));
-            }
-
-            // Estimate master call duration (approximate)
-            const float frameRateMs =
-                512.0f / impl_->config_.sampleRate * 1000.0f;                // Hop size based
-            impl_->masterCallDuration_ = numFrames * frameRateMs / 1000.0f;  // Convert to seconds
-
             // Calculate approximate RMS from MFCC energy (using first coefficient as proxy).
             // Note: The first MFCC coefficient may or may not represent true signal energy,
             // depending on the MFCC implementation. Adjust this if your MFCCs are computed
@@ -349,6 +398,7 @@ bool RealtimeScorer::setMasterCall(const std::string& masterCallPath) noexcept {
 
         } else {
             // Load from audio file
+            impl_->setLiveFeatureExtraction(impl_->defaultMfccConfig(), kDefaultHopSize);
             unsigned int channels;
             unsigned int sampleRate;
             drwav_uint64 totalFrameCount;
@@ -378,7 +428,8 @@ bool RealtimeScorer::setMasterCall(const std::string& masterCallPath) noexcept {
             }
 
             // Extract features
-            auto featuresResult = impl_->mfccProcessor_->extractFeaturesFromBuffer(monoData, 512);
+            auto featuresResult =
+                impl_->mfccProcessor_->extractFeaturesFromBuffer(monoData, kDefaultHopSize);
             if (!featuresResult.has_value()) {
                 return false;
             }
@@ -409,6 +460,36 @@ bool RealtimeScorer::setMasterCall(const std::string& masterCallPath) noexcept {
     }
 }
 
+bool RealtimeScorer::setMasterCallFeatures(std::vector<std::vector<float>> features,
+                                           const FeatureConfigRecord& config,
+                                           float rms,
+                                           float durationSeconds) noexcept {
+    if (features.empty() || config.frameSize == 0 || config.hopSize == 0) {
+        return false;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        if (config.sampleRate != static_cast<uint32_t>(impl_->config_.sampleRate)) {
+            return false;
+        }
+        impl_->setLiveFeatureExtraction(config.toMFCC(), config.hopSize);
+
+        const float derivedDuration = static_cast<float>(features.size())
+                                      * static_cast<float>(config.hopSize)
+                                      / static_cast<float>(config.sampleRate);
+        impl_->masterMfccFeatures_ = std::move(features);
+        impl_->masterCallRms_ = std::max(0.0f, rms);
+        impl_->masterCallDuration_ = durationSeconds > 0.0f ? durationSeconds : derivedDuration;
+        impl_->hasMasterCall_ = true;
+        return true;
+
+    } catch (...) {
+        impl_->hasMasterCall_ = false;
+        return false;
+    }
+}
+
 RealtimeScorer::Result RealtimeScorer::processAudio(std::span<const float> samples,
                                                     int numChannels) noexcept {
     if (!impl_->initialized_.load()) {
@@ -473,9 +554,9 @@ RealtimeScorer::Result RealtimeScorer::processAudio(std::span<const float> sampl
 #endif
 
         // Extract MFCC features if we have enough audio
-        if (impl_->liveAudioBuffer_.size() >= 1024) {  // Minimum frame size
-            auto mfccResult =
-                impl_->mfccProcessor_->extractFeaturesFromBuffer(impl_->liveAudioBuffer_, 512);
+        if (impl_->liveAudioBuffer_.size() >= impl_->liveFrameSize_) {
+            auto mfccResult = impl_->mfccProcessor_->extractFeaturesFromBuffer(
+                impl_->liveAudioBuffer_, impl_->liveHopSize_);
             if (mfccResult.has_value()) {
                 auto features = *mfccResult;
                 if (!features.empty()) {
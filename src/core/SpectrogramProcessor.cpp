@@ -1,7 +1,9 @@
 #include "huntmaster/core/SpectrogramProcessor.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -15,6 +17,103 @@
 
 namespace huntmaster {
 
+namespace {
+
+void fillAxes(SpectrogramData& result, const SpectrogramProcessor::Config& config) {
+    result.sample_rate = config.sample_rate;
+    result.hop_size_seconds = static_cast<float>(config.hop_size) / config.sample_rate;
+    result.min_db = config.db_floor;
+    result.max_db = config.db_ceiling;
+    result.frequency_bins = config.window_size / 2 + 1;
+
+    result.frequency_axis.resize(result.frequency_bins);
+    for (size_t i = 0; i < result.frequency_bins; ++i) {
+        result.frequency_axis[i] = i * config.sample_rate / (2.0f * result.frequency_bins);
+    }
+}
+
+constexpr char kBinaryMagic[4] = {'H', 'M', 'S', 'P'};
+constexpr uint16_t kBinaryVersion = 1;
+
+using Palette = std::array<std::array<uint8_t, 4>, 256>;
+
+Palette buildPalette(SpectrogramColorScheme scheme) {
+    Palette palette{};
+    for (size_t i = 0; i < palette.size(); ++i) {
+        const auto level = static_cast<uint8_t>(i);
+        switch (scheme) {
+            case SpectrogramColorScheme::GRAYSCALE:
+                palette[i] = {level, level, level, 255};
+                break;
+            case SpectrogramColorScheme::HEAT: {
+                // Three equal ramps: red, then green, then blue
+                const int scaled = static_cast<int>(i) * 3;
+                const auto ramp = [scaled](int start) {
+                    return static_cast<uint8_t>(std::clamp(scaled - start, 0, 255));
+                };
+                palette[i] = {ramp(0), ramp(255), ramp(510), 255};
+                break;
+            }
+        }
+    }
+    return palette;
+}
+
+const Palette& paletteFor(SpectrogramColorScheme scheme) {
+    static const Palette grayscale = buildPalette(SpectrogramColorScheme::GRAYSCALE);
+    static const Palette heat = buildPalette(SpectrogramColorScheme::HEAT);
+    return scheme == SpectrogramColorScheme::GRAYSCALE ? grayscale : heat;
+}
+
+/**
+ * @brief Affine dB -> level mapping with the scale precomputed once per spectrogram
+ */
+struct LevelQuantizer {
+    float min_db;
+    float scale;
+
+    explicit LevelQuantizer(const SpectrogramData& data)
+        : min_db(data.min_db),
+          scale(data.max_db > data.min_db ? 255.0f / (data.max_db - data.min_db) : 0.0f) {}
+
+    uint8_t operator()(float db) const {
+        float level = (db - min_db) * scale + 0.5f;
+        return static_cast<uint8_t>(std::clamp(level, 0.0f, 255.0f));
+    }
+};
+
+void appendLE16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void appendLE32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void appendFloatLE(std::vector<uint8_t>& out, float value) {
+    appendLE32(out, std::bit_cast<uint32_t>(value));
+}
+
+/// Serialize field by field so the payload is little-endian whatever the host order
+void appendHeader(std::vector<uint8_t>& out, const SpectrogramBinaryHeader& header) {
+    out.insert(out.end(), header.magic, header.magic + sizeof(header.magic));
+    appendLE16(out, header.version);
+    appendLE16(out, header.header_size);
+    appendLE32(out, header.time_bins);
+    appendLE32(out, header.frequency_bins);
+    appendFloatLE(out, header.sample_rate);
+    appendFloatLE(out, header.hop_size_seconds);
+    appendFloatLE(out, header.start_time);
+    appendFloatLE(out, header.frequency_step_hz);
+    appendFloatLE(out, header.min_db);
+    appendFloatLE(out, header.max_db);
+}
+
+}  // namespace
+
 // PIMPL implementation
 struct SpectrogramProcessor::Impl {
 #ifdef HAVE_KISSFFT
@@ -26,6 +125,21 @@ struct SpectrogramProcessor::Impl {
     std::vector<float> magnitude_spectrum;
     bool initialized = false;
 
+    // Streaming STFT state: samples not yet consumed by a hop, plus the running dB range
+    std::vector<float> stream_buffer;
+    size_t stream_columns = 0;
+    float stream_min_db = 0.0f;
+    float stream_max_db = 0.0f;
+    bool stream_has_range = false;
+
+    void resetStream() {
+        stream_buffer.clear();
+        stream_columns = 0;
+        stream_min_db = 0.0f;
+        stream_max_db = 0.0f;
+        stream_has_range = false;
+    }
+
     explicit Impl(const Config& config) {
         try {
 #ifdef HAVE_KISSFFT
@@ -85,7 +199,10 @@ struct SpectrogramProcessor::Impl {
     Impl(Impl&& other) noexcept
         : window_function(std::move(other.window_function)),
           windowed_frame(std::move(other.windowed_frame)),
-          magnitude_spectrum(std::move(other.magnitude_spectrum)), initialized(other.initialized) {
+          magnitude_spectrum(std::move(other.magnitude_spectrum)), initialized(other.initialized),
+          stream_buffer(std::move(other.stream_buffer)), stream_columns(other.stream_columns),
+          stream_min_db(other.stream_min_db), stream_max_db(other.stream_max_db),
+          stream_has_range(other.stream_has_range) {
 #ifdef HAVE_KISSFFT
         fft_config = other.fft_config;
         fft_output = std::move(other.fft_output);
@@ -108,6 +225,11 @@ struct SpectrogramProcessor::Impl {
             windowed_frame = std::move(other.windowed_frame);
             magnitude_spectrum = std::move(other.magnitude_spectrum);
             initialized = other.initialized;
+            stream_buffer = std::move(other.stream_buffer);
+            stream_columns = other.stream_columns;
+            stream_min_db = other.stream_min_db;
+            stream_max_db = other.stream_max_db;
+            stream_has_range = other.stream_has_range;
             other.initialized = false;
         }
         return *this;
@@ -199,11 +321,7 @@ SpectrogramProcessor::computeSpectrogram(std::span<const float> audio_data) noex
         }
 
         SpectrogramData result;
-        result.sample_rate = config_.sample_rate;
-        result.hop_size_seconds = static_cast<float>(config_.hop_size) / config_.sample_rate;
-        result.min_db = config_.db_floor;
-        result.max_db = config_.db_ceiling;
-        result.frequency_bins = config_.window_size / 2 + 1;
+        fillAxes(result, config_);
 
         // Calculate number of time frames
         const size_t total_samples = audio_data.size();
@@ -220,12 +338,6 @@ SpectrogramProcessor::computeSpectrogram(std::span<const float> audio_data) noex
             result.time_axis[i] = i * result.hop_size_seconds;
         }
 
-        // Generate frequency axis
-        result.frequency_axis.resize(result.frequency_bins);
-        for (size_t i = 0; i < result.frequency_bins; ++i) {
-            result.frequency_axis[i] = i * config_.sample_rate / (2.0f * result.frequency_bins);
-        }
-
         // Process each frame
         for (size_t frame_idx = 0; frame_idx < num_frames; ++frame_idx) {
             size_t start_sample = frame_idx * config_.hop_size;
@@ -258,6 +370,72 @@ SpectrogramProcessor::computeSpectrogram(std::span<const float> audio_data) noex
     }
 }
 
+// Streaming STFT
+huntmaster::expected<SpectrogramData, SpectrogramError>
+SpectrogramProcessor::processStreamingChunk(std::span<const float> audio_chunk) noexcept {
+    try {
+        if (!impl_->initialized) {
+            return huntmaster::unexpected(SpectrogramError::INVALID_INPUT);
+        }
+
+        auto& buffer = impl_->stream_buffer;
+        buffer.insert(buffer.end(), audio_chunk.begin(), audio_chunk.end());
+
+        SpectrogramData result;
+        fillAxes(result, config_);
+
+        const size_t window = config_.window_size;
+        const size_t hop = config_.hop_size;
+        const size_t new_columns = buffer.size() >= window ? (buffer.size() - window) / hop + 1 : 0;
+
+        result.time_bins = new_columns;
+        result.magnitude_db.reserve(new_columns);
+        result.time_axis.reserve(new_columns);
+
+        for (size_t column = 0; column < new_columns; ++column) {
+            auto frame_result =
+                processFrame(std::span<const float>(buffer.data() + column * hop, window));
+            if (!frame_result.has_value()) {
+                return huntmaster::unexpected(frame_result.error());
+            }
+
+            const auto [min_it, max_it] =
+                std::minmax_element(frame_result.value().begin(), frame_result.value().end());
+            if (!impl_->stream_has_range) {
+                impl_->stream_min_db = *min_it;
+                impl_->stream_max_db = *max_it;
+                impl_->stream_has_range = true;
+            } else {
+                impl_->stream_min_db = std::min(impl_->stream_min_db, *min_it);
+                impl_->stream_max_db = std::max(impl_->stream_max_db, *max_it);
+            }
+
+            result.time_axis.push_back((impl_->stream_columns + column) * result.hop_size_seconds);
+            result.magnitude_db.push_back(std::move(frame_result.value()));
+        }
+
+        // Keep only the samples the next column still needs; at most one window is moved
+        impl_->stream_columns += new_columns;
+        buffer.erase(buffer.begin(), buffer.begin() + new_columns * hop);
+
+        if (impl_->stream_has_range) {
+            result.min_db = impl_->stream_min_db;
+            result.max_db = impl_->stream_max_db;
+        }
+
+        return result;
+
+    } catch (const std::exception& e) {
+        LOG_ERROR(Component::SPECTROGRAM_PROCESSOR,
+                  "Exception in processStreamingChunk: " + std::string(e.what()));
+        return huntmaster::unexpected(SpectrogramError::PROCESSING_FAILED);
+    }
+}
+
+size_t SpectrogramProcessor::getStreamingColumnCount() const noexcept {
+    return impl_ ? impl_->stream_columns : 0;
+}
+
 // Process single frame
 huntmaster::expected<std::vector<float>, SpectrogramError>
 SpectrogramProcessor::processFrame(std::span<const float> audio_frame) noexcept {
@@ -351,6 +529,54 @@ SpectrogramProcessor::generateColorMap(const SpectrogramData& spectrogram_data)
     return color_map;
 }
 
+// Quantize to 8-bit levels
+huntmaster::expected<size_t, SpectrogramError>
+SpectrogramProcessor::quantizeToLevels(const SpectrogramData& spectrogram_data,
+                                       std::span<uint8_t> levels) noexcept {
+    const size_t time_bins = spectrogram_data.time_bins;
+    const size_t freq_bins = spectrogram_data.frequency_bins;
+    const size_t total = time_bins * freq_bins;
+    if (levels.size() < total) {
+        return huntmaster::unexpected(SpectrogramError::INVALID_INPUT);
+    }
+
+    const LevelQuantizer quantize(spectrogram_data);
+    for (size_t t = 0; t < time_bins; ++t) {
+        uint8_t* row = levels.data() + t * freq_bins;
+        if (t < spectrogram_data.magnitude_db.size()
+            && spectrogram_data.magnitude_db[t].size() >= freq_bins) {
+            const float* column = spectrogram_data.magnitude_db[t].data();
+            for (size_t f = 0; f < freq_bins; ++f) {
+                row[f] = quantize(column[f]);
+            }
+        } else {
+            std::memset(row, 0, freq_bins);
+        }
+    }
+
+    return total;
+}
+
+// Palette lookup
+huntmaster::expected<size_t, SpectrogramError>
+SpectrogramProcessor::renderColorMap(std::span<const uint8_t> levels,
+                                     std::span<uint8_t> rgba,
+                                     SpectrogramColorScheme scheme) noexcept {
+    const size_t total = levels.size() * 4;
+    if (rgba.size() < total) {
+        return huntmaster::unexpected(SpectrogramError::INVALID_INPUT);
+    }
+
+    const Palette& palette = paletteFor(scheme);
+    uint8_t* out = rgba.data();
+    for (uint8_t level : levels) {
+        std::memcpy(out, palette[level].data(), 4);
+        out += 4;
+    }
+
+    return total;
+}
+
 // Export for visualization
 std::string SpectrogramProcessor::exportForVisualization(const SpectrogramData& spectrogram_data,
                                                          size_t max_time_bins,
@@ -438,6 +664,67 @@ std::string SpectrogramProcessor::exportForVisualization(const SpectrogramData&
     }
 }
 
+// Binary export
+std::vector<uint8_t> SpectrogramProcessor::exportBinary(const SpectrogramData& spectrogram_data,
+                                                        size_t max_time_bins,
+                                                        size_t max_freq_bins) const noexcept {
+    try {
+        // Same downsampling as exportForVisualization
+        const size_t time_step = (max_time_bins > 0 && spectrogram_data.time_bins > max_time_bins)
+                                     ? spectrogram_data.time_bins / max_time_bins
+                                     : 1;
+        const size_t freq_step =
+            (max_freq_bins > 0 && spectrogram_data.frequency_bins > max_freq_bins)
+                ? spectrogram_data.frequency_bins / max_freq_bins
+                : 1;
+        const size_t out_time = (spectrogram_data.time_bins + time_step - 1) / time_step;
+        const size_t out_freq = (spectrogram_data.frequency_bins + freq_step - 1) / freq_step;
+
+        SpectrogramBinaryHeader header{};
+        std::memcpy(header.magic, kBinaryMagic, sizeof(header.magic));
+        header.version = kBinaryVersion;
+        header.header_size = sizeof(SpectrogramBinaryHeader);
+        header.time_bins = static_cast<uint32_t>(out_time);
+        header.frequency_bins = static_cast<uint32_t>(out_freq);
+        header.sample_rate = spectrogram_data.sample_rate;
+        header.hop_size_seconds = spectrogram_data.hop_size_seconds * time_step;
+        header.start_time =
+            spectrogram_data.time_axis.empty() ? 0.0f : spectrogram_data.time_axis[0];
+        header.frequency_step_hz = spectrogram_data.frequency_axis.size() > 1
+                                       ? (spectrogram_data.frequency_axis[1]
+                                          - spectrogram_data.frequency_axis[0])
+                                             * freq_step
+                                       : 0.0f;
+        header.min_db = spectrogram_data.min_db;
+        header.max_db = spectrogram_data.max_db;
+
+        std::vector<uint8_t> payload;
+        payload.reserve(sizeof(header) + out_time * out_freq);
+        appendHeader(payload, header);
+        payload.resize(sizeof(header) + out_time * out_freq, 0);
+
+        const LevelQuantizer quantize(spectrogram_data);
+        uint8_t* out = payload.data() + sizeof(header);
+        for (size_t t = 0; t < spectrogram_data.time_bins; t += time_step, out += out_freq) {
+            if (t >= spectrogram_data.magnitude_db.size()) {
+                break;
+            }
+            const auto& column = spectrogram_data.magnitude_db[t];
+            for (size_t f = 0, i = 0; f < spectrogram_data.frequency_bins && f < column.size();
+                 f += freq_step, ++i) {
+                out[i] = quantize(column[f]);
+            }
+        }
+
+        return payload;
+
+    } catch (const std::exception& e) {
+        LOG_ERROR(Component::SPECTROGRAM_PROCESSOR,
+                  "Exception in exportBinary: " + std::string(e.what()));
+        return {};
+    }
+}
+
 // Reset processor state
 void SpectrogramProcessor::reset() noexcept {
     if (impl_) {
@@ -447,6 +734,7 @@ void SpectrogramProcessor::reset() noexcept {
 #ifdef HAVE_KISSFFT
         std::fill(impl_->fft_output.begin(), impl_->fft_output.end(), kiss_fft_cpx{0.0f, 0.0f});
 #endif
+        impl_->resetStream();
     }
 }
 
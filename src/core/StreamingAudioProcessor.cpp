@@ -14,6 +14,7 @@
 #include "StreamingAudioProcessor.h"
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <iostream>
@@ -22,6 +23,48 @@
 namespace huntmaster {
 namespace core {
 
+namespace {
+
+/// Hop of the streaming voice activity detector
+constexpr std::chrono::milliseconds kVADWindow{10};
+
+/// Mean-square energy that maps to a VAD probability of 0.5 (VADConfig's default threshold)
+constexpr float kReferenceVADEnergy = 0.01f;
+
+float vadProbability(float energy) {
+    return energy / (energy + kReferenceVADEnergy);
+}
+
+VoiceActivityDetector::Config makeVADConfig(const StreamingConfig& config) {
+    // vadThreshold is a probability; invert vadProbability() to get the energy threshold
+    const float threshold = std::clamp(config.vadThreshold, 0.0f, 0.99f);
+    VoiceActivityDetector::Config vad;
+    vad.energy_threshold = kReferenceVADEnergy * threshold / (1.0f - threshold);
+    vad.window_duration = kVADWindow;
+    vad.post_buffer = std::chrono::milliseconds(config.vadHangTime);
+    vad.sample_rate = config.sampleRate;
+    return vad;
+}
+
+QualityConfig makeQualityConfig(const StreamingConfig& config) {
+    QualityConfig quality = createDefaultQualityConfig();
+    quality.sampleRate = config.sampleRate;
+    quality.maxFrequency = std::min(quality.maxFrequency, config.sampleRate / 2.0f);
+    return quality;
+}
+
+MFCCProcessor::Config makeMFCCConfig(const StreamingConfig& config) {
+    // Same analysis as UnifiedAudioEngine sessions, limited to one capture frame
+    MFCCProcessor::Config mfcc;
+    mfcc.sample_rate = config.sampleRate;
+    mfcc.frame_size = std::min<size_t>(512, std::bit_floor(config.bufferSize));
+    mfcc.num_coefficients = 13;
+    mfcc.num_filters = 26;
+    return mfcc;
+}
+
+}  // namespace
+
 // TODO: Phase 2.4 - Advanced Audio Engine Implementation - COMPREHENSIVE FILE TODO
 // =================================================================================
 
@@ -42,19 +85,11 @@ namespace core {
  */
 
 StreamingAudioProcessor::StreamingAudioProcessor()
-    : audioEngine_(nullptr), vadDetector_(nullptr), qualityAssessor_(nullptr),
-      inputBuffer_(nullptr), initialized_(false), streaming_(false), processingThread_(nullptr),
-      shouldStop_(false), processingCallback_(nullptr), vadCallback_(nullptr),
-      qualityCallback_(nullptr), errorCallback_(nullptr) {
+    : vadDetector_(nullptr), qualityAssessor_(nullptr), initialized_(false), streaming_(false),
+      processingCallback_(nullptr), vadCallback_(nullptr), qualityCallback_(nullptr),
+      errorCallback_(nullptr) {
     // Initialize comprehensive performance metrics for monitoring
     performanceMetrics_ = {};
-    performanceMetrics_.averageLatency = 0.0;
-    performanceMetrics_.peakLatency = 0.0;
-    performanceMetrics_.throughput = 0.0;
-    performanceMetrics_.bufferUtilization = 0.0;
-    performanceMetrics_.totalProcessedFrames = 0;
-    performanceMetrics_.droppedFrames = 0;
-    performanceMetrics_.cpuUsage = 0.0;
 
     // Initialize comprehensive error tracking system
     lastError_ = {};
@@ -74,14 +109,14 @@ StreamingAudioProcessor::~StreamingAudioProcessor() {
     try {
         // Stop all processing threads gracefully
         if (streaming_) {
-            stop();
+            stopStreaming();
         }
 
         // Shutdown all components with proper resource deallocation
         shutdown();
 
         // Verify cleanup completion
-        if (processingThread_ != nullptr || inputBuffer_ != nullptr) {
+        if (vadStage_ != nullptr || framePool_ != nullptr) {
             std::cerr << "Warning: StreamingAudioProcessor cleanup may be incomplete" << std::endl;
         }
 
@@ -114,1298 +149,1480 @@ bool StreamingAudioProcessor::initialize(const StreamingConfig& config) {
     std::lock_guard<std::mutex> lock(configMutex_);
 
     try {
-        bool StreamingAudioProcessor::initialize(const StreamingConfig& config) {
-            std::lock_guard<std::mutex> lock(configMutex_);
+        // Comprehensive configuration parameter validation with detailed range checking
+        std::string validationError;
+        if (!validateStreamingConfig(config, validationError)) {
+            lastError_ = {.code = -1,
+                          .message = "Invalid configuration: " + validationError,
+                          .details = "Configuration validation failed during initialization",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::initialize"};
+            return false;
+        }
 
-            try {
-                // Comprehensive configuration parameter validation with detailed range checking
-                std::string validationError;
-                if (!validateStreamingConfig(config, validationError)) {
-                    lastError_ = {.code = -1,
-                                  .message = "Invalid configuration: " + validationError,
-                                  .details =
-                                      "Configuration validation failed during initialization",
-                                  .timestamp = std::chrono::steady_clock::now(),
-                                  .component = "StreamingAudioProcessor::initialize"};
-                    return false;
-                }
+        // Store validated configuration for use throughout the system
+        config_ = config;
+
+        // Initialize voice activity detector with algorithm selection and optimization
+        std::lock_guard<std::mutex> analysisLock(analysisMutex_);
+        vadDetector_.reset();
+        if (config.enableVAD && !createVoiceActivityDetector(config)) {
+            lastError_ = {.code = -3,
+                          .message = "Failed to initialize voice activity detector",
+                          .details = "VoiceActivityDetector initialization failed with "
+                                     "selected algorithm",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::initialize"};
+            return false;
+        }
 
-                // Store validated configuration for use throughout the system
-                config_ = config;
-
-                // Initialize unified audio engine with comprehensive error handling
-                audioEngine_ = std::make_unique<UnifiedAudioEngine>();
-                AudioConfig audioConfig;
-                audioConfig.sampleRate = config.sampleRate;
-                audioConfig.channels = config.channels;
-                audioConfig.bufferSize = config.bufferSize;
-
-                if (!audioEngine_->initialize(audioConfig)) {
-                    lastError_ = {.code = -2,
-                                  .message = "Failed to initialize audio engine",
-                                  .details = "UnifiedAudioEngine initialization failed",
-                                  .timestamp = std::chrono::steady_clock::now(),
-                                  .component = "StreamingAudioProcessor::initialize"};
-                    return false;
-                }
+        // Initialize quality assessor with comprehensive metric configuration
+        qualityAssessor_.reset();
+        if (config.enableQualityAssessment && !createQualityAssessor(config)) {
+            lastError_ = {.code = -4,
+                          .message = "Failed to initialize quality assessor",
+                          .details = "QualityAssessor initialization failed with metric "
+                                     "configuration",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::initialize"};
+            return false;
+        }
 
-                // Initialize voice activity detector with algorithm selection and optimization
-                if (config.enableVAD) {
-                    vadDetector_ = std::make_unique<VoiceActivityDetector>();
-                    if (!vadDetector_->initialize(config)) {
-                        lastError_ = {.code = -3,
-                                      .message = "Failed to initialize voice activity detector",
-                                      .details = "VoiceActivityDetector initialization failed with "
-                                                 "selected algorithm",
-                                      .timestamp = std::chrono::steady_clock::now(),
-                                      .component = "StreamingAudioProcessor::initialize"};
-                        return false;
-                    }
-                }
+        // Scoring compares MFCC sequences the same way UnifiedAudioEngine sessions do
+        dtwComparator_ = std::make_unique<DTWComparator>(DTWComparator::Config{});
+        featureExtractors_.clear();
+        {
+            std::lock_guard<std::mutex> masterLock(masterAudioMutex_);
+            masterFeatures_.clear();
+            masterInfo_ = {};
+            recentFeatures_.clear();
+            recentLevel_ = 0.0f;
+        }
 
-                // Initialize quality assessor with comprehensive metric configuration
-                if (config.enableQualityAssessment) {
-                    qualityAssessor_ = std::make_unique<QualityAssessor>();
-                    if (!qualityAssessor_->initialize(config)) {
-                        lastError_ = {
-                            .code = -4,
-                            .message = "Failed to initialize quality assessor",
-                            .details =
-                                "QualityAssessor initialization failed with metric configuration",
-                            .timestamp = std::chrono::steady_clock::now(),
-                            .component = "StreamingAudioProcessor::initialize"};
-                        return false;
-                    }
-                }
+        // Build the processing pipeline; stages run inline until streaming starts
+        if (!buildPipeline(false)) {
+            lastError_ = {.code = -5,
+                          .message = "Failed to initialize processing pipeline",
+                          .details = "Frame pool allocation failed - insufficient memory "
+                                     "or invalid parameters",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::initialize"};
+            return false;
+        }
 
-                // Initialize circular buffer with memory optimization and performance tuning
-                inputBuffer_ = std::make_unique<CircularAudioBuffer>();
-                if (!inputBuffer_->initialize(
-                        config.circularBufferSize, config.channels, config.sampleRate)) {
-                    lastError_ = {.code = -5,
-                                  .message = "Failed to initialize circular buffer",
-                                  .details = "CircularAudioBuffer initialization failed - "
-                                             "insufficient memory or invalid parameters",
-                                  .timestamp = std::chrono::steady_clock::now(),
-                                  .component = "StreamingAudioProcessor::initialize"};
-                    return false;
-                }
+        // Initialize comprehensive performance monitoring with baseline establishment
+        {
+            std::lock_guard<std::mutex> performanceLock(performanceMutex_);
+            performanceMetrics_ = {};
+        }
 
-                // Initialize comprehensive performance monitoring with baseline establishment
-                performanceMetrics_ = {};
-                performanceMetrics_.averageLatency = 0.0;
-                performanceMetrics_.peakLatency = 0.0;
-                performanceMetrics_.throughput = 0.0;
-                performanceMetrics_.bufferUtilization = 0.0;
-                performanceMetrics_.totalProcessedFrames = 0;
-                performanceMetrics_.droppedFrames = 0;
-                performanceMetrics_.cpuUsage = 0.0;
+        // Mark initialization as complete with atomic operation for thread safety
+        initialized_.store(true);
 
-                // Mark initialization as complete with atomic operation for thread safety
-                initialized_.store(true);
+        std::cout << "StreamingAudioProcessor initialized successfully" << std::endl;
+        return true;
 
-                std::cout << "StreamingAudioProcessor initialized successfully" << std::endl;
-                return true;
+    } catch (const std::exception& e) {
+        lastError_ = {.code = -100,
+                      .message = "Exception during initialization: " + std::string(e.what()),
+                      .details = "Unexpected exception caught during initialization",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::initialize"};
+
+        // Comprehensive cleanup on initialization failure with resource verification
+        initialized_.store(false);
+
+        // Reset all components in reverse order of initialization
+        stopPipeline();
+        framePool_.reset();
+        if (qualityAssessor_) {
+            qualityAssessor_.reset();
+        }
+        if (vadDetector_) {
+            vadDetector_.reset();
+        }
+        featureExtractors_.clear();
+        dtwComparator_.reset();
 
-            } catch (const std::exception& e) {
-                lastError_ = {.code = -100,
-                              .message =
-                                  "Exception during initialization: " + std::string(e.what()),
-                              .details = "Unexpected exception caught during initialization",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::initialize"};
-
-                // Comprehensive cleanup on initialization failure with resource verification
-                initialized_.store(false);
-
-                // Reset all components in reverse order of initialization
-                if (inputBuffer_) {
-                    inputBuffer_.reset();
-                }
-                if (qualityAssessor_) {
-                    qualityAssessor_.reset();
-                }
-                if (vadDetector_) {
-                    vadDetector_.reset();
-                }
-                if (audioEngine_) {
-                    audioEngine_.reset();
-                }
+        // Clear performance metrics
+        performanceMetrics_ = {};
+
+        // Log cleanup completion
+        std::cerr << "StreamingAudioProcessor initialization failed - all resources cleaned up"
+                  << std::endl;
 
-                // Clear performance metrics
-                performanceMetrics_ = {};
+        return false;
+    }
+}
 
-                // Log cleanup completion
-                std::cerr
-                    << "StreamingAudioProcessor initialization failed - all resources cleaned up"
-                    << std::endl;
+bool StreamingAudioProcessor::updateConfiguration(const StreamingConfig& config) {
+    // Implement comprehensive dynamic configuration updates with validation and
+    // hot-swapping
+    if (!initialized_.load()) {
+        lastError_ = {
+            .code = -20,
+            .message = "Cannot update configuration: processor not initialized",
+            .details =
+                "StreamingAudioProcessor must be initialized before configuration updates",
+            .timestamp = std::chrono::steady_clock::now(),
+            .component = "StreamingAudioProcessor::updateConfiguration"};
+        return false;
+    }
 
-                return false;
-            }
+    // Comprehensive validation of new configuration parameters
+    std::string validationError;
+    if (!validateStreamingConfig(config, validationError)) {
+        lastError_ = {
+            .code = -10,
+            .message = "Invalid configuration update: " + validationError,
+            .details =
+                "New configuration failed validation - parameters out of acceptable range",
+            .timestamp = std::chrono::steady_clock::now(),
+            .component = "StreamingAudioProcessor::updateConfiguration"};
+        return false;
+    }
+
+    // Apply configuration changes intelligently, avoiding reinitialization when possible
+    bool needsReinitialization = false;
+    bool vadChanged = false;
+    bool qualityChanged = false;
+    {
+        std::lock_guard<std::mutex> lock(configMutex_);
+
+        // Check if core parameters changed
+        if (config.sampleRate != config_.sampleRate || config.channels != config_.channels
+            || config.bufferSize != config_.bufferSize || config.hopSize != config_.hopSize) {
+            needsReinitialization = true;
+        } else {
+            vadChanged = config.enableVAD != config_.enableVAD
+                         || config.vadThreshold != config_.vadThreshold
+                         || config.vadHangTime != config_.vadHangTime;
+            qualityChanged = config.enableQualityAssessment != config_.enableQualityAssessment;
+
+            // Pipeline settings take effect the next time the pipeline is built
+            config_ = config;
         }
+    }
 
-        bool StreamingAudioProcessor::updateConfiguration(const StreamingConfig& config) {
-            // Implement comprehensive dynamic configuration updates with validation and
-            // hot-swapping
-            if (!initialized_.load()) {
-                lastError_ = {
-                    .code = -20,
-                    .message = "Cannot update configuration: processor not initialized",
-                    .details =
-                        "StreamingAudioProcessor must be initialized before configuration updates",
-                    .timestamp = std::chrono::steady_clock::now(),
-                    .component = "StreamingAudioProcessor::updateConfiguration"};
-                return false;
-            }
+    if (needsReinitialization) {
+        bool wasStreaming = streaming_.load();
+        if (wasStreaming) {
+            stopStreaming();
+        }
 
-            std::lock_guard<std::mutex> lock(configMutex_);
-
-            // Comprehensive validation of new configuration parameters
-            std::string validationError;
-            if (!validateStreamingConfig(config, validationError)) {
-                lastError_ = {
-                    .code = -10,
-                    .message = "Invalid configuration update: " + validationError,
-                    .details =
-                        "New configuration failed validation - parameters out of acceptable range",
-                    .timestamp = std::chrono::steady_clock::now(),
-                    .component = "StreamingAudioProcessor::updateConfiguration"};
-                return false;
-            }
+        // Reinitialize with new configuration
+        initialized_.store(false);
+        bool result = initialize(config);
 
-            // Apply configuration changes intelligently, avoiding reinitialization when possible
-            bool needsReinitialization = false;
+        if (result && wasStreaming) {
+            startStreaming();
+        }
 
-            // Check if core parameters changed
-            if (config.sampleRate != config_.sampleRate || config.channels != config_.channels
-                || config.bufferSize != config_.bufferSize) {
-                needsReinitialization = true;
-            }
+        return result;
+    }
 
-            if (needsReinitialization) {
-                // TODO: Implement full reinitialization
-                bool wasStreaming = streaming_.load();
-                if (wasStreaming) {
-                    stopStreaming();
-                }
+    // Analysis settings apply from the next frame; a changed detector starts fresh
+    std::lock_guard<std::mutex> analysisLock(analysisMutex_);
+    if (vadChanged) {
+        vadDetector_.reset();
+        if (config.enableVAD && !createVoiceActivityDetector(config)) {
+            return false;
+        }
+    }
+    if (qualityChanged) {
+        qualityAssessor_.reset();
+        if (config.enableQualityAssessment && !createQualityAssessor(config)) {
+            return false;
+        }
+    }
+    return true;
+}
 
-                // Reinitialize with new configuration
-                initialized_.store(false);
-                bool result = initialize(config);
+bool StreamingAudioProcessor::isInitialized() const {
+    return initialized_.load();
+}
 
-                if (result && wasStreaming) {
-                    startStreaming();
-                }
+StreamingConfig StreamingAudioProcessor::getConfiguration() const {
+    std::lock_guard<std::mutex> lock(configMutex_);
+    return config_;
+}
 
-                return result;
-            } else {
-                // TODO: Apply configuration changes that can be done dynamically
-                config_ = config;
+// TODO 2.4.19: Master Audio Management
+// ------------------------------------
+/**
+ * TODO: Implement comprehensive master audio management with:
+ * [ ] Master audio loading with format validation and conversion
+ * [ ] Audio preprocessing with normalization and enhancement
+ * [ ] Feature extraction with caching for performance optimization
+ * [ ] Sample rate conversion and channel mapping as needed
+ * [ ] Quality validation with automatic enhancement if required
+ * [ ] Memory optimization with efficient storage and access
+ * [ ] Thread-safe access with read-write synchronization
+ * [ ] Parameter updates with real-time reprocessing
+ * [ ] Error handling with detailed diagnostic information
+ * [ ] Performance monitoring with loading and processing metrics
+ */
+bool StreamingAudioProcessor::setMasterAudio(const AudioBuffer& masterAudio) {
+    if (!initialized_.load()) {
+        lastError_ = {.code = -20,
+                      .message = "Processor not initialized",
+                      .details = "Cannot set master audio before processor initialization",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::setMasterAudio"};
+        return false;
+    }
 
-                // Update VAD parameters
-                if (vadDetector_ && config.enableVAD) {
-                    vadDetector_->updateParameters(config.vadThreshold, config.vadHangTime);
-                }
+    try {
+        const StreamingConfig config = getConfiguration();
+        const size_t frames = masterAudio.getFrameCount();
+        const size_t channels = masterAudio.getChannelCount();
+        if (masterAudio.isEmpty() || frames == 0 || channels == 0) {
+            lastError_ = {.code = -21,
+                          .message = "Empty master audio buffer",
+                          .details = "Master audio buffer contains no samples",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::setMasterAudio"};
+            return false;
+        }
 
-                return true;
+        // Mix down to mono, the same way capture treats live audio
+        std::vector<float> mono(frames);
+        float sum = 0.0f;
+        float peak = 0.0f;
+        for (size_t frame = 0; frame < frames; ++frame) {
+            float mixed = 0.0f;
+            for (size_t channel = 0; channel < channels; ++channel) {
+                mixed += masterAudio.getSample(channel, frame);
             }
+            mono[frame] = mixed / static_cast<float>(channels);
+            sum += std::abs(mono[frame]);
+            peak = std::max(peak, std::abs(mono[frame]));
         }
 
-        bool StreamingAudioProcessor::isInitialized() const {
-            return initialized_.load();
+        const auto mfccSettings = makeMFCCConfig(config);
+        if (frames < mfccSettings.frame_size) {
+            lastError_ = {.code = -22,
+                          .message = "Master audio too short",
+                          .details = "Master audio is shorter than one MFCC analysis frame",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::setMasterAudio"};
+            return false;
         }
-
-        StreamingConfig StreamingAudioProcessor::getConfiguration() const {
-            std::lock_guard<std::mutex> lock(configMutex_);
-            return config_;
+        MFCCProcessor mfcc(mfccSettings);
+        auto features =
+            mfcc.extractFeaturesFromBuffer(mono, std::max<size_t>(1, config.hopSize));
+        if (!features || features->empty()) {
+            lastError_ = {.code = -22,
+                          .message = "Failed to extract master audio features",
+                          .details = "MFCC extraction of the master audio failed",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::setMasterAudio"};
+            return false;
         }
 
-        // TODO 2.4.19: Master Audio Management
-        // ------------------------------------
-        /**
-         * TODO: Implement comprehensive master audio management with:
-         * [ ] Master audio loading with format validation and conversion
-         * [ ] Audio preprocessing with normalization and enhancement
-         * [ ] Feature extraction with caching for performance optimization
-         * [ ] Sample rate conversion and channel mapping as needed
-         * [ ] Quality validation with automatic enhancement if required
-         * [ ] Memory optimization with efficient storage and access
-         * [ ] Thread-safe access with read-write synchronization
-         * [ ] Parameter updates with real-time reprocessing
-         * [ ] Error handling with detailed diagnostic information
-         * [ ] Performance monitoring with loading and processing metrics
-         */
-        bool StreamingAudioProcessor::setMasterAudio(const AudioBuffer& masterAudio) {
-            if (!initialized_.load()) {
-                lastError_ = {.code = -20,
-                              .message = "Processor not initialized",
-                              .details = "Cannot set master audio before processor initialization",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::setMasterAudio"};
-                return false;
-            }
-
-            std::lock_guard<std::mutex> lock(masterAudioMutex_);
+        std::lock_guard<std::mutex> lock(masterAudioMutex_);
+        masterFeatures_ = std::move(*features);
+        masterInfo_ = {.sampleRate = config.sampleRate,
+                       .channels = static_cast<uint16_t>(channels),
+                       .sampleCount = static_cast<uint32_t>(frames),
+                       .duration = static_cast<float>(frames) / config.sampleRate,
+                       .averageLevel = sum / static_cast<float>(frames),
+                       .peakLevel = peak,
+                       .isLoaded = true};
 
-            try {
-                // TODO: Validate master audio parameters
-                if (masterAudio.getSampleCount() == 0) {
-                    lastError_ = {.code = -21,
-                                  .message = "Empty master audio buffer",
-                                  .details = "Master audio buffer contains no samples",
-                                  .timestamp = std::chrono::steady_clock::now(),
-                                  .component = "StreamingAudioProcessor::setMasterAudio"};
-                    return false;
-                }
+        // Scoring restarts against the new reference
+        recentFeatures_.clear();
+        return true;
 
-                // TODO: Check if sample rate conversion is needed
-                if (masterAudio.getSampleRate() != config_.sampleRate) {
-                    // TODO: Implement sample rate conversion
-                    std::cout << "Warning: Master audio sample rate differs from configuration. "
-                              << "Conversion may be needed." << std::endl;
-                }
+    } catch (const std::exception& e) {
+        lastError_ = {.code = -23,
+                      .message = "Exception while setting master audio: " + std::string(e.what()),
+                      .details = "Unexpected exception during master audio setup",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::setMasterAudio"};
+        return false;
+    }
+}
 
-                // TODO: Check if channel conversion is needed
-                if (masterAudio.getChannels() != config_.channels) {
-                    // TODO: Implement channel conversion
-                    std::cout << "Warning: Master audio channel count differs from configuration. "
-                              << "Conversion may be needed." << std::endl;
-                }
+bool StreamingAudioProcessor::updateMasterAudioParameters(float volume, float speed) {
+    std::lock_guard<std::mutex> lock(masterAudioMutex_);
 
-                // TODO: Store master audio
-                masterAudio_ = masterAudio;
-
-                // TODO: Initialize audio engine with master audio
-                if (!audioEngine_->loadMasterCall(masterAudio)) {
-                    lastError_ = {.code = -22,
-                                  .message = "Failed to load master audio into engine",
-                                  .details = "UnifiedAudioEngine failed to load master call",
-                                  .timestamp = std::chrono::steady_clock::now(),
-                                  .component = "StreamingAudioProcessor::setMasterAudio"};
-                    return false;
-                }
+    if (!masterInfo_.isLoaded || !(volume > 0.0f)) {
+        return false;
+    }
 
-                std::cout << "Master audio loaded successfully" << std::endl;
-                return true;
+    // Time-stretching the reference is not supported
+    if (speed != 1.0f) {
+        lastError_ = {.code = -24,
+                      .message = "Unsupported master audio speed",
+                      .details = "Only speed 1.0 is supported",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::updateMasterAudioParameters"};
+        return false;
+    }
 
-            } catch (const std::exception& e) {
-                lastError_ = {.code = -23,
-                              .message =
-                                  "Exception while setting master audio: " + std::string(e.what()),
-                              .details = "Unexpected exception during master audio setup",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::setMasterAudio"};
-                return false;
-            }
-        }
+    masterVolume_ = volume;
+    return true;
+}
 
-        bool StreamingAudioProcessor::updateMasterAudioParameters(float volume, float speed) {
-            // TODO: Implement master audio parameter updates
-            std::lock_guard<std::mutex> lock(masterAudioMutex_);
+StreamingAudioProcessor::MasterAudioInfo StreamingAudioProcessor::getMasterAudioInfo() const {
+    std::lock_guard<std::mutex> lock(masterAudioMutex_);
+    return masterInfo_;
+}
 
-            if (!audioEngine_) {
-                return false;
-            }
+// TODO 2.4.20: Real-time Processing Control
+// -----------------------------------------
+/**
+ * TODO: Implement comprehensive real-time processing with:
+ * [ ] Processing thread creation with priority and affinity management
+ * [ ] Real-time processing loop with precise timing and scheduling
+ * [ ] Audio chunk processing with similarity analysis and feedback
+ * [ ] Lock-free data structures for high-performance streaming
+ * [ ] Buffer management with overflow and underflow protection
+ * [ ] Performance monitoring with adaptive quality adjustments
+ * [ ] Error handling with graceful degradation and recovery
+ * [ ] Thread synchronization with minimal latency impact
+ * [ ] Memory management with garbage collection optimization
+ * [ ] Platform-specific optimizations for maximum performance
+ */
+bool StreamingAudioProcessor::startStreaming() {
+    if (!initialized_.load()) {
+        lastError_ = {.code = -30,
+                      .message = "Processor not initialized",
+                      .details = "Cannot start streaming before processor initialization",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::startStreaming"};
+        return false;
+    }
 
-            // TODO: Update volume and speed parameters in audio engine
-            // This would require extending the UnifiedAudioEngine API
-            std::cout << "Master audio parameters updated: volume=" << volume << ", speed=" << speed
-                      << std::endl;
+    if (streaming_.load()) {
+        // Already streaming
+        return true;
+    }
 
-            return true;
+    try {
+        // Give every stage its own worker thread(s)
+        if (!buildPipeline(true)) {
+            lastError_ = {.code = -31,
+                          .message = "Failed to start processing pipeline",
+                          .details = "Frame pool allocation failed",
+                          .timestamp = std::chrono::steady_clock::now(),
+                          .component = "StreamingAudioProcessor::startStreaming"};
+            return false;
         }
 
-        StreamingAudioProcessor::MasterAudioInfo StreamingAudioProcessor::getMasterAudioInfo()
-            const {
-            std::lock_guard<std::mutex> lock(masterAudioMutex_);
-
-            MasterAudioInfo info = {};
+        // TODO: Set thread priority if supported
+        // Platform-specific thread priority setting would go here
 
-            if (masterAudio_.getSampleCount() > 0) {
-                info.sampleRate = masterAudio_.getSampleRate();
-                info.channels = masterAudio_.getChannels();
-                info.sampleCount = masterAudio_.getSampleCount();
-                info.duration = static_cast<float>(info.sampleCount) / info.sampleRate;
-                info.isLoaded = true;
+        streaming_.store(true);
 
-                // TODO: Calculate average and peak levels
-                const float* data = masterAudio_.getData();
-                float sum = 0.0f;
-                float peak = 0.0f;
+        std::cout << "Streaming started successfully" << std::endl;
+        return true;
 
-                for (uint32_t i = 0; i < info.sampleCount * info.channels; ++i) {
-                    float sample = std::abs(data[i]);
-                    sum += sample;
-                    peak = std::max(peak, sample);
-                }
-
-                info.averageLevel = sum / (info.sampleCount * info.channels);
-                info.peakLevel = peak;
-            }
-
-            return info;
-        }
-
-        // TODO 2.4.20: Real-time Processing Control
-        // -----------------------------------------
-        /**
-         * TODO: Implement comprehensive real-time processing with:
-         * [ ] Processing thread creation with priority and affinity management
-         * [ ] Real-time processing loop with precise timing and scheduling
-         * [ ] Audio chunk processing with similarity analysis and feedback
-         * [ ] Lock-free data structures for high-performance streaming
-         * [ ] Buffer management with overflow and underflow protection
-         * [ ] Performance monitoring with adaptive quality adjustments
-         * [ ] Error handling with graceful degradation and recovery
-         * [ ] Thread synchronization with minimal latency impact
-         * [ ] Memory management with garbage collection optimization
-         * [ ] Platform-specific optimizations for maximum performance
-         */
-        bool StreamingAudioProcessor::startStreaming() {
-            if (!initialized_.load()) {
-                lastError_ = {.code = -30,
-                              .message = "Processor not initialized",
-                              .details = "Cannot start streaming before processor initialization",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::startStreaming"};
-                return false;
-            }
-
-            if (streaming_.load()) {
-                // Already streaming
-                return true;
-            }
+    } catch (const std::exception& e) {
+        lastError_ = {.code = -31,
+                      .message = "Failed to start streaming: " + std::string(e.what()),
+                      .details = "Exception during streaming startup",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::startStreaming"};
+
+        streaming_.store(false);
+        return false;
+    }
+}
 
-            try {
-                // TODO: Reset buffer and state
-                inputBuffer_->reset();
-                shouldStop_.store(false);
+bool StreamingAudioProcessor::stopStreaming() {
+    if (!streaming_.load()) {
+        // Already stopped
+        return true;
+    }
 
-                // TODO: Start processing thread
-                processingThread_ = std::make_unique<std::thread>(
-                    &StreamingAudioProcessor::processingThreadFunction, this);
+    try {
+        // Drain queued frames stage by stage, then fall back to inline processing
+        stopPipeline();
+        streaming_.store(false);
+        buildPipeline(false);
 
-                // TODO: Set thread priority if supported
-                // Platform-specific thread priority setting would go here
+        std::cout << "Streaming stopped successfully" << std::endl;
+        return true;
 
-                streaming_.store(true);
+    } catch (const std::exception& e) {
+        lastError_ = {.code = -32,
+                      .message = "Error stopping streaming: " + std::string(e.what()),
+                      .details = "Exception during streaming shutdown",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::stopStreaming"};
+        return false;
+    }
+}
 
-                std::cout << "Streaming started successfully" << std::endl;
-                return true;
+StreamingProcessingResult StreamingAudioProcessor::processAudioChunk(
+    const float* audioData, size_t sampleCount, bool enableRealtimeFeedback) {
+    // Capture stage: runs on the caller's (audio) thread. It mixes the interleaved chunk
+    // down to mono, cuts it into bufferSize frames and hands them to the VAD stage; the
+    // remainder waits for the next chunk. While streaming it returns as soon as the frames
+    // are queued and results arrive through the callbacks.
+    auto startTime = std::chrono::steady_clock::now();
+
+    StreamingProcessingResult result = {};
+    result.timestamp =
+        std::chrono::duration_cast<std::chrono::microseconds>(startTime.time_since_epoch())
+            .count();
+
+    if (!initialized_.load() || !vadStage_ || !audioData) {
+        result.errorCode = -40;
+        result.errorMessage = "Processor not initialized or no audio supplied";
+        return result;
+    }
 
-            } catch (const std::exception& e) {
-                lastError_ = {.code = -31,
-                              .message = "Failed to start streaming: " + std::string(e.what()),
-                              .details = "Exception during streaming startup",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::startStreaming"};
-
-                streaming_.store(false);
-                return false;
+    const bool threaded = streaming_.load();
+    const size_t channels = std::max<size_t>(config_.channels, 1);
+    const size_t frameSamples = config_.bufferSize;
+    const size_t inputFrames = sampleCount / channels;
+    size_t consumed = 0;
+    while (consumed < inputFrames) {
+        const size_t take = std::min(frameSamples - captureBuffer_.size(), inputFrames - consumed);
+        const float* interleaved = audioData + consumed * channels;
+        for (size_t i = 0; i < take; ++i) {
+            float mixed = 0.0f;
+            for (size_t channel = 0; channel < channels; ++channel) {
+                mixed += interleaved[i * channels + channel];
             }
+            captureBuffer_.push_back(mixed / static_cast<float>(channels));
+        }
+        consumed += take;
+        if (captureBuffer_.size() < frameSamples) {
+            break;
         }
 
-        bool StreamingAudioProcessor::stopStreaming() {
-            if (!streaming_.load()) {
-                // Already stopped
-                return true;
-            }
-
-            try {
-                // TODO: Signal processing thread to stop
-                shouldStop_.store(true);
-                processingCondition_.notify_all();
+        StreamingFrame frame;
+        auto handle = threaded ? framePool_->tryAcquireFor(std::chrono::milliseconds(0))
+                               : framePool_->acquire();
+        if (!handle) {
+            // Every frame is in flight: the pipeline is saturated
+            captureDrops_.fetch_add(1, std::memory_order_relaxed);
+            captureBuffer_.clear();
+            result.errorCode = -42;
+            result.errorMessage = "Pipeline saturated - frame dropped";
+            continue;
+        }
 
-                // TODO: Wait for processing thread to finish
-                if (processingThread_ && processingThread_->joinable()) {
-                    processingThread_->join();
-                }
-                processingThread_.reset();
+        frame.samples = std::move(*handle);
+        std::copy(captureBuffer_.begin(),
+                  captureBuffer_.end(),
+                  frame.samples.data().begin());
+        frame.sampleCount = captureBuffer_.size();
+        frame.inputSamples = captureBuffer_.size() * channels;
+        captureBuffer_.clear();
+        frame.realtimeFeedback = enableRealtimeFeedback;
+        frame.captured = startTime;
+        frame.result.timestamp = result.timestamp;
+        frame.result.sequenceNumber = sequenceCounter_.fetch_add(1);
+        result.sequenceNumber = frame.result.sequenceNumber;
+
+        if (!vadStage_->submit(frame)) {
+            result.errorCode = -42;
+            result.errorMessage = "Pipeline saturated - frame dropped";
+        } else if (!threaded) {
+            // Inline mode: the stages ran to completion inside submit()
+            result = frame.result;
+        }
+    }
 
-                streaming_.store(false);
+    result.processingLatency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    return result;
+}
 
-                std::cout << "Streaming stopped successfully" << std::endl;
-                return true;
+bool StreamingAudioProcessor::isStreaming() const {
+    return streaming_.load();
+}
 
-            } catch (const std::exception& e) {
-                lastError_ = {.code = -32,
-                              .message = "Error stopping streaming: " + std::string(e.what()),
-                              .details = "Exception during streaming shutdown",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::stopStreaming"};
-                return false;
-            }
-        }
+// TODO 2.4.21: Voice Activity Detection Integration
+// -------------------------------------------------
+/**
+ * TODO: Implement comprehensive VAD integration with:
+ * [ ] Dynamic VAD configuration with parameter validation
+ * [ ] Real-time VAD status monitoring with callback support
+ * [ ] VAD algorithm selection with performance optimization
+ * [ ] Context-aware VAD processing with environmental adaptation
+ * [ ] VAD performance metrics with accuracy measurement
+ * [ ] Integration with audio preprocessing for improved accuracy
+ * [ ] Multi-algorithm VAD with ensemble decision making
+ * [ ] VAD calibration with user-specific training data
+ * [ ] Error handling with fallback mechanisms
+ * [ ] Performance optimization with SIMD instructions
+ */
+bool StreamingAudioProcessor::configureVAD(float threshold, uint32_t hangTime, bool enabled) {
+    if (threshold < 0.0f || threshold > 1.0f || hangTime > 10000) {
+        lastError_ = {.code = -51,
+                      .message = "Failed to update VAD parameters",
+                      .details = "Threshold must be within [0, 1] and hang time at most 10 s",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::configureVAD"};
+        return false;
+    }
 
-        StreamingProcessingResult StreamingAudioProcessor::processAudioChunk(
-            const float* audioData, size_t sampleCount, bool enableRealtimeFeedback) {
-            auto startTime = std::chrono::high_resolution_clock::now();
+    StreamingConfig config;
+    {
+        std::lock_guard<std::mutex> lock(configMutex_);
+        config_.enableVAD = enabled;
+        config_.vadThreshold = threshold;
+        config_.vadHangTime = hangTime;
+        config = config_;
+    }
 
-            StreamingProcessingResult result = {};
-            result.timestamp =
-                std::chrono::duration_cast<std::chrono::microseconds>(startTime.time_since_epoch())
-                    .count();
+    // Detector thresholds are fixed at construction, so a new detector replaces the old one
+    std::lock_guard<std::mutex> analysisLock(analysisMutex_);
+    vadDetector_.reset();
+    if (enabled && !createVoiceActivityDetector(config)) {
+        lastError_ = {.code = -50,
+                      .message = "Failed to initialize VAD detector",
+                      .details = "VAD detector initialization failed during configuration",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::configureVAD"};
+        return false;
+    }
 
-            if (!initialized_.load() || !audioEngine_) {
-                result.errorCode = -40;
-                result.errorMessage = "Processor not initialized or engine unavailable";
-                return result;
-            }
+    std::cout << "VAD configured: enabled=" << enabled << ", threshold=" << threshold
+              << ", hangTime=" << hangTime << "ms" << std::endl;
 
-            try {
-                // TODO: Write audio data to circular buffer
-                size_t samplesWritten = inputBuffer_->write(audioData, sampleCount);
-                if (samplesWritten < sampleCount) {
-                    // Buffer overflow - log but continue processing
-                    std::lock_guard<std::mutex> lock(performanceMutex_);
-                    performanceMetrics_.bufferOverflows++;
-                }
+    return true;
+}
 
-                // TODO: Process audio chunk with engine
-                AudioBuffer chunkBuffer;
-                // TODO: Create AudioBuffer from input data
-                // This requires implementing AudioBuffer construction from raw data
-
-                // TODO: Perform similarity analysis
-                // float similarity = audioEngine_->calculateSimilarity(chunkBuffer);
-                float similarity = 0.75f;  // Placeholder
-
-                // TODO: Update result with similarity analysis
-                result.overallSimilarity = similarity;
-                result.confidence = 0.9f;                        // Placeholder
-                result.mfccSimilarity = similarity * 0.9f;       // Placeholder
-                result.volumeSimilarity = similarity * 1.1f;     // Placeholder
-                result.timingSimilarity = similarity * 0.95f;    // Placeholder
-                result.pitchSimilarity = similarity * 1.05f;     // Placeholder
-                result.spectralSimilarity = similarity * 0.98f;  // Placeholder
-
-                // TODO: Voice Activity Detection
-                if (vadDetector_) {
-                    float vadProbability, vadConfidence;
-                    AudioBuffer vadBuffer;  // TODO: Create from chunk data
-                    bool voiceDetected =
-                        vadDetector_->processBuffer(vadBuffer, vadProbability, vadConfidence);
-
-                    result.voiceActivityDetected = voiceDetected;
-                    result.vadProbability = vadProbability;
-
-                    // TODO: Trigger VAD callback if enabled
-                    if (vadCallback_) {
-                        vadCallback_(voiceDetected, vadProbability);
-                    }
-                }
+StreamingAudioProcessor::VADStatus StreamingAudioProcessor::getVADStatus() const {
+    std::lock_guard<std::mutex> lock(analysisMutex_);
+    VADStatus status = vadStatus_;
+    status.isEnabled = vadDetector_ != nullptr;
+    return status;
+}
 
-                // TODO: Quality Assessment
-                if (qualityAssessor_) {
-                    AudioBuffer qualityBuffer;  // TODO: Create from chunk data
-                    auto qualityMetrics = qualityAssessor_->assessQuality(qualityBuffer);
+// TODO 2.4.22: Quality Assessment Integration
+// ------------------------------------------
+/**
+ * TODO: Implement comprehensive quality assessment integration with:
+ * [ ] Dynamic quality assessment control with parameter validation
+ * [ ] Real-time quality monitoring with trend analysis
+ * [ ] Quality-based feedback with actionable recommendations
+ * [ ] Multi-domain quality metrics with perceptual modeling
+ * [ ] Quality prediction with machine learning models
+ * [ ] Adaptive quality enhancement with real-time processing
+ * [ ] Quality reporting with user-friendly explanations
+ * [ ] Performance-quality trade-off optimization
+ * [ ] Integration with audio processing pipeline
+ * [ ] Error handling with graceful degradation
+ */
+bool StreamingAudioProcessor::enableQualityAssessment(bool enabled, float threshold) {
+    if (threshold < 0.0f || threshold > 1.0f) {
+        lastError_ = {.code = -61,
+                      .message = "Invalid quality threshold",
+                      .details = "Quality threshold must be between 0.0 and 1.0",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::enableQualityAssessment"};
+        return false;
+    }
 
-                    result.signalToNoiseRatio = qualityMetrics.signalToNoiseRatio;
-                    result.totalHarmonicDistortion = qualityMetrics.totalHarmonicDistortion;
-                    result.clippingLevel = qualityMetrics.clippingLevel;
-                    result.isClipping = qualityMetrics.clippingLevel > 0.95f;
+    StreamingConfig config;
+    {
+        std::lock_guard<std::mutex> lock(configMutex_);
+        config_.enableQualityAssessment = enabled;
+        config_.qualityThreshold = threshold;
+        config = config_;
+    }
 
-                    // TODO: Trigger quality callback if enabled
-                    if (qualityCallback_) {
-                        qualityCallback_(qualityMetrics);
-                    }
-                }
+    std::lock_guard<std::mutex> analysisLock(analysisMutex_);
+    if (!enabled) {
+        qualityAssessor_.reset();
+    } else if (!qualityAssessor_ && !createQualityAssessor(config)) {
+        lastError_ = {.code = -60,
+                      .message = "Failed to initialize quality assessor",
+                      .details = "Quality assessor initialization failed",
+                      .timestamp = std::chrono::steady_clock::now(),
+                      .component = "StreamingAudioProcessor::enableQualityAssessment"};
+        return false;
+    }
 
-                // TODO: Calculate processing latency
-                auto endTime = std::chrono::high_resolution_clock::now();
-                result.processingLatency =
-                    std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    std::cout << "Quality assessment configured: enabled=" << enabled
+              << ", threshold=" << threshold << std::endl;
 
-                // TODO: Update performance metrics
-                updatePerformanceMetrics();
+    return true;
+}
 
-                // TODO: Set sequence number
-                static std::atomic<uint32_t> sequenceCounter{0};
-                result.sequenceNumber = sequenceCounter.fetch_add(1);
+QualityMetrics StreamingAudioProcessor::getCurrentQuality() const {
+    // Metrics of the latest frame the VAD stage assessed; default until one has been
+    std::lock_guard<std::mutex> lock(analysisMutex_);
+    return currentQuality_;
+}
 
-                // TODO: Trigger processing callback if enabled
-                if (processingCallback_ && enableRealtimeFeedback) {
-                    processingCallback_(result);
-                }
+std::vector<std::string> StreamingAudioProcessor::getQualityRecommendations() const {
+    std::lock_guard<std::mutex> lock(analysisMutex_);
 
-                result.errorCode = 0;  // Success
+    if (!qualityAssessor_) {
+        return {"Enable quality assessment for detailed recommendations"};
+    }
+    if (!qualityAssessed_) {
+        return {"No recent quality assessment available"};
+    }
+    return qualityAssessor_->generateRecommendations(currentQuality_);
+}
 
-            } catch (const std::exception& e) {
-                result.errorCode = -41;
-                result.errorMessage =
-                    "Exception during audio chunk processing: " + std::string(e.what());
-                result.debugInfo = "processAudioChunk failed with exception";
-
-                // TODO: Update error callback
-                if (errorCallback_) {
-                    errorCallback_(result.errorCode, result.errorMessage);
-                }
-            }
+// TODO 2.4.23: Performance Monitoring and Optimization
+// ----------------------------------------------------
+/**
+ * TODO: Implement comprehensive performance monitoring with:
+ * [ ] Real-time performance metrics collection with minimal overhead
+ * [ ] Adaptive performance optimization with quality trade-offs
+ * [ ] Performance trend analysis with predictive capabilities
+ * [ ] Resource usage monitoring with memory and CPU tracking
+ * [ ] Bottleneck identification with detailed profiling
+ * [ ] Performance regression detection with alerting
+ * [ ] Platform-specific optimizations with capability detection
+ * [ ] Multi-threading performance optimization
+ * [ ] Cache optimization with memory locality improvements
+ * [ ] Performance reporting with actionable insights
+ */
+StreamingAudioProcessor::PerformanceMetrics StreamingAudioProcessor::getPerformanceMetrics()
+    const {
+    PerformanceMetrics metrics;
+    {
+        std::lock_guard<std::mutex> lock(performanceMutex_);
+        metrics = performanceMetrics_;
+    }
 
-            return result;
-        }
+    // Backpressure drops are counted lock-free by the capture and VAD stages
+    metrics.framesDropped = captureDrops_.load(std::memory_order_relaxed);
+    for (const auto& stage : getStageMetrics()) {
+        metrics.framesDropped += stage.dropped;
+    }
+    metrics.bufferOverflows += static_cast<uint32_t>(metrics.framesDropped);
+    return metrics;
+}
 
-        bool StreamingAudioProcessor::isStreaming() const {
-            return streaming_.load();
+std::vector<StageMetrics> StreamingAudioProcessor::getStageMetrics() const {
+    std::vector<StageMetrics> metrics;
+    for (const auto* stage :
+         {&vadStage_, &featureStage_, &scoringStage_, &callbackStage_}) {
+        if (*stage) {
+            metrics.push_back((*stage)->metrics());
         }
+    }
+    return metrics;
+}
 
-        // TODO 2.4.21: Voice Activity Detection Integration
-        // -------------------------------------------------
-        /**
-         * TODO: Implement comprehensive VAD integration with:
-         * [ ] Dynamic VAD configuration with parameter validation
-         * [ ] Real-time VAD status monitoring with callback support
-         * [ ] VAD algorithm selection with performance optimization
-         * [ ] Context-aware VAD processing with environmental adaptation
-         * [ ] VAD performance metrics with accuracy measurement
-         * [ ] Integration with audio preprocessing for improved accuracy
-         * [ ] Multi-algorithm VAD with ensemble decision making
-         * [ ] VAD calibration with user-specific training data
-         * [ ] Error handling with fallback mechanisms
-         * [ ] Performance optimization with SIMD instructions
-         */
-        bool StreamingAudioProcessor::configureVAD(
-            float threshold, uint32_t hangTime, bool enabled) {
-            if (!vadDetector_) {
-                if (enabled) {
-                    // TODO: Create VAD detector if it doesn't exist
-                    vadDetector_ = std::make_unique<VoiceActivityDetector>();
-                    if (!vadDetector_->initialize(config_)) {
-                        lastError_ = {.code = -50,
-                                      .message = "Failed to initialize VAD detector",
-                                      .details =
-                                          "VAD detector initialization failed during configuration",
-                                      .timestamp = std::chrono::steady_clock::now(),
-                                      .component = "StreamingAudioProcessor::configureVAD"};
-                        return false;
-                    }
-                } else {
-                    // VAD not enabled, nothing to configure
-                    return true;
-                }
-            }
-
-            // TODO: Update VAD parameters
-            bool result = vadDetector_->updateParameters(threshold, hangTime);
-            if (!result) {
-                lastError_ = {.code = -51,
-                              .message = "Failed to update VAD parameters",
-                              .details = "VAD parameter update failed",
-                              .timestamp = std::chrono::steady_clock::now(),
-                              .component = "StreamingAudioProcessor::configureVAD"};
-                return false;
-            }
-
-            // TODO: Update configuration
-            std::lock_guard<std::mutex> lock(configMutex_);
-            config_.enableVAD = enabled;
-            config_.vadThreshold = threshold;
-            config_.vadHangTime = hangTime;
+bool StreamingAudioProcessor::optimizePerformance() {
+    // TODO: Implement adaptive performance optimization
 
-            std::cout << "VAD configured: enabled=" << enabled << ", threshold=" << threshold
-                      << ", hangTime=" << hangTime << "ms" << std::endl;
+    std::lock_guard<std::mutex> lock(performanceMutex_);
 
-            return true;
-        }
+    // TODO: Analyze current performance metrics
+    float currentLatency = performanceMetrics_.averageProcessingLatency;
+    float targetLatency = static_cast<float>(config_.maxLatencyMs);
 
-        StreamingAudioProcessor::VADStatus StreamingAudioProcessor::getVADStatus() const {
-            VADStatus status = {};
+    if (currentLatency > targetLatency * 1.5f) {
+        // TODO: Apply performance optimizations
+        std::cout << "Applying performance optimizations due to high latency: "
+                  << currentLatency << "ms (target: " << targetLatency << "ms)"
+                  << std::endl;
 
-            if (vadDetector_) {
-                status.isEnabled = config_.enableVAD;
+        // TODO: Reduce quality settings if necessary
+        // TODO: Optimize buffer sizes
+        // TODO: Enable performance mode
 
-                // TODO: Get current VAD statistics
-                auto vadStats = vadDetector_->getStatistics();
-                status.voiceDetected = vadStats.currentProbability > config_.vadThreshold;
-                status.probability = vadStats.currentProbability;
-                status.confidence = vadStats.accuracy;
+        return true;
+    }
 
-                // TODO: Calculate detection and silence durations
-                // This would require tracking state changes over time
-                status.detectionDuration = 0;  // Placeholder
-                status.silenceDuration = 0;    // Placeholder
-            }
+    return false;  // No optimization needed
+}
 
-            return status;
+// TODO 2.4.24: Internal Processing Implementation
+// -----------------------------------------------
+/**
+ * TODO: Implement comprehensive internal processing with:
+ * [ ] Processing thread main loop with precise timing
+ * [ ] Audio data processing with lock-free operations
+ * [ ] Performance metrics updates with atomic operations
+ * [ ] Error handling with comprehensive logging and recovery
+ * [ ] Memory management with garbage collection optimization
+ * [ ] Thread synchronization with minimal latency impact
+ * [ ] Platform-specific optimizations for maximum performance
+ * [ ] Algorithm optimization with SIMD instructions
+ * [ ] Cache optimization with memory locality improvements
+ * [ ] Integration with external libraries and dependencies
+ */
+bool StreamingAudioProcessor::buildPipeline(bool threaded) {
+    stopPipeline();
+
+    const size_t depth = std::max<uint32_t>(config_.stageQueueDepth, 2);
+    const size_t featureWorkers = std::max<uint32_t>(config_.featureWorkers, 1);
+    const auto timeout = std::chrono::milliseconds(config_.backpressureTimeoutMs);
+
+    // Enough frames to fill every queue and keep every worker busy, plus the capturer
+    const size_t frameBytes = static_cast<size_t>(config_.bufferSize) * sizeof(float);
+    const size_t frameCount = 4 * depth + featureWorkers + 4;
+    if (!framePool_ || framePool_->getStats().total_buffers != frameCount
+        || framePool_->getStats().current_memory_usage < frameCount * frameBytes) {
+        auto pool = AudioBufferPool::create(
+            AudioBufferPool::Config{.pool_size = frameCount, .buffer_size = frameBytes});
+        if (!pool) {
+            return false;
         }
+        framePool_ = std::move(*pool);
+    }
+    captureBuffer_.clear();
+    captureBuffer_.reserve(config_.bufferSize);
+
+    // One MFCC extractor per feature worker, so parallel workers never share one
+    const auto mfccSettings = makeMFCCConfig(config_);
+    featureExtractors_.clear();
+    for (size_t i = 0; i < (threaded ? featureWorkers : 1); ++i) {
+        auto extractor = std::make_unique<FeatureExtractor>();
+        extractor->mfcc = std::make_unique<MFCCProcessor>(mfccSettings);
+        extractor->frameSize = mfccSettings.frame_size;
+        extractor->hopSize = std::max<size_t>(config_.hopSize, 1);
+        featureExtractors_.push_back(std::move(extractor));
+    }
 
-        // TODO 2.4.22: Quality Assessment Integration
-        // ------------------------------------------
-        /**
-         * TODO: Implement comprehensive quality assessment integration with:
-         * [ ] Dynamic quality assessment control with parameter validation
-         * [ ] Real-time quality monitoring with trend analysis
-         * [ ] Quality-based feedback with actionable recommendations
-         * [ ] Multi-domain quality metrics with perceptual modeling
-         * [ ] Quality prediction with machine learning models
-         * [ ] Adaptive quality enhancement with real-time processing
-         * [ ] Quality reporting with user-friendly explanations
-         * [ ] Performance-quality trade-off optimization
-         * [ ] Integration with audio processing pipeline
-         * [ ] Error handling with graceful degradation
-         */
-        bool StreamingAudioProcessor::enableQualityAssessment(bool enabled, float threshold) {
-            if (!qualityAssessor_) {
-                if (enabled) {
-                    // TODO: Create quality assessor if it doesn't exist
-                    qualityAssessor_ = std::make_unique<QualityAssessor>();
-                    if (!qualityAssessor_->initialize(config_)) {
-                        lastError_ = {.code = -60,
-                                      .message = "Failed to initialize quality assessor",
-                                      .details = "Quality assessor initialization failed",
-                                      .timestamp = std::chrono::steady_clock::now(),
-                                      .component =
-                                          "StreamingAudioProcessor::enableQualityAssessment"};
-                        return false;
-                    }
-                } else {
-                    // Quality assessment not enabled, nothing to configure
-                    return true;
-                }
+    // A straggling worker can be overtaken by at most this many frames before the
+    // frame it holds is assumed lost; one worker (or inline) keeps frames in order
+    featureOrder_ = 0;
+    nextScoringOrder_ = 0;
+    reorderBuffer_.clear();
+    reorderWindow_ = threaded && featureWorkers > 1 ? featureWorkers + 2 * depth : 0;
+
+    // Stages are built back to front so each handler can forward to the next one.
+    // Only capture -> VAD applies the configured policy; later stages block so a
+    // frame that got in is not silently lost mid-pipeline.
+    auto stageConfig = [&](const char* name, size_t workers, BackpressurePolicy policy) {
+        return Stage::Config{.name = name,
+                             .queueDepth = depth,
+                             .workers = threaded ? workers : 0,
+                             .policy = policy,
+                             .blockTimeout = timeout};
+    };
+    // Errors are reported here and rethrown so the stage counts them
+    auto guarded = [this](void (StreamingAudioProcessor::*run)(StreamingFrame&)) {
+        return [this, run](StreamingFrame& frame) {
+            try {
+                (this->*run)(frame);
+            } catch (const std::exception& e) {
+                handleProcessingError(e);
+                throw;
             }
+        };
+    };
+    callbackStage_ =
+        std::make_unique<Stage>(stageConfig("callbacks", 1, BackpressurePolicy::Block),
+                                guarded(&StreamingAudioProcessor::runCallbackStage));
+    scoringStage_ =
+        std::make_unique<Stage>(stageConfig("scoring", 1, BackpressurePolicy::Block),
+                                guarded(&StreamingAudioProcessor::runScoringStage));
+    featureStage_ = std::make_unique<Stage>(
+        stageConfig("features", featureWorkers, BackpressurePolicy::Block),
+        guarded(&StreamingAudioProcessor::runFeatureStage));
+    vadStage_ = std::make_unique<Stage>(stageConfig("vad", 1, config_.backpressurePolicy),
+                                        guarded(&StreamingAudioProcessor::runVADStage));
+
+    if (threaded) {
+        callbackStage_->start();
+        scoringStage_->start();
+        featureStage_->start();
+        vadStage_->start();
+    }
+    return true;
+}
 
-            // TODO: Update configuration
-            std::lock_guard<std::mutex> lock(configMutex_);
-            config_.enableQualityAssessment = enabled;
-            config_.qualityThreshold = threshold;
+void StreamingAudioProcessor::stopPipeline() {
+    // Front to back, so each stage drains into a consumer that is still running
+    for (auto* stage : {&vadStage_, &featureStage_, &scoringStage_}) {
+        if (*stage) {
+            (*stage)->stop();
+        }
+    }
+    if (callbackStage_) {
+        drainReorderBuffer();
+        callbackStage_->stop();
+    }
+    vadStage_.reset();
+    featureStage_.reset();
+    scoringStage_.reset();
+    callbackStage_.reset();
+}
 
-            std::cout << "Quality assessment configured: enabled=" << enabled
-                      << ", threshold=" << threshold << std::endl;
+bool StreamingAudioProcessor::createVoiceActivityDetector(const StreamingConfig& config) {
+    vadDetector_ = std::make_unique<VoiceActivityDetector>(makeVADConfig(config));
+    vadWindowSamples_ = std::max<size_t>(
+        1, static_cast<size_t>(config.sampleRate) * kVADWindow.count() / 1000);
+    vadThreshold_ = config.vadThreshold;
+    vadCarry_.clear();
+    vadCarry_.reserve(config.bufferSize + vadWindowSamples_);
+    vadStatus_ = {};
+    return true;
+}
 
-            return true;
-        }
+bool StreamingAudioProcessor::createQualityAssessor(const StreamingConfig& config) {
+    auto assessor = std::make_unique<QualityAssessor>();
+    if (!assessor->initialize(makeQualityConfig(config))) {
+        return false;
+    }
+    qualityAssessor_ = std::move(assessor);
+    currentQuality_ = {};
+    qualityAssessed_ = false;
+    return true;
+}
 
-        QualityAssessor::QualityMetrics StreamingAudioProcessor::getCurrentQuality() const {
-            QualityAssessor::QualityMetrics metrics = {};
-
-            if (qualityAssessor_ && initialized_.load()) {
-                // Get current quality metrics from the assessor based on recent audio analysis
-                // This implementation provides real-time quality assessment based on processed
-                // audio
-
-                try {
-                    // Calculate quality metrics from current audio buffer and processing state
-                    float bufferUtilization =
-                        static_cast<float>(performanceMetrics_.bufferUtilization);
-                    float signalLevel =
-                        performanceMetrics_.averageLatency > 0
-                            ? 1.0f / static_cast<float>(performanceMetrics_.averageLatency)
-                            : 0.0f;
-
-                    // Derive comprehensive quality metrics from system performance
-                    metrics.overallQuality =
-                        std::clamp(0.9f - (bufferUtilization * 0.2f), 0.0f, 1.0f);
-                    metrics.signalToNoiseRatio =
-                        20.0f + (signalLevel * 15.0f);  // Estimated SNR in dB
-                    metrics.totalHarmonicDistortion =
-                        std::max(0.05f, bufferUtilization * 0.15f);  // THD percentage
-                    metrics.frequencyResponseScore =
-                        std::clamp(0.95f - (performanceMetrics_.droppedFrames * 0.01f), 0.7f, 1.0f);
-                    metrics.dynamicRangeScore =
-                        std::clamp(0.9f - (performanceMetrics_.cpuUsage * 0.001f), 0.6f, 1.0f);
-                    metrics.perceptualQuality =
-                        (metrics.overallQuality + metrics.frequencyResponseScore) * 0.5f;
-                    metrics.clippingLevel =
-                        performanceMetrics_.droppedFrames > 0
-                            ? static_cast<float>(performanceMetrics_.droppedFrames) * 0.001f
-                            : 0.0f;
-                    metrics.backgroundNoiseLevel =
-                        -45.0f + (signalLevel * 5.0f);  // Estimated noise floor in dB
-
-                } catch (const std::exception& e) {
-                    // Fallback to conservative quality estimates on calculation error
-                    metrics.overallQuality = 0.7f;
-                    metrics.signalToNoiseRatio = 20.0f;
-                    metrics.totalHarmonicDistortion = 0.2f;
-                    metrics.frequencyResponseScore = 0.8f;
-                    metrics.dynamicRangeScore = 0.75f;
-                    metrics.perceptualQuality = 0.7f;
-                    metrics.clippingLevel = 0.05f;
-                    metrics.backgroundNoiseLevel = -35.0f;
+void StreamingAudioProcessor::runVADStage(StreamingFrame& frame) {
+    const std::span<const float> samples(frame.samples.data().data(), frame.sampleCount);
+    StreamingProcessingResult& result = frame.result;
+
+    // Both analyses carry state from one frame to the next, so they run here, in order
+    {
+        std::lock_guard<std::mutex> lock(analysisMutex_);
+        if (vadDetector_) {
+            // Whole windows only; the remainder is carried into the next frame
+            vadCarry_.insert(vadCarry_.end(), samples.begin(), samples.end());
+            const std::span<const float> pending(vadCarry_);
+            float energy = 0.0f;
+            size_t offset = 0;
+            for (; offset + vadWindowSamples_ <= pending.size(); offset += vadWindowSamples_) {
+                auto window = vadDetector_->processWindow(pending.subspan(offset, vadWindowSamples_));
+                if (!window) {
+                    continue;
                 }
-            } else {
-                // Return default metrics when quality assessor is not available
-                metrics.overallQuality = 0.5f;
-                metrics.signalToNoiseRatio = 15.0f;
-                metrics.totalHarmonicDistortion = 0.3f;
-                metrics.frequencyResponseScore = 0.6f;
-                metrics.dynamicRangeScore = 0.6f;
-                metrics.perceptualQuality = 0.5f;
-                metrics.clippingLevel = 0.1f;
-                metrics.backgroundNoiseLevel = -30.0f;
+                energy = std::max(energy, window->energy_level);
+                vadStatus_.silenceDuration =
+                    window->is_active
+                        ? 0
+                        : vadStatus_.silenceDuration + static_cast<uint32_t>(kVADWindow.count());
             }
-
-            return metrics;
+            vadCarry_.erase(vadCarry_.begin(), vadCarry_.begin() + offset);
+
+            const float probability = vadProbability(energy);
+            vadStatus_.voiceDetected = vadDetector_->isVoiceActive();
+            vadStatus_.probability = probability;
+            vadStatus_.confidence =
+                std::min(1.0f,
+                         std::abs(probability - vadThreshold_)
+                             / std::max(vadThreshold_, 1.0f - vadThreshold_));
+            vadStatus_.detectionDuration =
+                static_cast<uint32_t>(vadDetector_->getActiveDuration().count());
+
+            result.voiceActivityDetected = vadStatus_.voiceDetected;
+            result.vadProbability = probability;
         }
 
-        std::vector<std::string> StreamingAudioProcessor::getQualityRecommendations() const {
-            std::vector<std::string> recommendations;
-
-            if (qualityAssessor_) {
-                // TODO: Get quality-based recommendations from the assessor
-                recommendations = qualityAssessor_->getQualityRecommendations();
-            } else {
-                recommendations.push_back("Enable quality assessment for detailed recommendations");
+        if (qualityAssessor_) {
+            QualityMetrics metrics = {};
+            if (qualityAssessor_->assessQualityRealtime(samples.data(), samples.size(), metrics)) {
+                result.signalToNoiseRatio = metrics.signalToNoiseRatio;
+                result.totalHarmonicDistortion = metrics.totalHarmonicDistortion;
+                result.clippingLevel = metrics.clippingLevel;
+                result.isClipping = metrics.isClipping;
+                result.speechQuality = metrics.overallQuality;
+                currentQuality_ = std::move(metrics);
+                qualityAssessed_ = true;
             }
+        }
+    }
+    // Only frames the feature stage accepted are numbered, so a drop here leaves no gap
+    frame.order = featureOrder_;
+    if (featureStage_->submit(frame)) {
+        ++featureOrder_;
+    }
+}
 
-            return recommendations;
+void StreamingAudioProcessor::runFeatureStage(StreamingFrame& frame) {
+    // Level features straight from the pooled samples
+    const std::span<const float> samples(frame.samples.data().data(), frame.sampleCount);
+    float peak = 0.0f;
+    float sum = 0.0f;
+    for (const float sample : samples) {
+        peak = std::max(peak, std::abs(sample));
+        sum += std::abs(sample);
+    }
+    frame.level = samples.empty() ? 0.0f : sum / static_cast<float>(samples.size());
+    frame.result.clippingLevel = std::max(frame.result.clippingLevel, peak);
+    frame.result.isClipping = frame.result.isClipping || peak > 0.95f;
+
+    // Any idle extractor will do; there are as many as there are workers
+    std::unique_lock<std::mutex> lock;
+    FeatureExtractor* extractor = nullptr;
+    for (const auto& candidate : featureExtractors_) {
+        lock = std::unique_lock<std::mutex>(candidate->mutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            extractor = candidate.get();
+            break;
         }
+    }
+    if (!extractor) {
+        extractor = featureExtractors_.front().get();
+        lock = std::unique_lock<std::mutex>(extractor->mutex);
+    }
 
-        // TODO 2.4.23: Performance Monitoring and Optimization
-        // ----------------------------------------------------
-        /**
-         * TODO: Implement comprehensive performance monitoring with:
-         * [ ] Real-time performance metrics collection with minimal overhead
-         * [ ] Adaptive performance optimization with quality trade-offs
-         * [ ] Performance trend analysis with predictive capabilities
-         * [ ] Resource usage monitoring with memory and CPU tracking
-         * [ ] Bottleneck identification with detailed profiling
-         * [ ] Performance regression detection with alerting
-         * [ ] Platform-specific optimizations with capability detection
-         * [ ] Multi-threading performance optimization
-         * [ ] Cache optimization with memory locality improvements
-         * [ ] Performance reporting with actionable insights
-         */
-        StreamingAudioProcessor::PerformanceMetrics StreamingAudioProcessor::getPerformanceMetrics()
-            const {
-            std::lock_guard<std::mutex> lock(performanceMutex_);
-            return performanceMetrics_;
+    if (samples.size() >= extractor->frameSize) {
+        auto features = extractor->mfcc->extractFeaturesFromBuffer(samples, extractor->hopSize);
+        if (features) {
+            frame.features = std::move(*features);
         }
+    }
+    lock.unlock();
+    scoringStage_->submit(frame);
+}
 
-        bool StreamingAudioProcessor::optimizePerformance() {
-            // TODO: Implement adaptive performance optimization
+void StreamingAudioProcessor::runScoringStage(StreamingFrame& frame) {
+    if (reorderWindow_ == 0) {
+        scoreFrame(frame, true);
+        callbackStage_->submit(frame);
+        return;
+    }
 
-            std::lock_guard<std::mutex> lock(performanceMutex_);
+    // DTW compares feature sequences, so frames are scored in the order they were captured
+    if (frame.order < nextScoringOrder_) {
+        // Its place was given up as lost; its features would land out of sequence
+        scoreFrame(frame, false);
+        callbackStage_->submit(frame);
+        return;
+    }
+    reorderBuffer_.emplace(frame.order, std::move(frame));
+    if (reorderBuffer_.size() > reorderWindow_) {
+        nextScoringOrder_ = reorderBuffer_.begin()->first;  // A frame failed upstream
+    }
+    while (!reorderBuffer_.empty() && reorderBuffer_.begin()->first == nextScoringOrder_) {
+        auto next = reorderBuffer_.extract(reorderBuffer_.begin());
+        scoreFrame(next.mapped(), true);
+        callbackStage_->submit(next.mapped());
+        ++nextScoringOrder_;
+    }
+}
 
-            // TODO: Analyze current performance metrics
-            float currentLatency = performanceMetrics_.averageProcessingLatency;
-            float targetLatency = static_cast<float>(config_.maxLatencyMs);
+void StreamingAudioProcessor::drainReorderBuffer() {
+    // Frames still parked behind a lost one when the pipeline stops
+    for (auto& [order, frame] : reorderBuffer_) {
+        scoreFrame(frame, true);
+        callbackStage_->submit(frame);
+    }
+    reorderBuffer_.clear();
+}
 
-            if (currentLatency > targetLatency * 1.5f) {
-                // TODO: Apply performance optimizations
-                std::cout << "Applying performance optimizations due to high latency: "
-                          << currentLatency << "ms (target: " << targetLatency << "ms)"
-                          << std::endl;
+void StreamingAudioProcessor::scoreFrame(StreamingFrame& frame, bool inOrder) {
+    StreamingProcessingResult& result = frame.result;
+    {
+        std::lock_guard<std::mutex> lock(masterAudioMutex_);
+        recentLevel_ =
+            recentLevel_ > 0.0f ? 0.8f * recentLevel_ + 0.2f * frame.level : frame.level;
+
+        // The latest stretch of features, as long as the master, is compared with DTW the
+        // same way UnifiedAudioEngine scores a session
+        if (masterInfo_.isLoaded && inOrder) {
+            recentFeatures_.insert(recentFeatures_.end(),
+                                   std::make_move_iterator(frame.features.begin()),
+                                   std::make_move_iterator(frame.features.end()));
+            if (recentFeatures_.size() > masterFeatures_.size()) {
+                recentFeatures_.erase(recentFeatures_.begin(),
+                                      recentFeatures_.end() - masterFeatures_.size());
+            }
+        }
+        if (masterInfo_.isLoaded && !recentFeatures_.empty()) {
+            const float distance = dtwComparator_->compare(masterFeatures_, recentFeatures_);
+            const float similarity = 1.0f / (1.0f + distance);
+            const float reference = masterInfo_.averageLevel * masterVolume_;
+
+            result.overallSimilarity = similarity;
+            result.mfccSimilarity = similarity;
+            result.volumeSimilarity =
+                reference > 0.0f && recentLevel_ > 0.0f
+                    ? std::min(reference, recentLevel_) / std::max(reference, recentLevel_)
+                    : 0.0f;
+            result.confidence = static_cast<float>(recentFeatures_.size())
+                                / static_cast<float>(masterFeatures_.size());
+        }
+    }
+    result.memoryUsed = frame.sampleCount * sizeof(float);
+}
 
-                // TODO: Reduce quality settings if necessary
-                // TODO: Optimize buffer sizes
-                // TODO: Enable performance mode
+void StreamingAudioProcessor::runCallbackStage(StreamingFrame& frame) {
+    StreamingProcessingResult& result = frame.result;
+    result.processingLatency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - frame.captured);
+    result.errorCode = 0;  // Success
+
+    {
+        std::lock_guard<std::mutex> lock(performanceMutex_);
+        performanceMetrics_.totalSamplesProcessed += frame.inputSamples;
+        const float latencyMs = result.processingLatency.count() / 1000.0f;
+        performanceMetrics_.averageProcessingLatency =
+            (performanceMetrics_.averageProcessingLatency * 0.9f) + (latencyMs * 0.1f);
+        performanceMetrics_.maxProcessingLatency =
+            std::max(performanceMetrics_.maxProcessingLatency, latencyMs);
+    }
+    updatePerformanceMetrics();
 
-                return true;
-            }
+    // Only this stage touches the callbacks, so the lock is contended by setters only
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    if (vadCallback_ && config_.enableVAD) {
+        vadCallback_(result.voiceActivityDetected, result.vadProbability);
+    }
+    if (qualityCallback_ && config_.enableQualityAssessment) {
+        QualityMetrics qualityMetrics = {};
+        qualityMetrics.overallQuality = result.speechQuality;
+        qualityMetrics.signalToNoiseRatio = result.signalToNoiseRatio;
+        qualityMetrics.totalHarmonicDistortion = result.totalHarmonicDistortion;
+        qualityMetrics.clippingLevel = result.clippingLevel;
+        qualityCallback_(qualityMetrics);
+    }
+    if (processingCallback_ && frame.realtimeFeedback) {
+        processingCallback_(result);
+    }
 
-            return false;  // No optimization needed
-        }
+    // Return the samples to the pool before the frame slot is reused
+    frame.samples = AudioBufferPool::BufferHandle{};
+}
 
-        // TODO 2.4.24: Internal Processing Implementation
-        // -----------------------------------------------
-        /**
-         * TODO: Implement comprehensive internal processing with:
-         * [ ] Processing thread main loop with precise timing
-         * [ ] Audio data processing with lock-free operations
-         * [ ] Performance metrics updates with atomic operations
-         * [ ] Error handling with comprehensive logging and recovery
-         * [ ] Memory management with garbage collection optimization
-         * [ ] Thread synchronization with minimal latency impact
-         * [ ] Platform-specific optimizations for maximum performance
-         * [ ] Algorithm optimization with SIMD instructions
-         * [ ] Cache optimization with memory locality improvements
-         * [ ] Integration with external libraries and dependencies
-         */
-        void StreamingAudioProcessor::processingThreadFunction() {
-            std::cout << "Processing thread started" << std::endl;
-
-            // TODO: Set thread priority and affinity if supported
-            // Platform-specific code would go here
-
-            auto lastProcessingTime = std::chrono::steady_clock::now();
-            const auto processingInterval = std::chrono::milliseconds(config_.processingIntervalMs);
-
-            while (!shouldStop_.load()) {
-                try {
-                    // TODO: Wait for processing interval or shutdown signal
-                    std::unique_lock<std::mutex> lock(configMutex_);
-                    processingCondition_.wait_for(
-                        lock, processingInterval, [this] { return shouldStop_.load(); });
-
-                    if (shouldStop_.load()) {
-                        break;
-                    }
-
-                    // TODO: Process available audio data
-                    processAudioData();
-
-                    // TODO: Update performance metrics
-                    auto currentTime = std::chrono::steady_clock::now();
-                    auto processingDuration = std::chrono::duration_cast<std::chrono::microseconds>(
-                        currentTime - lastProcessingTime);
-
-                    {
-                        std::lock_guard<std::mutex> perfLock(performanceMutex_);
-                        performanceMetrics_.averageProcessingLatency =
-                            (performanceMetrics_.averageProcessingLatency * 0.9f)
-                            + (processingDuration.count() / 1000.0f * 0.1f);  // Convert to ms
-
-                        performanceMetrics_.maxProcessingLatency =
-                            std::max(performanceMetrics_.maxProcessingLatency,
-                                     static_cast<float>(processingDuration.count() / 1000.0f));
-                    }
-
-                    lastProcessingTime = currentTime;
-
-                } catch (const std::exception& e) {
-                    handleProcessingError(e);
-                }
-            }
+void StreamingAudioProcessor::updatePerformanceMetrics() {
+    std::lock_guard<std::mutex> lock(performanceMutex_);
 
-            std::cout << "Processing thread stopped" << std::endl;
-        }
+    // TODO: Update CPU usage (platform-specific implementation needed)
+    performanceMetrics_.cpuUsage = 0.0f;  // Placeholder
 
-        void StreamingAudioProcessor::processAudioData() {
-            // TODO: Check if there's enough data in the buffer to process
-            auto bufferStatus = inputBuffer_->getStatus();
+    // TODO: Update memory usage (platform-specific implementation needed)
+    performanceMetrics_.memoryUsage = 0;  // Placeholder
 
-            if (bufferStatus.available < config_.bufferSize) {
-                // Not enough data available
-                std::lock_guard<std::mutex> lock(performanceMutex_);
-                performanceMetrics_.bufferUnderflows++;
-                return;
-            }
+    // TODO: Calculate processing efficiency
+    if (performanceMetrics_.maxProcessingLatency > 0) {
+        performanceMetrics_.processingEfficiency =
+            (static_cast<float>(config_.maxLatencyMs)
+             / performanceMetrics_.maxProcessingLatency)
+            * 100.0f;
+        performanceMetrics_.processingEfficiency =
+            std::min(100.0f, performanceMetrics_.processingEfficiency);
+    }
+}
 
-            // TODO: Read audio data from circular buffer
-            std::vector<float> audioData(config_.bufferSize * config_.channels);
-            size_t samplesRead = inputBuffer_->read(audioData.data(), config_.bufferSize);
+void StreamingAudioProcessor::handleProcessingError(const std::exception& e) {
+    lastError_ = {.code = -80,
+                  .message = "Processing thread error: " + std::string(e.what()),
+                  .details = "Exception caught in processing thread",
+                  .timestamp = std::chrono::steady_clock::now(),
+                  .component = "StreamingAudioProcessor::pipeline"};
 
-            if (samplesRead > 0) {
-                // TODO: Process the audio chunk
-                auto result = processAudioChunk(audioData.data(), samplesRead, true);
+    std::cerr << "Processing error: " << lastError_.message << std::endl;
 
-                // TODO: Update total samples processed
-                std::lock_guard<std::mutex> lock(performanceMutex_);
-                performanceMetrics_.totalSamplesProcessed += samplesRead;
-            }
-        }
+    // TODO: Trigger error callback
+    if (errorCallback_) {
+        errorCallback_(lastError_.code, lastError_.message);
+    }
+}
 
-        void StreamingAudioProcessor::updatePerformanceMetrics() {
-            std::lock_guard<std::mutex> lock(performanceMutex_);
+// TODO 2.4.25: Callback and Event System Implementation
+// -----------------------------------------------------
+/**
+ * TODO: Implement comprehensive callback system with:
+ * [ ] Thread-safe callback registration with validation
+ * [ ] Callback removal with proper cleanup and synchronization
+ * [ ] Event triggering with rate limiting and prioritization
+ * [ ] Callback error handling with exception safety
+ * [ ] Performance monitoring for callback execution
+ * [ ] Callback queuing with asynchronous execution
+ * [ ] Custom event creation and management
+ * [ ] Event filtering and subscription management
+ * [ ] Integration with external event systems
+ * [ ] Debugging and profiling support for callbacks
+ */
+void StreamingAudioProcessor::setProcessingCallback(ProcessingCallback callback) {
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    processingCallback_ = callback;
+}
 
-            // TODO: Update CPU usage (platform-specific implementation needed)
-            performanceMetrics_.cpuUsage = 0.0f;  // Placeholder
+void StreamingAudioProcessor::setVADCallback(VADCallback callback) {
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    vadCallback_ = callback;
+}
 
-            // TODO: Update memory usage (platform-specific implementation needed)
-            performanceMetrics_.memoryUsage = 0;  // Placeholder
+void StreamingAudioProcessor::setQualityCallback(QualityCallback callback) {
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    qualityCallback_ = callback;
+}
 
-            // TODO: Calculate processing efficiency
-            if (performanceMetrics_.maxProcessingLatency > 0) {
-                performanceMetrics_.processingEfficiency =
-                    (static_cast<float>(config_.maxLatencyMs)
-                     / performanceMetrics_.maxProcessingLatency)
-                    * 100.0f;
-                performanceMetrics_.processingEfficiency =
-                    std::min(100.0f, performanceMetrics_.processingEfficiency);
-            }
-        }
+void StreamingAudioProcessor::setErrorCallback(ErrorCallback callback) {
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    errorCallback_ = callback;
+}
 
-        void StreamingAudioProcessor::handleProcessingError(const std::exception& e) {
-            lastError_ = {.code = -80,
-                          .message = "Processing thread error: " + std::string(e.what()),
-                          .details = "Exception caught in processing thread",
-                          .timestamp = std::chrono::steady_clock::now(),
-                          .component = "StreamingAudioProcessor::processingThreadFunction"};
+void StreamingAudioProcessor::clearCallbacks() {
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    processingCallback_ = nullptr;
+    vadCallback_ = nullptr;
+    qualityCallback_ = nullptr;
+    errorCallback_ = nullptr;
+}
 
-            std::cerr << "Processing error: " << lastError_.message << std::endl;
+// TODO 2.4.26: Error Handling and Diagnostics Implementation
+// ----------------------------------------------------------
+/**
+ * TODO: Implement comprehensive error handling with:
+ * [ ] Detailed error reporting with context and diagnostic information
+ * [ ] Error categorization with severity levels and recovery options
+ * [ ] Error logging with structured data and searchable metadata
+ * [ ] Error recovery mechanisms with automatic and manual options
+ * [ ] Diagnostic information collection with system state capture
+ * [ ] Performance impact analysis for error handling overhead
+ * [ ] Integration with external error reporting systems
+ * [ ] Error prevention with proactive monitoring and validation
+ * [ ] User-friendly error messages with actionable guidance
+ * [ ] Developer debugging support with detailed stack traces
+ */
+StreamingAudioProcessor::ErrorInfo StreamingAudioProcessor::getLastError() const {
+    return lastError_;
+}
 
-            // TODO: Trigger error callback
-            if (errorCallback_) {
-                errorCallback_(lastError_.code, lastError_.message);
-            }
-        }
+void StreamingAudioProcessor::clearErrors() {
+    lastError_ = {};
+}
 
-        // TODO 2.4.25: Callback and Event System Implementation
-        // -----------------------------------------------------
-        /**
-         * TODO: Implement comprehensive callback system with:
-         * [ ] Thread-safe callback registration with validation
-         * [ ] Callback removal with proper cleanup and synchronization
-         * [ ] Event triggering with rate limiting and prioritization
-         * [ ] Callback error handling with exception safety
-         * [ ] Performance monitoring for callback execution
-         * [ ] Callback queuing with asynchronous execution
-         * [ ] Custom event creation and management
-         * [ ] Event filtering and subscription management
-         * [ ] Integration with external event systems
-         * [ ] Debugging and profiling support for callbacks
-         */
-        void StreamingAudioProcessor::setProcessingCallback(ProcessingCallback callback) {
-            std::lock_guard<std::mutex> lock(callbackMutex_);
-            processingCallback_ = callback;
-        }
+std::string StreamingAudioProcessor::getDiagnosticInfo() const {
+    std::ostringstream oss;
+
+    oss << "StreamingAudioProcessor Diagnostic Information:\n";
+    oss << "Initialized: " << (initialized_.load() ? "Yes" : "No") << "\n";
+    oss << "Streaming: " << (streaming_.load() ? "Yes" : "No") << "\n";
+
+    // TODO: Add configuration information
+    {
+        std::lock_guard<std::mutex> lock(configMutex_);
+        oss << "Configuration:\n";
+        oss << "  Sample Rate: " << config_.sampleRate << " Hz\n";
+        oss << "  Channels: " << config_.channels << "\n";
+        oss << "  Buffer Size: " << config_.bufferSize << " samples\n";
+        oss << "  Max Latency: " << config_.maxLatencyMs << " ms\n";
+        oss << "  VAD Enabled: " << (config_.enableVAD ? "Yes" : "No") << "\n";
+        oss << "  Quality Assessment: " << (config_.enableQualityAssessment ? "Yes" : "No")
+            << "\n";
+    }
 
-        void StreamingAudioProcessor::setVADCallback(VADCallback callback) {
-            std::lock_guard<std::mutex> lock(callbackMutex_);
-            vadCallback_ = callback;
-        }
+    // TODO: Add performance metrics
+    {
+        std::lock_guard<std::mutex> lock(performanceMutex_);
+        oss << "Performance Metrics:\n";
+        oss << "  Average Latency: " << performanceMetrics_.averageProcessingLatency
+            << " ms\n";
+        oss << "  Max Latency: " << performanceMetrics_.maxProcessingLatency << " ms\n";
+        oss << "  CPU Usage: " << performanceMetrics_.cpuUsage << "%\n";
+        oss << "  Memory Usage: " << performanceMetrics_.memoryUsage << " bytes\n";
+        oss << "  Buffer Overflows: " << performanceMetrics_.bufferOverflows << "\n";
+        oss << "  Buffer Underflows: " << performanceMetrics_.bufferUnderflows << "\n";
+        oss << "  Total Samples: " << performanceMetrics_.totalSamplesProcessed << "\n";
+    }
 
-        void StreamingAudioProcessor::setQualityCallback(QualityCallback callback) {
-            std::lock_guard<std::mutex> lock(callbackMutex_);
-            qualityCallback_ = callback;
+    // TODO: Add component status
+    oss << "Components:\n";
+    oss << "  Master Audio: " << (getMasterAudioInfo().isLoaded ? "Loaded" : "Not Loaded")
+        << "\n";
+    {
+        std::lock_guard<std::mutex> lock(analysisMutex_);
+        oss << "  VAD Detector: " << (vadDetector_ ? "Available" : "Not Available") << "\n";
+        oss << "  Quality Assessor: " << (qualityAssessor_ ? "Available" : "Not Available")
+            << "\n";
+    }
+    oss << "  Frame Pool: " << (framePool_ ? "Available" : "Not Available") << "\n";
+
+    // Per-stage queue depth and latency
+    const auto stages = getStageMetrics();
+    if (!stages.empty()) {
+        oss << "Pipeline Stages:\n";
+        for (const auto& stage : stages) {
+            oss << "  " << stage.name << ": depth " << stage.queueDepth << " (max "
+                << stage.maxQueueDepth << "), processed " << stage.processed
+                << ", dropped " << stage.dropped << ", wait " << stage.averageWaitUs
+                << "/" << stage.maxWaitUs << " us, service " << stage.averageServiceUs
+                << "/" << stage.maxServiceUs << " us\n";
         }
+    }
 
-        void StreamingAudioProcessor::setErrorCallback(ErrorCallback callback) {
-            std::lock_guard<std::mutex> lock(callbackMutex_);
-            errorCallback_ = callback;
-        }
+    // TODO: Add error information
+    if (lastError_.code != 0) {
+        oss << "Last Error:\n";
+        oss << "  Code: " << lastError_.code << "\n";
+        oss << "  Message: " << lastError_.message << "\n";
+        oss << "  Component: " << lastError_.component << "\n";
+        oss << "  Details: " << lastError_.details << "\n";
+    }
 
-        void StreamingAudioProcessor::clearCallbacks() {
-            std::lock_guard<std::mutex> lock(callbackMutex_);
-            processingCallback_ = nullptr;
-            vadCallback_ = nullptr;
-            qualityCallback_ = nullptr;
-            errorCallback_ = nullptr;
-        }
+    return oss.str();
+}
 
-        // TODO 2.4.26: Error Handling and Diagnostics Implementation
-        // ----------------------------------------------------------
-        /**
-         * TODO: Implement comprehensive error handling with:
-         * [ ] Detailed error reporting with context and diagnostic information
-         * [ ] Error categorization with severity levels and recovery options
-         * [ ] Error logging with structured data and searchable metadata
-         * [ ] Error recovery mechanisms with automatic and manual options
-         * [ ] Diagnostic information collection with system state capture
-         * [ ] Performance impact analysis for error handling overhead
-         * [ ] Integration with external error reporting systems
-         * [ ] Error prevention with proactive monitoring and validation
-         * [ ] User-friendly error messages with actionable guidance
-         * [ ] Developer debugging support with detailed stack traces
-         */
-        StreamingAudioProcessor::ErrorInfo StreamingAudioProcessor::getLastError() const {
-            return lastError_;
+// TODO 2.4.27: Resource Management and Cleanup Implementation
+// -----------------------------------------------------------
+/**
+ * TODO: Implement comprehensive resource management with:
+ * [ ] Safe shutdown with proper thread termination and resource cleanup
+ * [ ] Memory leak detection and prevention with verification
+ * [ ] Resource tracking with usage monitoring and optimization
+ * [ ] Graceful degradation with error handling and recovery
+ * [ ] State persistence with configuration and data preservation
+ * [ ] Component lifecycle management with proper initialization order
+ * [ ] External resource cleanup with dependency management
+ * [ ] Performance monitoring cleanup with metrics finalization
+ * [ ] Thread synchronization cleanup with deadlock prevention
+ * [ ] Error handling cleanup with proper exception safety
+ */
+void StreamingAudioProcessor::shutdown() {
+    std::cout << "Shutting down StreamingAudioProcessor..." << std::endl;
+
+    try {
+        // TODO: Stop streaming if active
+        if (streaming_.load()) {
+            stopStreaming();
         }
 
-        void StreamingAudioProcessor::clearErrors() {
-            lastError_ = {};
+        // TODO: Clear callbacks to prevent further notifications
+        clearCallbacks();
+
+        // TODO: Clean up components
+        stopPipeline();
+        framePool_.reset();
+        featureExtractors_.clear();
+        dtwComparator_.reset();
+        {
+            std::lock_guard<std::mutex> lock(analysisMutex_);
+            vadDetector_.reset();
+            qualityAssessor_.reset();
         }
 
-        std::string StreamingAudioProcessor::getDiagnosticInfo() const {
-            std::ostringstream oss;
-
-            oss << "StreamingAudioProcessor Diagnostic Information:\n";
-            oss << "Initialized: " << (initialized_.load() ? "Yes" : "No") << "\n";
-            oss << "Streaming: " << (streaming_.load() ? "Yes" : "No") << "\n";
-
-            // TODO: Add configuration information
-            {
-                std::lock_guard<std::mutex> lock(configMutex_);
-                oss << "Configuration:\n";
-                oss << "  Sample Rate: " << config_.sampleRate << " Hz\n";
-                oss << "  Channels: " << config_.channels << "\n";
-                oss << "  Buffer Size: " << config_.bufferSize << " samples\n";
-                oss << "  Max Latency: " << config_.maxLatencyMs << " ms\n";
-                oss << "  VAD Enabled: " << (config_.enableVAD ? "Yes" : "No") << "\n";
-                oss << "  Quality Assessment: " << (config_.enableQualityAssessment ? "Yes" : "No")
-                    << "\n";
-            }
+        // TODO: Reset state
+        initialized_.store(false);
 
-            // TODO: Add performance metrics
-            {
-                std::lock_guard<std::mutex> lock(performanceMutex_);
-                oss << "Performance Metrics:\n";
-                oss << "  Average Latency: " << performanceMetrics_.averageProcessingLatency
-                    << " ms\n";
-                oss << "  Max Latency: " << performanceMetrics_.maxProcessingLatency << " ms\n";
-                oss << "  CPU Usage: " << performanceMetrics_.cpuUsage << "%\n";
-                oss << "  Memory Usage: " << performanceMetrics_.memoryUsage << " bytes\n";
-                oss << "  Buffer Overflows: " << performanceMetrics_.bufferOverflows << "\n";
-                oss << "  Buffer Underflows: " << performanceMetrics_.bufferUnderflows << "\n";
-                oss << "  Total Samples: " << performanceMetrics_.totalSamplesProcessed << "\n";
-            }
+        // TODO: Clear error state
+        clearErrors();
 
-            // TODO: Add component status
-            oss << "Components:\n";
-            oss << "  Audio Engine: " << (audioEngine_ ? "Available" : "Not Available") << "\n";
-            oss << "  VAD Detector: " << (vadDetector_ ? "Available" : "Not Available") << "\n";
-            oss << "  Quality Assessor: " << (qualityAssessor_ ? "Available" : "Not Available")
-                << "\n";
-            oss << "  Input Buffer: " << (inputBuffer_ ? "Available" : "Not Available") << "\n";
-
-            // TODO: Add buffer status if available
-            if (inputBuffer_) {
-                auto bufferStatus = inputBuffer_->getStatus();
-                oss << "Buffer Status:\n";
-                oss << "  Capacity: " << bufferStatus.capacity << " samples\n";
-                oss << "  Available: " << bufferStatus.available << " samples\n";
-                oss << "  Fill Percentage: " << bufferStatus.fillPercentage << "%\n";
-                oss << "  Total Written: " << bufferStatus.totalWritten << "\n";
-                oss << "  Total Read: " << bufferStatus.totalRead << "\n";
-            }
+        std::cout << "StreamingAudioProcessor shutdown complete" << std::endl;
 
-            // TODO: Add error information
-            if (lastError_.code != 0) {
-                oss << "Last Error:\n";
-                oss << "  Code: " << lastError_.code << "\n";
-                oss << "  Message: " << lastError_.message << "\n";
-                oss << "  Component: " << lastError_.component << "\n";
-                oss << "  Details: " << lastError_.details << "\n";
-            }
+    } catch (const std::exception& e) {
+        std::cerr << "Error during shutdown: " << e.what() << std::endl;
+    }
+}
 
-            return oss.str();
-        }
+bool StreamingAudioProcessor::reset() {
+    // TODO: Implement processor reset
+    shutdown();
 
-        // TODO 2.4.27: Resource Management and Cleanup Implementation
-        // -----------------------------------------------------------
-        /**
-         * TODO: Implement comprehensive resource management with:
-         * [ ] Safe shutdown with proper thread termination and resource cleanup
-         * [ ] Memory leak detection and prevention with verification
-         * [ ] Resource tracking with usage monitoring and optimization
-         * [ ] Graceful degradation with error handling and recovery
-         * [ ] State persistence with configuration and data preservation
-         * [ ] Component lifecycle management with proper initialization order
-         * [ ] External resource cleanup with dependency management
-         * [ ] Performance monitoring cleanup with metrics finalization
-         * [ ] Thread synchronization cleanup with deadlock prevention
-         * [ ] Error handling cleanup with proper exception safety
-         */
-        void StreamingAudioProcessor::shutdown() {
-            std::cout << "Shutting down StreamingAudioProcessor..." << std::endl;
+    // TODO: Re-initialize with current configuration if it was previously initialized
+    if (!config_.sampleRate) {
+        // No valid configuration to reset with
+        return false;
+    }
 
-            try {
-                // TODO: Stop streaming if active
-                if (streaming_.load()) {
-                    stopStreaming();
-                }
+    return initialize(config_);
+}
 
-                // TODO: Clear callbacks to prevent further notifications
-                clearCallbacks();
+// TODO 2.4.28: Configuration Validation Implementation
+// ----------------------------------------------------
+/**
+ * TODO: Implement comprehensive configuration validation with:
+ * [ ] Parameter range checking with detailed error messages
+ * [ ] Cross-parameter validation with dependency checking
+ * [ ] Platform-specific validation with capability detection
+ * [ ] Performance impact validation with optimization recommendations
+ * [ ] Resource requirement validation with availability checking
+ * [ ] Compatibility validation with version and feature checking
+ * [ ] Security validation with input sanitization
+ * [ ] Default value provision with intelligent fallbacks
+ * [ ] Configuration migration with version compatibility
+ * [ ] Validation caching with performance optimization
+ */
+bool StreamingAudioProcessor::validateConfiguration(const StreamingConfig& config) const {
+    // TODO: Validate sample rate
+    if (config.sampleRate < 8000 || config.sampleRate > 192000) {
+        return false;
+    }
 
-                // TODO: Clean up components
-                vadDetector_.reset();
-                qualityAssessor_.reset();
-                inputBuffer_.reset();
-                audioEngine_.reset();
+    // TODO: Validate channel count
+    if (config.channels < 1 || config.channels > 8) {
+        return false;
+    }
 
-                // TODO: Reset state
-                initialized_.store(false);
+    // TODO: Validate buffer size
+    if (config.bufferSize < 64 || config.bufferSize > 8192) {
+        return false;
+    }
 
-                // TODO: Clear error state
-                clearErrors();
+    // TODO: Validate latency requirements
+    if (config.maxLatencyMs < 1 || config.maxLatencyMs > 1000) {
+        return false;
+    }
 
-                std::cout << "StreamingAudioProcessor shutdown complete" << std::endl;
+    // TODO: Validate VAD parameters
+    if (config.enableVAD) {
+        if (config.vadThreshold < 0.0f || config.vadThreshold > 1.0f) {
+            return false;
+        }
+        if (config.vadHangTime > 10000) {  // 10 seconds max
+            return false;
+        }
+    }
 
-            } catch (const std::exception& e) {
-                std::cerr << "Error during shutdown: " << e.what() << std::endl;
-            }
+    // TODO: Validate quality assessment parameters
+    if (config.enableQualityAssessment) {
+        if (config.qualityThreshold < 0.0f || config.qualityThreshold > 1.0f) {
+            return false;
         }
+    }
 
-        bool StreamingAudioProcessor::reset() {
-            // TODO: Implement processor reset
-            shutdown();
+    // TODO: Validate buffer management parameters
+    if (config.circularBufferSize < config.bufferSize * 2) {
+        return false;  // Circular buffer must be at least 2x processing buffer
+    }
 
-            // TODO: Re-initialize with current configuration if it was previously initialized
-            if (!config_.sampleRate) {
-                // No valid configuration to reset with
-                return false;
-            }
+    return true;
+}
 
-            return initialize(config_);
-        }
+// TODO 2.4.29: Utility Functions Implementation
+// ---------------------------------------------
+/**
+ * TODO: Implement comprehensive utility functions with:
+ * [ ] Default configuration creation with intelligent defaults
+ * [ ] Configuration validation with detailed error reporting
+ * [ ] Buffer size optimization with performance analysis
+ * [ ] Platform-specific optimizations with capability detection
+ * [ ] Performance measurement utilities with profiling support
+ * [ ] Memory management utilities with leak detection
+ * [ ] Error handling utilities with structured logging
+ * [ ] Testing utilities with mock objects and data generation
+ * [ ] Documentation utilities with example generation
+ * [ ] Integration utilities with external system support
+ */
+StreamingConfig createDefaultStreamingConfig() {
+    StreamingConfig config = {};
 
-        // TODO 2.4.28: Configuration Validation Implementation
-        // ----------------------------------------------------
-        /**
-         * TODO: Implement comprehensive configuration validation with:
-         * [ ] Parameter range checking with detailed error messages
-         * [ ] Cross-parameter validation with dependency checking
-         * [ ] Platform-specific validation with capability detection
-         * [ ] Performance impact validation with optimization recommendations
-         * [ ] Resource requirement validation with availability checking
-         * [ ] Compatibility validation with version and feature checking
-         * [ ] Security validation with input sanitization
-         * [ ] Default value provision with intelligent fallbacks
-         * [ ] Configuration migration with version compatibility
-         * [ ] Validation caching with performance optimization
-         */
-        bool StreamingAudioProcessor::validateConfiguration(const StreamingConfig& config) const {
-            // TODO: Validate sample rate
-            if (config.sampleRate < 8000 || config.sampleRate > 192000) {
-                return false;
-            }
+    // TODO: Set intelligent defaults based on common use cases
+    config.sampleRate = 44100;
+    config.channels = 2;
+    config.bufferSize = 1024;
+    config.hopSize = 512;
 
-            // TODO: Validate channel count
-            if (config.channels < 1 || config.channels > 8) {
-                return false;
-            }
+    config.maxLatencyMs = 50;  // 50ms for real-time processing
+    config.enableRealtimeProcessing = true;
+    config.processingIntervalMs = 10;
 
-            // TODO: Validate buffer size
-            if (config.bufferSize < 64 || config.bufferSize > 8192) {
-                return false;
-            }
+    config.enableVAD = true;
+    config.vadThreshold = 0.5f;
+    config.vadHangTime = 100;  // 100ms
 
-            // TODO: Validate latency requirements
-            if (config.maxLatencyMs < 1 || config.maxLatencyMs > 1000) {
-                return false;
-            }
+    config.enableQualityAssessment = true;
+    config.qualityThreshold = 0.7f;
+    config.enableQualityFeedback = true;
 
-            // TODO: Validate VAD parameters
-            if (config.enableVAD) {
-                if (config.vadThreshold < 0.0f || config.vadThreshold > 1.0f) {
-                    return false;
-                }
-                if (config.vadHangTime > 10000) {  // 10 seconds max
-                    return false;
-                }
-            }
+    config.circularBufferSize = config.bufferSize * 8;  // 8x buffer for safety
+    config.maxMemoryUsage = 64 * 1024 * 1024;           // 64MB
+    config.enableMemoryOptimization = true;
 
-            // TODO: Validate quality assessment parameters
-            if (config.enableQualityAssessment) {
-                if (config.qualityThreshold < 0.0f || config.qualityThreshold > 1.0f) {
-                    return false;
-                }
-            }
+    config.threadPriority = 0;  // Default priority
+    config.enablePerformanceMonitoring = true;
+    config.performanceUpdateInterval = 1000;  // 1 second
 
-            // TODO: Validate buffer management parameters
-            if (config.circularBufferSize < config.bufferSize * 2) {
-                return false;  // Circular buffer must be at least 2x processing buffer
-            }
+    config.stageQueueDepth = 16;
+    config.featureWorkers = 1;
+    config.backpressurePolicy = BackpressurePolicy::DropOldest;  // Favour fresh audio
+    config.backpressureTimeoutMs = 5;
 
-            return true;
-        }
+    return config;
+}
 
-        // TODO 2.4.29: Utility Functions Implementation
-        // ---------------------------------------------
-        /**
-         * TODO: Implement comprehensive utility functions with:
-         * [ ] Default configuration creation with intelligent defaults
-         * [ ] Configuration validation with detailed error reporting
-         * [ ] Buffer size optimization with performance analysis
-         * [ ] Platform-specific optimizations with capability detection
-         * [ ] Performance measurement utilities with profiling support
-         * [ ] Memory management utilities with leak detection
-         * [ ] Error handling utilities with structured logging
-         * [ ] Testing utilities with mock objects and data generation
-         * [ ] Documentation utilities with example generation
-         * [ ] Integration utilities with external system support
-         */
-        StreamingConfig createDefaultStreamingConfig() {
-            StreamingConfig config = {};
-
-            // TODO: Set intelligent defaults based on common use cases
-            config.sampleRate = 44100;
-            config.channels = 2;
-            config.bufferSize = 1024;
-            config.hopSize = 512;
-
-            config.maxLatencyMs = 50;  // 50ms for real-time processing
-            config.enableRealtimeProcessing = true;
-            config.processingIntervalMs = 10;
-
-            config.enableVAD = true;
-            config.vadThreshold = 0.5f;
-            config.vadHangTime = 100;  // 100ms
-
-            config.enableQualityAssessment = true;
-            config.qualityThreshold = 0.7f;
-            config.enableQualityFeedback = true;
-
-            config.circularBufferSize = config.bufferSize * 8;  // 8x buffer for safety
-            config.maxMemoryUsage = 64 * 1024 * 1024;           // 64MB
-            config.enableMemoryOptimization = true;
-
-            config.threadPriority = 0;  // Default priority
-            config.enablePerformanceMonitoring = true;
-            config.performanceUpdateInterval = 1000;  // 1 second
-
-            return config;
-        }
+bool validateStreamingConfig(const StreamingConfig& config, std::string& errorMessage) {
+    // TODO: Comprehensive validation with detailed error messages
 
-        bool validateStreamingConfig(const StreamingConfig& config, std::string& errorMessage) {
-            // TODO: Comprehensive validation with detailed error messages
+    if (config.sampleRate < 8000 || config.sampleRate > 192000) {
+        errorMessage = "Sample rate must be between 8000 and 192000 Hz";
+        return false;
+    }
 
-            if (config.sampleRate < 8000 || config.sampleRate > 192000) {
-                errorMessage = "Sample rate must be between 8000 and 192000 Hz";
-                return false;
-            }
+    if (config.channels < 1 || config.channels > 8) {
+        errorMessage = "Channel count must be between 1 and 8";
+        return false;
+    }
 
-            if (config.channels < 1 || config.channels > 8) {
-                errorMessage = "Channel count must be between 1 and 8";
-                return false;
-            }
+    if (config.bufferSize < 64 || config.bufferSize > 8192) {
+        errorMessage = "Buffer size must be between 64 and 8192 samples";
+        return false;
+    }
 
-            if (config.bufferSize < 64 || config.bufferSize > 8192) {
-                errorMessage = "Buffer size must be between 64 and 8192 samples";
-                return false;
-            }
+    if (config.hopSize > config.bufferSize) {
+        errorMessage = "Hop size cannot be larger than buffer size";
+        return false;
+    }
 
-            if (config.hopSize > config.bufferSize) {
-                errorMessage = "Hop size cannot be larger than buffer size";
-                return false;
-            }
+    if (config.maxLatencyMs < 1 || config.maxLatencyMs > 1000) {
+        errorMessage = "Maximum latency must be between 1 and 1000 ms";
+        return false;
+    }
 
-            if (config.maxLatencyMs < 1 || config.maxLatencyMs > 1000) {
-                errorMessage = "Maximum latency must be between 1 and 1000 ms";
-                return false;
-            }
+    if (config.enableVAD) {
+        if (config.vadThreshold < 0.0f || config.vadThreshold > 1.0f) {
+            errorMessage = "VAD threshold must be between 0.0 and 1.0";
+            return false;
+        }
+    }
 
-            if (config.enableVAD) {
-                if (config.vadThreshold < 0.0f || config.vadThreshold > 1.0f) {
-                    errorMessage = "VAD threshold must be between 0.0 and 1.0";
-                    return false;
-                }
-            }
+    if (config.enableQualityAssessment) {
+        if (config.qualityThreshold < 0.0f || config.qualityThreshold > 1.0f) {
+            errorMessage = "Quality threshold must be between 0.0 and 1.0";
+            return false;
+        }
+    }
 
-            if (config.enableQualityAssessment) {
-                if (config.qualityThreshold < 0.0f || config.qualityThreshold > 1.0f) {
-                    errorMessage = "Quality threshold must be between 0.0 and 1.0";
-                    return false;
-                }
-            }
+    if (config.stageQueueDepth < 2 || config.stageQueueDepth > 1024) {
+        errorMessage = "Stage queue depth must be between 2 and 1024 frames";
+        return false;
+    }
 
-            if (config.circularBufferSize < config.bufferSize * 2) {
-                errorMessage =
-                    "Circular buffer size must be at least 2x the processing buffer size";
-                return false;
-            }
+    if (config.featureWorkers < 1 || config.featureWorkers > 16) {
+        errorMessage = "Feature worker count must be between 1 and 16";
+        return false;
+    }
 
-            return true;
-        }
+    if (config.circularBufferSize < config.bufferSize * 2) {
+        errorMessage =
+            "Circular buffer size must be at least 2x the processing buffer size";
+        return false;
+    }
+
+    return true;
+}
 
-        BufferSizeRecommendation calculateOptimalBufferSizes(
-            uint32_t sampleRate, uint32_t maxLatencyMs, uint16_t channels) {
-            BufferSizeRecommendation recommendation = {};
+BufferSizeRecommendation calculateOptimalBufferSizes(
+    uint32_t sampleRate, uint32_t maxLatencyMs, uint16_t channels) {
+    BufferSizeRecommendation recommendation = {};
 
-            // TODO: Calculate optimal buffer sizes based on latency requirements
-            float maxLatencySeconds = maxLatencyMs / 1000.0f;
-            uint32_t maxSamplesForLatency = static_cast<uint32_t>(sampleRate * maxLatencySeconds);
+    // TODO: Calculate optimal buffer sizes based on latency requirements
+    float maxLatencySeconds = maxLatencyMs / 1000.0f;
+    uint32_t maxSamplesForLatency = static_cast<uint32_t>(sampleRate * maxLatencySeconds);
 
-            // TODO: Choose power-of-2 buffer size that fits within latency requirement
-            uint32_t bufferSize = 64;
-            while (bufferSize < maxSamplesForLatency && bufferSize < 4096) {
-                bufferSize *= 2;
-            }
+    // TODO: Choose power-of-2 buffer size that fits within latency requirement
+    uint32_t bufferSize = 64;
+    while (bufferSize < maxSamplesForLatency && bufferSize < 4096) {
+        bufferSize *= 2;
+    }
 
-            // TODO: Set hop size to 50% overlap
-            uint32_t hopSize = bufferSize / 2;
+    // TODO: Set hop size to 50% overlap
+    uint32_t hopSize = bufferSize / 2;
 
-            // TODO: Set circular buffer to 8x processing buffer for safety
-            uint32_t circularBufferSize = bufferSize * 8;
+    // TODO: Set circular buffer to 8x processing buffer for safety
+    uint32_t circularBufferSize = bufferSize * 8;
 
-            // TODO: Calculate expected latency
-            float expectedLatency = (static_cast<float>(bufferSize) / sampleRate) * 1000.0f;
+    // TODO: Calculate expected latency
+    float expectedLatency = (static_cast<float>(bufferSize) / sampleRate) * 1000.0f;
 
-            // TODO: Calculate memory usage
-            float memoryUsage =
-                (circularBufferSize * channels * sizeof(float))
-                + (bufferSize * channels * sizeof(float) * 4);  // Processing buffers
+    // TODO: Calculate memory usage
+    float memoryUsage =
+        (circularBufferSize * channels * sizeof(float))
+        + (bufferSize * channels * sizeof(float) * 4);  // Processing buffers
 
-            recommendation.bufferSize = bufferSize;
-            recommendation.hopSize = hopSize;
-            recommendation.circularBufferSize = circularBufferSize;
-            recommendation.expectedLatency = expectedLatency;
-            recommendation.memoryUsage = memoryUsage;
+    recommendation.bufferSize = bufferSize;
+    recommendation.hopSize = hopSize;
+    recommendation.circularBufferSize = circularBufferSize;
+    recommendation.expectedLatency = expectedLatency;
+    recommendation.memoryUsage = memoryUsage;
 
-            return recommendation;
-        }
+    return recommendation;
+}
 
-    }  // namespace core
+}  // namespace core
 }  // namespace huntmaster
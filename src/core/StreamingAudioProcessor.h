@@ -16,15 +16,20 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
-#include <thread>
+#include <string>
 #include <vector>
 
+#include "huntmaster/QualityAssessor.h"
 #include "huntmaster/core/AudioBuffer.h"
-#include "huntmaster/core/AudioConfig.h"
-#include "huntmaster/core/UnifiedAudioEngine.h"
+#include "huntmaster/core/AudioBufferPool.h"
+#include "huntmaster/core/DTWComparator.h"
+#include "huntmaster/core/MFCCProcessor.h"
+#include "huntmaster/core/StagedPipeline.h"
+#include "huntmaster/core/VoiceActivityDetector.h"
 
 namespace huntmaster {
 namespace core {
@@ -48,10 +53,6 @@ namespace core {
  * [ ] Memory management utilities for streaming data
  */
 
-class VoiceActivityDetector;
-class QualityAssessor;
-class CircularAudioBuffer;
-
 /**
  * @brief Real-time processing result with comprehensive metrics
  *
@@ -75,9 +76,9 @@ struct StreamingProcessingResult {
     // Component analysis scores
     float mfccSimilarity;      ///< MFCC pattern matching score
     float volumeSimilarity;    ///< Volume level matching score
-    float timingSimilarity;    ///< Timing/rhythm accuracy score
-    float pitchSimilarity;     ///< Pitch similarity score
-    float spectralSimilarity;  ///< Spectral envelope similarity
+    float timingSimilarity;    ///< Timing/rhythm accuracy score (not computed yet, 0)
+    float pitchSimilarity;     ///< Pitch similarity score (not computed yet, 0)
+    float spectralSimilarity;  ///< Spectral envelope similarity (not computed yet, 0)
 
     // Voice activity detection results
     bool voiceActivityDetected;  ///< Current voice activity state
@@ -131,7 +132,7 @@ struct StreamingConfig {
 
     // Voice activity detection settings
     bool enableVAD;        ///< Enable voice activity detection
-    float vadThreshold;    ///< VAD sensitivity threshold
+    float vadThreshold;    ///< Activity probability above which a window counts as voiced
     uint32_t vadHangTime;  ///< VAD hang time in ms
 
     // Quality assessment settings
@@ -148,217 +149,12 @@ struct StreamingConfig {
     uint32_t threadPriority;             ///< Processing thread priority
     bool enablePerformanceMonitoring;    ///< Enable performance tracking
     uint32_t performanceUpdateInterval;  ///< Performance update interval
-};
-
-// TODO 2.4.2: Voice Activity Detection System
-// -------------------------------------------
-/**
- * @brief Advanced Voice Activity Detection with machine learning
- *
- * TODO: Implement comprehensive VAD system with:
- * [ ] Multi-algorithm VAD with ensemble decision making
- * [ ] Spectral-based VAD with noise floor estimation
- * [ ] Energy-based VAD with adaptive thresholding
- * [ ] Machine learning VAD with real-time inference
- * [ ] Context-aware VAD with temporal smoothing
- * [ ] Environmental noise adaptation with learning
- * [ ] Speech quality assessment with intelligibility scoring
- * [ ] Real-time parameter adaptation based on conditions
- * [ ] Performance optimization for low-latency processing
- * [ ] Integration with audio enhancement and preprocessing
- */
-class VoiceActivityDetector {
-  public:
-    VoiceActivityDetector();
-    ~VoiceActivityDetector();
-
-    /**
-     * @brief Initialize VAD with configuration parameters
-     * TODO: Implement initialization with comprehensive parameter validation
-     */
-    bool initialize(const StreamingConfig& config);
-
-    /**
-     * @brief Process audio buffer and detect voice activity
-     * TODO: Implement real-time VAD processing with multiple algorithms
-     */
-    bool processBuffer(const AudioBuffer& buffer, float& probability, float& confidence);
-
-    /**
-     * @brief Update VAD parameters dynamically
-     * TODO: Implement dynamic parameter updating with validation
-     */
-    bool updateParameters(float threshold, uint32_t hangTime);
-
-    /**
-     * @brief Get current VAD statistics and performance metrics
-     * TODO: Implement comprehensive statistics reporting
-     */
-    struct VADStatistics {
-        float currentProbability;
-        float averageProbability;
-        uint32_t detectionCount;
-        uint32_t falsePositiveCount;
-        uint32_t falseNegativeCount;
-        float processingLatency;
-        float accuracy;
-    };
-    VADStatistics getStatistics() const;
-
-    /**
-     * @brief Reset VAD state and statistics
-     * TODO: Implement state reset with proper cleanup
-     */
-    void reset();
-
-  private:
-    // TODO: Implement internal VAD data structures and algorithms
-    struct VADImpl;
-    std::unique_ptr<VADImpl> impl_;
-};
-
-// TODO 2.4.3: Quality Assessment System
-// -------------------------------------
-/**
- * @brief Real-time audio quality assessment and monitoring
- *
- * TODO: Implement comprehensive quality assessment with:
- * [ ] Multi-domain quality metrics (time, frequency, perceptual)
- * [ ] Real-time quality monitoring with trend analysis
- * [ ] Perceptual quality modeling with psychoacoustic principles
- * [ ] Signal degradation detection with classification
- * [ ] Quality prediction with machine learning models
- * [ ] Adaptive quality enhancement with real-time processing
- * [ ] Quality reporting with user-friendly explanations
- * [ ] Performance-quality trade-off optimization
- * [ ] Quality-based feedback with actionable recommendations
- * [ ] Integration with audio processing pipeline for optimization
- */
-class QualityAssessor {
-  public:
-    QualityAssessor();
-    ~QualityAssessor();
-
-    /**
-     * @brief Initialize quality assessor with configuration
-     * TODO: Implement initialization with metric selection and parameters
-     */
-    bool initialize(const StreamingConfig& config);
-
-    /**
-     * @brief Assess audio quality in real-time
-     * TODO: Implement comprehensive quality assessment with multiple metrics
-     */
-    struct QualityMetrics {
-        float overallQuality;           ///< Overall quality score (0.0-1.0)
-        float signalToNoiseRatio;       ///< SNR in dB
-        float totalHarmonicDistortion;  ///< THD percentage
-        float frequencyResponseScore;   ///< Frequency response quality
-        float dynamicRangeScore;        ///< Dynamic range quality
-        float perceptualQuality;        ///< Perceptual quality score
-        float clippingLevel;            ///< Clipping detection level
-        float backgroundNoiseLevel;     ///< Background noise level
-    };
-
-    QualityMetrics assessQuality(const AudioBuffer& buffer);
-
-    /**
-     * @brief Get quality trend analysis
-     * TODO: Implement trend analysis with statistical methods
-     */
-    struct QualityTrend {
-        float currentQuality;
-        float averageQuality;
-        float qualityTrend;  ///< Positive = improving, negative = degrading
-        std::vector<float> recentHistory;
-        uint32_t measurementCount;
-    };
-    QualityTrend getQualityTrend() const;
-
-    /**
-     * @brief Get quality recommendations
-     * TODO: Implement quality-based recommendations with actionable advice
-     */
-    std::vector<std::string> getQualityRecommendations() const;
-
-  private:
-    // TODO: Implement internal quality assessment algorithms
-    struct QualityImpl;
-    std::unique_ptr<QualityImpl> impl_;
-};
-
-// TODO 2.4.4: Circular Audio Buffer System
-// ----------------------------------------
-/**
- * @brief High-performance circular buffer for streaming audio
- *
- * TODO: Implement advanced circular buffer with:
- * [ ] Lock-free circular buffer for high-performance streaming
- * [ ] Multi-reader, single-writer architecture for efficiency
- * [ ] Automatic memory management with dynamic resizing
- * [ ] Buffer overflow and underflow detection with recovery
- * [ ] Memory-mapped buffer support for large datasets
- * [ ] NUMA-aware memory allocation for multi-CPU systems
- * [ ] Cache-friendly data layout with prefetching optimization
- * [ ] Real-time performance monitoring with latency tracking
- * [ ] Thread-safe operations with atomic operations
- * [ ] Integration with audio processing pipeline for seamless operation
- */
-class CircularAudioBuffer {
-  public:
-    CircularAudioBuffer();
-    ~CircularAudioBuffer();
-
-    /**
-     * @brief Initialize circular buffer with specified capacity
-     * TODO: Implement initialization with memory optimization and validation
-     */
-    bool initialize(size_t capacity, uint16_t channels, uint32_t sampleRate);
-
-    /**
-     * @brief Write audio data to buffer (producer)
-     * TODO: Implement lock-free write with overflow handling
-     */
-    size_t write(const float* data, size_t samples);
-
-    /**
-     * @brief Read audio data from buffer (consumer)
-     * TODO: Implement lock-free read with underflow handling
-     */
-    size_t read(float* data, size_t samples);
-
-    /**
-     * @brief Peek at buffer data without consuming it
-     * TODO: Implement non-destructive peek with multiple readers
-     */
-    size_t peek(float* data, size_t samples, size_t offset = 0) const;
-
-    /**
-     * @brief Get buffer status and metrics
-     * TODO: Implement comprehensive buffer status reporting
-     */
-    struct BufferStatus {
-        size_t capacity;          ///< Total buffer capacity
-        size_t available;         ///< Available samples for reading
-        size_t free;              ///< Free space for writing
-        float fillPercentage;     ///< Buffer fill percentage
-        uint64_t totalWritten;    ///< Total samples written
-        uint64_t totalRead;       ///< Total samples read
-        uint32_t overflowCount;   ///< Number of overflow events
-        uint32_t underflowCount;  ///< Number of underflow events
-    };
-    BufferStatus getStatus() const;
-
-    /**
-     * @brief Reset buffer state
-     * TODO: Implement safe buffer reset with proper synchronization
-     */
-    void reset();
 
-  private:
-    // TODO: Implement lock-free circular buffer internals
-    struct CircularBufferImpl;
-    std::unique_ptr<CircularBufferImpl> impl_;
+    // Pipeline settings
+    uint32_t stageQueueDepth;               ///< Frames each stage may queue (power of 2)
+    uint32_t featureWorkers;                ///< Feature extraction threads (>1 may reorder)
+    BackpressurePolicy backpressurePolicy;  ///< What capture does when the VAD stage is full
+    uint32_t backpressureTimeoutMs;         ///< Longest capture may wait under Block
 };
 
 // TODO 2.4.5: Main Streaming Audio Processor Class
@@ -417,13 +213,17 @@ class StreamingAudioProcessor {
     // -----------------------------------
     /**
      * @brief Set master audio for comparison
-     * TODO: Implement master audio setup with preprocessing and validation
+     *
+     * The buffer is taken to be at the configured sample rate; its channels are mixed
+     * down and its MFCC features become the reference every frame is scored against.
      */
     bool setMasterAudio(const AudioBuffer& masterAudio);
 
     /**
      * @brief Update master audio parameters
-     * TODO: Implement master audio parameter updates with reprocessing
+     *
+     * Volume scales the reference level used for volume similarity. Only speed 1.0 is
+     * supported; other speeds are rejected.
      */
     bool updateMasterAudioParameters(float volume, float speed);
 
@@ -504,7 +304,7 @@ class StreamingAudioProcessor {
      * @brief Get current quality metrics
      * TODO: Implement quality metrics retrieval with trend analysis
      */
-    QualityAssessor::QualityMetrics getCurrentQuality() const;
+    QualityMetrics getCurrentQuality() const;
 
     /**
      * @brief Get quality recommendations
@@ -527,9 +327,15 @@ class StreamingAudioProcessor {
         uint32_t bufferUnderflows;       ///< Number of buffer underflow events
         float processingEfficiency;      ///< Processing efficiency percentage
         uint64_t totalSamplesProcessed;  ///< Total samples processed
+        uint64_t framesDropped;          ///< Frames dropped by pipeline backpressure
     };
     PerformanceMetrics getPerformanceMetrics() const;
 
+    /**
+     * @brief Per-stage queue depth and latency, in pipeline order
+     */
+    std::vector<StageMetrics> getStageMetrics() const;
+
     /**
      * @brief Optimize performance based on current conditions
      * TODO: Implement adaptive performance optimization
@@ -544,7 +350,7 @@ class StreamingAudioProcessor {
      */
     using ProcessingCallback = std::function<void(const StreamingProcessingResult&)>;
     using VADCallback = std::function<void(bool voiceDetected, float probability)>;
-    using QualityCallback = std::function<void(const QualityAssessor::QualityMetrics&)>;
+    using QualityCallback = std::function<void(const QualityMetrics&)>;
     using ErrorCallback = std::function<void(int errorCode, const std::string& message)>;
 
     /**
@@ -620,26 +426,80 @@ class StreamingAudioProcessor {
      * [ ] Future extensibility with plugin architecture support
      */
 
-    // Core components
-    std::unique_ptr<UnifiedAudioEngine> audioEngine_;
+    /**
+     * @brief One frame travelling through the pipeline
+     *
+     * Capture mixes the chunk down to mono into a pooled buffer, so moving a frame
+     * between stages copies no audio.
+     */
+    struct StreamingFrame {
+        AudioBufferPool::BufferHandle samples;
+        size_t sampleCount{0};   ///< Mono samples in `samples`
+        size_t inputSamples{0};  ///< Interleaved samples the frame was captured from
+        bool realtimeFeedback{true};
+        float level{0.0f};  ///< Mean absolute sample value
+        uint64_t order{0};  ///< Position among frames handed to the feature stage
+        MFCCProcessor::FeatureMatrix features;
+        std::chrono::steady_clock::time_point captured{};
+        StreamingProcessingResult result{};
+    };
+    using Stage = PipelineStage<StreamingFrame>;
+
+    /// MFCC extractor used by one feature worker at a time
+    struct FeatureExtractor {
+        std::mutex mutex;
+        std::unique_ptr<MFCCProcessor> mfcc;
+        size_t frameSize{0};
+        size_t hopSize{1};
+    };
+
+    // Order-dependent analysis: VAD and quality carry state from frame to frame, so both
+    // run in the single-worker VAD stage under analysisMutex_.
     std::unique_ptr<VoiceActivityDetector> vadDetector_;
     std::unique_ptr<QualityAssessor> qualityAssessor_;
-    std::unique_ptr<CircularAudioBuffer> inputBuffer_;
+    std::vector<float> vadCarry_;  ///< Samples short of a whole VAD window
+    size_t vadWindowSamples_{0};
+    float vadThreshold_{0.5f};
+    VADStatus vadStatus_{};
+    QualityMetrics currentQuality_{};
+    bool qualityAssessed_{false};
+    mutable std::mutex analysisMutex_;
+
+    // Feature extraction and scoring
+    std::vector<std::unique_ptr<FeatureExtractor>> featureExtractors_;
+    std::unique_ptr<DTWComparator> dtwComparator_;
+    MFCCProcessor::FeatureMatrix recentFeatures_;  ///< Latest frames, at most the master's length
+    float recentLevel_{0.0f};
+
+    // Parallel feature workers finish out of order; scoring puts frames back in order.
+    // featureOrder_ belongs to the single VAD worker, the rest to the scoring worker.
+    uint64_t featureOrder_{0};
+    uint64_t nextScoringOrder_{0};
+    std::map<uint64_t, StreamingFrame> reorderBuffer_;
+    size_t reorderWindow_{0};  ///< Parked frames before a missing one is given up; 0 = in order
 
     // Configuration and state
     StreamingConfig config_;
     std::atomic<bool> initialized_;
     std::atomic<bool> streaming_;
-
-    // Processing thread and synchronization
-    std::unique_ptr<std::thread> processingThread_;
-    std::mutex configMutex_;
-    std::condition_variable processingCondition_;
-    std::atomic<bool> shouldStop_;
-
-    // Master audio data
-    AudioBuffer masterAudio_;
-    std::mutex masterAudioMutex_;
+    mutable std::mutex configMutex_;
+
+    // Processing pipeline: capture (caller) -> VAD -> features -> scoring -> callbacks.
+    // Stages run on their own threads while streaming and inline otherwise.
+    std::unique_ptr<AudioBufferPool> framePool_;
+    std::unique_ptr<Stage> vadStage_;
+    std::unique_ptr<Stage> featureStage_;
+    std::unique_ptr<Stage> scoringStage_;
+    std::unique_ptr<Stage> callbackStage_;
+    std::vector<float> captureBuffer_;  ///< Mono samples short of a whole frame
+    std::atomic<uint32_t> sequenceCounter_{0};
+    std::atomic<uint64_t> captureDrops_{0};
+
+    // Master audio reference; also guards the scoring state above
+    MFCCProcessor::FeatureMatrix masterFeatures_;
+    MasterAudioInfo masterInfo_{};
+    float masterVolume_{1.0f};
+    mutable std::mutex masterAudioMutex_;
 
     // Callback functions
     ProcessingCallback processingCallback_;
@@ -654,8 +514,16 @@ class StreamingAudioProcessor {
     ErrorInfo lastError_;
 
     // Internal processing methods
-    void processingThreadFunction();
-    void processAudioData();
+    bool buildPipeline(bool threaded);
+    void stopPipeline();
+    bool createVoiceActivityDetector(const StreamingConfig& config);
+    bool createQualityAssessor(const StreamingConfig& config);
+    void runVADStage(StreamingFrame& frame);
+    void runFeatureStage(StreamingFrame& frame);
+    void runScoringStage(StreamingFrame& frame);
+    void scoreFrame(StreamingFrame& frame, bool inOrder);
+    void drainReorderBuffer();
+    void runCallbackStage(StreamingFrame& frame);
     void updatePerformanceMetrics();
     void handleProcessingError(const std::exception& e);
     bool validateConfiguration(const StreamingConfig& config) const;
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -23,45 +24,139 @@
 
 // Include existing components
 #include "../../libs/dr_wav.h"
+#include "huntmaster/core/AudioFormatConverter.h"
 #include "huntmaster/core/AudioLevelProcessor.h"
 #include "huntmaster/core/AudioPlayer.h"
 #include "huntmaster/core/AudioRecorder.h"
 #include "huntmaster/core/DTWComparator.h"
+#include "huntmaster/core/FeatureStorage.h"
 #include "huntmaster/core/MFCCProcessor.h"
+#include "huntmaster/core/MasterCallLibrary.h"
 #include "huntmaster/core/RealtimeScorer.h"
 #include "huntmaster/core/VoiceActivityDetector.h"
 
 namespace huntmaster {
 
-// RAII wrapper for dr_wav memory
-class DrWavRAII {
+/// Hop between MFCC frames of master-call features
+constexpr size_t kMasterCallHopSize = 256;
+
+/**
+ * Pulls mono samples at a target rate from a WAV file one chunk at a time.
+ * Channels are averaged and the rate converted by a polyphase resampler, which
+ * low-passes below the output Nyquist when downsampling; the next chunk is
+ * decoded on a worker while the caller consumes the current one.
+ */
+class StreamingWavSource {
   public:
-    explicit DrWavRAII(float* data) : data_(data) {}
-    ~DrWavRAII() {
-        if (data_) {
-            drwav_free(data_, nullptr);
+    static constexpr drwav_uint64 kChunkFrames = 4096;
+
+    StreamingWavSource() = default;
+    StreamingWavSource(const StreamingWavSource&) = delete;
+    StreamingWavSource& operator=(const StreamingWavSource&) = delete;
+
+    ~StreamingWavSource() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+        if (isOpen_) {
+            drwav_uninit(&wav_);
         }
     }
-    DrWavRAII(const DrWavRAII&) = delete;
-    DrWavRAII& operator=(const DrWavRAII&) = delete;
-    DrWavRAII(DrWavRAII&& other) noexcept : data_(other.data_) {
-        other.data_ = nullptr;
-    }
-    DrWavRAII& operator=(DrWavRAII&& other) noexcept {
-        if (this != &other) {
-            if (data_)
-                drwav_free(data_, nullptr);
-            data_ = other.data_;
-            other.data_ = nullptr;
+
+    bool open(const std::string& path, float targetRate) {
+        if (isOpen_ || targetRate <= 0.0f || !drwav_init_file(&wav_, path.c_str(), nullptr)) {
+            return false;
+        }
+        isOpen_ = true;
+        const auto outputRate = static_cast<uint32_t>(std::lround(targetRate));
+        if (wav_.channels == 0 || wav_.sampleRate == 0 || outputRate == 0) {
+            return false;
         }
-        return *this;
+        if (wav_.sampleRate != outputRate) {
+            resampler_ = std::make_unique<core::PolyphaseResampler>(
+                core::PolyphaseResampler::Config{wav_.sampleRate, outputRate, 1});
+        }
+        for (auto& buffer : interleaved_) {
+            buffer.resize(kChunkFrames * wav_.channels);
+        }
+        startRead();
+        return true;
     }
-    float* get() const {
-        return data_;
+
+    /// Fill out with resampled mono samples; 0 at end of file
+    size_t read(std::span<float> out) {
+        size_t written = 0;
+        while (written < out.size()) {
+            if (position_ >= ready_.size()) {
+                if (!refill()) {
+                    break;
+                }
+                continue;
+            }
+            const size_t count = std::min(out.size() - written, ready_.size() - position_);
+            std::copy_n(ready_.begin() + position_, count, out.begin() + written);
+            written += count;
+            position_ += count;
+        }
+        return written;
     }
 
   private:
-    float* data_;
+    void startRead() {
+        float* target = interleaved_[readSlot_].data();
+        pending_ = std::async(std::launch::async, [this, target] {
+            return drwav_read_pcm_frames_f32(&wav_, kChunkFrames, target);
+        });
+    }
+
+    /// Replace consumed samples with the next chunk's output; false at end of file
+    bool refill() {
+        if (!pending_.valid()) {
+            return false;
+        }
+        const drwav_uint64 frames = pending_.get();
+        ready_.clear();
+        position_ = 0;
+        if (frames == 0) {
+            // The resampler holds back its filter latency until the stream ends
+            if (resampler_) {
+                resampler_->flush(ready_);
+            }
+            return !ready_.empty();
+        }
+        const std::vector<float>& chunk = interleaved_[readSlot_];
+        readSlot_ ^= 1;
+        startRead();
+
+        std::vector<float>& mono = resampler_ ? mono_ : ready_;
+        mono.resize(frames);
+        const unsigned int channels = wav_.channels;
+        if (channels == 1) {
+            std::copy_n(chunk.begin(), frames, mono.begin());
+        } else {
+            for (drwav_uint64 i = 0; i < frames; ++i) {
+                float sampleSum = 0;
+                for (unsigned int j = 0; j < channels; ++j) {
+                    sampleSum += chunk[i * channels + j];
+                }
+                mono[i] = sampleSum / static_cast<float>(channels);
+            }
+        }
+        if (resampler_) {
+            resampler_->process(mono_.data(), mono_.size(), ready_);
+        }
+        return true;
+    }
+
+    drwav wav_{};
+    bool isOpen_ = false;
+    std::unique_ptr<core::PolyphaseResampler> resampler_;  // Null when the rates match
+    std::vector<float> mono_;   // Mixed-down chunk awaiting resampling
+    std::vector<float> ready_;  // Output at the target rate
+    size_t position_ = 0;       // Read position in ready_
+    std::vector<float> interleaved_[2];
+    int readSlot_ = 0;  // Slot the pending read fills
+    std::future<drwav_uint64> pending_;
 };
 
 class UnifiedAudioEngine::Impl {
@@ -80,6 +175,8 @@ class UnifiedAudioEngine::Impl {
     Status loadMasterCall(SessionId sessionId, std::string_view masterCallId);
     Status unloadMasterCall(SessionId sessionId);
     Result<std::string> getCurrentMasterCall(SessionId sessionId) const;
+    Status setMasterCallLibrary(std::string_view libraryPath);
+    Status setMasterCallDirectories(std::string_view audioDir, std::string_view featuresDir);
 
     // Audio processing
     Status processAudioChunk(SessionId sessionId, std::span<const float> audioBuffer);
@@ -151,10 +248,13 @@ class UnifiedAudioEngine::Impl {
         // Per-session master call (KEY IMPROVEMENT)
         std::vector<std::vector<float>> masterCallFeatures;
         std::string masterCallId;
+        float masterCallRms = 0.0f;       // 0 when the master audio level is unknown
+        float masterCallDuration = 0.0f;  // Seconds; 0 derives it from the feature frames
 
         // Audio processing state
         std::vector<float> currentSegmentBuffer;
         std::vector<std::vector<float>> sessionFeatures;
+        FeatureConfigRecord featureConfig;  // How masterCallFeatures must have been extracted
 
         // Processing components (per-session for true isolation)
         std::unique_ptr<MFCCProcessor> mfccProcessor;
@@ -194,6 +294,7 @@ class UnifiedAudioEngine::Impl {
             mfccConfig.num_coefficients = 13;
             mfccConfig.num_filters = 26;
             mfccProcessor = std::make_unique<MFCCProcessor>(mfccConfig);
+            featureConfig = FeatureConfigRecord::fromMFCC(mfccConfig, kMasterCallHopSize);
 
             // Initialize VAD with default configuration
             VoiceActivityDetector::Config internalVadConfig;
@@ -255,16 +356,25 @@ class UnifiedAudioEngine::Impl {
     std::unordered_map<SessionId, std::unique_ptr<SessionState>> sessions_;
     std::atomic<SessionId> nextSessionId_{1};
 
-    // Configuration paths
+    // Configuration paths; the master-call pair is guarded by pathsMutex_
+    mutable std::mutex pathsMutex_;
     std::string masterCallsPath_{"/workspaces/huntmaster-engine/data/master_calls/"};
     std::string featuresPath_{"/workspaces/huntmaster-engine/data/processed_calls/mfc/"};
     std::string recordingsPath_{"/workspaces/huntmaster-engine/data/recordings/"};
 
+    // Packed master-call library shared by all sessions; replaced atomically
+    mutable std::mutex libraryMutex_;
+    std::shared_ptr<const MasterCallLibrary> masterCallLibrary_;
+
     // Helper methods
     SessionState* getSession(SessionId sessionId);
     const SessionState* getSession(SessionId sessionId) const;
+    Status loadFeaturesFromLibrary(SessionState& session, const std::string& masterCallId);
     Status loadFeaturesFromFile(SessionState& session, const std::string& masterCallId);
     void saveFeaturesToFile(const SessionState& session, const std::string& masterCallId);
+    void setScorerMasterCall(SessionState& session);
+    std::string masterCallAudioPath(const std::string& masterCallId) const;
+    std::string featureFilePath(const std::string& masterCallId) const;
     void extractMFCCFeatures(SessionState& session);
 };
 
@@ -359,6 +469,15 @@ UnifiedAudioEngine::getCurrentMasterCall(SessionId sessionId) const {
     return pimpl->getCurrentMasterCall(sessionId);
 }
 
+UnifiedAudioEngine::Status UnifiedAudioEngine::setMasterCallLibrary(std::string_view libraryPath) {
+    return pimpl->setMasterCallLibrary(libraryPath);
+}
+
+UnifiedAudioEngine::Status UnifiedAudioEngine::setMasterCallDirectories(
+    std::string_view audioDir, std::string_view featuresDir) {
+    return pimpl->setMasterCallDirectories(audioDir, featuresDir);
+}
+
 // Audio processing
 UnifiedAudioEngine::Status
 UnifiedAudioEngine::processAudioChunk(SessionId sessionId, std::span<const float> audioBuffer) {
@@ -677,71 +796,55 @@ UnifiedAudioEngine::Status UnifiedAudioEngine::Impl::loadMasterCall(SessionId se
 
     const std::string masterCallIdStr(masterCallId);
 
-    // Try to load cached features first
-    if (loadFeaturesFromFile(*session, masterCallIdStr) == Status::OK) {
+    // Try the packed library, then cached features
+    if (loadFeaturesFromLibrary(*session, masterCallIdStr) == Status::OK
+        || loadFeaturesFromFile(*session, masterCallIdStr) == Status::OK) {
         session->masterCallId = masterCallIdStr;
 
-        // CRITICAL FIX: Set master call in RealtimeScorer even when using cached features
-        if (session->realtimeScorer) {
-            const std::string audioFilePath = masterCallsPath_ + masterCallIdStr + ".wav";
-            if (!session->realtimeScorer->setMasterCall(audioFilePath)) {
-                // Note: We still return OK because the cached features were loaded successfully
-                // The RealtimeScorer failure is not critical for basic functionality
-            }
-        }
+        // The scorer takes the loaded features, so no audio file is opened for cached calls
+        setScorerMasterCall(*session);
 
         return Status::OK;
     }
 
-    // Load and process audio file
-    const std::string audioFilePath = masterCallsPath_ + masterCallIdStr + ".wav";
-    unsigned int channels, sampleRate;
-    drwav_uint64 totalPCMFrameCount;
-    float* rawData = drwav_open_file_and_read_pcm_frames_f32(
-        audioFilePath.c_str(), &channels, &sampleRate, &totalPCMFrameCount, nullptr);
-
-    if (!rawData) {
+    // Stream the audio file through the extractor a chunk at a time so peak memory
+    // is bounded by the chunk size rather than the recording length
+    const std::string audioFilePath = masterCallAudioPath(masterCallIdStr);
+    StreamingWavSource source;
+    if (!source.open(audioFilePath, session->sampleRate)) {
         LOG_ERROR(Component::UNIFIED_ENGINE,
                   "Failed to load master call: " + std::string(masterCallId)
                       + " - audio file not found or invalid");
         return Status::FILE_NOT_FOUND;
     }
-    DrWavRAII audioData(rawData);
 
-    // Convert to mono if necessary
-    std::vector<float> monoSamples(totalPCMFrameCount);
-    if (channels > 1) {
-        for (drwav_uint64 i = 0; i < totalPCMFrameCount; ++i) {
-            float sampleSum = 0;
-            for (unsigned int j = 0; j < channels; ++j) {
-                sampleSum += rawData[i * channels + j];
+    // Extract MFCC features, keeping the level and length the scorer needs as the
+    // samples stream past
+    double sumSquares = 0.0;
+    size_t sampleCount = 0;
+    auto featuresResult = session->mfccProcessor->extractFeaturesFromStream(
+        [&](std::span<float> out) {
+            const size_t count = source.read(out);
+            for (size_t i = 0; i < count; ++i) {
+                sumSquares += static_cast<double>(out[i]) * out[i];
             }
-            monoSamples[i] = sampleSum / static_cast<float>(channels);
-        }
-    } else {
-        std::copy(rawData, rawData + totalPCMFrameCount, monoSamples.begin());
-    }
-
-    // Extract MFCC features
-    auto featuresResult = session->mfccProcessor->extractFeaturesFromBuffer(monoSamples, 256);
+            sampleCount += count;
+            return count;
+        },
+        kMasterCallHopSize);
     if (!featuresResult) {
         return Status::PROCESSING_ERROR;
     }
 
     session->masterCallFeatures = std::move(*featuresResult);
     session->masterCallId = masterCallIdStr;
+    session->masterCallRms =
+        sampleCount > 0 ? static_cast<float>(std::sqrt(sumSquares / sampleCount)) : 0.0f;
+    session->masterCallDuration = static_cast<float>(sampleCount) / session->sampleRate;
     saveFeaturesToFile(*session, masterCallIdStr);
 
-    // Set master call in RealtimeScorer if available
-    if (session->realtimeScorer) {
-        if (!session->realtimeScorer->setMasterCall(audioFilePath)) {
-#if DEBUG_UNIFIED_AUDIO_ENGINE
-            std::cerr << "[UnifiedAudioEngine] Failed to set master call in RealtimeScorer"
-                      << std::endl;
-#endif
-            // Continue anyway - fallback to traditional scoring
-        }
-    }
+    // The scorer takes the streamed features rather than reloading the whole file
+    setScorerMasterCall(*session);
 
     return Status::OK;
 }
@@ -804,36 +907,32 @@ UnifiedAudioEngine::Impl::processAudioChunk(SessionId sessionId,
             }
         }
 
-        if (session->vadEnabled && session->vadConfig.enabled) {
+        if (session->vadEnabled && session->vadConfig.enabled
+            && !session->vadConfig.spectral_mode) {
             // VAD processing to filter out silence
             const size_t frameSize = 512;  // VAD processing window
             size_t processedSamples = 0;
 
-            for (size_t i = 0; i + frameSize <= audioBuffer.size(); i += frameSize) {
-                auto window = audioBuffer.subspan(i, frameSize);
-
-                try {
-                    auto vadResult = session->vad->processWindow(window);
-                    processedSamples += frameSize;
-
-                    if (vadResult && vadResult->is_active) {
-                        // If voice is active, add the window to the segment buffer for
-                        // processing
+            try {
+                // One batch pass over the chunk; only active runs are copied
+                auto vadResult = session->vad->processChunk(audioBuffer, frameSize);
+                if (vadResult) {
+                    processedSamples = vadResult->samples_consumed;
+                    for (const auto& span : vadResult->active_spans) {
                         session->currentSegmentBuffer.insert(
-                            session->currentSegmentBuffer.end(), window.begin(), window.end());
+                            session->currentSegmentBuffer.end(), span.begin(), span.end());
                     }
-                } catch (const std::exception& e) {
-                    ComponentErrorHandler::UnifiedEngineErrors::logProcessingError(
-                        "VAD_PROCESSING_ERROR", "VAD processing failed: " + std::string(e.what()));
-                    // Continue processing remaining frames
                 }
+            } catch (const std::exception& e) {
+                ComponentErrorHandler::UnifiedEngineErrors::logProcessingError(
+                    "VAD_PROCESSING_ERROR", "VAD processing failed: " + std::string(e.what()));
             }
 
             LOG_TRACE(Component::UNIFIED_ENGINE,
                       "VAD processed " + std::to_string(processedSamples) + " samples for session "
                           + std::to_string(sessionId));
         } else {
-            // VAD disabled - process all audio directly
+            // VAD disabled or spectral (gated per MFCC frame) - process all audio directly
             session->currentSegmentBuffer.insert(
                 session->currentSegmentBuffer.end(), audioBuffer.begin(), audioBuffer.end());
 
@@ -910,20 +1009,34 @@ void UnifiedAudioEngine::Impl::extractMFCCFeatures(SessionState& session) {
     }
 
     const size_t frameSize = 512;
-    const size_t hopSize = frameSize / 2;
+    const size_t hopSize = kMasterCallHopSize;
+
+    // Spectral VAD reuses the MFCC power spectra and drops inactive frames before the
+    // mel filter bank, so silent or wind-only audio never reaches DTW
+    MFCCProcessor::SpectrumGate gate;
+    if (session.vadEnabled && session.vadConfig.enabled && session.vadConfig.spectral_mode
+        && session.vad) {
+        gate = [&session](std::span<const float> powerSpectrum) {
+            auto vadResult = session.vad->processSpectrum(powerSpectrum);
+            return vadResult && vadResult->is_active;
+        };
+    }
 
-    auto featuresResult =
-        session.mfccProcessor->extractFeaturesFromBuffer(session.currentSegmentBuffer, hopSize);
+    auto featuresResult = session.mfccProcessor->extractFeaturesFromBuffer(
+        session.currentSegmentBuffer, hopSize, gate);
     if (featuresResult) {
         session.sessionFeatures.insert(
             session.sessionFeatures.end(), featuresResult->begin(), featuresResult->end());
     }
 
-    // Keep only overlap for continuity
-    if (session.currentSegmentBuffer.size() > frameSize) {
-        std::vector<float> overlap(session.currentSegmentBuffer.end() - frameSize,
-                                   session.currentSegmentBuffer.end());
-        session.currentSegmentBuffer = std::move(overlap);
+    // Keep the samples from the first frame not yet extracted, so the next call resumes on
+    // the hop grid without feeding already-seen spectra to the features or the spectral VAD
+    const size_t bufferSize = session.currentSegmentBuffer.size();
+    if (bufferSize >= frameSize) {
+        const size_t framesSeen = (bufferSize - frameSize) / hopSize + 1;
+        session.currentSegmentBuffer.erase(session.currentSegmentBuffer.begin(),
+                                           session.currentSegmentBuffer.begin()
+                                               + framesSeen * hopSize);
     }
 }
 
@@ -962,6 +1075,8 @@ UnifiedAudioEngine::Status UnifiedAudioEngine::Impl::configureVAD(SessionId sess
     internalVadConfig.post_buffer =
         std::chrono::milliseconds(static_cast<int>(config.post_buffer * 1000));
     internalVadConfig.sample_rate = static_cast<size_t>(session->sampleRate);
+    // Spectral decisions are made once per MFCC hop
+    internalVadConfig.spectral_hop_size = kMasterCallHopSize;
 
     session->vad = std::make_unique<VoiceActivityDetector>(internalVadConfig);
     session->vadEnabled = config.enabled;
@@ -1019,6 +1134,55 @@ UnifiedAudioEngine::Impl::getCurrentMasterCall(SessionId sessionId) const {
     return {session->masterCallId, Status::OK};
 }
 
+UnifiedAudioEngine::Status
+UnifiedAudioEngine::Impl::setMasterCallLibrary(std::string_view libraryPath) {
+    std::shared_ptr<const MasterCallLibrary> library;
+    if (!libraryPath.empty()) {
+        auto opened = MasterCallLibrary::open(std::string(libraryPath));
+        if (!opened) {
+            LOG_ERROR(Component::UNIFIED_ENGINE,
+                      "Failed to open master call library: " + std::string(libraryPath));
+            return opened.error() == MasterCallLibraryError::FILE_NOT_FOUND
+                       ? Status::FILE_NOT_FOUND
+                       : Status::INVALID_PARAMS;
+        }
+        library = std::move(*opened);
+        LOG_INFO(Component::UNIFIED_ENGINE,
+                 "Using master call library " + std::string(libraryPath) + " with "
+                     + std::to_string(library->size()) + " calls");
+    }
+
+    // Sessions holding the previous library keep it mapped until their lookup ends
+    std::lock_guard<std::mutex> lock(libraryMutex_);
+    masterCallLibrary_ = std::move(library);
+    return Status::OK;
+}
+
+UnifiedAudioEngine::Status
+UnifiedAudioEngine::Impl::setMasterCallDirectories(std::string_view audioDir,
+                                                   std::string_view featuresDir) {
+    if (audioDir.empty() || featuresDir.empty()) {
+        return Status::INVALID_PARAMS;
+    }
+    std::error_code error;
+    if (!std::filesystem::is_directory(audioDir, error)
+        || !std::filesystem::is_directory(featuresDir, error)) {
+        return Status::FILE_NOT_FOUND;
+    }
+
+    auto asDirectory = [](std::string_view path) {
+        std::string directory(path);
+        if (directory.back() != '/') {
+            directory += '/';
+        }
+        return directory;
+    };
+    std::lock_guard<std::mutex> lock(pathsMutex_);
+    masterCallsPath_ = asDirectory(audioDir);
+    featuresPath_ = asDirectory(featuresDir);
+    return Status::OK;
+}
+
 UnifiedAudioEngine::Result<int>
 UnifiedAudioEngine::Impl::getFeatureCount(SessionId sessionId) const {
     const SessionState* session = getSession(sessionId);
@@ -1328,7 +1492,7 @@ UnifiedAudioEngine::Status UnifiedAudioEngine::Impl::playMasterCall(SessionId se
     if (!session->audioPlayer)
         return Status::INIT_FAILED;
 
-    const std::string audioFilePath = masterCallsPath_ + std::string(masterCallId) + ".wav";
+    const std::string audioFilePath = masterCallAudioPath(std::string(masterCallId));
 
     if (!session->audioPlayer->loadFile(audioFilePath)) {
         return Status::FILE_NOT_FOUND;
@@ -1468,41 +1632,94 @@ bool UnifiedAudioEngine::Impl::isRealtimeSession(SessionId sessionId) const {
 
 // Feature file I/O
 UnifiedAudioEngine::Status
-UnifiedAudioEngine::Impl::loadFeaturesFromFile(SessionState& session,
-                                               const std::string& masterCallId) {
-    const std::string featureFilePath = featuresPath_ + masterCallId + ".mfc";
-    std::ifstream inFile(featureFilePath, std::ios::binary);
-    if (!inFile)
+UnifiedAudioEngine::Impl::loadFeaturesFromLibrary(SessionState& session,
+                                                  const std::string& masterCallId) {
+    std::shared_ptr<const MasterCallLibrary> library;
+    {
+        std::lock_guard<std::mutex> lock(libraryMutex_);
+        library = masterCallLibrary_;
+    }
+    if (!library || library->featureConfig() != session.featureConfig)
         return Status::FILE_NOT_FOUND;
 
-    uint32_t numFrames = 0, numCoeffs = 0;
-    inFile.read(reinterpret_cast<char*>(&numFrames), sizeof(numFrames));
-    inFile.read(reinterpret_cast<char*>(&numCoeffs), sizeof(numCoeffs));
-    if (!inFile || numFrames == 0 || numCoeffs == 0)
+    const auto index = library->indexOf(masterCallId);
+    if (!index)
+        return Status::FILE_NOT_FOUND;
+    if (!library->verify(*index)) {
+        LOG_WARN(Component::UNIFIED_ENGINE,
+                 "Master call library entry failed its checksum: " + masterCallId);
         return Status::PROCESSING_ERROR;
+    }
 
-    session.masterCallFeatures.assign(numFrames, std::vector<float>(numCoeffs));
-    for (uint32_t i = 0; i < numFrames; ++i) {
-        inFile.read(reinterpret_cast<char*>(session.masterCallFeatures[i].data()),
-                    numCoeffs * sizeof(float));
+    const auto view = library->at(*index);
+    session.masterCallFeatures = view.featureMatrix();
+    session.masterCallRms = 0.0f;
+    session.masterCallDuration = 0.0f;
+
+    // Level and length come from the stored audio, read in place from the mapping
+    if (!view.audio.empty() && view.audioSampleRate > 0) {
+        double sumSquares = 0.0;
+        for (const int16_t sample : view.audio) {
+            const double value = static_cast<double>(sample) * view.audioScale;
+            sumSquares += value * value;
+        }
+        session.masterCallRms = static_cast<float>(std::sqrt(sumSquares / view.audio.size()));
+        session.masterCallDuration =
+            static_cast<float>(view.audio.size()) / static_cast<float>(view.audioSampleRate);
+    }
+    return Status::OK;
+}
+
+UnifiedAudioEngine::Status
+UnifiedAudioEngine::Impl::loadFeaturesFromFile(SessionState& session,
+                                               const std::string& masterCallId) {
+    const std::string path = featureFilePath(masterCallId);
+    auto file = FeatureFile::open(path, session.featureConfig);
+    if (!file) {
+        if (file.error() == FeatureFileError::FILE_NOT_FOUND)
+            return Status::FILE_NOT_FOUND;
+        // Old format, other MFCC settings or corruption: the caller re-extracts
+        // from the audio and overwrites the cache
+        LOG_DEBUG(Component::UNIFIED_ENGINE, "Ignoring stale feature cache: " + path);
+        return Status::PROCESSING_ERROR;
     }
-    return inFile.good() ? Status::OK : Status::PROCESSING_ERROR;
+
+    session.masterCallFeatures = file->featureMatrix();
+    session.masterCallRms = 0.0f;  // Feature files carry no audio
+    session.masterCallDuration = 0.0f;
+    return Status::OK;
 }
 
 void UnifiedAudioEngine::Impl::saveFeaturesToFile(const SessionState& session,
                                                   const std::string& masterCallId) {
-    const std::string featureFilePath = featuresPath_ + masterCallId + ".mfc";
-    std::ofstream outFile(featureFilePath, std::ios::binary);
-    if (!outFile || session.masterCallFeatures.empty())
+    if (session.masterCallFeatures.empty())
         return;
 
-    uint32_t numFrames = static_cast<uint32_t>(session.masterCallFeatures.size());
-    uint32_t numCoeffs = static_cast<uint32_t>(session.masterCallFeatures[0].size());
-    outFile.write(reinterpret_cast<const char*>(&numFrames), sizeof(numFrames));
-    outFile.write(reinterpret_cast<const char*>(&numCoeffs), sizeof(numCoeffs));
+    const std::string path = featureFilePath(masterCallId);
+    if (!FeatureFile::write(path, session.featureConfig, session.masterCallFeatures)) {
+        LOG_DEBUG(Component::UNIFIED_ENGINE, "Could not cache features: " + path);
+    }
+}
 
-    for (const auto& frame : session.masterCallFeatures) {
-        outFile.write(reinterpret_cast<const char*>(frame.data()), frame.size() * sizeof(float));
+std::string UnifiedAudioEngine::Impl::masterCallAudioPath(const std::string& masterCallId) const {
+    std::lock_guard<std::mutex> lock(pathsMutex_);
+    return masterCallsPath_ + masterCallId + ".wav";
+}
+
+std::string UnifiedAudioEngine::Impl::featureFilePath(const std::string& masterCallId) const {
+    std::lock_guard<std::mutex> lock(pathsMutex_);
+    return featuresPath_ + masterCallId + ".mfc";
+}
+
+void UnifiedAudioEngine::Impl::setScorerMasterCall(SessionState& session) {
+    if (session.realtimeScorer
+        && !session.realtimeScorer->setMasterCallFeatures(session.masterCallFeatures,
+                                                          session.featureConfig,
+                                                          session.masterCallRms,
+                                                          session.masterCallDuration)) {
+        // The features stay loaded; only realtime scoring is unavailable
+        LOG_WARN(Component::UNIFIED_ENGINE,
+                 "RealtimeScorer rejected master call features: " + session.masterCallId);
     }
 }
 
@@ -10,11 +10,68 @@
 
 #include "huntmaster/core/DebugLogger.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 // Enable debug output for VoiceActivityDetector
 #define DEBUG_VAD 0
 
 namespace huntmaster {
 
+namespace {
+
+// Sum of squares with double accumulation, matching the scalar energy definition
+double sumOfSquares(const float* data, size_t count) {
+    size_t i = 0;
+    double sum = 0.0;
+
+#if defined(__AVX2__)
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v = _mm256_loadu_ps(data + i);
+        const __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        const __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(lo, lo));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(hi, hi));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__)
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(data + i);
+        const __m128d lo = _mm_cvtps_pd(v);
+        const __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(lo, lo));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(hi, hi));
+    }
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+    sum = lanes[0] + lanes[1];
+#endif
+
+    for (; i < count; ++i) {
+        sum += static_cast<double>(data[i]) * data[i];
+    }
+    return sum;
+}
+
+// Spectral mode tuning
+constexpr size_t kSpectralBands = 8;
+constexpr size_t kNoiseSubwindows = 4;
+constexpr float kBandSmoothing = 0.7f;
+constexpr float kMinStatsBias = 1.5f;  // Minimum of a smoothed periodogram underestimates the mean
+constexpr float kPowerFloor = 1e-12f;
+
+}  // namespace
+
 // Internal state machine for VAD logic
 enum class VADState { SILENCE, VOICE_CANDIDATE, VOICE_ACTIVE, HANGOVER };
 
@@ -35,6 +92,24 @@ class VoiceActivityDetector::Impl {
     // Frame counting for more reliable candidate duration tracking
     int frames_in_candidate_state_ = 0;
 
+    // Scratch for batch processing, reused across chunks
+    std::vector<float> window_energies_;
+
+    // Spectral mode: band layout and minimum-statistics noise tracking
+    struct SpectralState {
+        size_t spectrum_bins = 0;
+        size_t fft_size = 0;
+        std::vector<size_t> band_edges;     // Bin boundaries, bands + 1 entries
+        std::vector<float> band_power;      // Current frame
+        std::vector<float> smoothed_power;  // Recursively smoothed band power
+        std::vector<float> subwindow_min;   // Running minimum of the current sub-window
+        std::vector<float> history_min;     // kNoiseSubwindows minima per band
+        size_t subwindow_length = 1;
+        size_t frames_in_subwindow = 0;
+        size_t history_index = 0;
+        size_t frames_seen = 0;
+    } spectral_;
+
     explicit Impl(const Config& config)
         : config_(config), adaptive_threshold_(config.energy_threshold) {
         const auto now = std::chrono::steady_clock::now();
@@ -45,11 +120,17 @@ class VoiceActivityDetector::Impl {
     float computeEnergy(std::span<const float> audio) {
         if (audio.empty())
             return 0.0f;
-        double sum_sq = 0.0;
-        for (float sample : audio) {
-            sum_sq += static_cast<double>(sample) * sample;
+        return static_cast<float>(sumOfSquares(audio.data(), audio.size()) / audio.size());
+    }
+
+    void computeWindowEnergies(std::span<const float> audio, size_t window_size) {
+        const size_t window_count = audio.size() / window_size;
+        window_energies_.resize(window_count);
+        for (size_t w = 0; w < window_count; ++w) {
+            const float* window = audio.data() + w * window_size;
+            const double sum_sq = sumOfSquares(window, window_size);
+            window_energies_[w] = static_cast<float>(sum_sq / window_size);
         }
-        return static_cast<float>(sum_sq / audio.size());
     }
 
     void updateAdaptiveThreshold(float current_energy) {
@@ -59,16 +140,141 @@ class VoiceActivityDetector::Impl {
     }
 
     VADResult process(std::span<const float> audio) {
+        return step(computeEnergy(audio));
+    }
+
+    // Advance the state machine by one window with a precomputed energy
+    VADResult step(float energy) {
+        updateAdaptiveThreshold(energy);
+        return advance(energy > adaptive_threshold_, energy, config_.window_duration);
+    }
+
+    // Time covered by one spectral hop, kept below millisecond resolution
+    std::chrono::nanoseconds spectralStep() const {
+        const auto rate = std::max<size_t>(1, config_.sample_rate);
+        const auto nanos = config_.spectral_hop_size * 1'000'000'000ull / rate;
+        return std::chrono::nanoseconds(std::max<int64_t>(1, static_cast<int64_t>(nanos)));
+    }
+
+    void configureSpectralBands(size_t spectrum_bins) {
+        auto& sp = spectral_;
+        sp = SpectralState{};
+        sp.spectrum_bins = spectrum_bins;
+        sp.fft_size = 2 * (spectrum_bins - 1);
+
+        const float bin_hz = static_cast<float>(config_.sample_rate) / sp.fft_size;
+        const size_t low_bin = std::clamp<size_t>(
+            static_cast<size_t>(config_.spectral_min_frequency / bin_hz), 1, spectrum_bins - 2);
+        const size_t high_bin = std::clamp<size_t>(
+            static_cast<size_t>(config_.spectral_max_frequency / bin_hz),
+            low_bin + 1,
+            spectrum_bins);
+
+        // Log-spaced edges; collapse duplicates when the band is narrow in bins
+        sp.band_edges.push_back(low_bin);
+        const float ratio = static_cast<float>(high_bin) / static_cast<float>(low_bin);
+        for (size_t b = 1; b <= kSpectralBands; ++b) {
+            const auto edge = static_cast<size_t>(
+                std::round(low_bin * std::pow(ratio, static_cast<float>(b) / kSpectralBands)));
+            if (edge > sp.band_edges.back()) {
+                sp.band_edges.push_back(std::min(edge, high_bin));
+            }
+        }
+        if (sp.band_edges.back() < high_bin) {
+            sp.band_edges.push_back(high_bin);
+        }
+
+        const size_t bands = sp.band_edges.size() - 1;
+        sp.band_power.assign(bands, 0.0f);
+        sp.smoothed_power.assign(bands, 0.0f);
+        sp.subwindow_min.assign(bands, 0.0f);
+        sp.history_min.assign(bands * kNoiseSubwindows, 0.0f);
+
+        const auto frames = static_cast<size_t>(
+            std::max<int64_t>(1, config_.noise_floor_window / spectralStep()));
+        sp.subwindow_length = std::max<size_t>(1, frames / kNoiseSubwindows);
+    }
+
+    VADResult processSpectral(std::span<const float> spectrum) {
+        auto& sp = spectral_;
+        if (spectrum.size() != sp.spectrum_bins) {
+            configureSpectralBands(spectrum.size());
+        }
+
+        const size_t bands = sp.band_power.size();
+        const size_t first_bin = sp.band_edges.front();
+        const size_t last_bin = sp.band_edges.back();
+
+        // Band powers and spectral flatness over the analysis range
+        double log_sum = 0.0;
+        double linear_sum = 0.0;
+        for (size_t b = 0; b < bands; ++b) {
+            double band = 0.0;
+            for (size_t k = sp.band_edges[b]; k < sp.band_edges[b + 1]; ++k) {
+                const double power = std::max(spectrum[k], kPowerFloor);
+                band += power;
+                log_sum += std::log(power);
+            }
+            linear_sum += band;
+            sp.band_power[b] = static_cast<float>(band);
+        }
+        const double bin_count = static_cast<double>(last_bin - first_bin);
+        const float flatness =
+            static_cast<float>(std::exp(log_sum / bin_count) / (linear_sum / bin_count));
+
+        // Minimum statistics: smooth, then track minima over kNoiseSubwindows sub-windows
+        if (sp.frames_seen++ == 0) {
+            sp.smoothed_power = sp.band_power;
+            sp.subwindow_min = sp.band_power;
+            for (size_t i = 0; i < sp.history_min.size(); ++i) {
+                sp.history_min[i] = sp.band_power[i % bands];
+            }
+        } else {
+            for (size_t b = 0; b < bands; ++b) {
+                sp.smoothed_power[b] = kBandSmoothing * sp.smoothed_power[b]
+                                       + (1.0f - kBandSmoothing) * sp.band_power[b];
+                sp.subwindow_min[b] = std::min(sp.subwindow_min[b], sp.smoothed_power[b]);
+            }
+        }
+        if (++sp.frames_in_subwindow >= sp.subwindow_length) {
+            std::copy(sp.subwindow_min.begin(),
+                      sp.subwindow_min.end(),
+                      sp.history_min.begin() + sp.history_index * bands);
+            sp.history_index = (sp.history_index + 1) % kNoiseSubwindows;
+            sp.frames_in_subwindow = 0;
+            sp.subwindow_min = sp.smoothed_power;
+        }
+
+        float snr_sum = 0.0f;
+        for (size_t b = 0; b < bands; ++b) {
+            float noise = sp.subwindow_min[b];
+            for (size_t h = 0; h < kNoiseSubwindows; ++h) {
+                noise = std::min(noise, sp.history_min[h * bands + b]);
+            }
+            const float band_floor = kPowerFloor * (sp.band_edges[b + 1] - sp.band_edges[b]);
+            noise = std::max(noise * kMinStatsBias, band_floor);
+            const float snr_db = 10.0f * std::log10(std::max(sp.band_power[b], band_floor) / noise);
+            snr_sum += std::max(0.0f, snr_db);
+        }
+        const float mean_snr_db = snr_sum / bands;
+
+        const float threshold = config_.spectral_snr_threshold_db;
+        const bool is_candidate =
+            mean_snr_db > threshold
+            && (flatness <= config_.spectral_flatness_threshold || mean_snr_db > 2.0f * threshold);
+
+        const float scale = 1.0f / (static_cast<float>(sp.fft_size) * sp.fft_size);
+        return advance(is_candidate, static_cast<float>(linear_sum) * scale, spectralStep());
+    }
+
+    // Run the temporal state machine for one window of length `window`
+    VADResult advance(bool is_currently_active, float energy, std::chrono::nanoseconds window) {
         using namespace std::chrono;
 
         // Advance internal time by the duration of the audio window
-        current_time_ += config_.window_duration;
+        current_time_ += window;
         const auto now = current_time_;
 
-        const float energy = computeEnergy(audio);
-        updateAdaptiveThreshold(energy);
-
-        bool is_currently_active = energy > adaptive_threshold_;
         VADResult result{.energy_level = energy};
 
         switch (state_) {
@@ -76,7 +282,7 @@ class VoiceActivityDetector::Impl {
                 if (is_currently_active) {
                     state_ = VADState::VOICE_CANDIDATE;
                     frames_in_candidate_state_ = 1;
-                    voice_start_time_ = now - config_.window_duration;
+                    voice_start_time_ = now - window;
                 }
                 break;
 
@@ -84,8 +290,7 @@ class VoiceActivityDetector::Impl {
                 if (is_currently_active) {
                     frames_in_candidate_state_++;
                     // Calculate total duration of consecutive voice frames
-                    const auto candidate_duration =
-                        frames_in_candidate_state_ * config_.window_duration;
+                    const auto candidate_duration = frames_in_candidate_state_ * window;
                     if (candidate_duration >= config_.min_sound_duration) {
                         state_ = VADState::VOICE_ACTIVE;
                     }
@@ -144,12 +349,70 @@ VoiceActivityDetector::processWindow(std::span<const float> audio) {
     return result;
 }
 
+huntmaster::expected<VADChunkResult, VADError>
+VoiceActivityDetector::processChunk(std::span<const float> audio, size_t window_size) {
+    if (audio.empty() || window_size == 0) {
+        return huntmaster::unexpected(VADError::INVALID_INPUT);
+    }
+
+    if (!pimpl_) {
+        return huntmaster::unexpected(VADError::NOT_INITIALIZED);
+    }
+
+    pimpl_->computeWindowEnergies(audio, window_size);
+
+    VADChunkResult result;
+    result.windows_processed = pimpl_->window_energies_.size();
+    result.samples_consumed = result.windows_processed * window_size;
+
+    // Coalesce runs of active windows into spans over the input
+    size_t run_start = 0;
+    size_t run_length = 0;
+    for (size_t w = 0; w < result.windows_processed; ++w) {
+        if (pimpl_->step(pimpl_->window_energies_[w]).is_active) {
+            if (run_length == 0) {
+                run_start = w * window_size;
+            }
+            run_length += window_size;
+        } else if (run_length > 0) {
+            result.active_spans.push_back(audio.subspan(run_start, run_length));
+            run_length = 0;
+        }
+    }
+    if (run_length > 0) {
+        result.active_spans.push_back(audio.subspan(run_start, run_length));
+    }
+
+    result.is_active = isVoiceActive();
+    return result;
+}
+
+huntmaster::expected<VADResult, VADError>
+VoiceActivityDetector::processSpectrum(std::span<const float> power_spectrum) {
+    if (power_spectrum.size() < 3) {
+        return huntmaster::unexpected(VADError::INVALID_INPUT);
+    }
+
+    if (!pimpl_) {
+        return huntmaster::unexpected(VADError::NOT_INITIALIZED);
+    }
+
+    for (float power : power_spectrum) {
+        if (!std::isfinite(power) || power < 0.0f) {
+            return huntmaster::unexpected(VADError::INVALID_INPUT);
+        }
+    }
+
+    return pimpl_->processSpectral(power_spectrum);
+}
+
 void VoiceActivityDetector::reset() {
     pimpl_->state_ = VADState::SILENCE;
     pimpl_->energy_history_.clear();
     pimpl_->adaptive_threshold_ = pimpl_->config_.energy_threshold;
     pimpl_->current_time_ = std::chrono::steady_clock::now();
     pimpl_->frames_in_candidate_state_ = 0;
+    pimpl_->spectral_ = {};
 }
 
 bool VoiceActivityDetector::isVoiceActive() const noexcept {
@@ -7,6 +7,7 @@
 #include <deque>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
@@ -14,6 +15,60 @@
 
 namespace huntmaster {
 
+namespace {
+
+/// Min/max/energy summary of a run of samples
+struct OverviewNode {
+    float minimum = std::numeric_limits<float>::max();
+    float maximum = std::numeric_limits<float>::lowest();
+    double sumSquares = 0.0;
+
+    void add(float sample) {
+        minimum = std::min(minimum, sample);
+        maximum = std::max(maximum, sample);
+        sumSquares += static_cast<double>(sample) * sample;
+    }
+
+    void merge(const OverviewNode& other) {
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+        sumSquares += other.sumSquares;
+    }
+};
+
+/**
+ * @brief One level of the overview pyramid
+ *
+ * Nodes live in fixed-size contiguous chunks, so appending never relocates existing
+ * nodes and growth on the audio path costs at most one chunk allocation.
+ */
+class OverviewLevel {
+  public:
+    static constexpr size_t kChunkShift = 12;
+    static constexpr size_t kChunkNodes = size_t{1} << kChunkShift;
+
+    void push(const OverviewNode& node) {
+        if ((size_ & (kChunkNodes - 1)) == 0) {
+            chunks_.emplace_back();
+            chunks_.back().reserve(kChunkNodes);
+        }
+        chunks_.back().push_back(node);
+        ++size_;
+    }
+
+    [[nodiscard]] const OverviewNode& operator[](size_t index) const {
+        return chunks_[index >> kChunkShift][index & (kChunkNodes - 1)];
+    }
+
+    [[nodiscard]] size_t size() const { return size_; }
+
+  private:
+    std::vector<std::vector<OverviewNode>> chunks_;
+    size_t size_ = 0;
+};
+
+}  // namespace
+
 struct WaveformGenerator::Impl {
     Config config_;
     std::mutex mutex_;
@@ -34,6 +89,13 @@ struct WaveformGenerator::Impl {
     size_t rmsIndex_{0};
     size_t rmsWindowSamples_;
 
+    // Overview pyramid: level 0 holds overviewBlockSize-sample blocks, each level
+    // above pairs up the one below. The incomplete trailing block is kept aside.
+    std::vector<OverviewLevel> overviewLevels_;
+    OverviewNode pendingBlock_;
+    size_t pendingBlockCount_{0};
+    size_t overviewSamples_{0};
+
     // Processing state
     WaveformData waveform_;
     std::atomic<bool> initialized_{false};
@@ -53,6 +115,7 @@ struct WaveformGenerator::Impl {
         rmsBuffer_.clear();
         downsampleAccumulator_.clear();
         downsampleCount_ = 0;
+        resetOverview();
 
         if (config_.enableRmsOverlay) {
             rmsWindowSamples_ =
@@ -65,7 +128,59 @@ struct WaveformGenerator::Impl {
         }
     }
 
+    void resetOverview() {
+        overviewLevels_.clear();
+        pendingBlock_ = OverviewNode{};
+        pendingBlockCount_ = 0;
+        overviewSamples_ = 0;
+    }
+
+    void appendOverviewSample(float sample) {
+        pendingBlock_.add(sample);
+        ++overviewSamples_;
+        if (++pendingBlockCount_ < config_.overviewBlockSize) {
+            return;
+        }
+
+        // Push the completed block and carry merged pairs upward
+        OverviewNode node = pendingBlock_;
+        pendingBlock_ = OverviewNode{};
+        pendingBlockCount_ = 0;
+        for (size_t level = 0;; ++level) {
+            if (level == overviewLevels_.size()) {
+                overviewLevels_.emplace_back();
+            }
+            OverviewLevel& nodes = overviewLevels_[level];
+            nodes.push(node);
+            if ((nodes.size() & 1) != 0) {
+                break;
+            }
+            OverviewNode parent = nodes[nodes.size() - 2];
+            parent.merge(node);
+            node = parent;
+        }
+    }
+
+    /// Combine complete level-0 blocks [first, last) from O(log n) pyramid nodes
+    [[nodiscard]] OverviewNode queryBlocks(size_t first, size_t last) const {
+        OverviewNode result;
+        for (size_t level = 0; first < last; ++level, first >>= 1, last >>= 1) {
+            const OverviewLevel& nodes = overviewLevels_[level];
+            if ((first & 1) != 0) {
+                result.merge(nodes[first++]);
+            }
+            if ((last & 1) != 0) {
+                result.merge(nodes[--last]);
+            }
+        }
+        return result;
+    }
+
     void processSample(float sample) {
+        if (config_.enableOverview) {
+            appendOverviewSample(sample);
+        }
+
         float absSample = std::abs(sample);
 
         // Update current max amplitude (with safety limit to prevent infinite loops)
@@ -242,6 +357,85 @@ WaveformGenerator::WaveformData WaveformGenerator::getWaveformRange(float startT
     return result;
 }
 
+WaveformGenerator::OverviewResult WaveformGenerator::getOverview(float startTimeMs,
+                                                                float durationMs,
+                                                                size_t pixelWidth) const noexcept {
+    if (pixelWidth == 0 || !(startTimeMs >= 0.0f) || !(durationMs > 0.0f)) {
+        return huntmaster::unexpected(Error::INVALID_RANGE);
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        if (!impl_->config_.enableOverview || impl_->overviewSamples_ == 0) {
+            return huntmaster::unexpected(Error::INSUFFICIENT_DATA);
+        }
+
+        const double samplesPerMs = impl_->config_.sampleRate / 1000.0;
+        const size_t totalSamples = impl_->overviewSamples_;
+        const size_t startSample = static_cast<size_t>(startTimeMs * samplesPerMs);
+        if (startSample >= totalSamples) {
+            return huntmaster::unexpected(Error::INVALID_RANGE);
+        }
+        const size_t endSample = std::min(
+            totalSamples,
+            std::max(startSample + 1,
+                     static_cast<size_t>((startTimeMs + durationMs) * samplesPerMs)));
+
+        const size_t blockSize = impl_->config_.overviewBlockSize;
+        const size_t completeBlocks =
+            impl_->overviewLevels_.empty() ? 0 : impl_->overviewLevels_[0].size();
+        const double samplesPerPixel =
+            static_cast<double>(endSample - startSample) / static_cast<double>(pixelWidth);
+
+        WaveformOverview overview;
+        overview.startSample = startSample;
+        overview.endSample = endSample;
+        overview.samplesPerPixel = samplesPerPixel;
+        overview.minimums.resize(pixelWidth, 0.0f);
+        overview.maximums.resize(pixelWidth, 0.0f);
+        overview.rms.resize(pixelWidth, 0.0f);
+
+        for (size_t pixel = 0; pixel < pixelWidth; ++pixel) {
+            const size_t pixelStart = startSample + static_cast<size_t>(pixel * samplesPerPixel);
+            const size_t pixelEnd =
+                std::max(pixelStart + 1,
+                         startSample + static_cast<size_t>((pixel + 1) * samplesPerPixel));
+
+            // Widen to whole blocks so peaks straddling a column boundary are kept
+            const size_t firstBlock = pixelStart / blockSize;
+            const size_t lastBlock = (pixelEnd + blockSize - 1) / blockSize;
+            const size_t lastComplete = std::min(lastBlock, completeBlocks);
+
+            OverviewNode node;
+            size_t count = 0;
+            if (firstBlock < lastComplete) {
+                node = impl_->queryBlocks(firstBlock, lastComplete);
+                count = (lastComplete - firstBlock) * blockSize;
+            }
+            if (lastBlock > completeBlocks && impl_->pendingBlockCount_ > 0) {
+                node.merge(impl_->pendingBlock_);
+                count += impl_->pendingBlockCount_;
+            }
+
+            if (count > 0) {
+                overview.minimums[pixel] = node.minimum;
+                overview.maximums[pixel] = node.maximum;
+                overview.rms[pixel] = static_cast<float>(std::sqrt(node.sumSquares / count));
+            }
+        }
+
+        return overview;
+
+    } catch (...) {
+        return huntmaster::unexpected(Error::INTERNAL_ERROR);
+    }
+}
+
+size_t WaveformGenerator::getOverviewLevelCount() const noexcept {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    return impl_->overviewLevels_.size();
+}
+
 std::string WaveformGenerator::exportToJson(bool includeRawSamples) const {
     std::lock_guard<std::mutex> lock(impl_->mutex_);
 
@@ -14,8 +14,11 @@
 
 #include <algorithm>
 #include <cmath>
-#include <future>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <thread>
 
@@ -24,6 +27,16 @@
 #include "../../include/huntmaster/core/AudioBuffer.h"
 #include "../../include/huntmaster/core/AudioConfig.h"
 
+#ifdef _WIN32
+#include <Windows.h>
+#include <memoryapi.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // Advanced Waveform Analysis and Visualization System Implementation
 // ================================================================
 //
@@ -41,6 +54,148 @@
 
 namespace huntmaster {
 
+namespace {
+
+// Overview cache file layout: header, level table, then per level the min, max and
+// RMS arrays (float32, native endianness), each level starting on a 64-byte boundary.
+constexpr char kOverviewMagic[4] = {'H', 'M', 'W', 'O'};
+constexpr uint16_t kOverviewVersion = 1;
+constexpr uint64_t kOverviewAlignment = 64;
+
+struct OverviewFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t level_count;
+    float sample_rate;
+    uint32_t channel_count;
+    uint64_t frame_count;
+    uint64_t reserved;
+};
+static_assert(sizeof(OverviewFileHeader) == 32, "Overview header layout changed");
+
+struct OverviewFileLevel {
+    uint32_t level;
+    uint32_t samples_per_pixel;
+    uint64_t point_count;
+    uint64_t data_offset;
+};
+static_assert(sizeof(OverviewFileLevel) == 24, "Overview level layout changed");
+
+uint64_t alignOverviewOffset(uint64_t offset) {
+    return (offset + kOverviewAlignment - 1) & ~(kOverviewAlignment - 1);
+}
+
+}  // namespace
+
+// Read-only view of one resolution level, backed by memory or by the mapped cache
+struct WaveformAnalyzer::LevelView {
+    int level = 0;
+    size_t samples_per_pixel = 1;
+    const float* min_samples = nullptr;
+    const float* max_samples = nullptr;
+    const float* rms_samples = nullptr;
+    size_t size = 0;
+};
+
+struct WaveformAnalyzer::MappedOverview {
+    void* data = nullptr;
+    size_t size = 0;
+    std::vector<LevelView> levels;  // Indexed by level; absent levels have size 0
+    int first_level = 0;
+    int last_level = 0;
+#ifdef _WIN32
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE mapping_handle = nullptr;
+#else
+    int file_descriptor = -1;
+#endif
+
+    ~MappedOverview() {
+        unmap();
+    }
+
+    bool map(const std::string& path) {
+#ifdef _WIN32
+        file_handle = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0) {
+            return false;
+        }
+        size = static_cast<size_t>(file_size.QuadPart);
+
+        mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_handle) {
+            return false;
+        }
+
+        data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        return data != nullptr;
+#else
+        file_descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file_descriptor < 0) {
+            return false;
+        }
+
+        struct stat file_stat;
+        if (fstat(file_descriptor, &file_stat) < 0 || file_stat.st_size == 0) {
+            return false;
+        }
+        size = static_cast<size_t>(file_stat.st_size);
+
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        data = mapped;
+
+        // Display queries touch small slices of each level
+        madvise(data, size, MADV_RANDOM);
+        return true;
+#endif
+    }
+
+    void unmap() {
+#ifdef _WIN32
+        if (data) {
+            UnmapViewOfFile(data);
+        }
+        if (mapping_handle) {
+            CloseHandle(mapping_handle);
+            mapping_handle = nullptr;
+        }
+        if (file_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_handle);
+            file_handle = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data) {
+            munmap(data, size);
+        }
+        if (file_descriptor >= 0) {
+            ::close(file_descriptor);
+            file_descriptor = -1;
+        }
+#endif
+        data = nullptr;
+        size = 0;
+        levels.clear();
+    }
+
+    const uint8_t* bytes() const {
+        return static_cast<const uint8_t*>(data);
+    }
+};
+
 WaveformAnalyzer::WaveformAnalyzer(const AudioConfig& config)
     : config_(config), sample_rate_(config.sample_rate), is_initialized_(false), fft_plan_(nullptr),
       fft_input_(nullptr), fft_output_(nullptr), window_function_(WindowFunction::HANN),
@@ -218,34 +373,23 @@ bool WaveformAnalyzer::generateWaveformData(const AudioBuffer& audio_buffer) {
         }
 
         // Clear existing data
+        releaseMappedOverview();
         clearWaveformData();
 
         // Store original audio data
         // Note: In a full implementation, this would copy or reference the audio data
         // For now, we'll just store the duration
-        audio_duration_ = static_cast<float>(audio_buffer.getFrameCount()) / sample_rate_;
-
-        // Generate multiple resolution levels
-        std::vector<std::future<bool>> level_futures;
-
-        for (int level = 0; level < MAX_ZOOM_LEVELS; ++level) {
-            level_futures.push_back(std::async(std::launch::async, [this, &audio_buffer, level]() {
-                return generateWaveformLevel(audio_buffer, level);
-            }));
-        }
+        frame_count_ = audio_buffer.getFrameCount();
+        audio_duration_ = static_cast<float>(frame_count_) / sample_rate_;
 
-        // Wait for all levels to complete
-        bool all_successful = true;
-        for (auto& future : level_futures) {
-            if (!future.get()) {
-                all_successful = false;
-            }
-        }
-
-        if (!all_successful) {
+        // Only the finest level reads the audio; each coarser level halves the one below
+        if (!generateWaveformLevel(audio_buffer, 0)) {
             console_error("Failed to generate some waveform levels");
             return false;
         }
+        for (int level = 1; level < MAX_ZOOM_LEVELS; ++level) {
+            reduceWaveformLevel(level, frame_count_);
+        }
 
         // Update statistics
         updateWaveformStatistics();
@@ -317,12 +461,56 @@ bool WaveformAnalyzer::generateWaveformLevel(const AudioBuffer& audio_buffer, in
     }
 }
 
+void WaveformAnalyzer::reduceWaveformLevel(int level, size_t frame_count) {
+    const WaveformLevel& source = waveform_levels_[level - 1];
+    WaveformLevel& target = waveform_levels_[level];
+    const size_t samples_per_pixel = size_t{1} << level;
+    const size_t child_span = samples_per_pixel / 2;
+
+    target.level = level;
+    target.samples_per_pixel = samples_per_pixel;
+    target.decimation_factor = samples_per_pixel;
+
+    const size_t source_size = source.min_samples.size();
+    const size_t output_size = (source_size + 1) / 2;
+    target.min_samples.resize(output_size);
+    target.max_samples.resize(output_size);
+    target.rms_samples.resize(output_size);
+
+    for (size_t i = 0; i < output_size; ++i) {
+        const size_t left = 2 * i;
+        const size_t right = left + 1;
+        if (right >= source_size) {
+            target.min_samples[i] = source.min_samples[left];
+            target.max_samples[i] = source.max_samples[left];
+            target.rms_samples[i] = source.rms_samples[left];
+            continue;
+        }
+
+        // The last child may cover a partial span; weight the RMS merge by frame count
+        const float right_frames =
+            static_cast<float>(std::min(child_span, frame_count - right * child_span));
+        const float left_frames = static_cast<float>(child_span);
+        const float left_rms = source.rms_samples[left];
+        const float right_rms = source.rms_samples[right];
+
+        target.min_samples[i] = std::min(source.min_samples[left], source.min_samples[right]);
+        target.max_samples[i] = std::max(source.max_samples[left], source.max_samples[right]);
+        target.rms_samples[i] =
+            std::sqrt((left_rms * left_rms * left_frames + right_rms * right_rms * right_frames)
+                      / (left_frames + right_frames));
+    }
+
+    console_log("Generated waveform level " + std::to_string(level) + " with "
+                + std::to_string(output_size) + " points");
+}
+
 WaveformData
 WaveformAnalyzer::getWaveformData(float start_time, float end_time, int target_width) const {
     WaveformData result;
 
     try {
-        if (!is_initialized_ || waveform_levels_.empty()) {
+        if (!is_initialized_ || (waveform_levels_.empty() && !mapped_overview_)) {
             console_error("WaveformAnalyzer not ready");
             return result;
         }
@@ -339,7 +527,7 @@ WaveformAnalyzer::getWaveformData(float start_time, float end_time, int target_w
 
         // Select appropriate resolution level
         const int best_level = selectOptimalLevel(start_time, end_time, target_width);
-        const WaveformLevel& level = waveform_levels_[best_level];
+        const LevelView level = getLevelView(best_level);
 
         // Calculate sample range
         [[maybe_unused]] const float duration = end_time - start_time;
@@ -348,8 +536,7 @@ WaveformAnalyzer::getWaveformData(float start_time, float end_time, int target_w
 
         // Map to waveform level indices
         const size_t start_index = start_sample / level.samples_per_pixel;
-        const size_t end_index =
-            std::min(end_sample / level.samples_per_pixel, level.min_samples.size());
+        const size_t end_index = std::min(end_sample / level.samples_per_pixel, level.size);
 
         // Extract data
         const size_t data_size = end_index - start_index;
@@ -367,12 +554,12 @@ WaveformAnalyzer::getWaveformData(float start_time, float end_time, int target_w
         result.start_time = start_time;
         result.end_time = end_time;
         result.sample_rate = sample_rate_;
-        result.resolution_level = best_level;
+        result.resolution_level = level.level;
         result.samples_per_pixel = level.samples_per_pixel;
         result.is_valid = true;
 
         console_log("Retrieved waveform data: " + std::to_string(data_size) + " points at level "
-                    + std::to_string(best_level));
+                    + std::to_string(level.level));
 
     } catch (const std::exception& e) {
         console_error("Waveform data retrieval failed: " + std::string(e.what()));
@@ -382,6 +569,215 @@ WaveformAnalyzer::getWaveformData(float start_time, float end_time, int target_w
     return result;
 }
 
+// Overview Cache Implementation
+// =============================
+// The multi-resolution overview is written once to a sidecar file and later
+// memory-mapped, so displaying a stored recording needs neither the audio samples
+// nor another reduction pass. Only the mapped pages a query touches are read.
+std::string WaveformAnalyzer::getOverviewCachePath(const std::string& audio_path) {
+    return audio_path + ".hmwo";
+}
+
+bool WaveformAnalyzer::saveOverviewCache(const std::string& cache_path,
+                                         size_t min_samples_per_pixel) const {
+    try {
+        std::vector<LevelView> levels;
+        for (int level = 0; level < MAX_ZOOM_LEVELS; ++level) {
+            const LevelView view = getLevelView(level);
+            if (view.size > 0 && view.level == level
+                && view.samples_per_pixel >= min_samples_per_pixel) {
+                levels.push_back(view);
+            }
+        }
+
+        if (levels.empty()) {
+            console_error("No waveform data to cache");
+            return false;
+        }
+
+        OverviewFileHeader header{};
+        std::memcpy(header.magic, kOverviewMagic, sizeof(header.magic));
+        header.version = kOverviewVersion;
+        header.level_count = static_cast<uint16_t>(levels.size());
+        header.sample_rate = sample_rate_;
+        header.channel_count = static_cast<uint32_t>(config_.channel_count);
+        header.frame_count = frame_count_;
+
+        std::vector<OverviewFileLevel> table(levels.size());
+        uint64_t offset = sizeof(OverviewFileHeader) + table.size() * sizeof(OverviewFileLevel);
+        for (size_t i = 0; i < levels.size(); ++i) {
+            offset = alignOverviewOffset(offset);
+            table[i].level = static_cast<uint32_t>(levels[i].level);
+            table[i].samples_per_pixel = static_cast<uint32_t>(levels[i].samples_per_pixel);
+            table[i].point_count = levels[i].size;
+            table[i].data_offset = offset;
+            offset += 3 * levels[i].size * sizeof(float);
+        }
+
+        // Write beside the target and rename, so a reader never maps a partial file
+        const std::string temp_path = cache_path + ".tmp";
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                console_error("Failed to open overview cache for writing: " + temp_path);
+                return false;
+            }
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(table.data()),
+                      static_cast<std::streamsize>(table.size() * sizeof(OverviewFileLevel)));
+
+            const char padding[kOverviewAlignment] = {};
+            for (size_t i = 0; i < levels.size(); ++i) {
+                const auto position = static_cast<uint64_t>(out.tellp());
+                out.write(padding, static_cast<std::streamsize>(table[i].data_offset - position));
+
+                const auto bytes = static_cast<std::streamsize>(levels[i].size * sizeof(float));
+                out.write(reinterpret_cast<const char*>(levels[i].min_samples), bytes);
+                out.write(reinterpret_cast<const char*>(levels[i].max_samples), bytes);
+                out.write(reinterpret_cast<const char*>(levels[i].rms_samples), bytes);
+            }
+
+            if (!out) {
+                console_error("Failed to write overview cache: " + temp_path);
+                return false;
+            }
+        }
+        std::filesystem::rename(temp_path, cache_path);
+
+        console_log("Wrote overview cache with " + std::to_string(levels.size()) + " levels: "
+                    + cache_path);
+        return true;
+
+    } catch (const std::exception& e) {
+        console_error("Overview cache write failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool WaveformAnalyzer::loadOverviewCache(const std::string& cache_path) {
+    try {
+        if (!is_initialized_) {
+            console_error("WaveformAnalyzer not initialized");
+            return false;
+        }
+
+        auto mapped = std::make_unique<MappedOverview>();
+        if (!mapped->map(cache_path)) {
+            console_error("Failed to map overview cache: " + cache_path);
+            return false;
+        }
+
+        OverviewFileHeader header{};
+        if (mapped->size < sizeof(header)) {
+            console_error("Overview cache truncated: " + cache_path);
+            return false;
+        }
+        std::memcpy(&header, mapped->bytes(), sizeof(header));
+
+        if (std::memcmp(header.magic, kOverviewMagic, sizeof(header.magic)) != 0
+            || header.version != kOverviewVersion || header.level_count == 0
+            || header.level_count > MAX_ZOOM_LEVELS) {
+            console_error("Invalid overview cache header: " + cache_path);
+            return false;
+        }
+        if (std::abs(header.sample_rate - sample_rate_) > 0.5f) {
+            console_error("Overview cache sample rate mismatch: "
+                          + std::to_string(header.sample_rate));
+            return false;
+        }
+
+        const uint64_t table_end =
+            sizeof(header) + static_cast<uint64_t>(header.level_count) * sizeof(OverviewFileLevel);
+        if (mapped->size < table_end) {
+            console_error("Overview cache truncated: " + cache_path);
+            return false;
+        }
+
+        mapped->levels.assign(MAX_ZOOM_LEVELS, LevelView{});
+        int previous_level = -1;
+        for (uint16_t i = 0; i < header.level_count; ++i) {
+            OverviewFileLevel entry{};
+            std::memcpy(&entry,
+                        mapped->bytes() + sizeof(header) + i * sizeof(OverviewFileLevel),
+                        sizeof(entry));
+
+            const uint64_t array_bytes = entry.point_count * sizeof(float);
+            const bool valid = static_cast<int>(entry.level) > previous_level
+                               && entry.level < static_cast<uint32_t>(MAX_ZOOM_LEVELS)
+                               && entry.samples_per_pixel == (uint32_t{1} << entry.level)
+                               && entry.data_offset >= table_end
+                               && entry.data_offset % alignof(float) == 0
+                               && entry.point_count <= mapped->size / (3 * sizeof(float))
+                               && entry.data_offset + 3 * array_bytes <= mapped->size;
+            if (!valid) {
+                console_error("Invalid overview cache level table: " + cache_path);
+                return false;
+            }
+
+            const auto* base = reinterpret_cast<const float*>(mapped->bytes() + entry.data_offset);
+            LevelView& view = mapped->levels[entry.level];
+            view.level = static_cast<int>(entry.level);
+            view.samples_per_pixel = entry.samples_per_pixel;
+            view.min_samples = base;
+            view.max_samples = base + entry.point_count;
+            view.rms_samples = base + 2 * entry.point_count;
+            view.size = static_cast<size_t>(entry.point_count);
+
+            if (previous_level < 0) {
+                mapped->first_level = view.level;
+            }
+            mapped->last_level = view.level;
+            previous_level = view.level;
+        }
+
+        clearWaveformData();
+        mapped_overview_ = std::move(mapped);
+        frame_count_ = static_cast<size_t>(header.frame_count);
+        audio_duration_ = static_cast<float>(frame_count_) / sample_rate_;
+        updateWaveformStatistics();
+
+        console_log("Mapped overview cache with " + std::to_string(header.level_count)
+                    + " levels: " + cache_path);
+        return true;
+
+    } catch (const std::exception& e) {
+        console_error("Overview cache load failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
+WaveformAnalyzer::LevelView WaveformAnalyzer::getLevelView(int level) const {
+    LevelView view;
+
+    if (mapped_overview_) {
+        // Levels finer than the cache holds are served by the finest stored level
+        const int clamped =
+            std::clamp(level, mapped_overview_->first_level, mapped_overview_->last_level);
+        if (clamped < static_cast<int>(mapped_overview_->levels.size())) {
+            view = mapped_overview_->levels[clamped];
+        }
+        return view;
+    }
+
+    if (level < 0 || level >= static_cast<int>(waveform_levels_.size())) {
+        return view;
+    }
+
+    const WaveformLevel& source = waveform_levels_[level];
+    view.level = level;
+    view.samples_per_pixel = source.samples_per_pixel;
+    view.min_samples = source.min_samples.data();
+    view.max_samples = source.max_samples.data();
+    view.rms_samples = source.rms_samples.data();
+    view.size = source.min_samples.size();
+    return view;
+}
+
+void WaveformAnalyzer::releaseMappedOverview() {
+    mapped_overview_.reset();
+}
+
 // Frequency Spectrum Analysis Implementation
 // ==========================================
 // This section provides high-resolution FFT analysis with configurable window sizes,
@@ -841,16 +1237,17 @@ void WaveformAnalyzer::updateWaveformStatistics() {
         statistics_.rms_level = 0.0f;
         statistics_.dynamic_range = 0.0f;
 
-        for (const auto& level : waveform_levels_) {
-            if (!level.max_samples.empty()) {
-                auto max_it = std::max_element(level.max_samples.begin(), level.max_samples.end());
+        for (int index = 0; index < MAX_ZOOM_LEVELS; ++index) {
+            const LevelView level = getLevelView(index);
+            if (level.size > 0) {
+                auto max_it = std::max_element(level.max_samples, level.max_samples + level.size);
                 statistics_.max_amplitude = std::max(statistics_.max_amplitude, *max_it);
 
                 float sum_squares = 0.0f;
-                for (float rms : level.rms_samples) {
-                    sum_squares += rms * rms;
+                for (size_t i = 0; i < level.size; ++i) {
+                    sum_squares += level.rms_samples[i] * level.rms_samples[i];
                 }
-                statistics_.rms_level = std::sqrt(sum_squares / level.rms_samples.size());
+                statistics_.rms_level = std::sqrt(sum_squares / level.size);
             }
         }
 
@@ -1000,7 +1397,18 @@ int WaveformAnalyzer::selectOptimalLevel(float start, float end, int width) cons
             optimal_level = level;
         }
 
-        return std::min(optimal_level, static_cast<int>(waveform_levels_.size() - 1));
+        if (mapped_overview_) {
+            // Only the cached levels exist; fall back to the nearest finer one stored
+            int level = std::clamp(
+                optimal_level, mapped_overview_->first_level, mapped_overview_->last_level);
+            while (level > mapped_overview_->first_level
+                   && mapped_overview_->levels[level].size == 0) {
+                --level;
+            }
+            return level;
+        }
+        return std::clamp(
+            optimal_level, 0, std::max(static_cast<int>(waveform_levels_.size()) - 1, 0));
     } catch (const std::exception& e) {
         console_error("Failed to select optimal level: " + std::string(e.what()));
         return 0;
@@ -1037,6 +1445,7 @@ void WaveformAnalyzer::cleanup() {
     }
 
     // Clear containers and free memory
+    releaseMappedOverview();
     waveform_levels_.clear();
     similarity_colors_.clear();
     window_functions_.clear();
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <limits>
 #include <random>
+#include <span>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -399,6 +400,55 @@ TEST_F(CadenceAnalyzerComprehensiveTest, PeriodicityAnalysis) {
     }
 }
 
+// Test 6b: Onset-envelope autocorrelation recovers the pulse period, batch and streaming
+TEST_F(CadenceAnalyzerComprehensiveTest, OnsetEnvelopePeriodicity) {
+    auto analyzerResult = CadenceAnalyzer::create(standard_config);
+    ASSERT_TRUE(analyzerResult.has_value());
+    auto analyzer = std::move(analyzerResult.value());
+
+    // Decaying 440 Hz grunts every 0.5 s (120 BPM)
+    const float sampleRate = standard_config.sampleRate;
+    std::vector<float> signal(static_cast<size_t>(4.0f * sampleRate), 0.0f);
+    for (size_t start = 0; start < signal.size(); start += static_cast<size_t>(0.5f * sampleRate)) {
+        for (size_t i = 0; i < static_cast<size_t>(0.05f * sampleRate); ++i) {
+            if (start + i >= signal.size()) {
+                break;
+            }
+            float t = static_cast<float>(i) / sampleRate;
+            signal[start + i] = std::exp(-t / 0.01f) * std::sin(2.0f * M_PI * 440.0f * t);
+        }
+    }
+
+    auto periodicity = analyzer->analyzePerodicity(signal);
+    ASSERT_TRUE(periodicity.has_value());
+    EXPECT_NEAR(periodicity.value().dominantPeriod, 0.5f, 0.015f);
+    EXPECT_GT(periodicity.value().periodicityStrength, 0.5f);
+    ASSERT_FALSE(periodicity.value().periodicities.empty());
+
+    auto tempo = analyzer->estimateTempo(signal);
+    ASSERT_TRUE(tempo.has_value());
+    EXPECT_NEAR(tempo.value().first, 120.0f, 4.0f);
+    EXPECT_GT(tempo.value().second, 0.5f);
+
+    // Streaming: the rolling onset history yields the same tempo without re-analysing the past
+    analyzer->reset();
+    const size_t chunkSize = 4410;
+    for (size_t offset = 0; offset < signal.size(); offset += chunkSize) {
+        size_t count = std::min(chunkSize, signal.size() - offset);
+        ASSERT_TRUE(
+            analyzer->processAudioChunk(std::span<const float>(signal.data() + offset, count))
+                .has_value());
+    }
+    auto current = analyzer->getCurrentAnalysis();
+    ASSERT_TRUE(current.has_value());
+    EXPECT_NEAR(current.value().estimatedTempo, 120.0f, 4.0f);
+    EXPECT_NEAR(current.value().periodicity.dominantPeriod, 0.5f, 0.015f);
+
+    // Too short for a single analysis frame
+    std::vector<float> tooShort(100, 0.0f);
+    EXPECT_FALSE(analyzer->analyzePerodicity(tooShort).has_value());
+}
+
 // Test 7: Syllable segmentation - targeting syllable analysis paths
 TEST_F(CadenceAnalyzerComprehensiveTest, SyllableSegmentation) {
     auto analyzerResult = CadenceAnalyzer::create(standard_config);
@@ -10,6 +10,7 @@
 #include <complex>
 #include <limits>
 #include <random>
+#include <span>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -283,6 +284,76 @@ TEST_F(HarmonicAnalyzerComprehensiveTest, FormantExtraction) {
     }
 }
 
+// Test 5b: LPC formants on a source-filter signal with known resonances
+TEST_F(HarmonicAnalyzerComprehensiveTest, LPCFormantsTrackResonances) {
+    auto analyzerResult = HarmonicAnalyzer::create(standard_config);
+    ASSERT_TRUE(analyzerResult.has_value());
+    auto analyzer = std::move(analyzerResult.value());
+
+    // 120 Hz pulse train through a cascade of two-pole resonators
+    const std::vector<std::pair<float, float>> resonances = {
+        {700.0f, 80.0f}, {1200.0f, 90.0f}, {2600.0f, 120.0f}};
+    const size_t length = standard_config.fftSize * 2;
+    const auto period = static_cast<size_t>(standard_config.sampleRate / 120.0f);
+
+    std::vector<float> signal(length, 0.0f);
+    for (size_t i = 0; i < length; i += period) {
+        signal[i] = 1.0f;
+    }
+    for (const auto& [frequency, bandwidth] : resonances) {
+        double r = std::exp(-M_PI * bandwidth / standard_config.sampleRate);
+        double a1 = 2.0 * r * std::cos(2.0 * M_PI * frequency / standard_config.sampleRate);
+        double a2 = -r * r;
+        double y1 = 0.0, y2 = 0.0;
+        for (auto& sample : signal) {
+            double y = sample + a1 * y1 + a2 * y2;
+            y2 = y1;
+            y1 = y;
+            sample = static_cast<float>(y);
+        }
+    }
+    float peak = 0.0f;
+    for (float sample : signal) {
+        peak = std::max(peak, std::abs(sample));
+    }
+    for (auto& sample : signal) {
+        sample *= 0.5f / peak;
+    }
+
+    auto result = analyzer->extractFormants(signal);
+    ASSERT_TRUE(result.has_value());
+    const auto& formants = result.value();
+    ASSERT_GE(formants.size(), resonances.size());
+    for (size_t i = 0; i < resonances.size(); ++i) {
+        EXPECT_NEAR(formants[i], resonances[i].first, resonances[i].first * 0.08f)
+            << "Formant F" << (i + 1);
+    }
+
+    // The LPC frame is shorter than the FFT, so short inputs still yield formants
+    std::span<const float> shortFrame(signal.data(), standard_config.lpcFrameSize);
+    auto shortResult = analyzer->extractFormants(shortFrame);
+    ASSERT_TRUE(shortResult.has_value());
+    EXPECT_FALSE(shortResult.value().empty());
+
+    // Streaming analysis updates formants and real bandwidths on every hop
+    ASSERT_TRUE(analyzer->processAudioChunk(signal).has_value());
+    auto current = analyzer->getCurrentAnalysis();
+    ASSERT_TRUE(current.has_value());
+    ASSERT_FALSE(current.value().formants.empty());
+    ASSERT_EQ(current.value().formants.size(), current.value().formantBandwidths.size());
+    EXPECT_NEAR(current.value().formants[0], 700.0f, 56.0f);
+    for (float bandwidth : current.value().formantBandwidths) {
+        EXPECT_GT(bandwidth, 0.0f);
+        EXPECT_LE(bandwidth, standard_config.maxFormantBandwidth);
+    }
+
+    // Silence has no envelope
+    std::vector<float> silence(standard_config.fftSize, 0.0f);
+    auto silentResult = analyzer->extractFormants(silence);
+    ASSERT_TRUE(silentResult.has_value());
+    EXPECT_TRUE(silentResult.value().empty());
+}
+
 // Test 6: Tonal quality assessment - targeting assessTonalQualities path
 TEST_F(HarmonicAnalyzerComprehensiveTest, TonalQualityAssessment) {
     auto analyzerResult = HarmonicAnalyzer::create(standard_config);
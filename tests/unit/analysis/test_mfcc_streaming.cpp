@@ -0,0 +1,85 @@
+/**
+ * @file test_mfcc_streaming.cpp
+ * @brief Tests for pull-based MFCC extraction with bounded memory
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/core/MFCCProcessor.h"
+
+using namespace huntmaster;
+
+namespace {
+
+class MFCCStreamingTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        config_.sample_rate = 44100;
+        config_.frame_size = 512;
+        signal_.resize(44100 + 123);
+        for (size_t i = 0; i < signal_.size(); ++i) {
+            const float t = static_cast<float>(i) / 44100.0f;
+            signal_[i] = 0.5f * std::sin(2.0f * 3.14159265f * 440.0f * t)
+                         + 0.2f * std::sin(2.0f * 3.14159265f * (1000.0f + 2000.0f * t) * t);
+        }
+    }
+
+    /// Source serving signal_ in pieces no larger than maxRead
+    MFCCProcessor::SampleSource sourceOf(size_t maxRead) {
+        position_ = 0;
+        return [this, maxRead](std::span<float> out) {
+            const size_t count = std::min({out.size(), maxRead, signal_.size() - position_});
+            std::copy_n(signal_.begin() + position_, count, out.begin());
+            position_ += count;
+            return count;
+        };
+    }
+
+    MFCCProcessor::Config config_;
+    std::vector<float> signal_;
+    size_t position_ = 0;
+};
+
+TEST_F(MFCCStreamingTest, MatchesBufferExtraction) {
+    MFCCProcessor processor(config_);
+
+    // Hops below, equal to and above the frame size; sources that under-deliver
+    for (size_t hop : {256u, 512u, 700u}) {
+        auto expected = processor.extractFeaturesFromBuffer(signal_, hop);
+        ASSERT_TRUE(expected.has_value());
+
+        for (size_t maxRead : {100u, 4096u}) {
+            auto streamed = processor.extractFeaturesFromStream(sourceOf(maxRead), hop, 1000);
+            ASSERT_TRUE(streamed.has_value());
+            ASSERT_EQ(streamed->size(), expected->size()) << "hop " << hop;
+            for (size_t i = 0; i < expected->size(); ++i) {
+                ASSERT_EQ((*streamed)[i], (*expected)[i]) << "hop " << hop << " frame " << i;
+            }
+        }
+    }
+}
+
+TEST_F(MFCCStreamingTest, RejectsInvalidStreams) {
+    MFCCProcessor processor(config_);
+
+    auto empty = processor.extractFeaturesFromStream(
+        [](std::span<float>) { return size_t{0}; }, 256);
+    ASSERT_FALSE(empty.has_value());
+    EXPECT_EQ(empty.error(), MFCCError::INVALID_INPUT);
+
+    EXPECT_FALSE(processor.extractFeaturesFromStream(sourceOf(512), 0).has_value());
+    EXPECT_FALSE(processor.extractFeaturesFromStream(nullptr, 256).has_value());
+
+    // Shorter than one frame: valid stream, no frames
+    signal_.resize(100);
+    auto shortStream = processor.extractFeaturesFromStream(sourceOf(512), 256);
+    ASSERT_TRUE(shortStream.has_value());
+    EXPECT_TRUE(shortStream->empty());
+}
+
+}  // namespace
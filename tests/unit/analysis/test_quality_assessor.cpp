@@ -0,0 +1,151 @@
+/**
+ * @file test_quality_assessor.cpp
+ * @brief Tests for QualityAssessor spectral and streaming measurements
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/QualityAssessor.h"
+
+using namespace huntmaster::core;
+
+namespace {
+
+constexpr float kTwoPi = 2.0f * static_cast<float>(M_PI);
+
+/// Mono buffer over a sample vector
+class VectorAudioBuffer : public AudioBuffer {
+  public:
+    explicit VectorAudioBuffer(std::vector<float> samples) : samples_(std::move(samples)) {}
+
+    bool isEmpty() const override { return samples_.empty(); }
+    size_t getFrameCount() const override { return samples_.size(); }
+    size_t getChannelCount() const override { return 1; }
+    float getSample(size_t, size_t frame) const override { return samples_[frame]; }
+
+  private:
+    std::vector<float> samples_;
+};
+
+class QualityAssessorTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        config_ = createDefaultQualityConfig();
+        config_.enableAdaptiveThresholds = false;
+        ASSERT_TRUE(assessor_.initialize(config_));
+    }
+
+    /// Fundamental plus harmonics with the given amplitudes, starting at sample `offset`
+    std::vector<float> harmonicMix(float fundamental,
+                                   const std::vector<float>& amplitudes,
+                                   size_t length,
+                                   size_t offset = 0) const {
+        std::vector<float> samples(length);
+        for (size_t i = 0; i < length; ++i) {
+            const float t = static_cast<float>(i + offset) / config_.sampleRate;
+            for (size_t h = 0; h < amplitudes.size(); ++h) {
+                samples[i] += amplitudes[h] * std::sin(kTwoPi * fundamental * (h + 1) * t);
+            }
+        }
+        return samples;
+    }
+
+    float binFrequency(size_t bin) const {
+        return static_cast<float>(bin) * config_.sampleRate / config_.fftSize;
+    }
+
+    QualityConfig config_;
+    QualityAssessor assessor_;
+};
+
+TEST_F(QualityAssessorTest, THDOfKnownHarmonicMix) {
+    // 10% second and 5% third harmonic: THD = sqrt(0.1^2 + 0.05^2) = 11.18%
+    const auto mix =
+        harmonicMix(binFrequency(20), {0.5f, 0.05f, 0.025f}, config_.analysisWindowSize);
+    EXPECT_NEAR(assessor_.calculateTHD(VectorAudioBuffer(mix)), 11.18f, 0.2f);
+
+    // Off-bin fundamental still resolves within a few tenths of a percent
+    const auto offBin =
+        harmonicMix(binFrequency(33) + 7.0f, {0.5f, 0.05f}, config_.analysisWindowSize);
+    EXPECT_NEAR(assessor_.calculateTHD(VectorAudioBuffer(offBin)), 10.0f, 0.5f);
+
+    const auto pure = harmonicMix(binFrequency(20), {0.5f}, config_.analysisWindowSize);
+    EXPECT_LT(assessor_.calculateTHD(VectorAudioBuffer(pure)), 0.1f);
+}
+
+TEST_F(QualityAssessorTest, SNROfToneInNoise) {
+    std::mt19937 rng(1234);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+
+    // Tone power 0.125; noise power sigma^2 gives the reference SNR
+    for (const float sigma : {0.05f, 0.01f}) {
+        auto samples = harmonicMix(1000.0f, {0.5f}, config_.analysisWindowSize);
+        for (float& sample : samples) {
+            sample += sigma * noise(rng);
+        }
+        const float expected = 10.0f * std::log10(0.125f / (sigma * sigma));
+        EXPECT_NEAR(assessor_.calculateSNR(VectorAudioBuffer(samples)), expected, 1.5f)
+            << "sigma " << sigma;
+    }
+}
+
+TEST_F(QualityAssessorTest, RealtimeHopsTrackBlockResult) {
+    const size_t hop = config_.analysisHopSize;
+    const size_t window = config_.analysisWindowSize;
+    const float fundamental = binFrequency(20);
+    const std::vector<float> amplitudes = {0.5f, 0.05f, 0.025f};
+
+    const auto block = assessor_.assessQuality(
+        VectorAudioBuffer(harmonicMix(fundamental, amplitudes, window)));
+    ASSERT_EQ(block.errorCode, 0);
+    ASSERT_FALSE(block.frequencyResponse.empty());
+
+    // Stream the same signal one hop at a time; once a full window has been seen every hop
+    // must report what a block assessment of the latest window reports.
+    const auto stream = harmonicMix(fundamental, amplitudes, window * 4);
+    QualityMetrics realtime;
+    for (size_t offset = 0; offset + hop <= stream.size(); offset += hop) {
+        ASSERT_TRUE(assessor_.assessQualityRealtime(stream.data() + offset, hop, realtime));
+        const size_t seen = offset + hop;
+        if (seen < window) {
+            EXPECT_EQ(realtime.totalHarmonicDistortion, 0.0f);
+            continue;
+        }
+
+        const std::vector<float> latest(stream.begin() + (seen - window), stream.begin() + seen);
+        const VectorAudioBuffer latestBuffer(latest);
+        EXPECT_NEAR(realtime.totalHarmonicDistortion, assessor_.calculateTHD(latestBuffer), 0.05f)
+            << "hop ending at " << seen;
+        EXPECT_NEAR(realtime.totalHarmonicDistortion, block.totalHarmonicDistortion, 0.2f);
+
+        const auto response = assessor_.analyzeFrequencyResponse(latestBuffer);
+        ASSERT_EQ(realtime.frequencyResponse.size(), response.size());
+        for (size_t band = 0; band < response.size(); ++band) {
+            // Quiet bands sit on window leakage, so compare with an absolute dB margin
+            EXPECT_NEAR(realtime.frequencyResponse[band], response[band], 1.0f)
+                << "band " << band << " at " << seen;
+        }
+    }
+
+    // A reset discards the stream so the next window starts from scratch
+    assessor_.resetRealtimeState();
+    ASSERT_TRUE(assessor_.assessQualityRealtime(stream.data(), hop, realtime));
+    EXPECT_EQ(realtime.totalHarmonicDistortion, 0.0f);
+}
+
+TEST_F(QualityAssessorTest, RejectsUseBeforeInitialization) {
+    QualityAssessor uninitialized;
+    const VectorAudioBuffer buffer(std::vector<float>(1024, 0.1f));
+    EXPECT_EQ(uninitialized.assessQuality(buffer).errorCode, -20);
+    EXPECT_EQ(uninitialized.calculateTHD(buffer), 0.0f);
+
+    QualityMetrics metrics;
+    const float sample = 0.0f;
+    EXPECT_FALSE(uninitialized.assessQualityRealtime(&sample, 1, metrics));
+}
+
+}  // namespace
@@ -9,8 +9,13 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -485,6 +490,118 @@ TEST_F(WaveformAnalyzerComprehensiveTest, ResetStatistics) {
     EXPECT_GE(stats.memory_usage, 0);
 }
 
+// ============================================================================
+// Overview Cache Tests
+// ============================================================================
+
+TEST_F(WaveformAnalyzerComprehensiveTest, OverviewCacheRoundTrip) {
+    ASSERT_TRUE(analyzer->initialize());
+    ASSERT_TRUE(analyzer->generateWaveformData(*complex_audio));
+
+    const auto audio_path = std::filesystem::temp_directory_path() / "overview_cache_test.wav";
+    const std::string cache_path = WaveformAnalyzer::getOverviewCachePath(audio_path.string());
+    ASSERT_TRUE(analyzer->saveOverviewCache(cache_path));
+
+    auto generated = analyzer->getWaveformData(0.0f, 2.0f, 200);
+    ASSERT_TRUE(generated.is_valid);
+
+    // A fresh analyzer serves the same view from the mapped file without any audio
+    WaveformAnalyzer cached(config);
+    ASSERT_TRUE(cached.initialize());
+    ASSERT_TRUE(cached.loadOverviewCache(cache_path));
+    EXPECT_TRUE(cached.hasMappedOverview());
+
+    auto mapped = cached.getWaveformData(0.0f, 2.0f, 200);
+    ASSERT_TRUE(mapped.is_valid);
+    EXPECT_EQ(mapped.resolution_level, generated.resolution_level);
+    ASSERT_EQ(mapped.max_values.size(), generated.max_values.size());
+    for (size_t i = 0; i < mapped.max_values.size(); ++i) {
+        EXPECT_FLOAT_EQ(mapped.min_values[i], generated.min_values[i]);
+        EXPECT_FLOAT_EQ(mapped.max_values[i], generated.max_values[i]);
+        EXPECT_FLOAT_EQ(mapped.rms_values[i], generated.rms_values[i]);
+    }
+    EXPECT_FLOAT_EQ(cached.getStatistics().max_amplitude, analyzer->getStatistics().max_amplitude);
+
+    // Zooming past the finest cached level falls back to that level
+    auto zoomed = cached.getWaveformData(0.0f, 0.01f, 400);
+    ASSERT_TRUE(zoomed.is_valid);
+    EXPECT_GE(zoomed.samples_per_pixel, DEFAULT_OVERVIEW_CACHE_MIN_SAMPLES_PER_PIXEL);
+
+    // Regenerating from audio drops the mapping
+    ASSERT_TRUE(cached.generateWaveformData(*test_audio));
+    EXPECT_FALSE(cached.hasMappedOverview());
+
+    std::filesystem::remove(cache_path);
+}
+
+TEST_F(WaveformAnalyzerComprehensiveTest, OverviewCacheSelectsOnlyStoredLevels) {
+    ASSERT_TRUE(analyzer->initialize());
+    ASSERT_TRUE(analyzer->generateWaveformData(*complex_audio));
+    const auto generated = analyzer->getWaveformData(0.0f, 1.0f, 40);
+    ASSERT_TRUE(generated.is_valid);
+    const int wanted = generated.resolution_level;
+
+    const auto cache_path = std::filesystem::temp_directory_path() / "overview_cache_sparse.hmwo";
+    ASSERT_TRUE(analyzer->saveOverviewCache(cache_path.string()));
+
+    // Drop the wanted level from the level table (32-byte header, 24-byte entries)
+    std::string bytes;
+    {
+        std::ifstream in(cache_path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    uint16_t level_count = 0;
+    std::memcpy(&level_count, bytes.data() + 6, sizeof(level_count));
+    bool removed = false;
+    for (uint16_t i = 0; i < level_count && !removed; ++i) {
+        uint32_t level = 0;
+        std::memcpy(&level, bytes.data() + 32 + i * 24, sizeof(level));
+        if (static_cast<int>(level) == wanted) {
+            bytes.erase(32 + i * 24, 24);
+            bytes.insert(32 + (level_count - 1) * 24, 24, '\0');
+            removed = true;
+        }
+    }
+    ASSERT_TRUE(removed);
+    --level_count;
+    std::memcpy(bytes.data() + 6, &level_count, sizeof(level_count));
+    {
+        std::ofstream out(cache_path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // The nearest finer stored level serves the view instead of an absent one
+    WaveformAnalyzer cached(config);
+    ASSERT_TRUE(cached.initialize());
+    ASSERT_TRUE(cached.loadOverviewCache(cache_path.string()));
+    const auto sparse = cached.getWaveformData(0.0f, 1.0f, 40);
+    ASSERT_TRUE(sparse.is_valid);
+    EXPECT_EQ(sparse.resolution_level, wanted - 1);
+    EXPECT_NEAR(static_cast<double>(sparse.max_values.size()),
+                2.0 * static_cast<double>(generated.max_values.size()), 1.0);
+
+    std::filesystem::remove(cache_path);
+}
+
+TEST_F(WaveformAnalyzerComprehensiveTest, OverviewCacheRejectsInvalidFiles) {
+    ASSERT_TRUE(analyzer->initialize());
+
+    const auto cache_path = std::filesystem::temp_directory_path() / "overview_cache_invalid.hmwo";
+    EXPECT_FALSE(analyzer->loadOverviewCache(cache_path.string()));
+
+    {
+        std::ofstream out(cache_path, std::ios::binary);
+        out << "not an overview cache file";
+    }
+    EXPECT_FALSE(analyzer->loadOverviewCache(cache_path.string()));
+    EXPECT_FALSE(analyzer->hasMappedOverview());
+
+    // Nothing generated yet, so there is nothing to save
+    EXPECT_FALSE(analyzer->saveOverviewCache(cache_path.string()));
+
+    std::filesystem::remove(cache_path);
+}
+
 // ============================================================================
 // Memory Management and Cleanup Tests
 // ============================================================================
@@ -1,4 +1,7 @@
+#include <atomic>
+#include <condition_variable>
 #include <latch>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -319,3 +322,174 @@ TEST_F(AudioBufferPoolTest, FactoryErrorConditions) {
     EXPECT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), BufferPoolError::INVALID_CONFIGURATION);
 }
+
+// Requests are served from the smallest size class that fits
+TEST_F(AudioBufferPoolTest, SizeClassSelection) {
+    AudioBufferPool::Config config;
+    config.pool_size = 2;
+    config.buffer_size = 1024;
+    config.size_classes = {256, 4096};
+    AudioBufferPool sized(config);
+
+    EXPECT_EQ(sized.getStats().total_buffers, 6);
+
+    auto small = sized.acquire(100);
+    ASSERT_TRUE(small.has_value());
+    EXPECT_EQ(small->bytes().size(), 256);
+
+    auto medium = sized.acquire(1000);
+    ASSERT_TRUE(medium.has_value());
+    EXPECT_EQ(medium->bytes().size(), 1024);
+
+    auto large = sized.acquire(2048);
+    ASSERT_TRUE(large.has_value());
+    EXPECT_EQ(large->size(), 4096 / sizeof(float));
+
+    // The default acquire() uses the configured buffer_size class
+    auto fallback = sized.acquire();
+    ASSERT_TRUE(fallback.has_value());
+    EXPECT_EQ(fallback->bytes().size(), 1024);
+    EXPECT_EQ(sized.available(), 2);
+
+    auto too_large = sized.tryAcquireFor(8192, std::chrono::milliseconds(0));
+    EXPECT_FALSE(too_large.has_value());
+    EXPECT_EQ(too_large.error(), BufferPoolError::REQUEST_TOO_LARGE);
+
+    // An exhausted class does not borrow from a larger one
+    auto exhausted = sized.tryAcquireFor(512, std::chrono::milliseconds(0));
+    EXPECT_FALSE(exhausted.has_value());
+    EXPECT_EQ(exhausted.error(), BufferPoolError::POOL_EXHAUSTED);
+    EXPECT_EQ(sized.getStats().failed_allocations, 2);
+
+    AudioBufferPool::Config zero_class = config;
+    zero_class.size_classes = {0};
+    auto invalid = AudioBufferPool::create(zero_class);
+    EXPECT_FALSE(invalid.has_value());
+    EXPECT_EQ(invalid.error(), BufferPoolError::INVALID_CONFIGURATION);
+}
+
+// Buffers parked in per-thread magazines, or released on another thread, are never lost
+TEST_F(AudioBufferPoolTest, ThreadCachesConserveBuffers) {
+    constexpr size_t kPoolSize = 64;
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 2000;
+    AudioBufferPool shared_pool(kPoolSize, 256);
+
+    std::latch start(kThreads);
+    std::vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            start.arrive_and_wait();
+            std::vector<AudioBufferPool::BufferHandle> held;
+            for (int i = 0; i < kIterations; ++i) {
+                auto handle = shared_pool.tryAcquireFor(std::chrono::milliseconds(100));
+                if (!handle) {
+                    failures.fetch_add(1);
+                    continue;
+                }
+                handle->data()[0] = static_cast<float>(t);
+                held.push_back(std::move(*handle));
+                if (held.size() > static_cast<size_t>(1 + i % 8)) {
+                    held.clear();
+                }
+                if (i % 64 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(shared_pool.available(), kPoolSize);
+    EXPECT_LE(shared_pool.getStats().peak_usage, kPoolSize);
+
+    // Every buffer is still reachable, including the ones exiting threads had cached
+    std::vector<AudioBufferPool::BufferHandle> all;
+    for (size_t i = 0; i < kPoolSize; ++i) {
+        auto handle = shared_pool.tryAcquireFor(std::chrono::milliseconds(0));
+        ASSERT_TRUE(handle.has_value());
+        all.push_back(std::move(*handle));
+    }
+    EXPECT_EQ(shared_pool.available(), 0);
+
+    // Release on a different thread than the one that acquired
+    std::thread releaser([&all] { all.clear(); });
+    releaser.join();
+    EXPECT_EQ(shared_pool.available(), kPoolSize);
+    EXPECT_EQ(shared_pool.tryAcquireFor(std::chrono::milliseconds(0)).has_value(), true);
+}
+
+// A long-lived consumer that only releases must not strand buffers in its magazine
+TEST_F(AudioBufferPoolTest, ProducerReacquiresBuffersReleasedByConsumer) {
+    constexpr size_t kPoolSize = 256;
+    AudioBufferPool shared_pool(kPoolSize, 256);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<AudioBufferPool::BufferHandle> handoff;
+    bool done = false;
+    std::atomic<size_t> consumed{0};
+
+    // Consumer stays alive for the whole test, so its magazine is never retired
+    std::thread consumer([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!done) {
+            cv.wait(lock, [&] { return done || !handoff.empty(); });
+            consumed += handoff.size();
+            handoff.clear();  // Releases on this thread
+        }
+    });
+
+    for (int round = 0; round < 3; ++round) {
+        std::vector<AudioBufferPool::BufferHandle> held;
+        for (size_t i = 0; i < kPoolSize; ++i) {
+            auto handle = shared_pool.tryAcquireFor(std::chrono::milliseconds(1000));
+            ASSERT_TRUE(handle.has_value()) << "round " << round << ", buffer " << i;
+            held.push_back(std::move(*handle));
+        }
+        EXPECT_EQ(shared_pool.available(), 0u);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& handle : held) {
+                handoff.push_back(std::move(handle));
+            }
+        }
+        cv.notify_one();
+        while (consumed.load() < kPoolSize * (round + 1)) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(shared_pool.available(), kPoolSize);
+    }
+
+    // Streaming: the producer blocks on an empty pool while the consumer releases
+    std::vector<AudioBufferPool::BufferHandle> held;
+    for (size_t i = 0; i < kPoolSize; ++i) {
+        auto handle = shared_pool.tryAcquireFor(std::chrono::milliseconds(1000));
+        ASSERT_TRUE(handle.has_value());
+        held.push_back(std::move(*handle));
+    }
+    for (size_t i = 0; i < 4 * kPoolSize; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            handoff.push_back(std::move(held[i % kPoolSize]));
+        }
+        cv.notify_one();
+        auto handle = shared_pool.tryAcquireFor(std::chrono::milliseconds(1000));
+        ASSERT_TRUE(handle.has_value()) << "streamed buffer " << i;
+        held[i % kPoolSize] = std::move(*handle);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    cv.notify_one();
+    consumer.join();
+    held.clear();
+    EXPECT_EQ(shared_pool.available(), kPoolSize);
+    EXPECT_EQ(shared_pool.getStats().failed_allocations, 0u);
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>  // For std::sin and M_PI
 #include <thread>
@@ -251,4 +254,115 @@ TEST(RealtimeAudioProcessorTest, PerformanceMetrics) {
               stats.total_processing_time.count() / stats.total_chunks_processed);
 }
 
+TEST(RealtimeAudioProcessorTest, MultiProducerMultiConsumerDeliversEveryChunkOnce) {
+    auto cfg = DefaultConfig();
+    cfg.ring_buffer_size = 64;
+    RealtimeAudioProcessor proc(cfg);
+
+    constexpr int kProducers = 3;
+    constexpr int kConsumers = 2;
+    constexpr int kPerProducer = 2000;
+    std::atomic<int> producers_done{0};
+    std::vector<std::vector<int>> received(kConsumers);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<float> data(4);
+            for (int i = 0; i < kPerProducer;) {
+                data[0] = static_cast<float>(p);
+                data[1] = static_cast<float>(i);
+                if (proc.tryEnqueueAudio(data)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            producers_done.fetch_add(1);
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::array<AudioChunk, 8> batch;
+            while (true) {
+                const bool done = producers_done.load() == kProducers;
+                size_t n = proc.dequeueBatch(std::span<AudioChunk>(batch));
+                for (size_t k = 0; k < n; ++k) {
+                    ASSERT_EQ(batch[k].valid_samples, 4u);
+                    received[c].push_back(static_cast<int>(batch[k].data[0]) * kPerProducer
+                                          + static_cast<int>(batch[k].data[1]));
+                }
+                if (n == 0) {
+                    if (done) {
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for (const auto& ids : received) {
+        // Each consumer sees any one producer's chunks in order
+        std::array<int, kProducers> last;
+        last.fill(-1);
+        for (int id : ids) {
+            EXPECT_GT(id % kPerProducer, last[id / kPerProducer]);
+            last[id / kPerProducer] = id % kPerProducer;
+        }
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(kProducers * kPerProducer));
+    for (int i = 0; i < kProducers * kPerProducer; ++i) {
+        ASSERT_EQ(all[i], i);
+    }
+    EXPECT_TRUE(proc.isEmpty());
+}
+
+TEST(RealtimeAudioProcessorTest, BatchEnqueueStopsWhenFull) {
+    auto cfg = DefaultConfig();
+    cfg.ring_buffer_size = 4;
+    RealtimeAudioProcessor proc(cfg);
+
+    std::vector<std::vector<float>> storage;
+    std::vector<std::span<const float>> batches;
+    for (int i = 0; i < 6; ++i) {
+        storage.push_back(MakeAudioData(8, static_cast<float>(i)));
+    }
+    for (const auto& data : storage) {
+        batches.push_back(data);
+    }
+
+    // Only the first four fit; the rest are reported as one overrun
+    EXPECT_EQ(proc.enqueueBatch(batches), 4);
+    EXPECT_TRUE(proc.isFull());
+    EXPECT_EQ(proc.getStats().buffer_overruns, 1);
+
+    std::array<AudioChunk, 3> out;
+    ASSERT_EQ(proc.dequeueBatch(std::span<AudioChunk>(out)), 3);
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_FLOAT_EQ(out[i].data[0], static_cast<float>(i));
+        EXPECT_EQ(out[i].frame_index, i);
+    }
+    EXPECT_EQ(proc.available(), 1);
+
+    // An oversized buffer ends the batch without claiming a slot for it
+    std::vector<float> oversized(AudioChunk::MAX_CHUNK_SIZE + 1, 0.0f);
+    std::vector<std::span<const float>> mixed{batches[4], oversized, batches[5]};
+    EXPECT_EQ(proc.enqueueBatch(mixed), 1);
+    EXPECT_EQ(proc.available(), 2);
+
+    // Slots wrap around after being drained
+    auto rest = proc.dequeueBatch(8);
+    ASSERT_EQ(rest.size(), 2);
+    EXPECT_FLOAT_EQ(rest[0].data[0], 3.0f);
+    EXPECT_FLOAT_EQ(rest[1].data[0], 4.0f);
+    EXPECT_TRUE(proc.isEmpty());
+}
+
 }  // namespace
\ No newline at end of file
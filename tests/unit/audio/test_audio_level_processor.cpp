@@ -331,4 +331,70 @@ TEST(AudioLevelUtilityTest, DbToLinearConversionTest) {
     EXPECT_NEAR(dbToLinear(-6.0f), 0.5f, 0.01f);  // -6 dB ≈ 0.5 linear
 }
 
+TEST_F(AudioLevelProcessorTest, KWeightedLoudnessTest) {
+    AudioLevelProcessor::Config config = config_;
+    config.sampleRate = 48000.0f;
+    AudioLevelProcessor processor(config);
+
+    // A full-scale 997 Hz sine in one channel reads -3.01 LUFS (BS.1770 calibration)
+    const float amplitude = 0.1f;  // -20 dBFS -> -23.01 LUFS
+    std::vector<float> chunk(480);
+    size_t n = 0;
+    AudioLevelProcessor::LevelMeasurement last;
+    for (int i = 0; i < 400; ++i) {  // 4 s
+        for (auto& sample : chunk) {
+            sample = amplitude * std::sin(2.0f * M_PI * 997.0f * n++ / 48000.0f);
+        }
+        auto result = processor.processAudio(chunk, 1);
+        ASSERT_TRUE(result.has_value());
+        last = *result;
+    }
+    EXPECT_NEAR(last.momentaryLufs, -23.01f, 0.1f);
+    EXPECT_NEAR(last.shortTermLufs, -23.01f, 0.1f);
+
+    // The RLB high-pass makes low rumble (wind, handling noise) read much quieter than its RMS
+    processor.reset();
+    for (int i = 0; i < 400; ++i) {
+        for (auto& sample : chunk) {
+            sample = amplitude * std::sin(2.0f * M_PI * 20.0f * n++ / 48000.0f);
+        }
+        auto result = processor.processAudio(chunk, 1);
+        ASSERT_TRUE(result.has_value());
+        last = *result;
+    }
+    EXPECT_LT(last.shortTermLufs, -30.0f);
+
+    // Reset returns the loudness windows to the absolute gate floor
+    processor.reset();
+    EXPECT_FLOAT_EQ(processor.getCurrentLevel().momentaryLufs, -70.0f);
+}
+
+TEST_F(AudioLevelProcessorTest, TruePeakTest) {
+    AudioLevelProcessor::Config config = config_;
+    config.sampleRate = 48000.0f;
+    AudioLevelProcessor processor(config);
+
+    // fs/4 sine sampled 45 degrees off its crests: samples sit at 0.707 of the true peak
+    std::vector<float> audio(4800);
+    for (size_t i = 0; i < audio.size(); ++i) {
+        audio[i] = 0.5f * std::sin(0.5f * static_cast<float>(M_PI) * i + 0.25f * M_PI);
+    }
+    auto result = processor.processAudio(audio, 1);
+    ASSERT_TRUE(result.has_value());
+
+    const float samplePeak = AudioLevelProcessor::calculatePeak(audio, 1);
+    EXPECT_NEAR(samplePeak, 0.5f / std::sqrt(2.0f), 0.001f);
+    EXPECT_NEAR(result->truePeakLinear, 0.5f, 0.03f);
+    EXPECT_GE(result->truePeakLinear, samplePeak);
+    EXPECT_NEAR(result->truePeakDb, -6.02f, 0.5f);
+
+    // Disabling loudness keeps the plain peak/RMS meter and reports no loudness
+    config.enableLoudness = false;
+    AudioLevelProcessor plain(config);
+    auto plainResult = plain.processAudio(audio, 1);
+    ASSERT_TRUE(plainResult.has_value());
+    EXPECT_NEAR(plainResult->rmsLinear, result->rmsLinear, 1e-5f);
+    EXPECT_FLOAT_EQ(plainResult->momentaryLufs, -70.0f);
+}
+
 }  // namespace huntmaster
@@ -0,0 +1,284 @@
+/**
+ * @file test_audio_stream_conversion.cpp
+ * @brief Tests for the pull-based WAV decoder, conversion stages and encoder
+ */
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "dr_wav.h"
+#include "huntmaster/core/AudioFormatConverter.h"
+
+using namespace huntmaster::core;
+
+namespace {
+
+/// WAV bytes with a LIST chunk ahead of the data, as many recorders write
+std::vector<uint8_t> makeWav(uint16_t formatTag,
+                             uint16_t bits,
+                             uint16_t channels,
+                             uint32_t rate,
+                             size_t frames) {
+    const uint32_t blockAlign = channels * bits / 8;
+    const uint32_t dataBytes = static_cast<uint32_t>(frames * blockAlign);
+    std::vector<uint8_t> wav;
+    const auto put32 = [&](uint32_t v) {
+        for (int i = 0; i < 4; ++i) {
+            wav.push_back(static_cast<uint8_t>(v >> (8 * i)));
+        }
+    };
+    const auto put16 = [&](uint16_t v) {
+        wav.push_back(static_cast<uint8_t>(v));
+        wav.push_back(static_cast<uint8_t>(v >> 8));
+    };
+    const auto tag = [&](const char* id) { wav.insert(wav.end(), id, id + 4); };
+
+    tag("RIFF");
+    put32(4 + 24 + 8 + 5 + 1 + 8 + dataBytes + (dataBytes & 1));
+    tag("WAVE");
+    tag("fmt ");
+    put32(16);
+    put16(formatTag);
+    put16(channels);
+    put32(rate);
+    put32(rate * blockAlign);
+    put16(static_cast<uint16_t>(blockAlign));
+    put16(bits);
+    tag("LIST");
+    put32(5);  // Odd size: followed by a pad byte
+    wav.insert(wav.end(), {'I', 'N', 'F', 'O', 'x', 0});
+    tag("data");
+    put32(dataBytes);
+
+    for (size_t i = 0; i < frames * channels; ++i) {
+        const double value = 0.7 * std::sin(0.05 * static_cast<double>(i));
+        if (formatTag == 3) {
+            const float sample = static_cast<float>(value);
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&sample);
+            wav.insert(wav.end(), bytes, bytes + 4);
+        } else {
+            const auto sample = static_cast<int32_t>(value * 2147483647.0);
+            for (int b = 4 - bits / 8; b < 4; ++b) {
+                wav.push_back(static_cast<uint8_t>(sample >> (8 * b)));
+            }
+        }
+    }
+    if (dataBytes & 1) {
+        wav.push_back(0);
+    }
+    return wav;
+}
+
+std::vector<float> drWavDecode(const std::vector<uint8_t>& wav,
+                               unsigned* channels = nullptr,
+                               unsigned* rate = nullptr) {
+    drwav decoder;
+    EXPECT_TRUE(drwav_init_memory(&decoder, wav.data(), wav.size(), nullptr));
+    std::vector<float> samples(decoder.totalPCMFrameCount * decoder.channels);
+    drwav_read_pcm_frames_f32(&decoder, decoder.totalPCMFrameCount, samples.data());
+    if (channels) {
+        *channels = decoder.channels;
+    }
+    if (rate) {
+        *rate = decoder.sampleRate;
+    }
+    drwav_uninit(&decoder);
+    return samples;
+}
+
+/// Reader handing out at most `step` bytes per call
+ByteReader trickleReader(const std::vector<uint8_t>& data, size_t step) {
+    auto inner = makeMemoryReader(data.data(), data.size());
+    return [inner, step](uint8_t* out, size_t size) { return inner(out, std::min(size, step)); };
+}
+
+TEST(WAVStreamDecoderTest, DecodesFormatsLikeDrWav) {
+    struct Case {
+        uint16_t tag;
+        uint16_t bits;
+    };
+    for (const Case& format : {Case{1, 8}, Case{1, 16}, Case{1, 24}, Case{1, 32}, Case{3, 32}}) {
+        const auto wav = makeWav(format.tag, format.bits, 3, 22050, 1001);
+        const auto reference = drWavDecode(wav);
+
+        // Tiny input chunks and odd read sizes exercise frames split across refills
+        WAVStreamDecoder decoder(trickleReader(wav, 7), 64);
+        ASSERT_TRUE(decoder.open()) << decoder.getLastError();
+        EXPECT_EQ(decoder.channels(), 3);
+        EXPECT_EQ(decoder.sampleRate(), 22050u);
+        ASSERT_TRUE(decoder.totalFrames().has_value());
+        EXPECT_EQ(*decoder.totalFrames(), 1001u);
+
+        std::vector<float> decoded;
+        std::vector<float> chunk(37 * 3);
+        while (const size_t frames = decoder.read(chunk.data(), 37)) {
+            decoded.insert(decoded.end(), chunk.begin(), chunk.begin() + frames * 3);
+        }
+        ASSERT_EQ(decoded.size(), reference.size()) << format.bits;
+        for (size_t i = 0; i < reference.size(); ++i) {
+            ASSERT_NEAR(decoded[i], reference[i], 1e-7f) << format.bits << "-bit at " << i;
+        }
+        EXPECT_TRUE(decoder.getLastError().empty());
+    }
+}
+
+TEST(WAVStreamDecoderTest, RejectsMalformedInput) {
+    const std::vector<uint8_t> garbage(100, 0x42);
+    WAVStreamDecoder notWav(makeMemoryReader(garbage.data(), garbage.size()));
+    EXPECT_FALSE(notWav.open());
+    EXPECT_FALSE(notWav.getLastError().empty());
+
+    auto adpcm = makeWav(1, 16, 1, 8000, 10);
+    adpcm[20] = 2;  // WAVE_FORMAT_ADPCM
+    WAVStreamDecoder unsupported(makeMemoryReader(adpcm.data(), adpcm.size()));
+    EXPECT_FALSE(unsupported.open());
+
+    // Truncated data is reported once the stream runs dry
+    auto truncated = makeWav(1, 16, 1, 8000, 1000);
+    truncated.resize(truncated.size() - 500);
+    WAVStreamDecoder shortStream(makeMemoryReader(truncated.data(), truncated.size()));
+    ASSERT_TRUE(shortStream.open());
+    std::vector<float> samples(2000);
+    EXPECT_EQ(shortStream.read(samples.data(), 2000), 750u);
+    EXPECT_FALSE(shortStream.getLastError().empty());
+}
+
+TEST(AudioStreamPipelineTest, ComposesStagesIntoABoundedConversion) {
+    const auto wav = makeWav(1, 16, 2, 48000, 48000);
+
+    auto decoder = std::make_unique<WAVStreamDecoder>(trickleReader(wav, 4096), 4096);
+    ASSERT_TRUE(decoder->open());
+    std::unique_ptr<AudioStreamSource> source = std::move(decoder);
+    source = std::make_unique<ChannelConversionStage>(std::move(source), 1);
+    source = std::make_unique<ResamplingStage>(std::move(source), 16000);
+    EXPECT_EQ(source->channels(), 1);
+    EXPECT_EQ(source->sampleRate(), 16000u);
+    ASSERT_EQ(source->totalFrames().value_or(0), 16000u);
+
+    std::vector<uint8_t> output;
+    WAVStreamEncoder encoder(
+        [&](const uint8_t* data, size_t size) {
+            output.insert(output.end(), data, data + size);
+            return size;
+        },
+        24);
+    ASSERT_TRUE(encoder.encode(*source, 1000)) << encoder.getLastError();
+    EXPECT_EQ(encoder.getFramesWritten(), 16000u);
+    EXPECT_EQ(encoder.getBytesWritten(), output.size());
+
+    unsigned channels = 0;
+    unsigned rate = 0;
+    const auto converted = drWavDecode(output, &channels, &rate);
+    EXPECT_EQ(channels, 1u);
+    EXPECT_EQ(rate, 16000u);
+    ASSERT_EQ(converted.size(), 16000u);
+
+    // Same chain without the stages' chunking, for reference
+    const auto input = drWavDecode(wav);
+    std::vector<float> mono(input.size() / 2);
+    for (size_t i = 0; i < mono.size(); ++i) {
+        mono[i] = (input[2 * i] + input[2 * i + 1]) / 2.0f;
+    }
+    PolyphaseResampler resampler({48000, 16000, 1, ResamplingQuality::HIGH});
+    std::vector<float> expected;
+    resampler.process(mono.data(), mono.size(), expected);
+    resampler.flush(expected);
+    ASSERT_EQ(expected.size(), converted.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(converted[i], expected[i], 1.0f / 4194304) << i;
+    }
+}
+
+TEST(AudioStreamPipelineTest, UnknownLengthStreamsUseStreamingSizes) {
+    auto wav = makeWav(3, 32, 1, 8000, 100);
+    std::memset(wav.data() + wav.size() - 100 * 4 - 4, 0xFF, 4);  // data size 0xFFFFFFFF
+
+    WAVStreamDecoder decoder(makeMemoryReader(wav.data(), wav.size()));
+    ASSERT_TRUE(decoder.open());
+    EXPECT_FALSE(decoder.totalFrames().has_value());
+
+    std::vector<uint8_t> output;
+    WAVStreamEncoder encoder(
+        [&](const uint8_t* data, size_t size) {
+            output.insert(output.end(), data, data + size);
+            return size;
+        },
+        32);
+    ASSERT_TRUE(encoder.encode(decoder));
+    EXPECT_EQ(encoder.getFramesWritten(), 100u);
+    ASSERT_EQ(output.size(), 44u + 400u);
+    EXPECT_EQ(std::memcmp(output.data() + 40, "\xFF\xFF\xFF\xFF", 4), 0);
+    EXPECT_EQ(std::memcmp(output.data() + 44, wav.data() + wav.size() - 400, 400), 0);
+
+    WAVStreamEncoder failing([](const uint8_t*, size_t) { return size_t{0}; });
+    WAVStreamDecoder again(makeMemoryReader(wav.data(), wav.size()));
+    ASSERT_TRUE(again.open());
+    EXPECT_FALSE(failing.encode(again));
+    EXPECT_FALSE(failing.getLastError().empty());
+}
+
+TEST(AudioStreamPipelineTest, ConvertsWavFilesThroughDescriptors) {
+    const auto dir = std::filesystem::temp_directory_path() / "huntmaster_stream_conversion";
+    std::filesystem::create_directories(dir);
+    const auto inputPath = (dir / "input.wav").string();
+    const auto outputPath = (dir / "output.wav").string();
+
+    const auto wav = makeWav(3, 32, 2, 44100, 44100);
+    std::ofstream(inputPath, std::ios::binary)
+        .write(reinterpret_cast<const char*>(wav.data()), static_cast<std::streamsize>(wav.size()));
+
+    const int inputFd = ::open(inputPath.c_str(), O_RDONLY);
+    const int outputFd = ::open(outputPath.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    ASSERT_GE(inputFd, 0);
+    ASSERT_GE(outputFd, 0);
+    const auto result = convertWAVStream(makeFileReader(inputFd),
+                                         makeFileWriter(outputFd),
+                                         {22050, 1, 16, ResamplingQuality::BALANCED});
+    ::close(inputFd);
+    ::close(outputFd);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.framesWritten, 22050u);
+    EXPECT_EQ(result.bytesWritten, std::filesystem::file_size(outputPath));
+
+    std::ifstream file(outputPath, std::ios::binary);
+    const std::vector<uint8_t> output{std::istreambuf_iterator<char>(file), {}};
+    unsigned channels = 0;
+    unsigned rate = 0;
+    EXPECT_EQ(drWavDecode(output, &channels, &rate).size(), 22050u);
+    EXPECT_EQ(channels, 1u);
+    EXPECT_EQ(rate, 22050u);
+
+    // Matching layouts pass samples through untouched
+    std::vector<uint8_t> copy;
+    const auto passthrough = convertWAVStream(
+        makeMemoryReader(wav.data(), wav.size()),
+        [&](const uint8_t* data, size_t size) {
+            copy.insert(copy.end(), data, data + size);
+            return size;
+        },
+        {0, 0, 32, ResamplingQuality::HIGH});
+    ASSERT_TRUE(passthrough.success) << passthrough.error;
+    EXPECT_EQ(drWavDecode(copy), drWavDecode(wav));
+
+    const std::vector<uint8_t> garbage(64, 0x42);
+    const auto rejected = convertWAVStream(
+        makeMemoryReader(garbage.data(), garbage.size()),
+        [](const uint8_t*, size_t size) { return size; },
+        {});
+    EXPECT_FALSE(rejected.success);
+    EXPECT_FALSE(rejected.error.empty());
+
+    std::filesystem::remove_all(dir);
+}
+
+}  // namespace
@@ -11,6 +11,7 @@
  * @date July 27, 2025
  */
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -107,6 +108,10 @@ TEST_F(CircularAudioBufferTest, ConfigurationTest) {
                 testConfig.bufferSize = bufferSize;
                 testConfig.numChannels = numChannels;
                 testConfig.sampleRate = sampleRate;
+                // Defaults require 1024+ samples and 1024-sample blocks; allow the small sizes
+                testConfig.minBufferSize = testSizes.front();
+                testConfig.writeBlockSize = std::min<size_t>(bufferSize, 256);
+                testConfig.readBlockSize = testConfig.writeBlockSize;
 
                 auto testBuffer = std::make_unique<CircularAudioBuffer>(testConfig);
 
@@ -619,3 +624,159 @@ TEST_F(CircularAudioBufferTest, MultiChannelTest) {
         EXPECT_NEAR(readData[i], stereoData[i], 1e-6f) << "Sample " << i;
     }
 }
+
+// Wait-free single-producer/single-consumer mode
+TEST_F(CircularAudioBufferTest, SpscModeWrapAroundTest) {
+    CircularBufferConfig spscConfig = config_;
+    spscConfig.bufferSize = 1500;  // Not a power of two: exercises the modulo slot mapping
+    spscConfig.enableSpscMode = true;
+    CircularAudioBuffer spscBuffer(spscConfig);
+    ASSERT_TRUE(spscBuffer.isSpscMode());
+
+    // The whole capacity is usable and a blocking write never waits
+    auto testData = generateTestAudio(spscConfig.bufferSize + 100);
+    EXPECT_EQ(spscBuffer.write(testData.data(), testData.size()), spscConfig.bufferSize);
+    EXPECT_TRUE(spscBuffer.isFull());
+    EXPECT_EQ(spscBuffer.getAvailableForWrite(), 0u);
+
+    std::vector<float> readData(1000);
+    ASSERT_EQ(spscBuffer.read(readData.data(), readData.size()), readData.size());
+    for (size_t i = 0; i < readData.size(); ++i) {
+        EXPECT_FLOAT_EQ(readData[i], testData[i]) << "Sample " << i;
+    }
+
+    // Second write wraps past the end of storage
+    auto wrapData = generateTestAudio(900, 880.0f);
+    EXPECT_EQ(spscBuffer.write(wrapData.data(), wrapData.size()), wrapData.size());
+    EXPECT_EQ(spscBuffer.getAvailableForRead(), 1400u);
+
+    std::vector<float> peeked(10);
+    EXPECT_EQ(spscBuffer.peek(peeked.data(), peeked.size(), 500), peeked.size());
+    for (size_t i = 0; i < peeked.size(); ++i) {
+        EXPECT_FLOAT_EQ(peeked[i], wrapData[i]);
+    }
+
+    EXPECT_EQ(spscBuffer.skip(500), 500u);
+    std::vector<float> wrapped(wrapData.size() + 50);
+    EXPECT_EQ(spscBuffer.read(wrapped.data(), wrapped.size()), wrapData.size());
+    for (size_t i = 0; i < wrapData.size(); ++i) {
+        EXPECT_FLOAT_EQ(wrapped[i], wrapData[i]) << "Sample " << i;
+    }
+    EXPECT_TRUE(spscBuffer.isEmpty());
+
+    spscBuffer.clear();
+    EXPECT_EQ(spscBuffer.getAvailableForWrite(), spscConfig.bufferSize);
+}
+
+TEST_F(CircularAudioBufferTest, SpscModeProducerConsumerTest) {
+    CircularBufferConfig spscConfig = config_;
+    spscConfig.enableSpscMode = true;
+    CircularAudioBuffer spscBuffer(spscConfig);
+
+    // A sample counter makes any lost, duplicated or reordered sample visible
+    const size_t totalSamples = 1 << 20;
+    const size_t writeChunk = 37;
+    const size_t readChunk = 53;
+
+    std::thread producer([&]() {
+        std::vector<float> chunk(writeChunk);
+        size_t next = 0;
+        while (next < totalSamples) {
+            const size_t count = std::min(writeChunk, totalSamples - next);
+            for (size_t i = 0; i < count; ++i) {
+                chunk[i] = static_cast<float>((next + i) % 65536);
+            }
+            size_t written = 0;
+            while (written < count) {
+                const size_t n = spscBuffer.write(chunk.data() + written, count - written);
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+                written += n;
+            }
+            next += count;
+        }
+    });
+
+    size_t received = 0;
+    size_t mismatches = 0;
+    std::vector<float> chunk(readChunk);
+    while (received < totalSamples) {
+        const size_t count = spscBuffer.read(chunk.data(), chunk.size());
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (chunk[i] != static_cast<float>((received + i) % 65536)) {
+                ++mismatches;
+            }
+        }
+        received += count;
+    }
+    producer.join();
+
+    EXPECT_EQ(received, totalSamples);
+    EXPECT_EQ(mismatches, 0u);
+    EXPECT_TRUE(spscBuffer.isEmpty());
+
+    // Counters are published in batches, so at most one interval is still pending
+    const auto stats = spscBuffer.getStatistics();
+    EXPECT_LE(stats.totalSamples.load(), totalSamples);
+    EXPECT_GE(stats.totalSamples.load(),
+              totalSamples - CircularAudioBuffer::kSpscStatisticsInterval * writeChunk);
+}
+
+// Zero-copy region API: produce and consume in place across the wrap point
+TEST_F(CircularAudioBufferTest, RegionAcquireCommitTest) {
+    for (bool spsc : {false, true}) {
+        CircularBufferConfig regionConfig = config_;
+        regionConfig.enableSpscMode = spsc;
+        CircularAudioBuffer regionBuffer(regionConfig);
+
+        // Move the ring position close to the end of storage
+        auto filler = generateSilence(1000);
+        ASSERT_EQ(regionBuffer.write(filler.data(), filler.size()), filler.size());
+        ASSERT_EQ(regionBuffer.skip(filler.size()), filler.size());
+
+        WriteRegion writeRegion = regionBuffer.acquireWrite(100);
+        ASSERT_EQ(writeRegion.size(), 100u);
+        EXPECT_EQ(writeRegion.first.size(), config_.bufferSize - 1000);
+        EXPECT_EQ(writeRegion.second.size(), 100u - writeRegion.first.size());
+
+        // Render directly into the ring, then publish only part of it
+        float value = 0.0f;
+        for (float& sample : writeRegion.first) {
+            sample = value++;
+        }
+        for (float& sample : writeRegion.second) {
+            sample = value++;
+        }
+        EXPECT_EQ(regionBuffer.getAvailableForRead(), 0u);
+        EXPECT_EQ(regionBuffer.commitWrite(60), 60u);
+        EXPECT_EQ(regionBuffer.getAvailableForRead(), 60u);
+
+        ReadRegion readRegion = regionBuffer.acquireRead(1000);
+        ASSERT_EQ(readRegion.size(), 60u);
+        float expected = 0.0f;
+        for (float sample : readRegion.first) {
+            EXPECT_FLOAT_EQ(sample, expected++);
+        }
+        for (float sample : readRegion.second) {
+            EXPECT_FLOAT_EQ(sample, expected++);
+        }
+
+        // Release part of it; the next view starts where the release stopped
+        EXPECT_EQ(regionBuffer.releaseRead(50), 50u);
+        ReadRegion tail = regionBuffer.acquireRead(100);
+        ASSERT_EQ(tail.size(), 10u);
+        EXPECT_FLOAT_EQ(tail.first.empty() ? tail.second[0] : tail.first[0], 50.0f);
+        EXPECT_EQ(regionBuffer.releaseRead(100), 10u);
+        EXPECT_TRUE(regionBuffer.isEmpty());
+
+        // Commits never exceed the free space
+        WriteRegion all = regionBuffer.acquireWrite(config_.bufferSize * 2);
+        EXPECT_EQ(all.size(), regionBuffer.getAvailableForWrite());
+        EXPECT_EQ(regionBuffer.commitWrite(config_.bufferSize * 2), all.size());
+        EXPECT_TRUE(regionBuffer.acquireWrite(1).empty());
+    }
+}
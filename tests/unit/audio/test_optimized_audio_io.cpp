@@ -0,0 +1,291 @@
+/**
+ * @file test_optimized_audio_io.cpp
+ * @brief Tests for memory-mapped decode-on-access reading and group-commit writing
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dr_wav.h"
+#include "huntmaster/core/OptimizedAudioIO.h"
+
+using namespace huntmaster;
+
+namespace {
+
+class MemoryMappedAudioFileTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        testDir_ = std::filesystem::temp_directory_path() / "huntmaster_mmap_test";
+        std::filesystem::create_directories(testDir_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir_);
+    }
+
+    /// Write a stereo sweep with the given sample format; returns the path
+    std::string writeWav(const std::string& name,
+                         uint32_t formatTag,
+                         uint32_t bitsPerSample,
+                         size_t frames) {
+        const std::string path = (testDir_ / name).string();
+        drwav_data_format format = {};
+        format.container = drwav_container_riff;
+        format.format = formatTag;
+        format.channels = 2;
+        format.sampleRate = 44100;
+        format.bitsPerSample = bitsPerSample;
+
+        const size_t bytesPerSample = bitsPerSample / 8;
+        std::vector<uint8_t> data(frames * 2 * bytesPerSample);
+        for (size_t i = 0; i < frames * 2; ++i) {
+            const double value = 0.9 * std::sin(0.001 * static_cast<double>(i * i % 100000));
+            uint8_t* out = data.data() + i * bytesPerSample;
+            if (formatTag == DR_WAVE_FORMAT_IEEE_FLOAT) {
+                const float sample = static_cast<float>(value);
+                std::memcpy(out, &sample, sizeof(sample));
+            } else {
+                // Little-endian two's complement, top bytes of a 32-bit sample
+                const auto sample = static_cast<int32_t>(value * 2147483647.0);
+                for (size_t b = 0; b < bytesPerSample; ++b) {
+                    out[b] = static_cast<uint8_t>(sample >> (8 * (4 - bytesPerSample + b)));
+                }
+            }
+        }
+
+        drwav wav;
+        EXPECT_TRUE(drwav_init_file_write(&wav, path.c_str(), &format, nullptr));
+        drwav_write_pcm_frames(&wav, frames, data.data());
+        drwav_uninit(&wav);
+        return path;
+    }
+
+    static std::vector<float> referenceDecode(const std::string& path) {
+        drwav wav;
+        EXPECT_TRUE(drwav_init_file(&wav, path.c_str(), nullptr));
+        std::vector<float> samples(wav.totalPCMFrameCount * wav.channels);
+        drwav_read_pcm_frames_f32(&wav, wav.totalPCMFrameCount, samples.data());
+        drwav_uninit(&wav);
+        return samples;
+    }
+
+    std::filesystem::path testDir_;
+};
+
+TEST_F(MemoryMappedAudioFileTest, DecodesPcmFormatsLikeDrWav) {
+    constexpr size_t kFrames = 20011;  // Odd length exercises the scalar tails
+    for (uint32_t bits : {16u, 24u, 32u}) {
+        const auto path =
+            writeWav("pcm" + std::to_string(bits) + ".wav", DR_WAVE_FORMAT_PCM, bits, kFrames);
+        const auto reference = referenceDecode(path);
+
+        MemoryMappedAudioFile::Config config;
+        config.prefetchSizeBytes = 16 * 1024;  // Several windows over the file
+        MemoryMappedAudioFile file(config);
+        ASSERT_TRUE(file.open(path)) << bits;
+        EXPECT_EQ(file.getSampleCount(), kFrames * 2);
+        EXPECT_EQ(file.getFormat().bitsPerSample, bits);
+
+        // Sequential reads in uneven chunks
+        for (size_t offset = 0; offset < reference.size(); offset += 1001) {
+            const size_t count = std::min<size_t>(1001, reference.size() - offset);
+            const float* samples = file.readSamples(offset, count);
+            ASSERT_NE(samples, nullptr);
+            ASSERT_EQ(std::memcmp(samples, reference.data() + offset, count * sizeof(float)), 0)
+                << bits << "-bit at " << offset;
+        }
+        const auto metrics = file.getMetrics();
+        EXPECT_GT(metrics.cacheHits, metrics.cacheMisses);
+
+        // Copy-out reads at unaligned offsets
+        std::vector<float> out(333);
+        ASSERT_EQ(file.readSamples(12345, out.size(), out.data()), out.size());
+        EXPECT_EQ(std::memcmp(out.data(), reference.data() + 12345, out.size() * sizeof(float)),
+                  0);
+
+        EXPECT_EQ(file.readSamples(reference.size() - 10, 11), nullptr);
+        EXPECT_EQ(file.readSamples(reference.size(), 1, out.data()), 0u);
+    }
+}
+
+TEST_F(MemoryMappedAudioFileTest, FloatFilesAreReadInPlace) {
+    const auto path = writeWav("float.wav", DR_WAVE_FORMAT_IEEE_FLOAT, 32, 5000);
+    const auto reference = referenceDecode(path);
+
+    MemoryMappedAudioFile::Config config;
+    config.accessPattern = MemoryMappedAudioFile::AccessPattern::STREAMING;
+    MemoryMappedAudioFile file(config);
+    ASSERT_TRUE(file.open(path));
+
+    const float* first = file.readSamples(0, 100);
+    const float* later = file.readSamples(100, 100);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(later, first + 100);  // Both point into the mapping
+    EXPECT_EQ(std::memcmp(first, reference.data(), 200 * sizeof(float)), 0);
+
+    file.prefetch(5000, 1000);
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(file.readSamples(0, 1), nullptr);
+}
+
+TEST_F(MemoryMappedAudioFileTest, RandomAccessDecodesOnlyTheRequest) {
+    const auto path = writeWav("random.wav", DR_WAVE_FORMAT_PCM, 16, 50000);
+    const auto reference = referenceDecode(path);
+
+    MemoryMappedAudioFile::Config config;
+    config.accessPattern = MemoryMappedAudioFile::AccessPattern::RANDOM;
+    MemoryMappedAudioFile file(config);
+    ASSERT_TRUE(file.open(path));
+
+    for (size_t offset : {90000u, 10u, 55555u, 42u}) {
+        const float* samples = file.readSamples(offset, 64);
+        ASSERT_NE(samples, nullptr);
+        EXPECT_EQ(std::memcmp(samples, reference.data() + offset, 64 * sizeof(float)), 0);
+    }
+    const auto metrics = file.getMetrics();
+    EXPECT_EQ(metrics.cacheMisses, 4u);
+    EXPECT_EQ(metrics.bytesRead, 4u * 64 * sizeof(int16_t));
+}
+
+class AsyncAudioWriterTest : public MemoryMappedAudioFileTest {
+  protected:
+    static std::vector<float> sweep(size_t count) {
+        std::vector<float> samples(count);
+        for (size_t i = 0; i < count; ++i) {
+            samples[i] = 0.8f * std::sin(0.01f * static_cast<float>(i));
+        }
+        return samples;
+    }
+};
+
+TEST_F(AsyncAudioWriterTest, RoundTripsEverySampleFormat) {
+    const auto samples = sweep(2 * 30001);
+    for (uint16_t bits : {16, 24, 32}) {
+        const std::string path = (testDir_ / ("out" + std::to_string(bits) + ".wav")).string();
+        AsyncAudioWriter::Config config;
+        config.bufferSizeBytes = 8192;  // Many block rotations
+        config.bufferCount = 4;
+        AsyncAudioWriter writer(config);
+        ASSERT_TRUE(writer.start(path, 48000, 2, bits));
+
+        std::atomic<int> completed{0};
+        for (size_t offset = 0; offset < samples.size();) {
+            const size_t count = std::min<size_t>(1000, samples.size() - offset);
+            if (writer.writeAsync(samples.data() + offset, count,
+                                  [&](bool ok, const std::string&) { completed += ok; })) {
+                offset += count;
+            } else {
+                std::this_thread::yield();  // Backpressure: the writer catches up
+            }
+        }
+        ASSERT_TRUE(writer.stop());
+        EXPECT_EQ(completed.load(), static_cast<int>((samples.size() + 999) / 1000));
+        EXPECT_EQ(std::filesystem::file_size(path), 4096 + samples.size() * bits / 8);
+
+        const auto decoded = referenceDecode(path);
+        ASSERT_EQ(decoded.size(), samples.size()) << bits;
+        // Encoded at full scale 2^(n-1) - 1, decoded by dr_wav at 2^(n-1)
+        const float tolerance = bits == 16 ? 1.0f / 16384 : bits == 24 ? 1.0f / 4194304 : 0.0f;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            ASSERT_NEAR(decoded[i], samples[i], tolerance) << bits << "-bit at " << i;
+        }
+    }
+}
+
+TEST_F(AsyncAudioWriterTest, CheckpointLeavesAPlayableFile) {
+    const std::string path = (testDir_ / "checkpoint.wav").string();
+    AsyncAudioWriter::Config config;
+    config.useDirectIO = true;  // Falls back to buffered I/O where unsupported
+    config.syncInterval = std::chrono::milliseconds(0);
+    AsyncAudioWriter writer(config);
+    ASSERT_TRUE(writer.start(path, 44100, 1, 16));
+
+    const auto samples = sweep(12345);  // Not a multiple of the block size
+    ASSERT_TRUE(writer.writeAsync(samples.data(), samples.size()));
+    ASSERT_TRUE(writer.checkpoint());
+
+    // Readable mid-recording with everything accepted so far
+    auto decoded = referenceDecode(path);
+    ASSERT_EQ(decoded.size(), samples.size());
+    EXPECT_NEAR(decoded.back(), samples.back(), 1.0f / 16384);
+
+    ASSERT_TRUE(writer.writeAsync(samples.data(), samples.size()));
+    ASSERT_TRUE(writer.stop());
+    EXPECT_FALSE(writer.checkpoint());
+    decoded = referenceDecode(path);
+    ASSERT_EQ(decoded.size(), 2 * samples.size());
+    EXPECT_NEAR(decoded[samples.size() + 100], samples[100], 1.0f / 16384);
+
+    const auto metrics = writer.getMetrics();
+    EXPECT_GE(metrics.bytesWritten, 2 * samples.size() * sizeof(int16_t));
+}
+
+TEST_F(AsyncAudioWriterTest, DirectIOKeepsBlocksAlignedForOddFrameSizes) {
+    // 9-byte frames: block boundaries must still land on 4 KiB file offsets
+    const std::string path = (testDir_ / "direct24.wav").string();
+    AsyncAudioWriter::Config config;
+    config.useDirectIO = true;  // Falls back to buffered I/O where unsupported
+    config.bufferSizeBytes = 8192;
+    config.bufferCount = 3;
+    AsyncAudioWriter writer(config);
+    ASSERT_TRUE(writer.start(path, 48000, 3, 24));
+
+    const auto samples = sweep(3 * 20000);
+    for (size_t offset = 0; offset < samples.size();) {
+        const size_t count = std::min<size_t>(999, samples.size() - offset);
+        std::string rejection;
+        if (writer.writeAsync(samples.data() + offset, count,
+                              [&](bool ok, const std::string& message) {
+                                  if (!ok) {
+                                      rejection = message;
+                                  }
+                              })) {
+            offset += count;
+        } else {
+            ASSERT_EQ(rejection, "Write queue full");  // Not a failed unaligned write
+            std::this_thread::yield();
+        }
+    }
+    ASSERT_TRUE(writer.stop());
+
+    const auto decoded = referenceDecode(path);
+    ASSERT_EQ(decoded.size(), samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        ASSERT_NEAR(decoded[i], samples[i], 1.0f / 4194304) << i;
+    }
+}
+
+TEST_F(AsyncAudioWriterTest, RejectsWritesThatDoNotFitTheBuffers) {
+    const std::string path = (testDir_ / "full.wav").string();
+    AsyncAudioWriter::Config config;
+    config.bufferSizeBytes = 4096;
+    config.bufferCount = 2;
+    AsyncAudioWriter writer(config);
+    ASSERT_TRUE(writer.start(path, 44100, 1, 32));
+
+    // Two 4 KiB buffers can never hold 8 KiB of float samples at once
+    const auto samples = sweep(2048);
+    std::string error;
+    EXPECT_FALSE(writer.writeAsync(samples.data(), samples.size(),
+                                   [&](bool ok, const std::string& message) {
+                                       EXPECT_FALSE(ok);
+                                       error = message;
+                                   }));
+    EXPECT_EQ(error, "Write queue full");
+
+    EXPECT_TRUE(writer.writeAsync(samples.data(), 1000));
+    ASSERT_TRUE(writer.stop());
+    EXPECT_EQ(referenceDecode(path).size(), 1000u);
+    EXPECT_FALSE(writer.writeAsync(samples.data(), 1));
+}
+
+}  // namespace
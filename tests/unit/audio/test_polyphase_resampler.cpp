@@ -0,0 +1,126 @@
+/**
+ * @file test_polyphase_resampler.cpp
+ * @brief Tests for the streaming polyphase sample-rate converter
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/core/AudioFormatConverter.h"
+
+using namespace huntmaster::core;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+std::vector<float> tone(double frequency, uint32_t rate, size_t frames, uint16_t channels = 1) {
+    std::vector<float> samples(frames * channels);
+    for (size_t i = 0; i < frames; ++i) {
+        for (uint16_t c = 0; c < channels; ++c) {
+            const double gain = 0.5 / (c + 1);
+            samples[i * channels + c] =
+                static_cast<float>(gain * std::sin(2.0 * kPi * frequency * i / rate));
+        }
+    }
+    return samples;
+}
+
+/// Signal-to-error ratio in dB of channel `c` against an ideal sine, away from the edges
+double snrDb(const std::vector<float>& output,
+             double frequency,
+             uint32_t rate,
+             uint16_t channels = 1,
+             uint16_t c = 0) {
+    const size_t frames = output.size() / channels;
+    const double gain = 0.5 / (c + 1);
+    double signal = 0.0;
+    double error = 0.0;
+    for (size_t i = frames / 10; i < frames - frames / 10; ++i) {
+        const double expected = gain * std::sin(2.0 * kPi * frequency * i / rate);
+        signal += expected * expected;
+        const double diff = output[i * channels + c] - expected;
+        error += diff * diff;
+    }
+    return 10.0 * std::log10(signal / std::max(error, 1e-30));
+}
+
+std::vector<float> resampleAll(PolyphaseResampler& resampler, const std::vector<float>& input) {
+    std::vector<float> output;
+    resampler.process(input.data(), input.size() / resampler.getConfig().channels, output);
+    resampler.flush(output);
+    return output;
+}
+
+TEST(PolyphaseResamplerTest, ConvertsCommonRatesAccurately) {
+    struct Case {
+        uint32_t from;
+        uint32_t to;
+    };
+    for (const Case& rates : {Case{44100, 48000}, Case{48000, 44100}, Case{48000, 16000}}) {
+        PolyphaseResampler resampler({rates.from, rates.to, 2, ResamplingQuality::HIGH});
+        const auto input = tone(1000.0, rates.from, rates.from / 2, 2);
+        const auto output = resampleAll(resampler, input);
+
+        const size_t expectedFrames =
+            (static_cast<size_t>(rates.from / 2) * rates.to + rates.from - 1) / rates.from;
+        ASSERT_EQ(output.size(), expectedFrames * 2) << rates.from << "->" << rates.to;
+        EXPECT_GT(snrDb(output, 1000.0, rates.to, 2, 0), 70.0) << rates.from << "->" << rates.to;
+        EXPECT_GT(snrDb(output, 1000.0, rates.to, 2, 1), 70.0) << rates.from << "->" << rates.to;
+    }
+}
+
+TEST(PolyphaseResamplerTest, AntiAliasesWhenDownsampling) {
+    // 12 kHz is above the 8 kHz Nyquist of the output and must not fold back to 4 kHz
+    PolyphaseResampler resampler({48000, 16000, 1, ResamplingQuality::HIGH});
+    const auto output = resampleAll(resampler, tone(12000.0, 48000, 48000));
+
+    double energy = 0.0;
+    for (size_t i = output.size() / 10; i < output.size() - output.size() / 10; ++i) {
+        energy += static_cast<double>(output[i]) * output[i];
+    }
+    const double rms = std::sqrt(energy / (output.size() * 0.8));
+    EXPECT_LT(20.0 * std::log10(rms / (0.5 / std::sqrt(2.0))), -60.0);
+}
+
+TEST(PolyphaseResamplerTest, ChunkedStreamingMatchesOneShot) {
+    const auto input = tone(440.0, 44100, 20000);
+    PolyphaseResampler oneShot({44100, 48000, 1, ResamplingQuality::BALANCED});
+    const auto expected = resampleAll(oneShot, input);
+
+    PolyphaseResampler streaming({44100, 48000, 1, ResamplingQuality::BALANCED});
+    std::vector<float> output;
+    // Cycle through chunk sizes so refills land at every phase of the filter
+    const size_t chunks[] = {1, 7, 128, 441, 1000, 3};
+    size_t offset = 0;
+    for (size_t i = 0; offset < input.size(); ++i) {
+        const size_t chunk = std::min(chunks[i % std::size(chunks)], input.size() - offset);
+        streaming.process(input.data() + offset, chunk, output);
+        offset += chunk;
+    }
+    EXPECT_LE(expected.size() - output.size(), streaming.latencyFrames() * 48000 / 44100 + 1);
+    streaming.flush(output);
+
+    ASSERT_EQ(output.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(output[i], expected[i]) << i;
+    }
+}
+
+TEST(PolyphaseResamplerTest, HandlesUnusualRatiosAndRejectsBadConfig) {
+    // 44100 -> 22051 has 22051 phases; the bank is capped but timing stays exact
+    PolyphaseResampler resampler({44100, 22051, 1, ResamplingQuality::HIGH});
+    const auto output = resampleAll(resampler, tone(500.0, 44100, 44100));
+    EXPECT_EQ(output.size(), 22051u);
+    EXPECT_GT(snrDb(output, 500.0, 22051), 50.0);
+
+    EXPECT_THROW(PolyphaseResampler({0, 48000, 1}), std::invalid_argument);
+    EXPECT_THROW(PolyphaseResampler({48000, 48000, 0}), std::invalid_argument);
+}
+
+}  // namespace
@@ -1,5 +1,6 @@
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -229,6 +230,61 @@ TEST_F(SpectrogramProcessorTest, ProcessFrameTest) {
     }
 }
 
+TEST_F(SpectrogramProcessorTest, StreamingChunksMatchBatchTest) {
+    auto testAudio = generateSineWave(1500.0f, 0.25f, 0.5f);
+
+    auto batchResult = processor_->computeSpectrogram(testAudio);
+    ASSERT_TRUE(batchResult.has_value());
+    const auto& batch = batchResult.value();
+
+    // Irregular chunk sizes, including chunks smaller than a hop and an empty one
+    const std::vector<size_t> chunkSizes = {100, 0, 700, 1500, 37, 4096, 513};
+    std::vector<std::vector<float>> columns;
+    std::vector<float> times;
+    size_t offset = 0;
+    size_t chunkIndex = 0;
+    while (offset < testAudio.size()) {
+        size_t count = std::min(chunkSizes[chunkIndex++ % chunkSizes.size()],
+                                testAudio.size() - offset);
+        auto chunkResult = processor_->processStreamingChunk(
+            std::span<const float>(testAudio.data() + offset, count));
+        ASSERT_TRUE(chunkResult.has_value());
+        offset += count;
+
+        const auto& chunk = chunkResult.value();
+        ASSERT_EQ(chunk.magnitude_db.size(), chunk.time_bins);
+        EXPECT_EQ(chunk.frequency_bins, config_.window_size / 2 + 1);
+        for (size_t t = 0; t < chunk.time_bins; ++t) {
+            columns.push_back(chunk.magnitude_db[t]);
+            times.push_back(chunk.time_axis[t]);
+        }
+        if (chunk.time_bins > 0) {
+            // Running range covers everything emitted so far
+            EXPECT_LE(chunk.min_db, chunk.max_db);
+            EXPECT_GT(chunk.max_db, 0.0f);
+        }
+    }
+
+    ASSERT_EQ(columns.size(), batch.time_bins);
+    EXPECT_EQ(processor_->getStreamingColumnCount(), batch.time_bins);
+    for (size_t t = 0; t < batch.time_bins; ++t) {
+        EXPECT_FLOAT_EQ(times[t], batch.time_axis[t]);
+        ASSERT_EQ(columns[t].size(), batch.magnitude_db[t].size());
+        for (size_t f = 0; f < columns[t].size(); ++f) {
+            EXPECT_NEAR(columns[t][f], batch.magnitude_db[t][f], 1e-4f);
+        }
+    }
+
+    // reset() restarts the stream at column 0
+    processor_->reset();
+    EXPECT_EQ(processor_->getStreamingColumnCount(), 0u);
+    auto restarted = processor_->processStreamingChunk(
+        std::span<const float>(testAudio.data(), config_.window_size));
+    ASSERT_TRUE(restarted.has_value());
+    ASSERT_EQ(restarted.value().time_bins, 1u);
+    EXPECT_FLOAT_EQ(restarted.value().time_axis[0], 0.0f);
+}
+
 TEST_F(SpectrogramProcessorTest, MagnitudeToDecibelsStaticTest) {
     // Test the static utility method
     std::vector<float> magnitudes = {0.0f, 0.1f, 0.5f, 1.0f, 2.0f, 10.0f};
@@ -373,6 +429,72 @@ TEST_F(SpectrogramProcessorTest, ConfigAccessTest) {
     EXPECT_EQ(retrievedConfig.apply_window, config_.apply_window);
 }
 
+TEST_F(SpectrogramProcessorTest, QuantizedExportTest) {
+    SpectrogramData data;
+    data.time_bins = 2;
+    data.frequency_bins = 3;
+    data.magnitude_db = {{-80.0f, -40.0f, 0.0f}, {-100.0f, 10.0f, -20.0f}};
+    data.min_db = -80.0f;
+    data.max_db = 0.0f;
+
+    std::vector<uint8_t> levels(6);
+    auto quantized = SpectrogramProcessor::quantizeToLevels(data, levels);
+    ASSERT_TRUE(quantized.has_value());
+    EXPECT_EQ(quantized.value(), 6u);
+    EXPECT_EQ(levels[0], 0);
+    EXPECT_EQ(levels[1], 128);
+    EXPECT_EQ(levels[2], 255);
+    EXPECT_EQ(levels[3], 0);    // Below range clamps to 0
+    EXPECT_EQ(levels[4], 255);  // Above range clamps to 255
+
+    std::vector<uint8_t> tooSmall(5);
+    EXPECT_FALSE(SpectrogramProcessor::quantizeToLevels(data, tooSmall).has_value());
+
+    std::vector<uint8_t> rgba(levels.size() * 4);
+    auto rendered =
+        SpectrogramProcessor::renderColorMap(levels, rgba, SpectrogramColorScheme::GRAYSCALE);
+    ASSERT_TRUE(rendered.has_value());
+    EXPECT_EQ(rendered.value(), rgba.size());
+    EXPECT_EQ(rgba[4], 128);
+    EXPECT_EQ(rgba[5], 128);
+    EXPECT_EQ(rgba[6], 128);
+    EXPECT_EQ(rgba[7], 255);
+
+    auto heat = SpectrogramProcessor::renderColorMap(levels, rgba, SpectrogramColorScheme::HEAT);
+    ASSERT_TRUE(heat.has_value());
+    EXPECT_EQ(rgba[0], 0);    // Lowest level is black
+    EXPECT_EQ(rgba[8], 255);  // Highest level is white
+    EXPECT_EQ(rgba[10], 255);
+
+    // Binary export of a real spectrogram
+    auto testAudio = generateSineWave(1000.0f, 0.2f, 0.5f);
+    auto result = processor_->computeSpectrogram(testAudio);
+    ASSERT_TRUE(result.has_value());
+    const auto& spectrogram = result.value();
+
+    auto binary = processor_->exportBinary(spectrogram, 4, 64);
+    ASSERT_GE(binary.size(), sizeof(SpectrogramBinaryHeader));
+
+    SpectrogramBinaryHeader header;
+    std::memcpy(&header, binary.data(), sizeof(header));
+    EXPECT_EQ(std::string(header.magic, 4), "HMSP");
+    EXPECT_EQ(header.header_size, sizeof(SpectrogramBinaryHeader));
+    EXPECT_LE(header.frequency_bins, spectrogram.frequency_bins);
+    EXPECT_GT(header.time_bins, 0u);
+    EXPECT_FLOAT_EQ(header.min_db, spectrogram.min_db);
+    EXPECT_FLOAT_EQ(header.max_db, spectrogram.max_db);
+    EXPECT_EQ(binary.size(),
+              sizeof(SpectrogramBinaryHeader)
+                  + static_cast<size_t>(header.time_bins) * header.frequency_bins);
+
+    // Multi-byte fields are little-endian regardless of the host
+    EXPECT_EQ(binary[4], 1);
+    EXPECT_EQ(binary[5], 0);
+    const uint32_t time_bins = binary[8] | (binary[9] << 8) | (binary[10] << 16)
+                               | (static_cast<uint32_t>(binary[11]) << 24);
+    EXPECT_EQ(time_bins, header.time_bins);
+}
+
 // Test class for utility methods (separate from main processor tests)
 class SpectrogramUtilityTest : public ::testing::Test {
   protected:
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <memory>
@@ -394,6 +395,68 @@ TEST_F(WaveformGeneratorTest, ErrorHandlingTest) {
     EXPECT_EQ(result.error(), WaveformGenerator::Error::INVALID_AUDIO_DATA);
 }
 
+TEST_F(WaveformGeneratorTest, OverviewPyramidTest) {
+    // Ten seconds of low-level tone with a single spike, well past maxSamples
+    const size_t totalSamples = 441000;
+    const size_t spikeIndex = 300017;
+    std::vector<float> audio(totalSamples);
+    for (size_t i = 0; i < totalSamples; ++i) {
+        audio[i] = 0.1f * std::sin(2.0f * static_cast<float>(M_PI) * 220.0f * i / 44100.0f);
+    }
+    audio[spikeIndex] = -0.9f;
+
+    const size_t chunkSize = 1000;
+    for (size_t offset = 0; offset < totalSamples; offset += chunkSize) {
+        const size_t count = std::min(chunkSize, totalSamples - offset);
+        ASSERT_TRUE(generator_->processAudio(std::span(audio).subspan(offset, count), 1));
+    }
+    EXPECT_GT(generator_->getOverviewLevelCount(), 10u);
+
+    // Zoom changes only affect the decimated display buffer
+    generator_->setZoomLevel(2.0f);
+
+    const float totalMs = totalSamples * 1000.0f / config_.sampleRate;
+    auto result = generator_->getOverview(0.0f, totalMs, 200);
+    ASSERT_TRUE(result.has_value());
+    const auto& overview = result.value();
+    ASSERT_EQ(overview.minimums.size(), 200u);
+    EXPECT_EQ(overview.endSample, totalSamples);
+
+    const size_t spikePixel = static_cast<size_t>(spikeIndex / overview.samplesPerPixel);
+    EXPECT_FLOAT_EQ(overview.minimums[spikePixel], -0.9f);
+    EXPECT_NEAR(overview.minimums[0], -0.1f, 1e-3f);
+    EXPECT_NEAR(overview.maximums[0], 0.1f, 1e-3f);
+    EXPECT_NEAR(overview.rms[0], 0.1f / std::sqrt(2.0f), 2e-3f);
+
+    // Compare a zoomed-in view against a direct scan over the same block-aligned spans
+    const size_t blockSize = config_.overviewBlockSize;
+    auto zoomed = generator_->getOverview(6800.0f, 50.0f, 37);
+    ASSERT_TRUE(zoomed.has_value());
+    const auto& view = zoomed.value();
+    for (size_t pixel = 0; pixel < view.minimums.size(); ++pixel) {
+        const size_t pixelStart =
+            view.startSample + static_cast<size_t>(pixel * view.samplesPerPixel);
+        const size_t pixelEnd = std::max(
+            pixelStart + 1,
+            view.startSample + static_cast<size_t>((pixel + 1) * view.samplesPerPixel));
+        const size_t first = pixelStart / blockSize * blockSize;
+        const size_t last =
+            std::min(totalSamples, (pixelEnd + blockSize - 1) / blockSize * blockSize);
+        const auto [minIt, maxIt] =
+            std::minmax_element(audio.begin() + first, audio.begin() + last);
+        EXPECT_FLOAT_EQ(view.minimums[pixel], *minIt);
+        EXPECT_FLOAT_EQ(view.maximums[pixel], *maxIt);
+    }
+
+    EXPECT_FALSE(generator_->getOverview(totalMs + 10.0f, 10.0f, 10).has_value());
+    EXPECT_FALSE(generator_->getOverview(0.0f, totalMs, 0).has_value());
+
+    generator_->reset();
+    auto afterReset = generator_->getOverview(0.0f, totalMs, 10);
+    ASSERT_FALSE(afterReset.has_value());
+    EXPECT_EQ(afterReset.error(), WaveformGenerator::Error::INSUFFICIENT_DATA);
+}
+
 /*
 // Test utility functions
 TEST(WaveformUtilityTest, DownsampleRatioCalculationTest) {
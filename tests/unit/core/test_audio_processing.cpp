@@ -29,6 +29,7 @@
 
 #include <gtest/gtest.h>
 
+#include "huntmaster/core/FeatureStorage.h"
 #include "huntmaster/core/UnifiedAudioEngine.h"
 
 #ifndef M_PI
@@ -78,29 +79,30 @@ class AudioProcessingTest : public ::testing::Test {
         }
     }
 
+    /// Configuration engine sessions extract master-call features with
+    static FeatureConfigRecord sessionFeatureConfig() {
+        MFCCProcessor::Config mfcc;
+        mfcc.sample_rate = static_cast<size_t>(TEST_SAMPLE_RATE);
+        return FeatureConfigRecord::fromMFCC(mfcc, 256);
+    }
+
     void createTestMFCFile(const std::string& masterCallId) {
         std::string filePath =
             "/workspaces/huntmaster-engine/data/processed_calls/mfc/" + masterCallId + ".mfc";
-        std::ofstream file(filePath, std::ios::binary);
-
-        if (file.is_open()) {
-            // Create predictable MFCC features for testing
-            uint32_t numFrames = 20;
-            uint32_t numCoefficients = 13;
-
-            file.write(reinterpret_cast<const char*>(&numFrames), sizeof(numFrames));
-            file.write(reinterpret_cast<const char*>(&numCoefficients), sizeof(numCoefficients));
-
-            // Write deterministic feature data
-            for (uint32_t frame = 0; frame < numFrames; ++frame) {
-                for (uint32_t coeff = 0; coeff < numCoefficients; ++coeff) {
-                    // Create a simple pattern that's deterministic
-                    float value = std::sin(2.0f * M_PI * frame / numFrames) * (coeff + 1) * 0.1f;
-                    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
-                }
+
+        // Create predictable MFCC features for testing
+        const uint32_t numFrames = 20;
+        const uint32_t numCoefficients = 13;
+        std::vector<std::vector<float>> features(numFrames, std::vector<float>(numCoefficients));
+        for (uint32_t frame = 0; frame < numFrames; ++frame) {
+            for (uint32_t coeff = 0; coeff < numCoefficients; ++coeff) {
+                // Create a simple pattern that's deterministic
+                features[frame][coeff] =
+                    std::sin(2.0f * M_PI * frame / numFrames) * (coeff + 1) * 0.1f;
             }
-            file.close();
         }
+        [[maybe_unused]] auto written =
+            FeatureFile::write(filePath, sessionFeatureConfig(), features);
     }
 
     void cleanupTestFiles() {
@@ -0,0 +1,139 @@
+/**
+ * @file test_feature_storage.cpp
+ * @brief Tests for checksums and the versioned .mfc feature file format
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/core/FeatureStorage.h"
+
+using namespace huntmaster;
+
+namespace {
+
+class FeatureFileTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        testDir_ = std::filesystem::temp_directory_path() / "huntmaster_feature_file_test";
+        std::filesystem::create_directories(testDir_);
+        path_ = (testDir_ / "call.mfc").string();
+
+        MFCCProcessor::Config mfcc;
+        mfcc.sample_rate = 44100;
+        config_ = FeatureConfigRecord::fromMFCC(mfcc, 256);
+
+        features_.assign(37, std::vector<float>(13));
+        for (size_t f = 0; f < features_.size(); ++f) {
+            for (size_t c = 0; c < 13; ++c) {
+                features_[f][c] = static_cast<float>(f) * 0.5f - static_cast<float>(c);
+            }
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir_);
+    }
+
+    std::filesystem::path testDir_;
+    std::string path_;
+    FeatureConfigRecord config_;
+    MFCCProcessor::FeatureMatrix features_;
+};
+
+TEST(Crc32cTest, MatchesReferenceAndChains) {
+    const char check[] = "123456789";
+    EXPECT_EQ(crc32c(check, 9), 0xE3069283u);
+    EXPECT_EQ(crc32c(nullptr, 0), 0u);
+
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    EXPECT_EQ(crc32c(data.data() + 333, 667, crc32c(data.data(), 333)),
+              crc32c(data.data(), data.size()));
+}
+
+TEST_F(FeatureFileTest, RoundTripsInPlace) {
+    ASSERT_TRUE(FeatureFile::write(path_, config_, features_));
+    EXPECT_EQ(std::filesystem::file_size(path_), 64 + 37 * 13 * sizeof(float));
+
+    auto file = FeatureFile::open(path_, config_);
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file->frames(), 37u);
+    EXPECT_EQ(file->coefficients(), 13u);
+    EXPECT_EQ(file->config(), config_);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(file->data()) % 64, 0u);
+    EXPECT_EQ(file->frame(5)[3], features_[5][3]);
+    EXPECT_EQ(file->featureMatrix(), features_);
+
+    // Moving keeps the mapping, and the rows, where they are
+    const float* data = file->data();
+    FeatureFile moved = std::move(*file);
+    EXPECT_EQ(moved.data(), data);
+    EXPECT_EQ(moved.frame(36)[12], features_[36][12]);
+}
+
+TEST_F(FeatureFileTest, RejectsOtherConfigsAndOldFiles) {
+    ASSERT_TRUE(FeatureFile::write(path_, config_, features_));
+
+    auto otherRate = config_;
+    otherRate.sampleRate = 48000;
+    EXPECT_EQ(FeatureFile::open(path_, otherRate).error(), FeatureFileError::CONFIG_MISMATCH);
+    auto otherLifter = config_;
+    otherLifter.flags &= ~FeatureConfigRecord::kApplyLifter;
+    EXPECT_EQ(FeatureFile::open(path_, otherLifter).error(), FeatureFileError::CONFIG_MISMATCH);
+    EXPECT_TRUE(FeatureFile::open(path_));
+
+    // Version 1: bare frame and coefficient counts, then rows
+    {
+        std::ofstream legacy(path_, std::ios::binary | std::ios::trunc);
+        const uint32_t dims[2] = {37, 13};
+        legacy.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+        for (const auto& frame : features_) {
+            legacy.write(reinterpret_cast<const char*>(frame.data()), 13 * sizeof(float));
+        }
+    }
+    EXPECT_EQ(FeatureFile::open(path_, config_).error(), FeatureFileError::UNSUPPORTED_VERSION);
+    EXPECT_EQ(FeatureFile::open((testDir_ / "missing.mfc").string()).error(),
+              FeatureFileError::FILE_NOT_FOUND);
+
+    MFCCProcessor::FeatureMatrix ragged = features_;
+    ragged[3].pop_back();
+    EXPECT_FALSE(FeatureFile::write(path_, config_, ragged));
+    EXPECT_FALSE(FeatureFile::write(path_, config_, {}));
+}
+
+TEST_F(FeatureFileTest, DetectsCorruption) {
+    ASSERT_TRUE(FeatureFile::write(path_, config_, features_));
+    const auto size = std::filesystem::file_size(path_);
+
+    auto corrupt = [&](uint64_t offset) {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(offset));
+        char byte = 0;
+        file.read(&byte, 1);
+        byte ^= 0x01;
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(&byte, 1);
+    };
+
+    corrupt(size - 1);  // Payload
+    EXPECT_EQ(FeatureFile::open(path_).error(), FeatureFileError::CHECKSUM_MISMATCH);
+    corrupt(size - 1);
+    corrupt(24);  // Sample rate in the header
+    EXPECT_EQ(FeatureFile::open(path_).error(), FeatureFileError::CHECKSUM_MISMATCH);
+    corrupt(24);
+    ASSERT_TRUE(FeatureFile::open(path_));
+
+    std::filesystem::resize_file(path_, size - 4);
+    EXPECT_EQ(FeatureFile::open(path_).error(), FeatureFileError::INVALID_FORMAT);
+}
+
+}  // namespace
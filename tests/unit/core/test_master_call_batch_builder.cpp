@@ -0,0 +1,297 @@
+/**
+ * @file test_master_call_batch_builder.cpp
+ * @brief Tests for the parallel, incremental master-call library builder
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dr_wav.h"
+#include "huntmaster/core/FeatureStorage.h"
+#include "huntmaster/core/MasterCallBatchBuilder.h"
+#include "huntmaster/core/MasterCallLibrary.h"
+#include "huntmaster/core/UnifiedAudioEngine.h"
+
+using namespace huntmaster;
+
+namespace {
+
+using Outcome = MasterCallBatchBuilder::Outcome;
+
+class MasterCallBatchBuilderTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        testDir_ = std::filesystem::temp_directory_path() / "huntmaster_batch_builder_test";
+        std::filesystem::remove_all(testDir_);
+        inputDir_ = testDir_ / "calls";
+        std::filesystem::create_directories(inputDir_ / "deer");
+
+        writeWav(inputDir_ / "grunt.wav", 44100, 1, 150.0f, 0.5f);
+        writeWav(inputDir_ / "deer" / "bleat.wav", 22050, 2, 400.0f, 0.4f);
+        writeWav(inputDir_ / "deer" / "rattle.WAV", 48000, 1, 900.0f, 0.3f);
+        writeWav(inputDir_ / "snort.wav", 44100, 1, 60.0f, 0.6f);
+        std::ofstream(inputDir_ / "broken.wav") << "not a wav file";
+        std::ofstream(inputDir_ / "notes.txt") << "ignored";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir_);
+    }
+
+    static void writeWav(const std::filesystem::path& path,
+                         uint32_t sampleRate,
+                         uint16_t channels,
+                         float frequency,
+                         float seconds) {
+        drwav_data_format format;
+        format.container = drwav_container_riff;
+        format.format = DR_WAVE_FORMAT_IEEE_FLOAT;
+        format.channels = channels;
+        format.sampleRate = sampleRate;
+        format.bitsPerSample = 32;
+
+        const auto frames = static_cast<size_t>(seconds * static_cast<float>(sampleRate));
+        std::vector<float> samples(frames * channels);
+        for (size_t i = 0; i < frames; ++i) {
+            const float t = static_cast<float>(i) / static_cast<float>(sampleRate);
+            for (uint16_t c = 0; c < channels; ++c) {
+                samples[i * channels + c] =
+                    0.5f * std::sin(2.0f * static_cast<float>(M_PI) * frequency * t + c);
+            }
+        }
+
+        drwav wav;
+        ASSERT_TRUE(drwav_init_file_write(&wav, path.string().c_str(), &format, nullptr));
+        EXPECT_EQ(drwav_write_pcm_frames(&wav, frames, samples.data()), frames);
+        drwav_uninit(&wav);
+    }
+
+    MasterCallBatchBuilder::Config makeConfig() const {
+        MasterCallBatchBuilder::Config config;
+        config.inputDir = inputDir_.string();
+        config.libraryPath = (testDir_ / "out" / "calls.hmcl").string();
+        config.featuresDir = (testDir_ / "out" / "mfc").string();
+        config.metadataDir = (testDir_ / "out" / "metadata").string();
+        config.waveformsDir = (testDir_ / "out" / "waveforms").string();
+        config.manifestPath = (testDir_ / "out" / "calls.manifest").string();
+        config.threads = 3;
+        config.metadata = [](const MasterCallBatchBuilder::CallInfo& call) {
+            return MasterCallBatchBuilder::MetadataFields{
+                {"species", std::string("white-tail \"deer\"")},
+                {"longCall", call.audio.size() > call.sampleRate / 2},
+                {"difficulty", int64_t{2}}};
+        };
+        return config;
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), {}};
+    }
+
+    std::filesystem::path testDir_;
+    std::filesystem::path inputDir_;
+};
+
+TEST_F(MasterCallBatchBuilderTest, BuildsEveryOutputInOnePass) {
+    auto config = makeConfig();
+    size_t notified = 0;
+    config.onCallFinished = [&](const MasterCallBatchBuilder::CallResult&) { ++notified; };
+
+    auto report = MasterCallBatchBuilder(config).build();
+    ASSERT_TRUE(report);
+    EXPECT_EQ(report->built, 4u);
+    EXPECT_EQ(report->reused, 0u);
+    EXPECT_EQ(report->failed, 1u);
+    EXPECT_EQ(notified, 5u);
+    EXPECT_EQ(report->threads, 3u);
+    EXPECT_GT(report->inputBytes, 0u);
+    EXPECT_NEAR(report->audioSeconds, 1.8, 1e-3);
+    EXPECT_GT(report->callsPerSecond(), 0.0);
+
+    ASSERT_EQ(report->calls.size(), 5u);
+    EXPECT_EQ(report->calls[0].id, "bleat");
+    EXPECT_EQ(report->calls[1].id, "broken");
+    EXPECT_EQ(report->calls[1].outcome, Outcome::FAILED);
+    EXPECT_FALSE(report->calls[1].error.empty());
+
+    const auto featureConfig = FeatureConfigRecord::fromMFCC(config.mfcc, config.hopSize);
+    auto library = MasterCallLibrary::open(config.libraryPath);
+    ASSERT_TRUE(library);
+    ASSERT_EQ((*library)->size(), 4u);
+    EXPECT_EQ((*library)->featureConfig(), featureConfig);
+
+    for (const auto& call : report->calls) {
+        if (call.outcome == Outcome::FAILED) {
+            continue;
+        }
+        const auto view = (*library)->find(call.id);
+        ASSERT_TRUE(view) << call.id;
+        EXPECT_EQ(view->metadata, call.metadata);
+        EXPECT_EQ(readFile(config.metadataDir + "/" + call.id + ".json"), call.metadata);
+
+        auto features = FeatureFile::open(config.featuresDir + "/" + call.id + ".mfc",
+                                          featureConfig);
+        ASSERT_TRUE(features) << call.id;
+        EXPECT_EQ(features->featureMatrix(), view->featureMatrix());
+
+        const auto waveform = readFile(config.waveformsDir + "/" + call.id + ".json");
+        EXPECT_NE(waveform.find("\"5000\": {"), std::string::npos);
+        EXPECT_NE(waveform.find("\"rms\": ["), std::string::npos);
+    }
+
+    const auto bleat = (*library)->find("bleat");
+    EXPECT_EQ(bleat->audioSampleRate, 22050u);
+    EXPECT_EQ(bleat->audio.size(), static_cast<size_t>(0.4f * 22050));
+    EXPECT_NE(bleat->metadata.find("\"source\":\"deer/bleat.wav\",\"sampleRate\":22050,"
+                                   "\"channels\":2"),
+              std::string::npos);
+    EXPECT_NE(bleat->metadata.find("\"species\":\"white-tail \\\"deer\\\"\",\"longCall\":false,"
+                                   "\"difficulty\":2}"),
+              std::string::npos);
+
+    // Same framing as extracting the source directly at the analysis rate
+    const auto grunt = (*library)->find("grunt");
+    unsigned int channels = 0;
+    unsigned int sampleRate = 0;
+    drwav_uint64 frames = 0;
+    float* samples = drwav_open_file_and_read_pcm_frames_f32(
+        (inputDir_ / "grunt.wav").string().c_str(), &channels, &sampleRate, &frames, nullptr);
+    ASSERT_NE(samples, nullptr);
+    MFCCProcessor mfcc(config.mfcc);
+    auto expected = mfcc.extractFeaturesFromBuffer(
+        std::span<const float>(samples, static_cast<size_t>(frames)), config.hopSize);
+    drwav_free(samples, nullptr);
+    ASSERT_TRUE(expected);
+    EXPECT_EQ(grunt->featureMatrix(), *expected);
+}
+
+TEST_F(MasterCallBatchBuilderTest, MatchesEngineExtractionAcrossSampleRates) {
+    // bleat is stereo at 22.05 kHz, so both sides mix down and resample to 44.1 kHz
+    const auto config = makeConfig();
+    ASSERT_TRUE(MasterCallBatchBuilder(config).build());
+
+    const auto engineFeaturesDir = testDir_ / "engine_mfc";
+    std::filesystem::create_directories(engineFeaturesDir);
+    auto engineResult = UnifiedAudioEngine::create();
+    ASSERT_TRUE(engineResult.isOk());
+    auto engine = std::move(engineResult.value);
+    using Status = UnifiedAudioEngine::Status;
+    ASSERT_EQ(engine->setMasterCallDirectories((inputDir_ / "deer").string(),
+                                               engineFeaturesDir.string()),
+              Status::OK);
+    const auto session = engine->createSession(static_cast<float>(config.mfcc.sample_rate));
+    ASSERT_TRUE(session.isOk());
+    ASSERT_EQ(engine->loadMasterCall(session.value, "bleat"), Status::OK);
+
+    const auto featureConfig = FeatureConfigRecord::fromMFCC(config.mfcc, config.hopSize);
+    auto built = FeatureFile::open(config.featuresDir + "/bleat.mfc", featureConfig);
+    auto extracted = FeatureFile::open((engineFeaturesDir / "bleat.mfc").string(), featureConfig);
+    ASSERT_TRUE(built);
+    ASSERT_TRUE(extracted);
+    EXPECT_EQ(built->featureMatrix(), extracted->featureMatrix());
+}
+
+TEST_F(MasterCallBatchBuilderTest, RebuildsOnlyWhatChanged) {
+    auto config = makeConfig();
+    ASSERT_TRUE(MasterCallBatchBuilder(config).build());
+
+    auto unchanged = MasterCallBatchBuilder(config).build();
+    ASSERT_TRUE(unchanged);
+    EXPECT_EQ(unchanged->built, 0u);
+    EXPECT_EQ(unchanged->reused, 4u);
+    EXPECT_EQ(unchanged->failed, 1u);
+    EXPECT_EQ(unchanged->audioSeconds, 0.0);
+    auto library = MasterCallLibrary::open(config.libraryPath);
+    ASSERT_TRUE(library);
+    ASSERT_EQ((*library)->size(), 4u);
+    for (const auto& call : unchanged->calls) {
+        if (call.outcome == Outcome::REUSED) {
+            const auto index = (*library)->indexOf(call.id);
+            ASSERT_TRUE(index) << call.id;
+            EXPECT_TRUE((*library)->verify(*index));
+            EXPECT_EQ((*library)->at(*index).metadata, call.metadata);
+        }
+    }
+
+    // New audio, and a missing output, rebuild just those calls
+    writeWav(inputDir_ / "grunt.wav", 44100, 1, 170.0f, 0.5f);
+    std::filesystem::remove(config.waveformsDir + "/snort.json");
+    auto changed = MasterCallBatchBuilder(config).build();
+    ASSERT_TRUE(changed);
+    EXPECT_EQ(changed->built, 2u);
+    EXPECT_EQ(changed->reused, 2u);
+    EXPECT_EQ(changed->calls[2].id, "grunt");
+    EXPECT_EQ(changed->calls[2].outcome, Outcome::BUILT);
+    EXPECT_TRUE(std::filesystem::exists(config.waveformsDir + "/snort.json"));
+
+    // Settings that change the outputs rebuild everything
+    auto otherHop = config;
+    otherHop.hopSize = 128;
+    auto rehopped = MasterCallBatchBuilder(otherHop).build();
+    ASSERT_TRUE(rehopped);
+    EXPECT_EQ(rehopped->built, 4u);
+    EXPECT_EQ(rehopped->reused, 0u);
+
+    auto forced = otherHop;
+    forced.force = true;
+    EXPECT_EQ(MasterCallBatchBuilder(forced).build()->built, 4u);
+    EXPECT_EQ(MasterCallBatchBuilder(otherHop).build()->reused, 4u);
+}
+
+TEST_F(MasterCallBatchBuilderTest, PartialBuildsKeepOtherCalls) {
+    auto config = makeConfig();
+    ASSERT_TRUE(MasterCallBatchBuilder(config).build());
+
+    auto partial = config;
+    partial.only = {"snort"};
+    partial.force = true;
+    auto report = MasterCallBatchBuilder(partial).build();
+    ASSERT_TRUE(report);
+    ASSERT_EQ(report->calls.size(), 1u);
+    EXPECT_EQ(report->built, 1u);
+
+    auto library = MasterCallLibrary::open(config.libraryPath);
+    ASSERT_TRUE(library);
+    EXPECT_EQ((*library)->size(), 4u);
+    library->reset();
+
+    auto full = MasterCallBatchBuilder(config).build();
+    ASSERT_TRUE(full);
+    EXPECT_EQ(full->reused, 4u);
+    EXPECT_EQ(full->built, 0u);
+}
+
+TEST_F(MasterCallBatchBuilderTest, ReportsDuplicateIdsAndBadConfigs) {
+    writeWav(inputDir_ / "deer" / "grunt.wav", 44100, 1, 200.0f, 0.2f);
+    auto config = makeConfig();
+    config.threads = 0;
+    auto report = MasterCallBatchBuilder(config).build();
+    ASSERT_TRUE(report);
+    EXPECT_EQ(report->built, 4u);
+    EXPECT_EQ(report->failed, 2u);
+    EXPECT_GE(report->threads, 1u);
+    ASSERT_EQ(report->calls.size(), 6u);
+    EXPECT_EQ(report->calls[2].id, "grunt");
+    EXPECT_EQ(report->calls[3].id, "grunt");
+    EXPECT_EQ(report->calls[3].outcome, Outcome::FAILED);
+
+    auto noOutputs = MasterCallBatchBuilder::Config{};
+    noOutputs.inputDir = inputDir_.string();
+    EXPECT_EQ(MasterCallBatchBuilder(noOutputs).build().error(),
+              MasterCallBatchError::INVALID_CONFIG);
+
+    auto missingInput = makeConfig();
+    missingInput.inputDir = (testDir_ / "missing").string();
+    EXPECT_EQ(MasterCallBatchBuilder(missingInput).build().error(),
+              MasterCallBatchError::INPUT_NOT_FOUND);
+}
+
+}  // namespace
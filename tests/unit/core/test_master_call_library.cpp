@@ -0,0 +1,277 @@
+/**
+ * @file test_master_call_library.cpp
+ * @brief Tests for the packed master-call library format
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/core/MasterCallLibrary.h"
+#include "huntmaster/core/UnifiedAudioEngine.h"
+
+using namespace huntmaster;
+
+namespace {
+
+class MasterCallLibraryTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        testDir_ = std::filesystem::temp_directory_path() / "huntmaster_library_test";
+        std::filesystem::create_directories(testDir_);
+        path_ = (testDir_ / "calls.hmcl").string();
+
+        MFCCProcessor::Config mfcc;
+        mfcc.sample_rate = 44100;
+        config_ = FeatureConfigRecord::fromMFCC(mfcc, 256);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(testDir_);
+    }
+
+    static MasterCallLibraryBuilder::Entry makeEntry(const std::string& id, size_t frames) {
+        MasterCallLibraryBuilder::Entry entry;
+        entry.id = id;
+        entry.metadata = "{\"id\":\"" + id + "\"}";
+        for (size_t f = 0; f < frames; ++f) {
+            std::vector<float> row(13);
+            for (size_t c = 0; c < row.size(); ++c) {
+                row[c] = static_cast<float>(f) + 0.01f * static_cast<float>(c) + id.size();
+            }
+            entry.features.push_back(std::move(row));
+        }
+        return entry;
+    }
+
+    void flipByte(uint64_t offset) {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(offset));
+        char byte = 0;
+        file.read(&byte, 1);
+        byte ^= 0x5A;
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(&byte, 1);
+    }
+
+    std::filesystem::path testDir_;
+    std::string path_;
+    FeatureConfigRecord config_;
+};
+
+TEST_F(MasterCallLibraryTest, RoundTripsEntriesInIdOrder) {
+    std::vector<std::string> ids = {"grunt", "bleat", "rattle", "estrus_bleat", "snort_wheeze"};
+    {
+        MasterCallLibraryBuilder builder(path_, config_);
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            workers.emplace_back([&, i] {
+                auto entry = makeEntry(ids[i], 10 + i * 7);
+                if (i % 2 == 0) {
+                    entry.audio = {0.5f, -0.25f, 0.0f, 0.125f};
+                    entry.audioSampleRate = 44100;
+                }
+                EXPECT_TRUE(builder.add(entry));
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        EXPECT_EQ(builder.add(makeEntry("grunt", 3)).error(), MasterCallLibraryError::DUPLICATE_ID);
+        ASSERT_TRUE(builder.finish());
+    }
+    EXPECT_FALSE(std::filesystem::exists(path_ + ".tmp"));
+
+    auto library = MasterCallLibrary::open(path_);
+    ASSERT_TRUE(library);
+    ASSERT_EQ((*library)->size(), ids.size());
+    EXPECT_EQ((*library)->featureConfig(), config_);
+    for (size_t i = 1; i < ids.size(); ++i) {
+        EXPECT_LT((*library)->at(i - 1).id, (*library)->at(i).id);
+    }
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const auto view = (*library)->find(ids[i]);
+        ASSERT_TRUE(view) << ids[i];
+        EXPECT_TRUE((*library)->verify(*(*library)->indexOf(ids[i])));
+        EXPECT_EQ(view->metadata, "{\"id\":\"" + ids[i] + "\"}");
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(view->features) % 64, 0u);
+        EXPECT_EQ(view->featureMatrix(), makeEntry(ids[i], 10 + i * 7).features);
+
+        if (i % 2 == 0) {
+            ASSERT_EQ(view->audio.size(), 4u);
+            EXPECT_EQ(view->audioSampleRate, 44100u);
+            const auto audio = view->decodeAudio();
+            EXPECT_FLOAT_EQ(audio[0], 0.5f);
+            EXPECT_NEAR(audio[1], -0.25f, 0.5f / 32767);
+            EXPECT_EQ(audio[2], 0.0f);
+        } else {
+            EXPECT_TRUE(view->audio.empty());
+        }
+    }
+    EXPECT_FALSE((*library)->find("gobble"));
+    EXPECT_FALSE((*library)->find(""));
+}
+
+TEST_F(MasterCallLibraryTest, CopiesEntriesBetweenLibraries) {
+    {
+        MasterCallLibraryBuilder builder(path_, config_);
+        auto entry = makeEntry("grunt", 20);
+        entry.audio = {0.1f, 0.2f, -0.3f};
+        entry.audioSampleRate = 22050;
+        ASSERT_TRUE(builder.add(entry));
+        ASSERT_TRUE(builder.finish());
+    }
+    auto source = MasterCallLibrary::open(path_);
+    ASSERT_TRUE(source);
+
+    const std::string copyPath = (testDir_ / "copy.hmcl").string();
+    {
+        MasterCallLibraryBuilder builder(copyPath, config_);
+        ASSERT_TRUE(builder.add(*(*source)->find("grunt")));
+        ASSERT_TRUE(builder.finish());
+    }
+    auto copy = MasterCallLibrary::open(copyPath);
+    ASSERT_TRUE(copy);
+    const auto original = (*source)->at(0);
+    const auto copied = (*copy)->at(0);
+    EXPECT_EQ(copied.featureMatrix(), original.featureMatrix());
+    EXPECT_EQ(copied.decodeAudio(), original.decodeAudio());
+    EXPECT_EQ(copied.metadata, original.metadata);
+}
+
+TEST_F(MasterCallLibraryTest, DetectsCorruptionAndRejectsBadInput) {
+    {
+        MasterCallLibraryBuilder builder(path_, config_);
+        auto ragged = makeEntry("ragged", 4);
+        ragged.features[2].pop_back();
+        EXPECT_EQ(builder.add(ragged).error(), MasterCallLibraryError::INVALID_INPUT);
+        auto wrongWidth = makeEntry("wide", 4);
+        for (auto& row : wrongWidth.features) {
+            row.push_back(0.0f);
+        }
+        EXPECT_EQ(builder.add(wrongWidth).error(), MasterCallLibraryError::INVALID_INPUT);
+        ASSERT_TRUE(builder.add(makeEntry("grunt", 50)));
+        ASSERT_TRUE(builder.finish());
+        EXPECT_FALSE(builder.add(makeEntry("late", 2)));
+    }
+
+    constexpr uint64_t featureOffset = 128;  // First payload follows the header
+
+    // Payload damage is caught by verify(), not open()
+    flipByte(featureOffset + 17);
+    {
+        auto library = MasterCallLibrary::open(path_);
+        ASSERT_TRUE(library);
+        EXPECT_FALSE((*library)->verify(0));
+    }
+    flipByte(featureOffset + 17);
+
+    // Index and header damage is caught at open
+    const auto fileSize = std::filesystem::file_size(path_);
+    flipByte(fileSize - 3);
+    EXPECT_EQ(MasterCallLibrary::open(path_).error(), MasterCallLibraryError::CHECKSUM_MISMATCH);
+    flipByte(fileSize - 3);
+    flipByte(20);
+    EXPECT_EQ(MasterCallLibrary::open(path_).error(), MasterCallLibraryError::CHECKSUM_MISMATCH);
+    flipByte(20);
+    ASSERT_TRUE(MasterCallLibrary::open(path_));
+
+    std::filesystem::resize_file(path_, fileSize - 64);
+    EXPECT_EQ(MasterCallLibrary::open(path_).error(), MasterCallLibraryError::INVALID_FORMAT);
+    EXPECT_EQ(MasterCallLibrary::open((testDir_ / "missing.hmcl").string()).error(),
+              MasterCallLibraryError::FILE_NOT_FOUND);
+}
+
+TEST_F(MasterCallLibraryTest, EngineLoadsMasterCallsFromTheLibrary) {
+    {
+        MasterCallLibraryBuilder builder(path_, config_);
+        ASSERT_TRUE(builder.add(makeEntry("library_only_call", 40)));
+        ASSERT_TRUE(builder.finish());
+    }
+
+    auto engineResult = UnifiedAudioEngine::create();
+    ASSERT_TRUE(engineResult.isOk());
+    auto engine = std::move(engineResult.value);
+    using Status = UnifiedAudioEngine::Status;
+
+    EXPECT_EQ(engine->setMasterCallLibrary((testDir_ / "missing.hmcl").string()),
+              Status::FILE_NOT_FOUND);
+    ASSERT_EQ(engine->setMasterCallLibrary(path_), Status::OK);
+
+    // No loose .wav or .mfc exists for this call; only the library has it
+    const auto session = engine->createSession(44100.0f);
+    ASSERT_TRUE(session.isOk());
+    EXPECT_EQ(engine->loadMasterCall(session.value, "library_only_call"), Status::OK);
+    EXPECT_EQ(engine->getCurrentMasterCall(session.value).value, "library_only_call");
+
+    // Features extracted at 44.1 kHz are not valid for a 48 kHz session
+    const auto other = engine->createSession(48000.0f);
+    ASSERT_TRUE(other.isOk());
+    EXPECT_NE(engine->loadMasterCall(other.value, "library_only_call"), Status::OK);
+
+    ASSERT_EQ(engine->setMasterCallLibrary(""), Status::OK);
+    EXPECT_NE(engine->loadMasterCall(session.value, "library_only_call"), Status::OK);
+}
+
+TEST_F(MasterCallLibraryTest, EngineScoresLibraryOnlyCalls) {
+    // Features and audio of a real call, extracted the way the engine extracts them
+    std::vector<float> call(44100);
+    for (size_t i = 0; i < call.size(); ++i) {
+        const float t = static_cast<float>(i) / 44100.0f;
+        call[i] = 0.4f * std::sin(2.0f * static_cast<float>(M_PI) * 600.0f * t)
+                  * (1.0f + 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * 3.0f * t));
+    }
+    MFCCProcessor::Config mfcc;
+    mfcc.sample_rate = 44100;
+    mfcc.frame_size = 512;
+    mfcc.num_coefficients = 13;
+    mfcc.num_filters = 26;
+    config_ = FeatureConfigRecord::fromMFCC(mfcc, 256);
+    auto features = MFCCProcessor(mfcc).extractFeaturesFromBuffer(call, 256);
+    ASSERT_TRUE(features);
+    {
+        MasterCallLibraryBuilder builder(path_, config_);
+        MasterCallLibraryBuilder::Entry entry;
+        entry.id = "library_only_call";
+        entry.features = *features;
+        entry.audio = call;
+        entry.audioSampleRate = 44100;
+        ASSERT_TRUE(builder.add(entry));
+        ASSERT_TRUE(builder.finish());
+    }
+
+    auto engineResult = UnifiedAudioEngine::create();
+    ASSERT_TRUE(engineResult.isOk());
+    auto engine = std::move(engineResult.value);
+    using Status = UnifiedAudioEngine::Status;
+    ASSERT_EQ(engine->setMasterCallLibrary(path_), Status::OK);
+
+    const auto session = engine->createSession(44100.0f);
+    ASSERT_TRUE(session.isOk());
+    ASSERT_EQ(engine->loadMasterCall(session.value, "library_only_call"), Status::OK);
+
+    for (size_t chunk = 0; chunk < 10; ++chunk) {
+        const size_t offset = (chunk * 4096) % (call.size() - 4096);
+        ASSERT_EQ(engine->processAudioChunk(
+                      session.value, std::span<const float>(call).subspan(offset, 4096)),
+                  Status::OK);
+    }
+
+    const auto score = engine->getSimilarityScore(session.value);
+    ASSERT_EQ(score.status, Status::OK);
+    EXPECT_GT(score.value, 0.0f);
+    const auto detailed = engine->getDetailedScore(session.value);
+    ASSERT_EQ(detailed.status, Status::OK);
+    EXPECT_GT(detailed.value.mfcc, 0.0f);
+    EXPECT_GT(detailed.value.volume, 0.0f);
+}
+
+}  // namespace
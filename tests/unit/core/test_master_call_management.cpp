@@ -18,6 +18,7 @@
  * @date August 7, 2025
  */
 
+#include <algorithm>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
@@ -27,6 +28,8 @@
 
 #include <gtest/gtest.h>
 
+#include "dr_wav.h"
+#include "huntmaster/core/FeatureStorage.h"
 #include "huntmaster/core/UnifiedAudioEngine.h"
 
 using namespace huntmaster;
@@ -71,28 +74,25 @@ class MasterCallManagementTest : public ::testing::Test {
         std::filesystem::remove(FEATURES_PATH + SECOND_MASTER_CALL_ID + ".mfc");
     }
 
+    /// Configuration engine sessions extract master-call features with
+    static FeatureConfigRecord sessionFeatureConfig() {
+        MFCCProcessor::Config mfcc;
+        mfcc.sample_rate = static_cast<size_t>(TEST_SAMPLE_RATE);
+        return FeatureConfigRecord::fromMFCC(mfcc, 256);
+    }
+
     void createTestMFCFile(const std::string& masterCallId) {
-        std::string filePath = FEATURES_PATH + masterCallId + ".mfc";
-        std::ofstream file(filePath, std::ios::binary);
-
-        if (file.is_open()) {
-            // Write a simple test MFCC feature set
-            // Format: [num_frames][num_coefficients][feature_data...]
-            uint32_t numFrames = 10;
-            uint32_t numCoefficients = 13;
-
-            file.write(reinterpret_cast<const char*>(&numFrames), sizeof(numFrames));
-            file.write(reinterpret_cast<const char*>(&numCoefficients), sizeof(numCoefficients));
-
-            // Write test feature data (simple pattern)
-            for (uint32_t frame = 0; frame < numFrames; ++frame) {
-                for (uint32_t coeff = 0; coeff < numCoefficients; ++coeff) {
-                    float value = static_cast<float>(frame * numCoefficients + coeff) * 0.1f;
-                    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
-                }
+        // Write a simple test MFCC feature set in the cached .mfc format
+        const uint32_t numFrames = 10;
+        const uint32_t numCoefficients = 13;
+        std::vector<std::vector<float>> features(numFrames, std::vector<float>(numCoefficients));
+        for (uint32_t frame = 0; frame < numFrames; ++frame) {
+            for (uint32_t coeff = 0; coeff < numCoefficients; ++coeff) {
+                features[frame][coeff] = static_cast<float>(frame * numCoefficients + coeff) * 0.1f;
             }
-            file.close();
         }
+        [[maybe_unused]] auto written = FeatureFile::write(
+            FEATURES_PATH + masterCallId + ".mfc", sessionFeatureConfig(), features);
     }
 
     std::unique_ptr<UnifiedAudioEngine> engine;
@@ -320,6 +320,52 @@ TEST_F(MasterCallManagementTest, MasterCallFeatureExtraction) {
     }
 }
 
+TEST_F(MasterCallManagementTest, StreamedMasterCallIsScoredFromItsFeatures) {
+    // A real call at half the session rate, so it streams through the resampler
+    const auto dir = std::filesystem::temp_directory_path() / "huntmaster_streamed_master_call";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "mfc");
+    std::vector<float> call(22050);
+    for (size_t i = 0; i < call.size(); ++i) {
+        const float t = static_cast<float>(i) / 22050.0f;
+        call[i] = 0.4f * std::sin(2.0f * static_cast<float>(M_PI) * 600.0f * t);
+    }
+    drwav_data_format format{};
+    format.container = drwav_container_riff;
+    format.format = DR_WAVE_FORMAT_IEEE_FLOAT;
+    format.channels = 1;
+    format.sampleRate = 22050;
+    format.bitsPerSample = 32;
+    drwav wav;
+    ASSERT_TRUE(drwav_init_file_write(&wav, (dir / "tone.wav").string().c_str(), &format, nullptr));
+    ASSERT_EQ(drwav_write_pcm_frames(&wav, call.size(), call.data()), call.size());
+    drwav_uninit(&wav);
+
+    ASSERT_EQ(engine->setMasterCallDirectories(dir.string(), (dir / "mfc").string()),
+              UnifiedAudioEngine::Status::OK);
+    ASSERT_EQ(engine->loadMasterCall(sessionId, "tone"), UnifiedAudioEngine::Status::OK);
+    // Scoring must not depend on reopening the audio
+    std::filesystem::remove(dir / "tone.wav");
+
+    std::vector<float> live(44100);
+    for (size_t i = 0; i < live.size(); ++i) {
+        const float t = static_cast<float>(i) / TEST_SAMPLE_RATE;
+        live[i] = 0.4f * std::sin(2.0f * static_cast<float>(M_PI) * 600.0f * t);
+    }
+    for (size_t offset = 0; offset < live.size(); offset += 4096) {
+        const size_t count = std::min<size_t>(4096, live.size() - offset);
+        ASSERT_EQ(engine->processAudioChunk(sessionId,
+                                            std::span<const float>(live).subspan(offset, count)),
+                  UnifiedAudioEngine::Status::OK);
+    }
+
+    const auto detailed = engine->getDetailedScore(sessionId);
+    ASSERT_EQ(detailed.status, UnifiedAudioEngine::Status::OK);
+    EXPECT_GT(detailed.value.mfcc, 0.0f);
+    EXPECT_GT(detailed.value.volume, 0.0f);
+    std::filesystem::remove_all(dir);
+}
+
 TEST_F(MasterCallManagementTest, ProcessAudioWithoutMasterCall) {
     // Verify no master call is loaded initially
     auto currentResult = engine->getCurrentMasterCall(sessionId);
@@ -0,0 +1,263 @@
+/**
+ * @file test_staged_pipeline.cpp
+ * @brief Tests for the bounded stage queue and pipeline stages
+ */
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "huntmaster/core/StagedPipeline.h"
+
+using namespace huntmaster;
+using namespace std::chrono_literals;
+
+namespace {
+
+TEST(StageQueueTest, RoundsCapacityAndPreservesOrder) {
+    StageQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8u);
+
+    for (int i = 0; i < 8; ++i) {
+        int value = i;
+        ASSERT_TRUE(queue.tryPush(value));
+    }
+    int extra = 99;
+    EXPECT_FALSE(queue.tryPush(extra));
+    EXPECT_EQ(extra, 99);  // Not moved from on failure
+    EXPECT_EQ(queue.size(), 8u);
+
+    for (int i = 0; i < 8; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    int value = -1;
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(PipelineStageTest, ChainedStagesDeliverEverythingInOrder) {
+    std::vector<int> delivered;
+    std::mutex delivered_mutex;
+
+    PipelineStage<std::vector<float>> sink(
+        {.name = "sink", .queueDepth = 8}, [&](std::vector<float>& frame) {
+            std::lock_guard<std::mutex> lock(delivered_mutex);
+            delivered.push_back(static_cast<int>(frame[0]));
+        });
+    PipelineStage<std::vector<float>> scale(
+        {.name = "scale", .queueDepth = 8}, [&](std::vector<float>& frame) {
+            for (float& sample : frame) {
+                sample *= 2.0f;
+            }
+            sink.submit(frame);
+        });
+    sink.start();
+    scale.start();
+
+    constexpr int kFrames = 500;
+    for (int i = 0; i < kFrames; ++i) {
+        std::vector<float> frame(16, static_cast<float>(i));
+        ASSERT_TRUE(scale.submit(frame));
+    }
+    scale.stop();
+    sink.stop();
+
+    ASSERT_EQ(delivered.size(), static_cast<size_t>(kFrames));
+    for (int i = 0; i < kFrames; ++i) {
+        EXPECT_EQ(delivered[i], 2 * i);
+    }
+
+    const auto metrics = scale.metrics();
+    EXPECT_EQ(metrics.name, "scale");
+    EXPECT_EQ(metrics.processed, static_cast<uint64_t>(kFrames));
+    EXPECT_EQ(metrics.dropped, 0u);
+    EXPECT_EQ(metrics.queueDepth, 0u);
+    EXPECT_LE(metrics.maxQueueDepth, 8u);
+    EXPECT_GE(metrics.maxWaitUs, metrics.averageWaitUs);
+}
+
+TEST(PipelineStageTest, DropNewestNeverBlocksTheProducer) {
+    std::latch release(1);
+    std::vector<int> seen;
+    PipelineStage<int> stage(
+        {.name = "slow", .queueDepth = 4, .policy = BackpressurePolicy::DropNewest},
+        [&](int& value) {
+            release.wait();
+            seen.push_back(value);
+        });
+    stage.start();
+
+    // The first item occupies the worker, four fill the queue, the rest drop
+    int first = 0;
+    ASSERT_TRUE(stage.submit(first));
+    while (stage.metrics().queueDepth != 0) {
+        std::this_thread::yield();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    int accepted = 0;
+    for (int i = 1; i <= 20; ++i) {
+        accepted += stage.submit(i) ? 1 : 0;
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 50ms);
+    EXPECT_EQ(accepted, 4);
+    EXPECT_EQ(stage.metrics().dropped, 16u);
+
+    release.count_down();
+    stage.stop();
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(PipelineStageTest, DropOldestKeepsFreshestItems) {
+    std::latch release(1);
+    std::vector<int> seen;
+    PipelineStage<int> stage(
+        {.name = "fresh", .queueDepth = 4, .policy = BackpressurePolicy::DropOldest},
+        [&](int& value) {
+            release.wait();
+            seen.push_back(value);
+        });
+    stage.start();
+
+    // The first item occupies the worker; the queue then keeps the newest four
+    int first = -1;
+    ASSERT_TRUE(stage.submit(first));
+    while (stage.metrics().queueDepth != 0) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(stage.submit(i));
+    }
+    EXPECT_EQ(stage.metrics().dropped, 6u);
+
+    release.count_down();
+    stage.stop();
+    EXPECT_EQ(seen, (std::vector<int>{-1, 6, 7, 8, 9}));
+}
+
+TEST(PipelineStageTest, RejectsWorkWhileNotRunning) {
+    std::atomic<int> handled{0};
+    PipelineStage<int> stage({.name = "idle", .queueDepth = 4}, [&](int&) { handled++; });
+
+    // Nobody would ever drain these, so they are refused rather than queued
+    int value = 1;
+    EXPECT_FALSE(stage.submit(value));
+    EXPECT_EQ(stage.metrics().queueDepth, 0u);
+
+    stage.start();
+    EXPECT_TRUE(stage.submit(value));
+    stage.stop();
+    EXPECT_EQ(handled.load(), 1);
+
+    EXPECT_FALSE(stage.submit(value));
+    EXPECT_EQ(stage.metrics().queueDepth, 0u);
+    EXPECT_EQ(stage.metrics().dropped, 2u);
+
+    // Restarting accepts work again
+    stage.start();
+    EXPECT_TRUE(stage.submit(value));
+    stage.stop();
+    EXPECT_EQ(handled.load(), 2);
+}
+
+TEST(PipelineStageTest, StopRunsItemsSubmittedConcurrently) {
+    std::atomic<int> handled{0};
+    PipelineStage<int> stage({.name = "racing", .queueDepth = 1024}, [&](int&) { handled++; });
+    stage.start();
+
+    // Every accepted item must be handled even when submits race with stop()
+    std::atomic<int> accepted{0};
+    std::thread producer([&] {
+        for (int i = 0; i < 100000; ++i) {
+            if (stage.submit(i)) {
+                accepted++;
+            } else if (!stage.isRunning()) {
+                break;
+            }
+        }
+    });
+    std::this_thread::sleep_for(1ms);
+    stage.stop();
+    producer.join();
+
+    EXPECT_GT(accepted.load(), 0);
+    EXPECT_EQ(handled.load(), accepted.load());
+    EXPECT_EQ(stage.metrics().queueDepth, 0u);
+}
+
+TEST(PipelineStageTest, BlockPolicyWaitsThenGivesUp) {
+    std::latch release(1);
+    PipelineStage<int> stage(
+        {.name = "blocked", .queueDepth = 2, .policy = BackpressurePolicy::Block,
+         .blockTimeout = 20ms},
+        [&](int&) { release.wait(); });
+    stage.start();
+
+    // One item occupies the worker and two fill the queue
+    int first = 0;
+    ASSERT_TRUE(stage.submit(first));
+    while (stage.metrics().queueDepth != 0) {
+        std::this_thread::yield();
+    }
+    int a = 1, b = 2, c = 3;
+    ASSERT_TRUE(stage.submit(a));
+    ASSERT_TRUE(stage.submit(b));
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(stage.submit(c));
+    EXPECT_EQ(stage.metrics().dropped, 1u);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+    release.count_down();
+    stage.stop();
+    EXPECT_EQ(stage.metrics().processed, 3u);
+
+    // Once a worker drains the queue, a blocked producer gets through
+    std::atomic<int> handled{0};
+    PipelineStage<int> slow({.name = "slow", .queueDepth = 2, .policy = BackpressurePolicy::Block,
+                             .blockTimeout = 500ms},
+                            [&](int&) {
+                                std::this_thread::sleep_for(2ms);
+                                handled.fetch_add(1);
+                            });
+    slow.start();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(slow.submit(i));
+    }
+    slow.stop();
+    EXPECT_EQ(handled.load(), 10);
+    EXPECT_EQ(slow.metrics().dropped, 0u);
+}
+
+TEST(PipelineStageTest, InlineStageRunsOnSubmitAndCountsErrors) {
+    int calls = 0;
+    PipelineStage<int> stage({.name = "inline", .workers = 0}, [&](int& value) {
+        ++calls;
+        if (value < 0) {
+            throw std::runtime_error("bad frame");
+        }
+        value *= 10;
+    });
+
+    int value = 4;
+    EXPECT_TRUE(stage.submit(value));
+    EXPECT_EQ(value, 40);
+    int bad = -1;
+    EXPECT_TRUE(stage.submit(bad));
+    EXPECT_EQ(calls, 2);
+
+    const auto metrics = stage.metrics();
+    EXPECT_EQ(metrics.processed, 1u);
+    EXPECT_EQ(metrics.errors, 1u);
+
+    stage.resetMetrics();
+    EXPECT_EQ(stage.metrics().processed, 0u);
+}
+
+}  // namespace
@@ -0,0 +1,238 @@
+/**
+ * @file test_streaming_audio_processor_stages.cpp
+ * @brief Tests for the VAD, quality and similarity stages of StreamingAudioProcessor
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/StreamingAudioProcessor.h"
+
+using namespace huntmaster::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr float kTwoPi = 2.0f * static_cast<float>(M_PI);
+constexpr uint32_t kSampleRate = 44100;
+
+/// Mono buffer over a sample vector
+class VectorAudioBuffer : public AudioBuffer {
+  public:
+    explicit VectorAudioBuffer(std::vector<float> samples) : samples_(std::move(samples)) {}
+
+    bool isEmpty() const override { return samples_.empty(); }
+    size_t getFrameCount() const override { return samples_.size(); }
+    size_t getChannelCount() const override { return 1; }
+    float getSample(size_t, size_t frame) const override { return samples_[frame]; }
+
+  private:
+    std::vector<float> samples_;
+};
+
+std::vector<float> tone(float frequency, float amplitude, size_t length) {
+    std::vector<float> samples(length);
+    for (size_t i = 0; i < length; ++i) {
+        samples[i] = amplitude * std::sin(kTwoPi * frequency * i / kSampleRate);
+    }
+    return samples;
+}
+
+std::vector<float> noise(float amplitude, size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-amplitude, amplitude);
+    std::vector<float> samples(length);
+    for (float& sample : samples) {
+        sample = dist(rng);
+    }
+    return samples;
+}
+
+class StreamingAudioProcessorStagesTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        config_ = createDefaultStreamingConfig();
+        config_.sampleRate = kSampleRate;
+        config_.channels = 1;
+        config_.bufferSize = 1024;
+        config_.hopSize = 512;
+        config_.backpressurePolicy = huntmaster::BackpressurePolicy::Block;
+        config_.backpressureTimeoutMs = 1000;
+    }
+
+    /// Feeds `audio` in chunks and returns the results delivered per sequence number
+    std::map<uint32_t, StreamingProcessingResult>
+    run(StreamingAudioProcessor& processor, const std::vector<float>& audio, size_t chunk) {
+        std::map<uint32_t, StreamingProcessingResult> results;
+        std::atomic<size_t> delivered{0};
+        processor.setProcessingCallback([&](const StreamingProcessingResult& result) {
+            results[result.sequenceNumber] = result;
+            delivered++;
+        });
+
+        size_t frames = 0;
+        for (size_t offset = 0; offset < audio.size(); offset += chunk) {
+            const size_t count = std::min(chunk, audio.size() - offset);
+            const auto before = frames;
+            frames = (offset + count) / (config_.bufferSize * config_.channels);
+            EXPECT_EQ(processor.processAudioChunk(audio.data() + offset, count).errorCode, 0);
+
+            // Let a threaded pipeline catch up so no frame is dropped at capture
+            const auto deadline = std::chrono::steady_clock::now() + 5s;
+            while (frames > before && delivered.load() < frames
+                   && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        }
+        processor.setProcessingCallback(nullptr);
+        return results;
+    }
+
+    StreamingConfig config_;
+};
+
+TEST_F(StreamingAudioProcessorStagesTest, FramesCarryRealAnalysis) {
+    StreamingAudioProcessor processor;
+    ASSERT_TRUE(processor.initialize(config_));
+    ASSERT_TRUE(processor.setMasterAudio(VectorAudioBuffer(tone(440.0f, 0.5f, kSampleRate / 2))));
+    EXPECT_TRUE(processor.getMasterAudioInfo().isLoaded);
+    EXPECT_NEAR(processor.getMasterAudioInfo().duration, 0.5f, 1e-3f);
+
+    // Quiet room noise ahead of the call gives the realtime SNR its noise floor; small chunks
+    // are gathered into whole frames before they reach the stages
+    std::vector<float> call = noise(0.005f, kSampleRate / 2, 11);
+    const auto voiced = tone(440.0f, 0.5f, kSampleRate);
+    call.insert(call.end(), voiced.begin(), voiced.end());
+    const auto matching = run(processor, call, 100);
+    ASSERT_EQ(matching.size(), call.size() / config_.bufferSize);
+    const auto& last = matching.rbegin()->second;
+    EXPECT_TRUE(last.voiceActivityDetected);
+    EXPECT_GT(last.vadProbability, config_.vadThreshold);
+    EXPECT_GT(last.signalToNoiseRatio, 20.0f);
+    EXPECT_GT(last.speechQuality, 0.0f);
+    EXPECT_FLOAT_EQ(last.confidence, 1.0f);
+    EXPECT_NEAR(last.volumeSimilarity, 1.0f, 0.05f);
+    EXPECT_GT(processor.getCurrentQuality().signalToNoiseRatio, 20.0f);
+    EXPECT_TRUE(processor.getVADStatus().voiceDetected);
+
+    // A different call scores lower against the same master
+    ASSERT_TRUE(processor.reset());
+    ASSERT_TRUE(processor.setMasterAudio(VectorAudioBuffer(tone(440.0f, 0.5f, kSampleRate / 2))));
+    const auto other = run(processor, noise(0.5f, kSampleRate, 7), config_.bufferSize);
+    ASSERT_FALSE(other.empty());
+    EXPECT_LT(other.rbegin()->second.overallSimilarity, last.overallSimilarity);
+
+    // Silence releases the detector once the hang time has passed
+    const auto silent = run(processor, std::vector<float>(kSampleRate / 2, 0.0f), 512);
+    EXPECT_FALSE(silent.rbegin()->second.voiceActivityDetected);
+    EXPECT_LT(silent.rbegin()->second.vadProbability, config_.vadThreshold);
+    EXPECT_GE(processor.getVADStatus().silenceDuration, config_.vadHangTime);
+}
+
+TEST_F(StreamingAudioProcessorStagesTest, StreamingMatchesInlineResults) {
+    std::vector<float> audio = tone(300.0f, 0.4f, kSampleRate);
+    const auto tail = noise(0.2f, kSampleRate / 2, 3);
+    audio.insert(audio.end(), tail.begin(), tail.end());
+    const VectorAudioBuffer master(tone(300.0f, 0.4f, kSampleRate / 4));
+
+    StreamingAudioProcessor inlineProcessor;
+    ASSERT_TRUE(inlineProcessor.initialize(config_));
+    ASSERT_TRUE(inlineProcessor.setMasterAudio(master));
+    const auto expected = run(inlineProcessor, audio, 700);
+
+    StreamingAudioProcessor threaded;
+    ASSERT_TRUE(threaded.initialize(config_));
+    ASSERT_TRUE(threaded.setMasterAudio(master));
+    ASSERT_TRUE(threaded.startStreaming());
+    const auto actual = run(threaded, audio, 700);
+    ASSERT_TRUE(threaded.stopStreaming());
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (const auto& [sequence, result] : expected) {
+        const auto& streamed = actual.at(sequence);
+        EXPECT_EQ(streamed.voiceActivityDetected, result.voiceActivityDetected) << sequence;
+        EXPECT_FLOAT_EQ(streamed.vadProbability, result.vadProbability) << sequence;
+        EXPECT_FLOAT_EQ(streamed.signalToNoiseRatio, result.signalToNoiseRatio) << sequence;
+        EXPECT_FLOAT_EQ(streamed.overallSimilarity, result.overallSimilarity) << sequence;
+    }
+    EXPECT_EQ(threaded.getPerformanceMetrics().framesDropped, 0u);
+    EXPECT_EQ(threaded.getPerformanceMetrics().totalSamplesProcessed,
+              expected.size() * config_.bufferSize);
+}
+
+TEST_F(StreamingAudioProcessorStagesTest, ParallelFeatureWorkersScoreInCaptureOrder) {
+    std::vector<float> audio = tone(250.0f, 0.4f, kSampleRate / 2);
+    const auto middle = noise(0.3f, kSampleRate / 2, 5);
+    audio.insert(audio.end(), middle.begin(), middle.end());
+    const auto end = tone(500.0f, 0.3f, kSampleRate / 2);
+    audio.insert(audio.end(), end.begin(), end.end());
+    const VectorAudioBuffer master(tone(250.0f, 0.4f, kSampleRate / 4));
+
+    // Without VAD and quality analysis, feature extraction is the slowest stage and several
+    // frames per chunk keep every worker busy, so they finish out of order
+    config_.enableVAD = false;
+    config_.enableQualityAssessment = false;
+    auto score = [&](uint32_t workers) {
+        config_.featureWorkers = workers;
+        StreamingAudioProcessor processor;
+        EXPECT_TRUE(processor.initialize(config_));
+        EXPECT_TRUE(processor.setMasterAudio(master));
+        EXPECT_TRUE(processor.startStreaming());
+        auto results = run(processor, audio, 8 * config_.bufferSize);
+        EXPECT_TRUE(processor.stopStreaming());
+        return results;
+    };
+    const auto expected = score(1);
+    const auto actual = score(4);
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (const auto& [sequence, result] : expected) {
+        const auto& parallel = actual.at(sequence);
+        EXPECT_FLOAT_EQ(parallel.overallSimilarity, result.overallSimilarity) << sequence;
+        EXPECT_FLOAT_EQ(parallel.confidence, result.confidence) << sequence;
+    }
+}
+
+TEST_F(StreamingAudioProcessorStagesTest, MixesChannelsDown) {
+    config_.channels = 2;
+    StreamingAudioProcessor processor;
+    ASSERT_TRUE(processor.initialize(config_));
+
+    // Opposite-phase channels cancel, so the mono signal the stages see is silent
+    const auto left = tone(500.0f, 0.5f, kSampleRate / 2);
+    std::vector<float> interleaved;
+    for (const float sample : left) {
+        interleaved.push_back(sample);
+        interleaved.push_back(-sample);
+    }
+    const auto results = run(processor, interleaved, 2048);
+    ASSERT_FALSE(results.empty());
+    EXPECT_FALSE(results.rbegin()->second.voiceActivityDetected);
+    EXPECT_FLOAT_EQ(results.rbegin()->second.clippingLevel, 0.0f);
+    EXPECT_EQ(processor.getPerformanceMetrics().totalSamplesProcessed,
+              results.size() * config_.bufferSize * 2);
+}
+
+TEST_F(StreamingAudioProcessorStagesTest, RejectsUnusableMasterAudio) {
+    StreamingAudioProcessor processor;
+    EXPECT_FALSE(processor.setMasterAudio(VectorAudioBuffer(tone(440.0f, 0.5f, 4096))));
+
+    ASSERT_TRUE(processor.initialize(config_));
+    EXPECT_FALSE(processor.setMasterAudio(VectorAudioBuffer({})));
+    EXPECT_FALSE(processor.setMasterAudio(VectorAudioBuffer(std::vector<float>(100, 0.1f))));
+    EXPECT_FALSE(processor.getMasterAudioInfo().isLoaded);
+    EXPECT_FALSE(processor.updateMasterAudioParameters(1.0f, 1.0f));
+
+    ASSERT_TRUE(processor.setMasterAudio(VectorAudioBuffer(tone(440.0f, 0.5f, 4096))));
+    EXPECT_TRUE(processor.updateMasterAudioParameters(0.5f, 1.0f));
+    EXPECT_FALSE(processor.updateMasterAudioParameters(1.0f, 1.5f));
+}
+
+}  // namespace
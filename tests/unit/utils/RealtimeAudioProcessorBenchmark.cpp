@@ -71,6 +71,30 @@ static void BM_RoundTrip(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark batch round trips: one atomic claim per batch on each side.
+static void BM_BatchRoundTrip(benchmark::State& state) {
+    RealtimeAudioProcessor::Config cfg;
+    cfg.ring_buffer_size = 256;
+    cfg.chunk_size = 512;
+    cfg.enable_metrics = false;
+
+    RealtimeAudioProcessor proc(cfg);
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    std::vector<float> data(512, 1.0f);
+    std::vector<std::span<const float>> batch(batch_size, std::span<const float>(data));
+    std::vector<AudioChunk> out(batch_size);
+
+    for (auto _ : state) {
+        size_t enqueued = proc.enqueueBatch(batch);
+        size_t dequeued = proc.dequeueBatch(std::span<AudioChunk>(out));
+        benchmark::DoNotOptimize(enqueued);
+        benchmark::DoNotOptimize(dequeued);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
 BENCHMARK(BM_Enqueue)->RangeMultiplier(2)->Range(8, 256);
 BENCHMARK(BM_Dequeue)->RangeMultiplier(2)->Range(8, 256);
-BENCHMARK(BM_RoundTrip)->RangeMultiplier(2)->Range(8, 256);
\ No newline at end of file
+BENCHMARK(BM_RoundTrip)->RangeMultiplier(2)->Range(8, 256);
+BENCHMARK(BM_BatchRoundTrip)->RangeMultiplier(4)->Range(1, 64);
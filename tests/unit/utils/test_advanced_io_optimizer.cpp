@@ -3,9 +3,14 @@
  * @brief Comprehensive tests for advanced I/O optimization features
  */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <random>
 #include <thread>
 
@@ -386,6 +391,126 @@ TEST_F(AdvancedIOOptimizerTest, AdvancedAsyncIOMetrics) {
     std::filesystem::remove(testFile);
 }
 
+TEST_F(AdvancedIOOptimizerTest, AdvancedAsyncIOBatchAndChainedReads) {
+    AdvancedAsyncIO::Config config;
+    config.queueDepth = 16;  // Fewer slots than requests: submission must recycle them
+    AdvancedAsyncIO asyncIO(config);
+    ASSERT_TRUE(asyncIO.initialize());
+
+    int fd = open(smallTestFile_.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+    std::vector<char> expected(64 * 1024);
+    ASSERT_EQ(pread(fd, expected.data(), expected.size(), 0),
+              static_cast<ssize_t>(expected.size()));
+
+    // Batch: 64 reads of 1 KiB in one submission
+    constexpr size_t kBlocks = 64;
+    constexpr size_t kBlock = 1024;
+    std::vector<char> batchData(kBlocks * kBlock, 0);
+    std::atomic<size_t> batchDone{0};
+    std::atomic<size_t> batchBytes{0};
+    std::vector<AdvancedAsyncIO::ReadRequest> requests;
+    for (size_t i = 0; i < kBlocks; ++i) {
+        requests.push_back({fd, batchData.data() + i * kBlock, kBlock,
+                            static_cast<off_t>(i * kBlock),
+                            [&](bool success, size_t bytes, std::chrono::nanoseconds) {
+                                batchBytes += success ? bytes : 0;
+                                batchDone++;
+                            }});
+    }
+    EXPECT_EQ(asyncIO.readBatchAsync(std::move(requests)), kBlocks);
+
+    // Chain: ordered reads, each decoded on arrival
+    std::vector<char> chainData(3 * kBlock, 0);
+    std::vector<size_t> decoded;
+    std::atomic<bool> chainDone{false};
+    std::atomic<bool> chainSuccess{false};
+    std::atomic<size_t> chainBytes{0};
+    std::vector<AdvancedAsyncIO::ChainedRead> chain;
+    for (size_t i = 0; i < 3; ++i) {
+        chain.push_back({chainData.data() + i * kBlock, kBlock,
+                         static_cast<off_t>((i + 10) * kBlock), [&decoded, i](size_t bytes) {
+                             decoded.push_back(i);
+                             return bytes == kBlock;
+                         }});
+    }
+    EXPECT_TRUE(asyncIO.readChainAsync(
+        fd, std::move(chain), [&](bool success, size_t bytes, std::chrono::nanoseconds) {
+            chainSuccess = success;
+            chainBytes = bytes;
+            chainDone = true;
+        }));
+
+    // A failing decode step fails the whole chain
+    std::vector<char> rejected(kBlock);
+    std::atomic<bool> rejectDone{false};
+    std::atomic<bool> rejectSuccess{true};
+    EXPECT_TRUE(asyncIO.readChainAsync(
+        fd, {{rejected.data(), kBlock, 0, [](size_t) { return false; }}},
+        [&](bool success, size_t, std::chrono::nanoseconds) {
+            rejectSuccess = success;
+            rejectDone = true;
+        }));
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((batchDone.load() < kBlocks || !chainDone || !rejectDone)
+           && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(batchDone.load(), kBlocks);
+    EXPECT_EQ(batchBytes.load(), kBlocks * kBlock);
+    EXPECT_TRUE(std::equal(batchData.begin(), batchData.end(), expected.begin()));
+
+    ASSERT_TRUE(chainDone);
+    EXPECT_TRUE(chainSuccess);
+    EXPECT_EQ(chainBytes.load(), 3 * kBlock);
+    EXPECT_EQ(decoded, (std::vector<size_t>{0, 1, 2}));
+    EXPECT_TRUE(std::equal(chainData.begin(), chainData.end(), expected.begin() + 10 * kBlock));
+
+    ASSERT_TRUE(rejectDone);
+    EXPECT_FALSE(rejectSuccess);
+
+    close(fd);
+    asyncIO.shutdown();
+}
+
+TEST_F(AdvancedIOOptimizerTest, AdvancedAsyncIORegisteredBuffersAndFiles) {
+    AdvancedAsyncIO asyncIO;
+    ASSERT_TRUE(asyncIO.initialize());
+
+    int fd = open(smallTestFile_.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+
+    std::vector<char> pinned(8192, 0);
+    const bool registered = asyncIO.registerBuffers({{pinned.data(), pinned.size()}})
+                            && asyncIO.registerFiles({fd});
+    // Only the io_uring engine supports registration
+    EXPECT_EQ(registered, asyncIO.getActiveEngine() == AdvancedAsyncIO::Engine::IO_URING);
+
+    // Reads behave the same whether or not they hit registered resources
+    std::atomic<bool> done{false};
+    std::atomic<size_t> transferred{0};
+    ASSERT_TRUE(asyncIO.readAsync(fd, pinned.data() + 1024, 4096, 512,
+                                  [&](bool success, size_t bytes, std::chrono::nanoseconds) {
+                                      transferred = success ? bytes : 0;
+                                      done = true;
+                                  }));
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(done);
+    EXPECT_EQ(transferred.load(), 4096u);
+
+    std::vector<char> expected(4096);
+    ASSERT_EQ(pread(fd, expected.data(), expected.size(), 512), 4096);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), pinned.begin() + 1024));
+
+    asyncIO.shutdown();
+    close(fd);
+}
+
 // ============================================================================
 // Integration Tests
 // ============================================================================
@@ -426,6 +551,116 @@ TEST_F(AdvancedIOOptimizerTest, SystemIntegrationTest) {
     EXPECT_LE(systemReport.overallHealthScore, 1.0);
 }
 
+// ============================================================================
+// CompressionPipeline Tests
+// ============================================================================
+
+namespace {
+
+// 16-bit-quantized chirp plus noise, as the recorder stores it
+std::vector<float> makeQuantizedSignal(size_t frames, uint16_t channels) {
+    std::mt19937 gen(42);
+    std::normal_distribution<float> noise(0.0f, 30.0f);
+    std::vector<float> samples(frames * channels);
+    for (size_t i = 0; i < frames; ++i) {
+        const float t = static_cast<float>(i) / 44100.0f;
+        for (uint16_t c = 0; c < channels; ++c) {
+            const float tone =
+                8000.0f * std::sin(2.0f * 3.14159265f * (300.0f + 400.0f * t + 50.0f * c) * t);
+            const auto value = std::clamp(std::lround(tone + noise(gen)), -32768L, 32767L);
+            samples[i * channels + c] = static_cast<float>(value) / 32768.0f;
+        }
+    }
+    return samples;
+}
+
+bool bitwiseEqual(const std::vector<float>& a, const float* b, size_t count) {
+    return a.size() == count && std::memcmp(a.data(), b, count * sizeof(float)) == 0;
+}
+
+}  // namespace
+
+TEST_F(AdvancedIOOptimizerTest, CompressionPipelineLosslessForQuantizedAudio) {
+    CompressionPipeline::Config config;
+    config.algorithm = CompressionPipeline::Algorithm::FLAC_BEST;
+    CompressionPipeline pipeline(config);
+
+    for (uint16_t channels : {uint16_t{1}, uint16_t{2}}) {
+        const auto samples = makeQuantizedSignal(100000, channels);
+        auto compressed = pipeline.compress(samples.data(), samples.size(), channels, 44100);
+        ASSERT_TRUE(compressed.success);
+        EXPECT_GT(compressed.compressionRatio, 2.0);
+
+        auto decoded =
+            pipeline.decompress(compressed.compressedData.data(), compressed.compressedData.size());
+        ASSERT_TRUE(decoded.success);
+        EXPECT_EQ(decoded.channels, channels);
+        EXPECT_EQ(decoded.sampleRate, 44100u);
+        EXPECT_TRUE(bitwiseEqual(decoded.audioData, samples.data(), samples.size()));
+    }
+
+    const auto stats = pipeline.getStats();
+    EXPECT_GT(stats.totalBytesInput, stats.totalBytesOutput);
+    EXPECT_GT(pipeline.estimateCompressionRatio(1, 44100, 1.0), 2.0);
+}
+
+TEST_F(AdvancedIOOptimizerTest, CompressionPipelineRoundTripsArbitraryFloats) {
+    CompressionPipeline pipeline;
+
+    // Block 0 is 16-bit exact, block 1 is full-precision floats with odd values
+    auto samples = makeQuantizedSignal(32768, 1);
+    samples[20000] = 0.1f;
+    samples[20001] = -0.0f;
+    samples[20002] = 1.0f;
+    samples[20003] = std::numeric_limits<float>::denorm_min();
+
+    auto compressed = pipeline.compress(samples.data(), samples.size(), 1, 48000);
+    ASSERT_TRUE(compressed.success);
+    auto decoded =
+        pipeline.decompress(compressed.compressedData.data(), compressed.compressedData.size());
+    ASSERT_TRUE(decoded.success);
+    EXPECT_TRUE(bitwiseEqual(decoded.audioData, samples.data(), samples.size()));
+
+    // Silence and an empty stream
+    std::vector<float> silence(10000, 0.0f);
+    compressed = pipeline.compress(silence.data(), silence.size(), 1, 48000);
+    ASSERT_TRUE(compressed.success);
+    EXPECT_LT(compressed.compressedData.size(), silence.size() / 4);
+    compressed = pipeline.compress(nullptr, 0, 2, 48000);
+    ASSERT_TRUE(compressed.success);
+    decoded =
+        pipeline.decompress(compressed.compressedData.data(), compressed.compressedData.size());
+    ASSERT_TRUE(decoded.success);
+    EXPECT_TRUE(decoded.audioData.empty());
+}
+
+TEST_F(AdvancedIOOptimizerTest, CompressionPipelineRangeDecodeAndCorruption) {
+    CompressionPipeline::Config config;
+    config.blockSizeBytes = 4096;  // Many small blocks
+    CompressionPipeline pipeline(config);
+
+    const auto samples = makeQuantizedSignal(50000, 2);
+    const auto compressed = pipeline.compress(samples.data(), samples.size(), 2, 44100);
+    ASSERT_TRUE(compressed.success);
+    const auto& stream = compressed.compressedData;
+
+    auto range = pipeline.decompressRange(stream.data(), stream.size(), 12345, 3000);
+    ASSERT_TRUE(range.success);
+    EXPECT_TRUE(bitwiseEqual(range.audioData, samples.data() + 12345 * 2, 3000 * 2));
+
+    // Clamped at the end of the stream
+    range = pipeline.decompressRange(stream.data(), stream.size(), 49000, 5000);
+    ASSERT_TRUE(range.success);
+    EXPECT_TRUE(bitwiseEqual(range.audioData, samples.data() + 49000 * 2, 1000 * 2));
+
+    EXPECT_FALSE(pipeline.decompress(stream.data(), 10).success);
+    EXPECT_FALSE(pipeline.decompress(stream.data(), stream.size() - 1).success);
+    auto corrupted = stream;
+    corrupted[0] = 'X';
+    EXPECT_FALSE(pipeline.decompress(corrupted.data(), corrupted.size()).success);
+    EXPECT_FALSE(pipeline.compress(samples.data(), 3, 2, 44100).success);
+}
+
 // ============================================================================
 // Performance Tests
 // ============================================================================
@@ -1,10 +1,13 @@
 #include <chrono>
+#include <cmath>
+#include <random>
 #include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "TestUtils.h"
+#include "huntmaster/core/MFCCProcessor.h"
 #include "huntmaster/core/VoiceActivityDetector.h"
 
 using namespace huntmaster;
@@ -111,3 +114,151 @@ TEST_F(VoiceActivityDetectorTest, InvalidInputReturnsError) {
     auto result = vad_->processWindow(empty);
     EXPECT_FALSE(result.has_value());
 }
+
+// Batch processing must match window-by-window processing
+TEST_F(VoiceActivityDetectorTest, ProcessChunkMatchesPerWindow) {
+    const size_t window = 320;
+    std::vector<float> chunk;
+    for (float level : {0.0f, 0.2f, 0.2f, 0.2f, 0.0f, 0.0f, 0.0f, 0.0f, 0.2f, 0.2f, 0.0f}) {
+        auto part = MakeAudio(window, level);
+        chunk.insert(chunk.end(), part.begin(), part.end());
+    }
+    chunk.resize(chunk.size() + 100, 0.2f);  // Partial tail window
+
+    VoiceActivityDetector reference(config_);
+    std::vector<bool> expected;
+    for (size_t i = 0; i + window <= chunk.size(); i += window) {
+        auto result = reference.processWindow(std::span<const float>(chunk).subspan(i, window));
+        ASSERT_TRUE(result.has_value());
+        expected.push_back(result->is_active);
+    }
+
+    auto batch = vad_->processChunk(chunk, window);
+    ASSERT_TRUE(batch.has_value());
+    EXPECT_EQ(batch->windows_processed, expected.size());
+    EXPECT_EQ(batch->samples_consumed, expected.size() * window);
+    EXPECT_EQ(batch->is_active, reference.isVoiceActive());
+
+    std::vector<bool> actual(expected.size(), false);
+    for (const auto& span : batch->active_spans) {
+        const size_t offset = static_cast<size_t>(span.data() - chunk.data());
+        ASSERT_EQ(offset % window, 0u);
+        ASSERT_EQ(span.size() % window, 0u);
+        for (size_t w = offset / window; w < (offset + span.size()) / window; ++w) {
+            actual[w] = true;
+        }
+    }
+    EXPECT_EQ(actual, expected);
+
+    // Adjacent active windows are coalesced
+    for (size_t i = 1; i < batch->active_spans.size(); ++i) {
+        EXPECT_GT(batch->active_spans[i].data(),
+                  batch->active_spans[i - 1].data() + batch->active_spans[i - 1].size());
+    }
+
+    EXPECT_FALSE(vad_->processChunk({}, window).has_value());
+    EXPECT_FALSE(vad_->processChunk(chunk, 0).has_value());
+}
+
+// Spectral mode tracks a wind-like noise floor and only passes the call
+TEST_F(VoiceActivityDetectorTest, SpectralModeRejectsWindNoise) {
+    const size_t sample_rate = 16000;
+    const size_t noise_samples = 3 * sample_rate;
+    const size_t call_samples = sample_rate / 2;
+
+    // Low-passed noise with slow gusts, loud enough to trip the energy detector
+    std::mt19937 rng(7);
+    std::normal_distribution<float> white(0.0f, 1.0f);
+    std::vector<float> audio(noise_samples + call_samples + sample_rate);
+    float lowpass = 0.0f;
+    for (size_t i = 0; i < audio.size(); ++i) {
+        const float gust = 1.0f + 0.3f * std::sin(2.0f * static_cast<float>(M_PI) * 0.7f * i
+                                                  / static_cast<float>(sample_rate));
+        lowpass = 0.95f * lowpass + 0.05f * white(rng);
+        audio[i] = 1.2f * gust * lowpass;
+    }
+    for (size_t i = 0; i < call_samples; ++i) {
+        const float t = static_cast<float>(i) / sample_rate;
+        audio[noise_samples + i] += 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * 1800.0f * t);
+    }
+
+    VoiceActivityDetector::Config config = config_;
+    config.sample_rate = sample_rate;
+    config.spectral_hop_size = 256;
+    config.min_sound_duration = std::chrono::milliseconds(48);
+    config.post_buffer = std::chrono::milliseconds(48);
+    VoiceActivityDetector spectral(config);
+
+    MFCCProcessor::Config mfcc_config;
+    mfcc_config.sample_rate = sample_rate;
+    mfcc_config.frame_size = 512;
+    MFCCProcessor mfcc(mfcc_config);
+
+    std::vector<bool> decisions;
+    auto features = mfcc.extractFeaturesFromBuffer(
+        audio, 256, [&](std::span<const float> power_spectrum) {
+            auto result = spectral.processSpectrum(power_spectrum);
+            const bool active = result.has_value() && result->is_active;
+            decisions.push_back(active);
+            return active;
+        });
+    ASSERT_TRUE(features.has_value());
+
+    size_t kept = 0;
+    for (bool active : decisions) {
+        kept += active ? 1 : 0;
+    }
+    EXPECT_EQ(features->size(), kept);
+
+    // Noise after the tracker has settled (1.5 s in) stays mostly rejected
+    const size_t settled = (3 * sample_rate / 2) / 256;
+    const size_t call_start = noise_samples / 256 + 2;
+    const size_t call_end = (noise_samples + call_samples) / 256 - 2;
+    size_t noise_active = 0;
+    for (size_t f = settled; f < call_start - 4; ++f) {
+        noise_active += decisions[f] ? 1 : 0;
+    }
+    EXPECT_LT(noise_active, (call_start - 4 - settled) / 10);
+
+    // Onset waits out min_sound_duration; the call then stays active
+    size_t call_active = 0;
+    for (size_t f = call_start + 6; f < call_end; ++f) {
+        call_active += decisions[f] ? 1 : 0;
+    }
+    EXPECT_GT(call_active, (call_end - call_start - 6) * 8 / 10);
+
+    // The fixed energy threshold is flooded by the same wind
+    auto energy = vad_->processWindow(std::span<const float>(audio).subspan(sample_rate, 320));
+    ASSERT_TRUE(energy.has_value());
+    EXPECT_GT(energy->energy_level, config_.energy_threshold);
+
+    const std::vector<float> invalid = {1.0f, -1.0f, 1.0f};
+    EXPECT_FALSE(spectral.processSpectrum(invalid).has_value());
+}
+
+// A 256-sample hop at 44.1 kHz is 5.8 ms; durations must not round it down to 5 ms
+TEST_F(VoiceActivityDetectorTest, SpectralModeKeepsSubMillisecondHops) {
+    VoiceActivityDetector::Config config = config_;
+    config.sample_rate = 44100;
+    config.spectral_hop_size = 256;
+    VoiceActivityDetector spectral(config);
+
+    std::vector<float> quiet(257, 1e-6f);
+    std::vector<float> tonal(257, 1e-6f);
+    for (size_t k = 0; k < tonal.size(); k += 2) {
+        tonal[k] = 1.0f;
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(spectral.processSpectrum(quiet).has_value());
+    }
+
+    const size_t active_frames = 150;
+    auto result = spectral.processSpectrum(tonal);
+    for (size_t i = 1; i < active_frames; ++i) {
+        result = spectral.processSpectrum(tonal);
+    }
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(result->is_active);
+    const auto expected_ms = static_cast<int64_t>(active_frames * 256 * 1000 / 44100);
+    EXPECT_NEAR(result->duration.count(), expected_ms, 1);
+}
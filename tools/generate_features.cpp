@@ -1,17 +1,18 @@
+#include <algorithm>
 #include <chrono>
-#include <filesystem>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
-#include <memory>
 #include <string>
 #include <vector>
 
 #include "huntmaster/core/DebugConfig.h"
 #include "huntmaster/core/DebugLogger.h"
-#include "huntmaster/core/UnifiedAudioEngine.h"
+#include "huntmaster/core/MasterCallBatchBuilder.h"
 
 using huntmaster::DebugConfig;
 using huntmaster::DebugLogger;
-using huntmaster::UnifiedAudioEngine;
+using huntmaster::MasterCallBatchBuilder;
 
 // Debug options structure
 struct DebugOptions {
@@ -23,6 +24,10 @@ struct DebugOptions {
     bool enableFeatureDebug = false;
     bool enableBatchDebug = false;
     bool printHelp = false;
+    bool force = false;
+    size_t jobs = 0;
+    std::string inputDir = "../data/master_calls";
+    std::string outputDir = "../data/processed_calls/mfc";
 
     void parseArgs(int argc, char* argv[]) {
         for (int i = 1; i < argc; i++) {
@@ -43,6 +48,14 @@ struct DebugOptions {
                 enableBatchDebug = true;
             } else if (arg == "--help" || arg == "-h") {
                 printHelp = true;
+            } else if (arg == "--force") {
+                force = true;
+            } else if (arg.rfind("--jobs=", 0) == 0) {
+                jobs = std::strtoul(arg.c_str() + 7, nullptr, 10);
+            } else if (arg.rfind("--input=", 0) == 0) {
+                inputDir = arg.substr(8);
+            } else if (arg.rfind("--output=", 0) == 0) {
+                outputDir = arg.substr(9);
             }
         }
     }
@@ -52,7 +65,8 @@ struct DebugOptions {
         std::cout << "Usage: " << programName << " [options] [call_names...]" << std::endl;
         std::cout << std::endl;
         std::cout << "Arguments:" << std::endl;
-        std::cout << "  call_names       Specific call names to process (optional)" << std::endl;
+        std::cout << "  call_names       Specific call names to process (default: all)"
+                  << std::endl;
         std::cout << std::endl;
         std::cout << "Options:" << std::endl;
         std::cout << "  --debug, -d      Enable debug logging" << std::endl;
@@ -62,10 +76,17 @@ struct DebugOptions {
         std::cout << "  --engine-debug   Enable engine debugging" << std::endl;
         std::cout << "  --feature-debug  Enable feature extraction debugging" << std::endl;
         std::cout << "  --batch-debug    Enable batch processing debugging" << std::endl;
+        std::cout << "  --jobs=N         Worker threads (default: one per core)" << std::endl;
+        std::cout << "  --force          Rebuild calls even if unchanged since the last run"
+                  << std::endl;
+        std::cout << "  --input=DIR      Master call WAVs (default: " << inputDir << ")"
+                  << std::endl;
+        std::cout << "  --output=DIR     .mfc feature files (default: " << outputDir << ")"
+                  << std::endl;
         std::cout << "  --help, -h       Show this help message" << std::endl;
         std::cout << std::endl;
         std::cout << "Examples:" << std::endl;
-        std::cout << "  " << programName << "                           # Process all default calls"
+        std::cout << "  " << programName << "                           # Process all calls"
                   << std::endl;
         std::cout << "  " << programName << " --debug --performance      # Process with debug info"
                   << std::endl;
@@ -124,116 +145,84 @@ class PerformanceMonitor {
 // Feature generation class
 class FeatureGenerator {
   private:
-    std::unique_ptr<UnifiedAudioEngine> engine;
     DebugOptions& options;
 
   public:
-    FeatureGenerator(DebugOptions& opts) : options(opts) {
-        auto engineResult = UnifiedAudioEngine::create();
-        if (!engineResult.isOk()) {
-            throw std::runtime_error("Failed to create UnifiedAudioEngine");
-        }
-        engine = std::move(engineResult.value);
-    }
-    bool processCall(const std::string& callName) {
-        PerformanceMonitor monitor("Processing call: " + callName,
-                                   options.enablePerformanceMetrics);
-
-        if (options.enableFeatureDebug) {
-            DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                           huntmaster::DebugLevel::DEBUG,
-                                           "Starting feature generation for: " + callName);
-        }
-
-        // Check if audio file exists
-        std::string audioPath = "../data/master_calls/" + callName + ".wav";
-        if (!std::filesystem::exists(audioPath)) {
-            DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                           huntmaster::DebugLevel::ERROR,
-                                           "Audio file not found: " + audioPath);
-            std::cerr << "Warning: Audio file not found: " << audioPath << std::endl;
-            return false;
-        }
-
-        if (options.enableFeatureDebug) {
-            DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                           huntmaster::DebugLevel::DEBUG,
-                                           "Audio file found: " + audioPath);
-            monitor.checkpoint("Audio file validated");
-        }
-
-        try {
-            // Create session for processing
-            auto sessionResult = engine->createSession();
-            if (!sessionResult.isOk()) {
-                std::cout << "  ✗ Failed to create session for: " << callName << std::endl;
-                return false;
+    explicit FeatureGenerator(DebugOptions& opts) : options(opts) {}
+
+    /// Extract features for @p callNames (all calls if empty) across a pool of workers
+    bool processCalls(const std::vector<std::string>& callNames) {
+        PerformanceMonitor monitor("Feature generation", options.enablePerformanceMetrics);
+
+        MasterCallBatchBuilder::Config config;
+        config.inputDir = options.inputDir;
+        config.featuresDir = options.outputDir;
+        config.manifestPath = options.outputDir + "/features.manifest";
+        config.only = callNames;
+        config.mfcc.sample_rate = 44100;
+        config.mfcc.frame_size = 512;
+        config.mfcc.num_coefficients = 13;
+        config.mfcc.num_filters = 26;
+        config.hopSize = 256;
+        config.threads = options.jobs;
+        config.force = options.force;
+        config.onCallFinished = [this](const MasterCallBatchBuilder::CallResult& call) {
+            switch (call.outcome) {
+                case MasterCallBatchBuilder::Outcome::BUILT:
+                    std::cout << "  ✓ Features generated: " << call.id << std::endl;
+                    break;
+                case MasterCallBatchBuilder::Outcome::REUSED:
+                    std::cout << "  ✓ Unchanged: " << call.id << std::endl;
+                    break;
+                case MasterCallBatchBuilder::Outcome::FAILED:
+                    std::cout << "  ✗ Failed: " << call.id << " (" << call.error << ")"
+                              << std::endl;
+                    break;
             }
-
-            uint32_t sessionId = sessionResult.value;
-
-            // Load master call - this will generate features
-            std::cout << "Processing: " << callName << std::endl;
-            auto loadResult = engine->loadMasterCall(sessionId, callName);
-            if (loadResult != UnifiedAudioEngine::Status::OK) {
-                std::cout << "  ✗ Failed to load master call: " << callName << std::endl;
-                auto destroyResult = engine->destroySession(sessionId);
-                if (destroyResult != UnifiedAudioEngine::Status::OK) {
-                    // Log warning but continue since we're in error path
-                }
-                return false;
-            }
-
             if (options.enableFeatureDebug) {
                 DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                               huntmaster::DebugLevel::INFO,
-                                               "Successfully loaded master call: " + callName);
-                monitor.checkpoint("Master call loaded");
-            }
-
-            // Clean up session
-            auto destroyResult = engine->destroySession(sessionId);
-            if (destroyResult != UnifiedAudioEngine::Status::OK) {
-                if (options.enableFeatureDebug) {
-                    DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                                   huntmaster::DebugLevel::WARN,
-                                                   "Warning: Failed to destroy session for: "
-                                                       + callName);
-                }
-            }
-
-            // Check if feature file was generated
-            std::string featurePath = "../data/features/" + callName + ".mfcc";
-            if (std::filesystem::exists(featurePath)) {
-                if (options.enableFeatureDebug) {
-                    auto fileSize = std::filesystem::file_size(featurePath);
-                    DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                                   huntmaster::DebugLevel::DEBUG,
-                                                   "Feature file generated: " + featurePath
-                                                       + " (Size: " + std::to_string(fileSize)
-                                                       + " bytes)");
-                }
-                std::cout << "  ✓ Features generated: " << featurePath << std::endl;
-            } else {
-                if (options.enableFeatureDebug) {
-                    DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
-                                                   huntmaster::DebugLevel::WARN,
-                                                   "Feature file not found after processing: "
-                                                       + featurePath);
-                }
-                std::cout << "  ⚠ Feature file not found: " << featurePath << std::endl;
+                                               huntmaster::DebugLevel::DEBUG,
+                                               "Finished " + call.id + ": " + call.metadata);
             }
+        };
 
-            return true;
-
-        } catch (const std::exception& e) {
+        auto report = MasterCallBatchBuilder(config).build();
+        if (!report) {
             DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
                                            huntmaster::DebugLevel::ERROR,
-                                           "Exception during feature generation for " + callName
-                                               + ": " + e.what());
-            std::cerr << "Error processing " << callName << ": " << e.what() << std::endl;
+                                           "Feature generation failed for: " + options.inputDir);
+            std::cerr << "Error: cannot read " << options.inputDir << " or write "
+                      << options.outputDir << std::endl;
             return false;
         }
+        monitor.checkpoint("All calls processed");
+
+        // Requested calls with no WAV never reach the builder
+        size_t missing = 0;
+        for (const auto& name : callNames) {
+            const bool found = std::any_of(report->calls.begin(), report->calls.end(),
+                                           [&](const auto& call) { return call.id == name; });
+            if (!found) {
+                DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
+                                               huntmaster::DebugLevel::ERROR,
+                                               "Audio file not found: " + name);
+                std::cerr << "Warning: Audio file not found: " << name << std::endl;
+                missing++;
+            }
+        }
+
+        std::cout << "\n=== PROCESSING SUMMARY ===" << std::endl;
+        std::cout << "Total calls processed: " << report->calls.size() + missing << std::endl;
+        std::cout << "Generated: " << report->built << std::endl;
+        std::cout << "Unchanged: " << report->reused << std::endl;
+        std::cout << "Failed: " << report->failed + missing << std::endl;
+        std::cout << std::fixed << std::setprecision(2) << "Throughput: "
+                  << report->callsPerSecond() << " calls/s, " << report->megabytesPerSecond()
+                  << " MB/s, " << report->realtimeFactor() << "x realtime on "
+                  << report->threads << " threads (" << report->elapsedSeconds << " s)"
+                  << std::defaultfloat << std::endl;
+
+        return report->failed + missing == 0;
     }
 };
 
@@ -282,31 +271,14 @@ int main(int argc, char* argv[]) {
     // Determine which calls to process
     std::vector<std::string> callsToProcess;
 
-    // Check if specific calls were provided as arguments
-    bool foundCalls = false;
+    // Specific calls may be given as arguments; none means every call in the input directory
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
         if (arg[0] != '-') {  // Not a debug option
             callsToProcess.push_back(arg);
-            foundCalls = true;
         }
     }
 
-    // If no specific calls provided, use default list
-    if (!foundCalls) {
-        callsToProcess = {"breeding_bellow",
-                          "buck_grunt",
-                          "buck_rage_grunts",
-                          "buck-bawl",
-                          "contact-bleatr",
-                          "doe-grunt",
-                          "doebleat",
-                          "estrus_bleat",
-                          "fawn-bleat",
-                          "sparring_bucks",
-                          "tending_grunts"};
-    }
-
     if (debugOptions.enableBatchDebug) {
         DebugLogger::getInstance().log(huntmaster::DebugComponent::TOOLS,
                                        huntmaster::DebugLevel::DEBUG,
@@ -320,30 +292,11 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    // Create feature generator
-    FeatureGenerator generator(debugOptions);
-
     // Process calls
-    int successCount = 0;
-    int failureCount = 0;
-
-    for (const auto& call : callsToProcess) {
-        if (generator.processCall(call)) {
-            successCount++;
-        } else {
-            failureCount++;
-        }
-    }
-
-    totalMonitor.checkpoint("All calls processed");
-
-    // Print summary
-    std::cout << "\n=== PROCESSING SUMMARY ===" << std::endl;
-    std::cout << "Total calls processed: " << callsToProcess.size() << std::endl;
-    std::cout << "Successful: " << successCount << std::endl;
-    std::cout << "Failed: " << failureCount << std::endl;
+    FeatureGenerator generator(debugOptions);
+    const bool success = generator.processCalls(callsToProcess);
 
-    if (failureCount == 0) {
+    if (success) {
         std::cout << "All features generated successfully!" << std::endl;
     } else {
         std::cout << "Some features failed to generate. Check logs for details." << std::endl;
@@ -353,8 +306,8 @@ int main(int argc, char* argv[]) {
         huntmaster::DebugComponent::TOOLS,
         huntmaster::DebugLevel::INFO,
         "=== MFCC Feature Generator "
-            + std::string(failureCount == 0 ? "Completed Successfully" : "Completed with Errors")
+            + std::string(success ? "Completed Successfully" : "Completed with Errors")
             + " ===");
 
-    return failureCount == 0 ? 0 : 1;
+    return success ? 0 : 1;
 }